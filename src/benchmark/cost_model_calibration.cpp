@@ -0,0 +1,389 @@
+#include <algorithm>
+#include <cmath>
+#include <iostream>
+#include <memory>
+#include <numeric>
+#include <random>
+#include <string>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include <cxxopts.hpp>
+
+#include "cost_estimation/cost_model_coefficients.hpp"
+#include "expression/expression_functional.hpp"
+#include "hyrise.hpp"
+#include "micro_benchmark_utils.hpp"
+#include "operators/aggregate_hash.hpp"
+#include "operators/index_scan.hpp"
+#include "operators/join_hash.hpp"
+#include "operators/join_nested_loop.hpp"
+#include "operators/join_sort_merge.hpp"
+#include "operators/projection.hpp"
+#include "operators/sort.hpp"
+#include "operators/table_scan.hpp"
+#include "operators/table_wrapper.hpp"
+#include "storage/chunk_encoder.hpp"
+#include "storage/index/group_key/group_key_index.hpp"
+#include "storage/table.hpp"
+#include "storage/value_segment.hpp"
+
+/**
+ * Measures the coefficients of the CostEstimatorCalibrated (see CostModelCoefficients) on the machine it runs on and
+ * writes them to a JSON file. Load them with `CostModelCoefficients::load()` and set
+ * Hyrise::get().cost_model_coefficients to let the optimizer and the LQPTranslator use them.
+ *
+ * Every operator runs on synthetic single-column tables, once per encoding where relevant. Each measurement is
+ * repeated with a cold cache and the run with the median walltime is used. Where an operator records the runtimes of
+ * its steps (see OperatorPerformanceData), they attribute the runtime to build/probe rows, sorted rows, and output
+ * rows. Otherwise, two runs with the same input and different output sizes separate the cost per input row from the
+ * cost per output row.
+ *
+ * The operators run with the default (single-threaded) scheduler, so the coefficients describe the work of a single
+ * core.
+ */
+
+using namespace hyrise;                         // NOLINT
+using namespace hyrise::expression_functional;  // NOLINT
+
+namespace {
+
+constexpr auto REPETITION_COUNT = size_t{5};
+constexpr auto LOW_SELECTIVITY = 0.01;
+constexpr auto HIGH_SELECTIVITY = 0.5;
+constexpr auto NESTED_LOOP_ROW_COUNT = size_t{2'000};
+constexpr auto SEED = 17;
+
+template <typename T>
+T make_value(const int32_t value);
+
+template <>
+int32_t make_value<int32_t>(const int32_t value) {
+  return value;
+}
+
+// Padded to a fixed length so that the lexicographic order matches the numeric one.
+template <>
+pmr_string make_value<pmr_string>(const int32_t value) {
+  const auto string = std::to_string(value);
+  return pmr_string{std::string(10 - string.size(), '0').append(string)};
+}
+
+DataType column_data_type(const EncodingType encoding_type) {
+  // FixedStringDictionary only supports strings.
+  return encoding_supports_data_type(encoding_type, DataType::Int) ? DataType::Int : DataType::String;
+}
+
+AllTypeVariant make_variant(const DataType data_type, const int32_t value) {
+  if (data_type == DataType::Int) {
+    return make_value<int32_t>(value);
+  }
+  return make_value<pmr_string>(value);
+}
+
+template <typename T>
+std::shared_ptr<Table> create_typed_table(const size_t row_count, const size_t distinct_count, const bool sorted) {
+  auto values = std::vector<int32_t>(row_count);
+  for (auto row_id = size_t{0}; row_id < row_count; ++row_id) {
+    values[row_id] = static_cast<int32_t>(row_id % distinct_count);
+  }
+
+  if (sorted) {
+    std::sort(values.begin(), values.end());
+  } else {
+    auto generator = std::mt19937{SEED};
+    std::shuffle(values.begin(), values.end(), generator);
+  }
+
+  const auto data_type = std::is_same_v<T, int32_t> ? DataType::Int : DataType::String;
+  auto table = std::make_shared<Table>(TableColumnDefinitions{{"a", data_type, false}}, TableType::Data);
+  for (auto chunk_begin = size_t{0}; chunk_begin < row_count; chunk_begin += Chunk::DEFAULT_SIZE) {
+    const auto chunk_end = std::min(chunk_begin + Chunk::DEFAULT_SIZE, row_count);
+    auto chunk_values = pmr_vector<T>{};
+    chunk_values.reserve(chunk_end - chunk_begin);
+    for (auto row_id = chunk_begin; row_id < chunk_end; ++row_id) {
+      chunk_values.emplace_back(make_value<T>(values[row_id]));
+    }
+
+    table->append_chunk({std::make_shared<ValueSegment<T>>(std::move(chunk_values))});
+    table->last_chunk()->finalize();
+  }
+
+  return table;
+}
+
+// Creates a single-column table whose values are evenly distributed between 0 and distinct_count - 1. Thus, the
+// predicate `a < distinct_count * selectivity` selects the given share of the rows.
+std::shared_ptr<TableWrapper> create_table(const size_t row_count, const size_t distinct_count,
+                                           const EncodingType encoding_type, const bool sorted = false,
+                                           const bool with_group_key_index = false) {
+  const auto table = column_data_type(encoding_type) == DataType::Int
+                         ? create_typed_table<int32_t>(row_count, distinct_count, sorted)
+                         : create_typed_table<pmr_string>(row_count, distinct_count, sorted);
+
+  if (encoding_type != EncodingType::Unencoded) {
+    ChunkEncoder::encode_all_chunks(table, SegmentEncodingSpec{encoding_type});
+  }
+
+  const auto chunk_count = table->chunk_count();
+  for (auto chunk_id = ChunkID{0}; chunk_id < chunk_count; ++chunk_id) {
+    const auto chunk = table->get_chunk(chunk_id);
+    if (sorted) {
+      chunk->set_individually_sorted_by(SortColumnDefinition{ColumnID{0}, SortMode::Ascending});
+    }
+    if (with_group_key_index) {
+      chunk->create_index<GroupKeyIndex>(std::vector<ColumnID>{ColumnID{0}});
+    }
+  }
+
+  const auto table_wrapper = std::make_shared<TableWrapper>(table);
+  table_wrapper->never_clear_output();
+  table_wrapper->execute();
+  return table_wrapper;
+}
+
+// Executes the operator created by @param make_operator REPETITION_COUNT times with a cold cache and returns the run
+// with the median walltime.
+template <typename OperatorFactory>
+std::shared_ptr<AbstractOperator> execute_median_run(const OperatorFactory& make_operator) {
+  auto runs = std::vector<std::shared_ptr<AbstractOperator>>{};
+  runs.reserve(REPETITION_COUNT);
+  for (auto repetition = size_t{0}; repetition < REPETITION_COUNT; ++repetition) {
+    micro_benchmark_clear_cache();
+    const auto run = make_operator();
+    run->execute();
+    runs.emplace_back(run);
+  }
+
+  std::sort(runs.begin(), runs.end(), [](const auto& lhs, const auto& rhs) {
+    return lhs->performance_data->walltime < rhs->performance_data->walltime;
+  });
+  return runs[REPETITION_COUNT / 2];
+}
+
+Cost to_cost(const std::chrono::nanoseconds runtime) {
+  return static_cast<Cost>(runtime.count());
+}
+
+// Solves `walltime = cost_per_input_row * input_row_count + cost_per_output_row * output_row_count` for two runs with
+// the same input and different output sizes.
+std::pair<Cost, Cost> fit_costs_per_row(const size_t input_row_count, const AbstractOperator& low_output_run,
+                                        const AbstractOperator& high_output_run) {
+  const auto low_output_row_count = static_cast<Cost>(low_output_run.performance_data->output_row_count);
+  const auto high_output_row_count = static_cast<Cost>(high_output_run.performance_data->output_row_count);
+  Assert(high_output_row_count > low_output_row_count, "Expected runs with different output sizes.");
+
+  const auto low_walltime = to_cost(low_output_run.performance_data->walltime);
+  const auto high_walltime = to_cost(high_output_run.performance_data->walltime);
+  const auto cost_per_output_row =
+      std::max((high_walltime - low_walltime) / (high_output_row_count - low_output_row_count), 0.0f);
+  const auto cost_per_input_row = std::max(
+      (low_walltime - cost_per_output_row * low_output_row_count) / static_cast<Cost>(input_row_count), 0.0f);
+  return {cost_per_input_row, cost_per_output_row};
+}
+
+Cost sorted_row_count(const size_t row_count) {
+  return static_cast<Cost>(row_count) * std::log(std::max(static_cast<Cost>(row_count), 1.0f));
+}
+
+std::shared_ptr<AbstractExpression> less_than_predicate(const DataType data_type, const size_t distinct_count,
+                                                        const double selectivity) {
+  return less_than_(pqp_column_(ColumnID{0}, data_type, false, "a"),
+                    value_(make_variant(data_type, static_cast<int32_t>(distinct_count * selectivity))));
+}
+
+void calibrate_table_scans(CostModelCoefficients& coefficients, const size_t row_count) {
+  auto cost_per_output_row_sum = Cost{0.0f};
+  for (const auto encoding_type : encoding_type_enum_values) {
+    const auto data_type = column_data_type(encoding_type);
+    const auto table_wrapper = create_table(row_count, row_count, encoding_type);
+    const auto run = [&](const double selectivity) {
+      return execute_median_run([&]() {
+        return std::make_shared<TableScan>(table_wrapper, less_than_predicate(data_type, row_count, selectivity));
+      });
+    };
+
+    const auto [cost_per_input_row, cost_per_output_row] =
+        fit_costs_per_row(row_count, *run(LOW_SELECTIVITY), *run(HIGH_SELECTIVITY));
+    coefficients.table_scan_cost_per_input_row[encoding_type] = cost_per_input_row;
+    cost_per_output_row_sum += cost_per_output_row;
+    std::cout << "- TableScan on " << encoding_type << ": " << cost_per_input_row << " ns per input row" << std::endl;
+  }
+  coefficients.table_scan_cost_per_output_row =
+      cost_per_output_row_sum / static_cast<Cost>(encoding_type_enum_values.size());
+
+  // Scan the ReferenceSegments of a TableScan that selects all rows.
+  const auto table_wrapper = create_table(row_count, row_count, EncodingType::Unencoded);
+  const auto reference_input = std::make_shared<TableScan>(
+      table_wrapper, greater_than_equals_(pqp_column_(ColumnID{0}, DataType::Int, false, "a"), 0));
+  reference_input->never_clear_output();
+  reference_input->execute();
+  const auto run_on_references = [&](const double selectivity) {
+    return execute_median_run([&]() {
+      return std::make_shared<TableScan>(reference_input, less_than_predicate(DataType::Int, row_count, selectivity));
+    });
+  };
+  coefficients.reference_table_scan_cost_per_input_row =
+      fit_costs_per_row(row_count, *run_on_references(LOW_SELECTIVITY), *run_on_references(HIGH_SELECTIVITY)).first;
+
+  // Scans on sorted segments binary search the matching range. Their runtime is attributed to the output rows.
+  const auto sorted_table_wrapper = create_table(row_count, row_count, EncodingType::Dictionary, true);
+  const auto sorted_run = execute_median_run([&]() {
+    return std::make_shared<TableScan>(sorted_table_wrapper,
+                                       less_than_predicate(DataType::Int, row_count, HIGH_SELECTIVITY));
+  });
+  coefficients.sorted_table_scan_cost_per_output_row =
+      to_cost(sorted_run->performance_data->walltime) /
+      static_cast<Cost>(std::max(sorted_run->performance_data->output_row_count, uint64_t{1}));
+}
+
+void calibrate_index_scans(CostModelCoefficients& coefficients, const size_t row_count) {
+  const auto table_wrapper = create_table(row_count, row_count, EncodingType::Dictionary, false, true);
+  const auto run = [&](const double selectivity) {
+    return execute_median_run([&]() {
+      return std::make_shared<IndexScan>(table_wrapper, SegmentIndexType::GroupKey, std::vector<ColumnID>{ColumnID{0}},
+                                         PredicateCondition::LessThan,
+                                         std::vector<AllTypeVariant>{static_cast<int32_t>(row_count * selectivity)});
+    });
+  };
+
+  std::tie(coefficients.index_scan_cost_per_input_row, coefficients.index_scan_cost_per_output_row) =
+      fit_costs_per_row(row_count, *run(LOW_SELECTIVITY), *run(HIGH_SELECTIVITY));
+}
+
+void calibrate_joins(CostModelCoefficients& coefficients, const size_t row_count) {
+  // Each value of the smaller (right) input has exactly one join partner in the larger (left) input.
+  const auto left_row_count = row_count;
+  const auto right_row_count = row_count / 10;
+  const auto left_input = create_table(left_row_count, left_row_count, EncodingType::Dictionary);
+  const auto right_input = create_table(right_row_count, right_row_count, EncodingType::Dictionary);
+  const auto join_predicate = OperatorJoinPredicate{{ColumnID{0}, ColumnID{0}}, PredicateCondition::Equals};
+
+  {
+    const auto join_hash = execute_median_run(
+        [&]() { return std::make_shared<JoinHash>(left_input, right_input, JoinMode::Inner, join_predicate); });
+    const auto& performance_data =
+        dynamic_cast<const OperatorPerformanceData<JoinHash::OperatorSteps>&>(*join_hash->performance_data);
+    using Steps = JoinHash::OperatorSteps;
+
+    // JoinHash builds the hash table for the smaller input. Both inputs are radix clustered.
+    const auto clustering_cost_per_row = to_cost(performance_data.get_step_runtime(Steps::Clustering)) /
+                                         static_cast<Cost>(left_row_count + right_row_count);
+    coefficients.join_hash_cost_per_build_row =
+        to_cost(performance_data.get_step_runtime(Steps::BuildSideMaterializing) +
+                performance_data.get_step_runtime(Steps::Building)) /
+            static_cast<Cost>(right_row_count) +
+        clustering_cost_per_row;
+    coefficients.join_hash_cost_per_probe_row =
+        to_cost(performance_data.get_step_runtime(Steps::ProbeSideMaterializing) +
+                performance_data.get_step_runtime(Steps::Probing)) /
+            static_cast<Cost>(left_row_count) +
+        clustering_cost_per_row;
+    coefficients.join_hash_cost_per_output_row = to_cost(performance_data.get_step_runtime(Steps::OutputWriting)) /
+                                                 static_cast<Cost>(performance_data.output_row_count);
+  }
+
+  {
+    const auto join_sort_merge = execute_median_run(
+        [&]() { return std::make_shared<JoinSortMerge>(left_input, right_input, JoinMode::Inner, join_predicate); });
+    const auto& performance_data =
+        dynamic_cast<const OperatorPerformanceData<JoinSortMerge::OperatorSteps>&>(*join_sort_merge->performance_data);
+    using Steps = JoinSortMerge::OperatorSteps;
+
+    coefficients.join_sort_merge_cost_per_input_row =
+        to_cost(performance_data.get_step_runtime(Steps::LeftSideMaterializing) +
+                performance_data.get_step_runtime(Steps::RightSideMaterializing) +
+                performance_data.get_step_runtime(Steps::Clustering) +
+                performance_data.get_step_runtime(Steps::Merging)) /
+        static_cast<Cost>(left_row_count + right_row_count);
+    coefficients.join_sort_merge_cost_per_sorted_row = to_cost(performance_data.get_step_runtime(Steps::Sorting)) /
+                                                       (sorted_row_count(left_row_count) +
+                                                        sorted_row_count(right_row_count));
+    coefficients.join_sort_merge_cost_per_output_row =
+        to_cost(performance_data.get_step_runtime(Steps::OutputWriting)) /
+        static_cast<Cost>(performance_data.output_row_count);
+  }
+
+  {
+    // The JoinNestedLoop compares all pairs of rows. With one join partner per row, writing the output is negligible.
+    const auto nested_loop_input =
+        create_table(NESTED_LOOP_ROW_COUNT, NESTED_LOOP_ROW_COUNT, EncodingType::Dictionary);
+    const auto join_nested_loop = execute_median_run([&]() {
+      return std::make_shared<JoinNestedLoop>(nested_loop_input, nested_loop_input, JoinMode::Inner, join_predicate);
+    });
+    coefficients.join_nested_loop_cost_per_row_pair =
+        to_cost(join_nested_loop->performance_data->walltime) /
+        static_cast<Cost>(NESTED_LOOP_ROW_COUNT * NESTED_LOOP_ROW_COUNT);
+  }
+}
+
+void calibrate_other_operators(CostModelCoefficients& coefficients, const size_t row_count) {
+  const auto table_wrapper = create_table(row_count, row_count, EncodingType::Unencoded);
+
+  const auto sort = execute_median_run([&]() {
+    return std::make_shared<Sort>(table_wrapper, std::vector<SortColumnDefinition>{SortColumnDefinition{ColumnID{0}}});
+  });
+  coefficients.sort_cost_per_sorted_row = to_cost(sort->performance_data->walltime) / sorted_row_count(row_count);
+
+  // Group by a column with few and with only distinct values.
+  const auto few_groups_table_wrapper = create_table(row_count, row_count / 1'000, EncodingType::Unencoded);
+  const auto aggregate = [&](const std::shared_ptr<TableWrapper>& input) {
+    return execute_median_run([&]() {
+      return std::make_shared<AggregateHash>(input, std::vector<std::shared_ptr<AggregateExpression>>{},
+                                             std::vector<ColumnID>{ColumnID{0}});
+    });
+  };
+  std::tie(coefficients.aggregate_cost_per_input_row, coefficients.aggregate_cost_per_output_row) =
+      fit_costs_per_row(row_count, *aggregate(few_groups_table_wrapper), *aggregate(table_wrapper));
+
+  // All other operators are costed like a Projection that evaluates an expression for every row.
+  const auto projection = execute_median_run([&]() {
+    return std::make_shared<Projection>(
+        table_wrapper,
+        std::vector<std::shared_ptr<AbstractExpression>>{add_(pqp_column_(ColumnID{0}, DataType::Int, false, "a"), 1)});
+  });
+  coefficients.cost_per_row = to_cost(projection->performance_data->walltime) / static_cast<Cost>(2 * row_count);
+}
+
+}  // namespace
+
+int main(int argc, char* argv[]) {
+  auto cli_options = cxxopts::Options{"hyriseCostModelCalibration",
+                                      "Measures the coefficients of the calibrated cost model on this machine."};
+
+  // clang-format off
+  cli_options.add_options()
+      ("help", "print a summary of CLI options")
+      ("o,output", "JSON file to write the coefficients to", cxxopts::value<std::string>()->default_value("cost_model_coefficients.json")) // NOLINT
+      ("r,rows", "Number of rows of the calibration tables", cxxopts::value<size_t>()->default_value("10000000")); // NOLINT
+  // clang-format on
+
+  const auto cli_parse_result = cli_options.parse(argc, argv);
+  if (cli_parse_result.count("help")) {
+    std::cout << cli_options.help() << std::endl;
+    return 0;
+  }
+
+  const auto output_filename = cli_parse_result["output"].as<std::string>();
+  const auto row_count = cli_parse_result["rows"].as<size_t>();
+  Assert(row_count >= 10'000, "Calibration tables should have at least 10,000 rows.");
+
+  auto coefficients = CostModelCoefficients{};
+
+  std::cout << "- Calibrating scans" << std::endl;
+  calibrate_table_scans(coefficients, row_count);
+  calibrate_index_scans(coefficients, row_count);
+
+  std::cout << "- Calibrating joins" << std::endl;
+  calibrate_joins(coefficients, row_count);
+
+  std::cout << "- Calibrating other operators" << std::endl;
+  calibrate_other_operators(coefficients, row_count);
+
+  coefficients.save(output_filename);
+  std::cout << "- Coefficients written to " << output_filename << std::endl;
+
+  return 0;
+}
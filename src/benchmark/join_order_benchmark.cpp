@@ -8,6 +8,7 @@
 #include "file_based_benchmark_item_runner.hpp"
 #include "file_based_table_generator.hpp"
 #include "hyrise.hpp"
+#include "statistics/cardinality_feedback.hpp"
 #include "types.hpp"
 #include "utils/performance_warning.hpp"
 #include "utils/sqlite_add_indices.hpp"
@@ -116,7 +117,9 @@ int main(int argc, char* argv[]) {
   cli_options.add_options()
   ("table_path", "Directory containing the Tables as csv, tbl or binary files. CSV files require meta-files, see csv_meta.hpp or any *.csv.json file.", cxxopts::value<std::string>()->default_value(DEFAULT_TABLE_PATH)) // NOLINT
   ("query_path", "Directory containing the .sql files of the Join Order Benchmark", cxxopts::value<std::string>()->default_value(DEFAULT_QUERY_PATH)) // NOLINT
-  ("q,queries", "Subset of queries to run as a comma separated list", cxxopts::value<std::string>()->default_value("all")); // NOLINT
+  ("q,queries", "Subset of queries to run as a comma separated list", cxxopts::value<std::string>()->default_value("all")) // NOLINT
+  ("cardinality_feedback", "Use the cardinalities observed in previous executions for the join ordering", cxxopts::value<bool>()->default_value("false")) // NOLINT
+  ("reoptimization_threshold", "Re-optimize plans after executing the join inputs if their cardinalities differ from the estimations by more than this factor (requires --cardinality_feedback, 0 to disable)", cxxopts::value<float>()->default_value("0")); // NOLINT
   // clang-format on
 
   std::shared_ptr<BenchmarkConfig> benchmark_config;
@@ -136,6 +139,12 @@ int main(int argc, char* argv[]) {
   table_path = cli_parse_result["table_path"].as<std::string>();
   queries_str = cli_parse_result["queries"].as<std::string>();
 
+  if (cli_parse_result["cardinality_feedback"].as<bool>()) {
+    const auto reoptimization_threshold = cli_parse_result["reoptimization_threshold"].as<float>();
+    Hyrise::get().cardinality_feedback = std::make_shared<CardinalityFeedback>(
+        reoptimization_threshold > 0.0f ? std::optional<float>{reoptimization_threshold} : std::nullopt);
+  }
+
   benchmark_config = std::make_shared<BenchmarkConfig>(CLIConfigParser::parse_cli_options(cli_parse_result));
 
   // Check that the options "query_path" and "table_path" were specified
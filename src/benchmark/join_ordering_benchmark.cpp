@@ -0,0 +1,100 @@
+#include <memory>
+
+#include "benchmark/benchmark.h"
+#include "cost_estimation/cost_estimator_logical.hpp"
+#include "expression/expression_functional.hpp"
+#include "logical_query_plan/mock_node.hpp"
+#include "optimizer/join_ordering/dp_ccp.hpp"
+#include "optimizer/join_ordering/greedy_operator_ordering.hpp"
+#include "optimizer/join_ordering/iterative_dp_ccp.hpp"
+#include "optimizer/join_ordering/join_graph.hpp"
+#include "statistics/attribute_statistics.hpp"
+#include "statistics/cardinality_estimator.hpp"
+#include "statistics/statistics_objects/generic_histogram.hpp"
+#include "statistics/table_statistics.hpp"
+
+/**
+ * Synthetic wide joins to compare the optimization time and the estimated cost of the plans of the join ordering
+ * algorithms. The vertices are MockNodes with differing row counts and value ranges. Run with
+ * --benchmark_filter=BM_JoinOrdering to only execute these benchmarks.
+ */
+
+namespace hyrise {
+
+using namespace expression_functional;  // NOLINT
+
+enum class JoinGraphShape { Chain, Star, Cycle };
+
+static JoinGraph generate_join_graph(const JoinGraphShape shape, const size_t vertex_count) {
+  auto vertices = std::vector<std::shared_ptr<AbstractLQPNode>>{};
+  auto columns = std::vector<std::shared_ptr<AbstractExpression>>{};
+  for (auto vertex_idx = size_t{0}; vertex_idx < vertex_count; ++vertex_idx) {
+    const auto row_count = static_cast<Cardinality>(1'000 * (vertex_idx % 7 + 1) + 100 * vertex_idx);
+    const auto max_value = static_cast<int32_t>(500 + 250 * (vertex_idx % 5));
+    const auto histogram = GenericHistogram<int32_t>::with_single_bin(1, max_value, row_count, row_count / 10);
+    const auto column_statistics = std::make_shared<AttributeStatistics<int32_t>>();
+    column_statistics->set_statistics_object(histogram);
+
+    const auto mock_node = MockNode::make(MockNode::ColumnDefinitions{{DataType::Int, "a"}});
+    mock_node->set_table_statistics(std::make_shared<TableStatistics>(
+        std::vector<std::shared_ptr<BaseAttributeStatistics>>{column_statistics}, row_count));
+    vertices.emplace_back(mock_node);
+    columns.emplace_back(mock_node->get_column("a"));
+  }
+
+  auto edges = std::vector<JoinGraphEdge>{};
+  const auto add_edge = [&](const size_t left_vertex_idx, const size_t right_vertex_idx) {
+    auto vertex_set = JoinGraphVertexSet{vertex_count};
+    vertex_set.set(left_vertex_idx);
+    vertex_set.set(right_vertex_idx);
+    edges.emplace_back(vertex_set, expression_vector(equals_(columns[left_vertex_idx], columns[right_vertex_idx])));
+  };
+
+  for (auto vertex_idx = size_t{1}; vertex_idx < vertex_count; ++vertex_idx) {
+    add_edge(shape == JoinGraphShape::Star ? 0 : vertex_idx - 1, vertex_idx);
+  }
+  if (shape == JoinGraphShape::Cycle) {
+    add_edge(0, vertex_count - 1);
+  }
+
+  return JoinGraph{vertices, edges};
+}
+
+template <typename JoinOrderingAlgorithm>
+static void BM_JoinOrdering(benchmark::State& state, const JoinGraphShape shape) {
+  const auto vertex_count = static_cast<size_t>(state.range(0));
+  const auto join_graph = generate_join_graph(shape, vertex_count);
+  const auto cost_estimator = std::make_shared<CostEstimatorLogical>(std::make_shared<CardinalityEstimator>());
+
+  auto plan = std::shared_ptr<AbstractLQPNode>{};
+  for (auto _ : state) {
+    // As in the JoinOrderingRule, each optimization uses a fresh estimator with empty caches.
+    const auto caching_cost_estimator = cost_estimator->new_instance();
+    caching_cost_estimator->guarantee_bottom_up_construction();
+    caching_cost_estimator->cardinality_estimator->guarantee_join_graph(join_graph);
+    plan = JoinOrderingAlgorithm{}(join_graph, caching_cost_estimator);
+    benchmark::DoNotOptimize(plan);
+  }
+
+  state.counters["plan_cost"] = cost_estimator->estimate_plan_cost(plan);
+}
+
+BENCHMARK_CAPTURE(BM_JoinOrdering<DpCcp>, Chain, JoinGraphShape::Chain)->DenseRange(4, 12, 4);
+BENCHMARK_CAPTURE(BM_JoinOrdering<DpCcp>, Star, JoinGraphShape::Star)->DenseRange(4, 12, 4);
+BENCHMARK_CAPTURE(BM_JoinOrdering<DpCcp>, Cycle, JoinGraphShape::Cycle)->DenseRange(4, 12, 4);
+
+BENCHMARK_CAPTURE(BM_JoinOrdering<GreedyOperatorOrdering>, Chain, JoinGraphShape::Chain)
+    ->RangeMultiplier(2)
+    ->Range(8, 64);
+BENCHMARK_CAPTURE(BM_JoinOrdering<GreedyOperatorOrdering>, Star, JoinGraphShape::Star)
+    ->RangeMultiplier(2)
+    ->Range(8, 64);
+BENCHMARK_CAPTURE(BM_JoinOrdering<GreedyOperatorOrdering>, Cycle, JoinGraphShape::Cycle)
+    ->RangeMultiplier(2)
+    ->Range(8, 64);
+
+BENCHMARK_CAPTURE(BM_JoinOrdering<IterativeDpCcp>, Chain, JoinGraphShape::Chain)->RangeMultiplier(2)->Range(8, 64);
+BENCHMARK_CAPTURE(BM_JoinOrdering<IterativeDpCcp>, Star, JoinGraphShape::Star)->RangeMultiplier(2)->Range(8, 64);
+BENCHMARK_CAPTURE(BM_JoinOrdering<IterativeDpCcp>, Cycle, JoinGraphShape::Cycle)->RangeMultiplier(2)->Range(8, 64);
+
+}  // namespace hyrise
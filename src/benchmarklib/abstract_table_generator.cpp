@@ -1,6 +1,8 @@
 #include <filesystem>
 #include <iostream>
 
+#include <magic_enum.hpp>
+
 #include "abstract_table_generator.hpp"
 
 #include "benchmark_config.hpp"
@@ -308,7 +310,8 @@ void AbstractTableGenerator::generate_and_store() {
   if (_benchmark_config->indexes) {
     std::cout << "- Creating indexes" << std::endl;
     const auto& indexes_by_table = _indexes_by_table();
-    if (indexes_by_table.empty()) {
+    const auto& table_indexes_by_table = _table_indexes_by_table();
+    if (indexes_by_table.empty() && table_indexes_by_table.empty() && !_enforce_primary_keys()) {
       std::cout << "-  No indexes defined by benchmark" << std::endl;
     }
     for (const auto& [table_name, indexes] : indexes_by_table) {
@@ -337,6 +340,32 @@ void AbstractTableGenerator::generate_and_store() {
         std::cout << "(" << per_index_timer.lap_formatted() << ")" << std::endl;
       }
     }
+    for (const auto& [table_name, table_indexes] : table_indexes_by_table) {
+      const auto& table = table_info_by_name[table_name].table;
+
+      for (const auto& [index_column, index_type] : table_indexes) {
+        std::cout << "-  Creating " << magic_enum::enum_name(index_type) << " table index on " << table_name << " [ "
+                  << index_column << " ] " << std::flush;
+        Timer per_index_timer;
+        table->create_table_index(table->column_id_by_name(index_column), index_type);
+        std::cout << "(" << per_index_timer.lap_formatted() << ")" << std::endl;
+      }
+    }
+    if (_enforce_primary_keys()) {
+      for (const auto& [table_name, table_info] : table_info_by_name) {
+        for (const auto& key_constraint : table_info.table->soft_key_constraints()) {
+          if (key_constraint.key_type() != KeyConstraintType::PRIMARY_KEY) {
+            continue;
+          }
+
+          std::cout << "-  Creating primary key index on " << table_name << " " << std::flush;
+          Timer per_index_timer;
+          const auto& key_columns = key_constraint.columns();
+          table_info.table->create_primary_key_index(std::vector<ColumnID>{key_columns.cbegin(), key_columns.cend()});
+          std::cout << "(" << per_index_timer.lap_formatted() << ")" << std::endl;
+        }
+      }
+    }
     metrics.index_duration = timer.lap();
     std::cout << "- Creating indexes done (" << format_duration(metrics.index_duration) << ")" << std::endl;
   } else {
@@ -391,6 +420,14 @@ AbstractTableGenerator::IndexesByTable AbstractTableGenerator::_indexes_by_table
   return {};
 }
 
+AbstractTableGenerator::TableIndexesByTable AbstractTableGenerator::_table_indexes_by_table() const {
+  return {};
+}
+
+bool AbstractTableGenerator::_enforce_primary_keys() const {
+  return false;
+}
+
 AbstractTableGenerator::SortOrderByTable AbstractTableGenerator::_sort_order_by_table() const {
   return {};
 }
@@ -6,6 +6,7 @@
 
 #include "encoding_config.hpp"
 #include "storage/chunk.hpp"
+#include "storage/index/table_index/abstract_table_index.hpp"
 #include "types.hpp"
 
 namespace hyrise {
@@ -69,6 +70,15 @@ class AbstractTableGenerator {
   using IndexesByTable = std::map<std::string, std::vector<std::vector<std::string>>>;
   virtual IndexesByTable _indexes_by_table() const;
 
+  // Optionally, the benchmark may define single-column table indexes (see AbstractTableIndex), e.g., for point lookups
+  // on key columns. They are created along with the chunk indexes above and maintained when rows are inserted.
+  using TableIndexesByTable = std::map<std::string, std::vector<std::pair<std::string, TableIndexType>>>;
+  virtual TableIndexesByTable _table_indexes_by_table() const;
+
+  // Optionally, the benchmark may enforce the PRIMARY KEY constraints added by _add_constraints() through
+  // PrimaryKeyIndexes. These are created along with the indexes above.
+  virtual bool _enforce_primary_keys() const;
+
   // Optionally, the benchmark may define tables (left side) that are sorted (aka. clustered) by one of their columns
   // (right side).
   using SortOrderByTable = std::map<std::string, std::string>;
@@ -25,7 +25,7 @@ class BenchmarkConfig {
                   const std::optional<std::string>& init_output_file_path, const bool init_enable_scheduler,
                   const uint32_t init_cores, const uint32_t init_data_preparation_cores, const uint32_t init_clients,
                   const bool init_enable_visualization, const bool init_verify, const bool init_cache_binary_tables,
-                  const bool init_metrics);
+                  const bool init_metrics, const std::optional<std::string>& init_cost_model_coefficients_path);
 
   static BenchmarkConfig get_default_config();
 
@@ -46,6 +46,8 @@ class BenchmarkConfig {
   bool cache_binary_tables = false;  // Defaults to false for internal use, but the CLI sets it to true by default
   bool use_mmap = false;
   bool metrics = false;
+  // JSON file written by hyriseCostModelCalibration. If set, the calibrated cost model is used for the benchmark.
+  std::optional<std::string> cost_model_coefficients_path = std::nullopt;
 
  private:
   BenchmarkConfig() = default;
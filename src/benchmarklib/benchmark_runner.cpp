@@ -14,6 +14,7 @@
 
 #include "benchmark_config.hpp"
 #include "constant_mappings.hpp"
+#include "cost_estimation/cost_model_coefficients.hpp"
 #include "hyrise.hpp"
 #include "scheduler/job_task.hpp"
 #include "sql/sql_pipeline_builder.hpp"
@@ -36,6 +37,11 @@ BenchmarkRunner::BenchmarkRunner(const BenchmarkConfig& config,
   Hyrise::get().default_pqp_cache = std::make_shared<SQLPhysicalPlanCache>();
   Hyrise::get().default_lqp_cache = std::make_shared<SQLLogicalPlanCache>();
 
+  if (config.cost_model_coefficients_path) {
+    const auto coefficients = CostModelCoefficients::load(*config.cost_model_coefficients_path);
+    Hyrise::get().cost_model_coefficients = std::make_shared<const CostModelCoefficients>(coefficients);
+  }
+
   // Initialise the scheduler if the benchmark was requested to run multi-threaded
   if (config.enable_scheduler) {
     Hyrise::get().topology.use_default_topology(config.cores);
@@ -506,7 +512,8 @@ cxxopts::Options BenchmarkRunner::get_basic_cli_options(const std::string& bench
     ("dont_cache_binary_tables", "Do not cache tables as binary files for faster loading on subsequent runs", cxxopts::value<bool>()->default_value("false")) // NOLINT
     ("metrics", "Track more metrics (steps in SQL pipeline, system utilization, etc.) and add them to the output JSON (see -o)", cxxopts::value<bool>()->default_value("false")) // NOLINT
     // This option is only advised when the underlying system's memory capacity is overleaded by the preparation phase.
-    ("data_preparation_cores", "Specify the number of cores used by the scheduler for data preparation, i.e., sorting and encoding tables and generating table statistics. 0 means all available cores.", cxxopts::value<uint32_t>()->default_value("0")); // NOLINT
+    ("data_preparation_cores", "Specify the number of cores used by the scheduler for data preparation, i.e., sorting and encoding tables and generating table statistics. 0 means all available cores.", cxxopts::value<uint32_t>()->default_value("0")) // NOLINT
+    ("cost_model_coefficients", "JSON file with calibrated cost model coefficients (see hyriseCostModelCalibration)", cxxopts::value<std::string>()); // NOLINT
   // clang-format on
 
   return cli_options;
@@ -545,6 +552,7 @@ nlohmann::json BenchmarkRunner::create_context(const BenchmarkConfig& config) {
                         {"clients", config.clients},
                         {"data_preparation_cores", config.data_preparation_cores},
                         {"verify", config.verify},
+                        {"cost_model_coefficients", config.cost_model_coefficients_path.value_or("")},
                         {"time_unit", "ns"},
                         {"GIT-HASH", GIT_HEAD_SHA1 + std::string(GIT_IS_DIRTY ? "-dirty" : "")}};
 }
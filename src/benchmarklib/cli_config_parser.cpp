@@ -137,6 +137,12 @@ BenchmarkConfig CLIConfigParser::parse_cli_options(const cxxopts::ParseResult& p
     std::cout << "- Not tracking SQL metrics" << std::endl;
   }
 
+  auto cost_model_coefficients_path = std::optional<std::string>{};
+  if (parse_result.count("cost_model_coefficients")) {
+    cost_model_coefficients_path = parse_result["cost_model_coefficients"].as<std::string>();
+    std::cout << "- Using the cost model coefficients from '" << *cost_model_coefficients_path << "'" << std::endl;
+  }
+
   return BenchmarkConfig{benchmark_mode,
                          chunk_size,
                          *encoding_config,
@@ -152,7 +158,8 @@ BenchmarkConfig CLIConfigParser::parse_cli_options(const cxxopts::ParseResult& p
                          enable_visualization,
                          verify,
                          cache_binary_tables,
-                         metrics};
+                         metrics,
+                         cost_model_coefficients_path};
 }
 
 EncodingConfig CLIConfigParser::parse_encoding_config(const std::string& encoding_file_str) {
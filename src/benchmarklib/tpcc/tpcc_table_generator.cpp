@@ -617,6 +617,21 @@ void TPCCTableGenerator::_add_constraints(
        KeyConstraintType::PRIMARY_KEY});
 }
 
+AbstractTableGenerator::TableIndexesByTable TPCCTableGenerator::_table_indexes_by_table() const {
+  // The warehouse and district IDs only have few distinct values. The remaining key columns identify few rows each.
+  // Predicates on the other key columns are evaluated on the output of the index lookup.
+  return {{"ITEM", {{"I_ID", TableIndexType::Hash}}},
+          {"STOCK", {{"S_I_ID", TableIndexType::Hash}}},
+          {"CUSTOMER", {{"C_ID", TableIndexType::Hash}, {"C_LAST", TableIndexType::Hash}}},
+          {"ORDER", {{"O_ID", TableIndexType::Hash}, {"O_C_ID", TableIndexType::Hash}}},
+          {"ORDER_LINE", {{"OL_O_ID", TableIndexType::Hash}}},
+          {"NEW_ORDER", {{"NO_O_ID", TableIndexType::Hash}}}};
+}
+
+bool TPCCTableGenerator::_enforce_primary_keys() const {
+  return true;
+}
+
 thread_local TPCCRandomGenerator TPCCTableGenerator::_random_gen;  // NOLINT
 
 }  // namespace hyrise
@@ -57,6 +57,12 @@ class TPCCTableGenerator : public AbstractTableGenerator {
  protected:
   void _add_constraints(std::unordered_map<std::string, BenchmarkTableInfo>& table_info_by_name) const override;
 
+  // Hash table indexes on the most selective key column of each table that is accessed by point lookups
+  TableIndexesByTable _table_indexes_by_table() const override;
+
+  // Enforces the primary keys, which also makes them available for point lookups
+  bool _enforce_primary_keys() const override;
+
   template <typename T>
   std::vector<std::optional<T>> _generate_inner_order_line_column(
       const std::vector<size_t>& indices, OrderLineCounts order_line_counts,
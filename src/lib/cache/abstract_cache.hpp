@@ -52,9 +52,6 @@ class AbstractCache {
   virtual std::unordered_map<Key, SnapshotEntry> snapshot() const = 0;
 
  protected:
-  // Remove an element from the cache according to the cache algorithm's strategy
-  virtual void _evict() = 0;
-
   std::atomic_size_t _capacity;
 };
 
@@ -1,5 +1,9 @@
 #pragma once
 
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <functional>
 #include <mutex>
 #include <shared_mutex>
 
@@ -11,11 +15,19 @@
 namespace hyrise {
 
 /**
- * Generic cache implementation using the GDFS policy.
+ * Generic cache implementation using the GDFS (Greedy-Dual-Frequency-Size) policy. The priority of an entry is its
+ * access frequency weighted by cost / size (both default to 1.0), plus the inflation that ages the entries.
  * To iterate over the cache in a thread-safe manner, use the copy provided by snapshot().
+ *
+ * Lookups only take a shared lock. Updating the frequency and priority of an entry would require a unique lock, so
+ * try_get() records the access in a buffer instead. The buffered accesses are applied in a batch once the buffer is
+ * full, and before any entry is inserted or evicted. As the inflation only changes on eviction, the resulting
+ * priorities are the same as if they were updated on every access. The lookup that fills the buffer waits for the
+ * unique lock to apply it. Lookups that find the buffer full in the meantime apply their access directly once they
+ * hold the unique lock. Thus, no access is lost.
  * Different cache implementations existed in the past, but were retired with PR 2129.
  */
-template <typename Key, typename Value>
+template <typename Key, typename Value, typename Hash = std::hash<Key>, typename KeyEqual = std::equal_to<Key>>
 class GDFSCache : public AbstractCache<Key, Value> {
  public:
   // Entries within the GDFS cache.
@@ -23,6 +35,7 @@ class GDFSCache : public AbstractCache<Key, Value> {
     Key key;
     Value value;
     size_t frequency;
+    double cost;
     double size;
     double priority;
 
@@ -34,9 +47,11 @@ class GDFSCache : public AbstractCache<Key, Value> {
   };
 
   using Handle = typename boost::heap::fibonacci_heap<GDFSCacheEntry>::handle_type;
-  using CacheMap = typename std::unordered_map<Key, Handle>;
+  using CacheMap = typename std::unordered_map<Key, Handle, Hash, KeyEqual>;
   using SnapshotEntry = typename AbstractCache<Key, Value>::SnapshotEntry;
 
+  static constexpr auto ACCESS_BUFFER_SIZE = size_t{64};
+
   explicit GDFSCache(size_t capacity = DEFAULT_CACHE_CAPACITY) : AbstractCache<Key, Value>(capacity), _inflation(0.0) {}
 
   void set(const Key& key, const Value& value, double cost = 1.0, double size = 1.0) final {
@@ -45,6 +60,8 @@ class GDFSCache : public AbstractCache<Key, Value> {
       return;
     }
 
+    _apply_accesses();
+
     auto it = _map.find(key);
     if (it != _map.end()) {
       // Update priority.
@@ -52,9 +69,10 @@ class GDFSCache : public AbstractCache<Key, Value> {
 
       GDFSCacheEntry& entry = (*handle);
       entry.value = value;
+      entry.cost = cost;
       entry.size = size;
       entry.frequency++;
-      entry.priority = _inflation + static_cast<double>(entry.frequency) / entry.size;
+      entry.priority = _priority(entry);
       _queue.update(handle);
 
       return;
@@ -67,25 +85,48 @@ class GDFSCache : public AbstractCache<Key, Value> {
     }
 
     // Insert new item in cache.
-    GDFSCacheEntry entry{key, value, 1, size, 0.0};
-    entry.priority = _inflation + static_cast<double>(entry.frequency) / entry.size;
+    GDFSCacheEntry entry{key, value, 1, cost, size, 0.0};
+    entry.priority = _priority(entry);
     Handle handle = _queue.push(entry);
     _map[key] = handle;
   }
 
   std::optional<Value> try_get(const Key& query) final {
+    auto value = std::optional<Value>{};
+    auto access_index = size_t{0};
+    {
+      std::shared_lock<std::shared_mutex> lock(_mutex);
+      auto it = _map.find(query);
+      if (it == _map.end()) {
+        return std::nullopt;
+      }
+
+      value = (*it->second).value;
+
+      // Concurrent readers write to different slots. The buffer is only read while holding the unique lock.
+      access_index = _access_count.fetch_add(1);
+      if (access_index + 1 < ACCESS_BUFFER_SIZE) {
+        _access_buffer[access_index] = it->second;
+        return value;
+      }
+
+      if (access_index + 1 == ACCESS_BUFFER_SIZE) {
+        _access_buffer[access_index] = it->second;
+      }
+    }
+
+    // The buffer is full. Apply it, as well as this access if it did not fit into the buffer. The entry might have been
+    // evicted after we released the shared lock, so we have to look it up again.
     std::unique_lock<std::shared_mutex> lock(_mutex);
-    auto it = _map.find(query);
-    if (it == _map.end()) {
-      return std::nullopt;
+    _apply_accesses();
+    if (access_index >= ACCESS_BUFFER_SIZE) {
+      const auto it = _map.find(query);
+      if (it != _map.end()) {
+        _apply_access(it->second);
+      }
     }
 
-    Handle handle = it->second;
-    GDFSCacheEntry& entry = (*handle);
-    entry.frequency++;
-    entry.priority = _inflation + static_cast<double>(entry.frequency) / entry.size;
-    _queue.update(handle);
-    return entry.value;
+    return value;
   }
 
   bool has(const Key& key) const final {
@@ -102,10 +143,12 @@ class GDFSCache : public AbstractCache<Key, Value> {
     std::unique_lock<std::shared_mutex> lock(_mutex);
     _map.clear();
     _queue.clear();
+    _access_count = 0;
   }
 
   void resize(size_t capacity) final {
     std::unique_lock<std::shared_mutex> lock(_mutex);
+    _apply_accesses();
     while (_queue.size() > capacity) {
       _evict();
     }
@@ -113,17 +156,23 @@ class GDFSCache : public AbstractCache<Key, Value> {
   }
 
   std::unordered_map<Key, SnapshotEntry> snapshot() const final {
-    std::shared_lock<std::shared_mutex> lock(_mutex);
+    // Concurrent lookups write to the access buffer while holding a shared lock. To count the buffered accesses, we
+    // need a unique lock.
+    std::unique_lock<std::shared_mutex> lock(_mutex);
     std::unordered_map<Key, SnapshotEntry> map_copy(_map.size());
     for (const auto& [key, entry] : _map) {
       map_copy[key] = SnapshotEntry{(*entry).value, (*entry).frequency};
     }
+
+    const auto access_count = std::min(_access_count.load(), ACCESS_BUFFER_SIZE);
+    for (auto access_index = size_t{0}; access_index < access_count; ++access_index) {
+      ++*map_copy[(*_access_buffer[access_index]).key].frequency;
+    }
     return map_copy;
   }
 
  protected:
   friend class CachePolicyTest;
-  friend class QueryPlanCacheTest;
 
   // Priority queue to hold all elements. Implemented as max-heap.
   boost::heap::fibonacci_heap<GDFSCacheEntry> _queue;
@@ -142,7 +191,34 @@ class GDFSCache : public AbstractCache<Key, Value> {
   // Inflation value that will be updated whenever an item is evicted.
   double _inflation;
 
-  void _evict() final {
+  // Handles of the entries that were accessed by try_get() since the last call of _apply_accesses(). Only the first
+  // ACCESS_BUFFER_SIZE accesses are recorded, but _access_count counts all of them.
+  std::array<Handle, ACCESS_BUFFER_SIZE> _access_buffer;
+  std::atomic_size_t _access_count{0};
+
+  // Updates the frequencies and priorities of the buffered accesses. Requires the unique lock, so that no handle in the
+  // buffer has been invalidated by an eviction.
+  void _apply_accesses() {
+    const auto access_count = std::min(_access_count.load(), ACCESS_BUFFER_SIZE);
+    for (auto access_index = size_t{0}; access_index < access_count; ++access_index) {
+      _apply_access(_access_buffer[access_index]);
+    }
+    _access_count = 0;
+  }
+
+  void _apply_access(const Handle& handle) {
+    GDFSCacheEntry& entry = (*handle);
+    entry.frequency++;
+    entry.priority = _priority(entry);
+    _queue.update(handle);
+  }
+
+  double _priority(const GDFSCacheEntry& entry) const {
+    return _inflation + static_cast<double>(entry.frequency) * entry.cost / entry.size;
+  }
+
+  // Removes the entry with the lowest priority.
+  void _evict() {
     auto top = _queue.top();
 
     _inflation = top.priority;
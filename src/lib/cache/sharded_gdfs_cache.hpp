@@ -0,0 +1,100 @@
+#pragma once
+
+#include <algorithm>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <shared_mutex>
+#include <unordered_map>
+#include <vector>
+
+#include "abstract_cache.hpp"
+#include "gdfs_cache.hpp"
+
+namespace hyrise {
+
+/**
+ * Cache that is split into GDFSCaches (shards) with separate locks. Keys are assigned to shards by their hash. Thus,
+ * threads that insert or look up different keys rarely compete for the same lock. Each shard gets an equal part of
+ * the capacity and applies the GDFS policy to its own entries only.
+ *
+ * Evicting within a shard is less accurate than evicting the entry with the globally lowest priority. Hence, each
+ * shard holds at least MIN_SHARD_CAPACITY entries. Caches with a capacity below 2 * MIN_SHARD_CAPACITY consist of a
+ * single shard and behave like a GDFSCache.
+ */
+template <typename Key, typename Value, typename Hash = std::hash<Key>, typename KeyEqual = std::equal_to<Key>>
+class ShardedGDFSCache : public AbstractCache<Key, Value> {
+ public:
+  using Shard = GDFSCache<Key, Value, Hash, KeyEqual>;
+  using SnapshotEntry = typename AbstractCache<Key, Value>::SnapshotEntry;
+
+  static constexpr auto MIN_SHARD_CAPACITY = size_t{64};
+  static constexpr auto MAX_SHARD_COUNT = size_t{16};
+
+  explicit ShardedGDFSCache(size_t capacity = DEFAULT_CACHE_CAPACITY)
+      : AbstractCache<Key, Value>(capacity),
+        _shards(std::clamp(capacity / MIN_SHARD_CAPACITY, size_t{1}, MAX_SHARD_COUNT)) {
+    for (auto shard_id = size_t{0}; shard_id < _shards.size(); ++shard_id) {
+      _shards[shard_id] = std::make_unique<Shard>(_shard_capacity(capacity, shard_id));
+    }
+  }
+
+  void set(const Key& key, const Value& value, double cost = 1.0, double size = 1.0) final {
+    _shard(key).set(key, value, cost, size);
+  }
+
+  std::optional<Value> try_get(const Key& query) final {
+    return _shard(query).try_get(query);
+  }
+
+  bool has(const Key& key) const final {
+    return _shard(key).has(key);
+  }
+
+  size_t size() const final {
+    auto size = size_t{0};
+    for (const auto& shard : _shards) {
+      size += shard->size();
+    }
+    return size;
+  }
+
+  void clear() final {
+    for (const auto& shard : _shards) {
+      shard->clear();
+    }
+  }
+
+  // The number of shards is fixed on construction. Only their capacities change.
+  void resize(size_t capacity) final {
+    for (auto shard_id = size_t{0}; shard_id < _shards.size(); ++shard_id) {
+      _shards[shard_id]->resize(_shard_capacity(capacity, shard_id));
+    }
+    this->_capacity = capacity;
+  }
+
+  std::unordered_map<Key, SnapshotEntry> snapshot() const final {
+    auto map_copy = std::unordered_map<Key, SnapshotEntry>{};
+    for (const auto& shard : _shards) {
+      map_copy.merge(shard->snapshot());
+    }
+    return map_copy;
+  }
+
+  size_t shard_count() const {
+    return _shards.size();
+  }
+
+ protected:
+  std::vector<std::unique_ptr<Shard>> _shards;
+
+  Shard& _shard(const Key& key) const {
+    return *_shards[Hash{}(key) % _shards.size()];
+  }
+
+  size_t _shard_capacity(const size_t capacity, const size_t shard_id) const {
+    return capacity / _shards.size() + (shard_id < capacity % _shards.size() ? 1 : 0);
+  }
+};
+
+}  // namespace hyrise
@@ -0,0 +1,299 @@
+#include "cost_estimator_calibrated.hpp"
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+
+#include "expression/abstract_predicate_expression.hpp"
+#include "expression/lqp_column_expression.hpp"
+#include "expression/value_expression.hpp"
+#include "hyrise.hpp"
+#include "logical_query_plan/join_node.hpp"
+#include "logical_query_plan/limit_node.hpp"
+#include "logical_query_plan/predicate_node.hpp"
+#include "logical_query_plan/static_table_node.hpp"
+#include "logical_query_plan/stored_table_node.hpp"
+#include "logical_query_plan/union_node.hpp"
+#include "lossy_cast.hpp"
+#include "operators/join_hash.hpp"
+#include "operators/join_nested_loop.hpp"
+#include "operators/join_sort_merge.hpp"
+#include "operators/operator_scan_predicate.hpp"
+#include "statistics/cardinality_estimator.hpp"
+#include "storage/segment_encoding_utils.hpp"
+#include "utils/assert.hpp"
+
+namespace {
+
+using namespace hyrise;  // NOLINT
+
+// The join operators the LQPTranslator chooses from, in the order of its preference if their costs are equal.
+constexpr auto JOIN_OPERATOR_TYPES =
+    std::array<OperatorType, 3>{OperatorType::JoinHash, OperatorType::JoinSortMerge, OperatorType::JoinNestedLoop};
+
+// A JoinNestedLoop compares all pairs of input rows, so underestimated input cardinalities can make it arbitrarily
+// slow. Thus, the join operator is only chosen by its costs if the inputs are guaranteed to form at most this many
+// pairs.
+constexpr auto MAX_NESTED_LOOP_ROW_PAIR_COUNT = 1'000'000.0f;
+
+// @return an upper bound of the row count of @param node that holds regardless of the cardinality estimation. Such a
+// bound is known for StaticTableNodes, LIMITs with a literal row count, and nodes that do not add rows to them.
+std::optional<float> guaranteed_max_row_count(const AbstractLQPNode& node) {
+  switch (node.type) {
+    case LQPNodeType::StaticTable:
+      return static_cast<float>(static_cast<const StaticTableNode&>(node).table->row_count());
+
+    case LQPNodeType::DummyTable:
+      return 1.0f;
+
+    case LQPNodeType::Limit: {
+      const auto input_max_row_count = guaranteed_max_row_count(*node.left_input());
+      const auto value_expression =
+          std::dynamic_pointer_cast<ValueExpression>(static_cast<const LimitNode&>(node).num_rows_expression());
+      const auto limit = value_expression ? lossy_variant_cast<float>(value_expression->value) : std::nullopt;
+      if (!limit) {
+        return input_max_row_count;
+      }
+      return input_max_row_count ? std::min(*limit, *input_max_row_count) : *limit;
+    }
+
+    case LQPNodeType::Alias:
+    case LQPNodeType::Predicate:
+    case LQPNodeType::Projection:
+    case LQPNodeType::Sort:
+    case LQPNodeType::Validate:
+      return guaranteed_max_row_count(*node.left_input());
+
+    default:
+      return std::nullopt;
+  }
+}
+
+// Number of comparisons for sorting @param row_count rows. Guards against log(0).
+float sorted_row_count(const float row_count) {
+  return row_count * std::log(std::max(row_count, 1.0f));
+}
+
+bool join_operator_supports(const OperatorType join_operator_type, const JoinConfiguration& configuration) {
+  switch (join_operator_type) {
+    case OperatorType::JoinHash:
+      return JoinHash::supports(configuration);
+    case OperatorType::JoinSortMerge:
+      return JoinSortMerge::supports(configuration);
+    case OperatorType::JoinNestedLoop:
+      return JoinNestedLoop::supports(configuration);
+    default:
+      Fail("Unexpected join operator type.");
+  }
+}
+
+}  // namespace
+
+namespace hyrise {
+
+CostEstimatorCalibrated::CostEstimatorCalibrated(
+    const std::shared_ptr<AbstractCardinalityEstimator>& init_cardinality_estimator,
+    const std::shared_ptr<const CostModelCoefficients>& init_coefficients)
+    : AbstractCostEstimator(init_cardinality_estimator), coefficients(init_coefficients) {
+  Assert(coefficients, "CostEstimatorCalibrated requires coefficients.");
+}
+
+std::shared_ptr<AbstractCostEstimator> CostEstimatorCalibrated::new_instance() const {
+  return std::make_shared<CostEstimatorCalibrated>(cardinality_estimator->new_instance(), coefficients);
+}
+
+Cost CostEstimatorCalibrated::estimate_node_cost(const std::shared_ptr<AbstractLQPNode>& node) const {
+  switch (node->type) {
+    case LQPNodeType::Predicate: {
+      const auto predicate_node = std::static_pointer_cast<PredicateNode>(node);
+      return estimate_scan_cost(predicate_node, predicate_node->scan_type);
+    }
+
+    case LQPNodeType::Join: {
+      const auto join_node = std::static_pointer_cast<JoinNode>(node);
+      const auto join_operator_type = cheapest_join_operator(join_node);
+      if (join_operator_type) {
+        return estimate_join_cost(join_node, *join_operator_type);
+      }
+      // Cross joins are executed by the Product, whose cost is dominated by writing the output.
+      break;
+    }
+
+    default:
+      break;
+  }
+
+  const auto output_row_count = cardinality_estimator->estimate_cardinality(node);
+  const auto left_input_row_count =
+      node->left_input() ? cardinality_estimator->estimate_cardinality(node->left_input()) : 0.0f;
+  const auto right_input_row_count =
+      node->right_input() ? cardinality_estimator->estimate_cardinality(node->right_input()) : 0.0f;
+
+  switch (node->type) {
+    case LQPNodeType::Aggregate:
+      return left_input_row_count * coefficients->aggregate_cost_per_input_row +
+             output_row_count * coefficients->aggregate_cost_per_output_row;
+
+    case LQPNodeType::Sort:
+      return sorted_row_count(left_input_row_count) * coefficients->sort_cost_per_sorted_row;
+
+    case LQPNodeType::Union:
+      // UnionPositions sorts the position lists of both inputs.
+      if (std::static_pointer_cast<UnionNode>(node)->set_operation_mode == SetOperationMode::Positions) {
+        return (sorted_row_count(left_input_row_count) + sorted_row_count(right_input_row_count)) *
+               coefficients->sort_cost_per_sorted_row;
+      }
+      return (left_input_row_count + right_input_row_count + output_row_count) * coefficients->cost_per_row;
+
+    default:
+      return (left_input_row_count + right_input_row_count + output_row_count) * coefficients->cost_per_row;
+  }
+}
+
+Cost CostEstimatorCalibrated::estimate_scan_cost(const std::shared_ptr<PredicateNode>& predicate_node,
+                                                 const ScanType scan_type) const {
+  const auto input_row_count = cardinality_estimator->estimate_cardinality(predicate_node->left_input());
+  const auto output_row_count = cardinality_estimator->estimate_cardinality(predicate_node);
+
+  if (scan_type == ScanType::IndexScan) {
+    return input_row_count * coefficients->index_scan_cost_per_input_row +
+           output_row_count * coefficients->index_scan_cost_per_output_row;
+  }
+
+  const auto [cost_per_input_row, cost_per_output_row] = _table_scan_costs_per_row(*predicate_node);
+  return input_row_count * cost_per_input_row + output_row_count * cost_per_output_row;
+}
+
+Cost CostEstimatorCalibrated::estimate_join_cost(const std::shared_ptr<JoinNode>& join_node,
+                                                 const OperatorType join_operator_type) const {
+  const auto output_row_count = cardinality_estimator->estimate_cardinality(join_node);
+  const auto left_input_row_count = cardinality_estimator->estimate_cardinality(join_node->left_input());
+  const auto right_input_row_count = cardinality_estimator->estimate_cardinality(join_node->right_input());
+
+  switch (join_operator_type) {
+    case OperatorType::JoinHash: {
+      // Mirrors the choice of the build side in JoinHash::_on_execute().
+      const auto join_mode = join_node->join_mode;
+      const auto build_right_input =
+          join_mode == JoinMode::Left || join_mode == JoinMode::Semi || join_mode == JoinMode::AntiNullAsTrue ||
+          join_mode == JoinMode::AntiNullAsFalse ||
+          (join_mode == JoinMode::Inner && left_input_row_count > right_input_row_count);
+      const auto build_row_count = build_right_input ? right_input_row_count : left_input_row_count;
+      const auto probe_row_count = build_right_input ? left_input_row_count : right_input_row_count;
+      return build_row_count * coefficients->join_hash_cost_per_build_row +
+             probe_row_count * coefficients->join_hash_cost_per_probe_row +
+             output_row_count * coefficients->join_hash_cost_per_output_row;
+    }
+
+    case OperatorType::JoinSortMerge:
+      return (left_input_row_count + right_input_row_count) * coefficients->join_sort_merge_cost_per_input_row +
+             (sorted_row_count(left_input_row_count) + sorted_row_count(right_input_row_count)) *
+                 coefficients->join_sort_merge_cost_per_sorted_row +
+             output_row_count * coefficients->join_sort_merge_cost_per_output_row;
+
+    case OperatorType::JoinNestedLoop:
+      return left_input_row_count * right_input_row_count * coefficients->join_nested_loop_cost_per_row_pair +
+             output_row_count * coefficients->join_nested_loop_cost_per_output_row;
+
+    default:
+      Fail("Unexpected join operator type.");
+  }
+}
+
+std::optional<OperatorType> CostEstimatorCalibrated::cheapest_join_operator(
+    const std::shared_ptr<JoinNode>& join_node) const {
+  if (join_node->join_mode == JoinMode::Cross) {
+    return std::nullopt;
+  }
+
+  const auto& join_predicates = join_node->join_predicates();
+  Assert(!join_predicates.empty(), "Need predicate for non Cross Join");
+  const auto primary_predicate = std::dynamic_pointer_cast<AbstractPredicateExpression>(join_predicates.front());
+  Assert(primary_predicate, "Expected the primary join predicate to be a predicate expression.");
+
+  const auto configuration =
+      JoinConfiguration{join_node->join_mode, primary_predicate->predicate_condition,
+                        primary_predicate->arguments[0]->data_type(), primary_predicate->arguments[1]->data_type(),
+                        join_predicates.size() > 1};
+
+  // Cardinality estimates can be off by orders of magnitude. Thus, the costs only decide between the join operators if
+  // the inputs are guaranteed to be small. Otherwise, the first supported operator in the order of preference is chosen
+  // (i.e., the JoinNestedLoop only if no other operator supports the JoinNode).
+  const auto left_max_row_count = guaranteed_max_row_count(*join_node->left_input());
+  const auto right_max_row_count = guaranteed_max_row_count(*join_node->right_input());
+  const auto has_small_inputs = left_max_row_count && right_max_row_count &&
+                                *left_max_row_count * *right_max_row_count <= MAX_NESTED_LOOP_ROW_PAIR_COUNT;
+
+  auto cheapest_join_operator_type = std::optional<OperatorType>{};
+  auto cheapest_cost = Cost{0.0f};
+  for (const auto join_operator_type : JOIN_OPERATOR_TYPES) {
+    if (!join_operator_supports(join_operator_type, configuration)) {
+      continue;
+    }
+
+    if (!has_small_inputs) {
+      return join_operator_type;
+    }
+
+    const auto cost = estimate_join_cost(join_node, join_operator_type);
+    if (!cheapest_join_operator_type || cost < cheapest_cost) {
+      cheapest_join_operator_type = join_operator_type;
+      cheapest_cost = cost;
+    }
+  }
+
+  return cheapest_join_operator_type;
+}
+
+std::pair<Cost, Cost> CostEstimatorCalibrated::_table_scan_costs_per_row(const PredicateNode& predicate_node) const {
+  const auto cost_per_output_row = coefficients->table_scan_cost_per_output_row;
+
+  // Predicates on intermediate results scan ReferenceSegments.
+  const auto stored_table_node = std::dynamic_pointer_cast<StoredTableNode>(predicate_node.left_input());
+  if (!stored_table_node) {
+    return {coefficients->reference_table_scan_cost_per_input_row, cost_per_output_row};
+  }
+
+  // Predicates that are not a simple comparison of a column with a value are evaluated by the ExpressionEvaluator,
+  // which, just like a scan on ReferenceSegments, accesses the values one by one.
+  const auto operator_predicates = OperatorScanPredicate::from_expression(*predicate_node.predicate(), predicate_node);
+  if (!operator_predicates || operator_predicates->size() != 1) {
+    return {coefficients->reference_table_scan_cost_per_input_row, cost_per_output_row};
+  }
+
+  const auto& operator_predicate = operator_predicates->front();
+  const auto column_expression = std::dynamic_pointer_cast<LQPColumnExpression>(
+      stored_table_node->output_expressions()[operator_predicate.column_id]);
+  DebugAssert(column_expression, "Expected the StoredTableNode to output LQPColumnExpressions");
+  const auto column_id = column_expression->original_column_id;
+
+  // Tables are usually encoded uniformly, so the first chunk represents the table.
+  const auto table = Hyrise::get().storage_manager.get_table(stored_table_node->table_name);
+  const auto chunk_count = table->chunk_count();
+  for (auto chunk_id = ChunkID{0}; chunk_id < chunk_count; ++chunk_id) {
+    const auto chunk = table->get_chunk(chunk_id);
+    if (!chunk) {
+      continue;
+    }
+
+    // Scans with literal values on sorted segments binary search the matching range (see SortedSegmentSearch) and
+    // thus hardly depend on the number of input rows.
+    const auto& sorted_by = chunk->individually_sorted_by();
+    const auto is_sorted = std::any_of(sorted_by.cbegin(), sorted_by.cend(), [&](const auto& sort_definition) {
+      return sort_definition.column == column_id;
+    });
+    const auto predicate_condition = operator_predicate.predicate_condition;
+    if (is_sorted && is_variant(operator_predicate.value) &&
+        (is_binary_numeric_predicate_condition(predicate_condition) ||
+         is_between_predicate_condition(predicate_condition))) {
+      return {0.0f, coefficients->sorted_table_scan_cost_per_output_row};
+    }
+
+    const auto encoding_type = get_segment_encoding_spec(chunk->get_segment(column_id)).encoding_type;
+    return {coefficients->table_scan_cost_per_input_row.at(encoding_type), cost_per_output_row};
+  }
+
+  return {0.0f, cost_per_output_row};
+}
+
+}  // namespace hyrise
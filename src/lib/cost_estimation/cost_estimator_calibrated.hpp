@@ -0,0 +1,61 @@
+#pragma once
+
+#include <memory>
+#include <optional>
+#include <utility>
+
+#include "abstract_cost_estimator.hpp"
+#include "cost_model_coefficients.hpp"
+#include "logical_query_plan/predicate_node.hpp"
+#include "operators/abstract_operator.hpp"
+
+namespace hyrise {
+
+class JoinNode;
+
+/**
+ * Cost model for the physical execution of a plan, i.e., the approximate execution time in nanoseconds. Unlike the
+ * CostEstimatorLogical, it distinguishes between physical operators (e.g., a JoinHash and a JoinSortMerge, or a
+ * TableScan and an IndexScan) and considers the encoding and the sort order of the scanned segments. The per-row costs
+ * are taken from CostModelCoefficients, which can be calibrated for the machine at hand with
+ * hyriseCostModelCalibration.
+ *
+ * If Hyrise::get().cost_model_coefficients is set, the default optimizer uses this cost model and the LQPTranslator
+ * chooses the cheapest join operator according to it.
+ */
+class CostEstimatorCalibrated : public AbstractCostEstimator {
+ public:
+  CostEstimatorCalibrated(const std::shared_ptr<AbstractCardinalityEstimator>& init_cardinality_estimator,
+                          const std::shared_ptr<const CostModelCoefficients>& init_coefficients);
+
+  std::shared_ptr<AbstractCostEstimator> new_instance() const override;
+
+  Cost estimate_node_cost(const std::shared_ptr<AbstractLQPNode>& node) const override;
+
+  /**
+   * @return the estimated cost of executing @param predicate_node as a TableScan or as an IndexScan, regardless of
+   *         its current scan_type.
+   */
+  Cost estimate_scan_cost(const std::shared_ptr<PredicateNode>& predicate_node, const ScanType scan_type) const;
+
+  /**
+   * @return the estimated cost of executing @param join_node with the join operator of @param join_operator_type
+   *         (JoinHash, JoinSortMerge, or JoinNestedLoop).
+   */
+  Cost estimate_join_cost(const std::shared_ptr<JoinNode>& join_node, const OperatorType join_operator_type) const;
+
+  /**
+   * @return the cheapest of the join operators supporting @param join_node, std::nullopt for cross joins. Unless both
+   *         inputs are guaranteed to be small (e.g., StaticTableNodes or LIMITs), the first supporting operator of
+   *         JoinHash, JoinSortMerge, and JoinNestedLoop is returned regardless of the estimated costs.
+   */
+  std::optional<OperatorType> cheapest_join_operator(const std::shared_ptr<JoinNode>& join_node) const;
+
+  const std::shared_ptr<const CostModelCoefficients> coefficients;
+
+ private:
+  // @return the cost of a TableScan per input row and per output row, depending on the scanned segments.
+  std::pair<Cost, Cost> _table_scan_costs_per_row(const PredicateNode& predicate_node) const;
+};
+
+}  // namespace hyrise
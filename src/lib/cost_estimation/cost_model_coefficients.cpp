@@ -0,0 +1,80 @@
+#include "cost_model_coefficients.hpp"
+
+#include <fstream>
+#include <string>
+
+#include "nlohmann/json.hpp"
+
+#include "constant_mappings.hpp"
+#include "utils/assert.hpp"
+
+namespace {
+
+using namespace hyrise;  // NOLINT
+
+// Calls @param functor with the name and a reference of every scalar coefficient so that loading and saving cannot
+// diverge. Coefficients is either CostModelCoefficients or const CostModelCoefficients.
+template <typename Coefficients, typename Functor>
+void visit_scalar_coefficients(Coefficients& coefficients, const Functor& functor) {
+  functor("reference_table_scan_cost_per_input_row", coefficients.reference_table_scan_cost_per_input_row);
+  functor("sorted_table_scan_cost_per_output_row", coefficients.sorted_table_scan_cost_per_output_row);
+  functor("table_scan_cost_per_output_row", coefficients.table_scan_cost_per_output_row);
+  functor("index_scan_cost_per_input_row", coefficients.index_scan_cost_per_input_row);
+  functor("index_scan_cost_per_output_row", coefficients.index_scan_cost_per_output_row);
+  functor("join_hash_cost_per_build_row", coefficients.join_hash_cost_per_build_row);
+  functor("join_hash_cost_per_probe_row", coefficients.join_hash_cost_per_probe_row);
+  functor("join_hash_cost_per_output_row", coefficients.join_hash_cost_per_output_row);
+  functor("join_sort_merge_cost_per_input_row", coefficients.join_sort_merge_cost_per_input_row);
+  functor("join_sort_merge_cost_per_sorted_row", coefficients.join_sort_merge_cost_per_sorted_row);
+  functor("join_sort_merge_cost_per_output_row", coefficients.join_sort_merge_cost_per_output_row);
+  functor("join_nested_loop_cost_per_row_pair", coefficients.join_nested_loop_cost_per_row_pair);
+  functor("join_nested_loop_cost_per_output_row", coefficients.join_nested_loop_cost_per_output_row);
+  functor("aggregate_cost_per_input_row", coefficients.aggregate_cost_per_input_row);
+  functor("aggregate_cost_per_output_row", coefficients.aggregate_cost_per_output_row);
+  functor("sort_cost_per_sorted_row", coefficients.sort_cost_per_sorted_row);
+  functor("cost_per_row", coefficients.cost_per_row);
+}
+
+}  // namespace
+
+namespace hyrise {
+
+CostModelCoefficients CostModelCoefficients::load(const std::string& filename) {
+  auto file = std::ifstream{filename};
+  Assert(file.good(), "Cost model coefficients file does not exist: " + filename);
+  auto json = nlohmann::json{};
+  file >> json;
+
+  // Coefficients missing in the file keep their defaults. Thus, partial calibrations can be loaded.
+  auto coefficients = CostModelCoefficients{};
+  visit_scalar_coefficients(coefficients, [&](const std::string& name, Cost& coefficient) {
+    if (json.contains(name)) {
+      coefficient = json.at(name).get<Cost>();
+    }
+  });
+
+  if (json.contains("table_scan_cost_per_input_row")) {
+    for (const auto& [encoding_name, coefficient] : json.at("table_scan_cost_per_input_row").items()) {
+      const auto encoding_iter = encoding_type_to_string.right.find(encoding_name);
+      Assert(encoding_iter != encoding_type_to_string.right.end(), "Unknown encoding type: " + encoding_name);
+      coefficients.table_scan_cost_per_input_row[encoding_iter->second] = coefficient.get<Cost>();
+    }
+  }
+
+  return coefficients;
+}
+
+void CostModelCoefficients::save(const std::string& filename) const {
+  auto json = nlohmann::json{};
+  visit_scalar_coefficients(*this, [&](const std::string& name, const Cost& coefficient) { json[name] = coefficient; });
+
+  for (const auto& [encoding_type, coefficient] : table_scan_cost_per_input_row) {
+    json["table_scan_cost_per_input_row"][encoding_type_to_string.left.at(encoding_type)] = coefficient;
+  }
+
+  auto file = std::ofstream{filename};
+  Assert(file.good(), "Cannot write cost model coefficients to " + filename);
+  file << json.dump(2) << '\n';
+}
+
+}  // namespace hyrise
@@ -0,0 +1,61 @@
+#pragma once
+
+#include <map>
+#include <string>
+
+#include "storage/encoding_type.hpp"
+#include "types.hpp"
+
+namespace hyrise {
+
+/**
+ * Coefficients of the CostEstimatorCalibrated, i.e., the time (in nanoseconds) an operator spends per input row, output
+ * row, or other unit of work. The defaults roughly reflect a current x86 server. To reflect the machine Hyrise runs
+ * on, hyriseCostModelCalibration measures them with micro benchmarks and writes them to a JSON file that can be loaded
+ * with `load()`.
+ */
+struct CostModelCoefficients {
+  static CostModelCoefficients load(const std::string& filename);
+  void save(const std::string& filename) const;
+
+  // TableScans on stored segments compare every value. Their cost depends on the encoding of the scanned segments.
+  std::map<EncodingType, Cost> table_scan_cost_per_input_row{
+      {EncodingType::Unencoded, 1.0f},        {EncodingType::Dictionary, 0.8f},
+      {EncodingType::RunLength, 0.5f},        {EncodingType::FixedStringDictionary, 1.0f},
+      {EncodingType::FrameOfReference, 1.5f}, {EncodingType::LZ4, 8.0f}};
+
+  // Scans on intermediate results (i.e., ReferenceSegments) access the referenced segments in random order.
+  Cost reference_table_scan_cost_per_input_row{3.0f};
+
+  // TableScans on sorted segments binary search the matching range. Their cost is dominated by writing the output.
+  Cost sorted_table_scan_cost_per_output_row{0.5f};
+  Cost table_scan_cost_per_output_row{1.0f};
+
+  // IndexScans only touch the matching rows, but access them in random order. The cost per input row covers the
+  // per-chunk index lookups.
+  Cost index_scan_cost_per_input_row{0.05f};
+  Cost index_scan_cost_per_output_row{20.0f};
+
+  Cost join_hash_cost_per_build_row{10.0f};
+  Cost join_hash_cost_per_probe_row{5.0f};
+  Cost join_hash_cost_per_output_row{2.0f};
+
+  // The sorting cost is multiplied by n * log(n) of both inputs.
+  Cost join_sort_merge_cost_per_input_row{8.0f};
+  Cost join_sort_merge_cost_per_sorted_row{1.5f};
+  Cost join_sort_merge_cost_per_output_row{2.0f};
+
+  Cost join_nested_loop_cost_per_row_pair{2.0f};
+  Cost join_nested_loop_cost_per_output_row{2.0f};
+
+  Cost aggregate_cost_per_input_row{8.0f};
+  Cost aggregate_cost_per_output_row{4.0f};
+
+  // Multiplied by n * log(n) of the input.
+  Cost sort_cost_per_sorted_row{3.0f};
+
+  // All other operators are costed by the number of their input and output rows.
+  Cost cost_per_row{1.0f};
+};
+
+}  // namespace hyrise
@@ -1,5 +1,6 @@
 #include "expression_evaluator.hpp"
 
+#include <algorithm>
 #include <iterator>
 #include <type_traits>
 
@@ -44,6 +45,11 @@ namespace {
 
 using namespace hyrise;  // NOLINT
 
+// A CASE branch is only evaluated for the rows that take it if they are at most this share of all rows. Gathering
+// their column values costs more than evaluating the branch for all rows otherwise (measured for an arithmetic branch
+// on two int columns of a 65'535 row chunk, where both took the same time at a share of 0.25).
+constexpr auto MAX_CASE_BRANCH_SUBSET_SHARE = 0.2;
+
 template <typename Functor>
 void resolve_binary_predicate_evaluator(const PredicateCondition predicate_condition, const Functor functor) {
   /**
@@ -151,6 +157,17 @@ ExpressionEvaluator::ExpressionEvaluator(
   _segment_materializations.resize(_chunk->column_count());
 }
 
+ExpressionEvaluator::ExpressionEvaluator(ExpressionEvaluator& parent_evaluator,
+                                         const pmr_vector<ChunkOffset>& parent_chunk_offsets)
+    : _table(parent_evaluator._table),
+      _chunk(parent_evaluator._chunk),
+      _chunk_id(parent_evaluator._chunk_id),
+      _output_row_count(parent_chunk_offsets.size()),
+      _segment_materializations(parent_evaluator._segment_materializations.size()),
+      _uncorrelated_subquery_results(parent_evaluator._uncorrelated_subquery_results),
+      _parent_evaluator(&parent_evaluator),
+      _parent_chunk_offsets(&parent_chunk_offsets) {}
+
 template <typename Result>
 std::shared_ptr<ExpressionResult<Result>> ExpressionEvaluator::evaluate_expression_to_result(
     const AbstractExpression& expression) {
@@ -163,6 +180,7 @@ std::shared_ptr<ExpressionResult<Result>> ExpressionEvaluator::evaluate_expressi
 
   // Ok, we have to actually work...
   auto result = std::shared_ptr<ExpressionResult<Result>>{};
+  ++_evaluation_depth;
 
   switch (expression.type) {
     case ExpressionType::Arithmetic:
@@ -235,6 +253,13 @@ std::shared_ptr<ExpressionResult<Result>> ExpressionEvaluator::evaluate_expressi
       Fail("IntervalExpression should have been resolved by SQLTranslator");
   }
 
+  // Scratch memory is only used while an expression is evaluated. Release it once the outermost evaluation returns, so
+  // that it does not grow with the number of expressions an evaluator computes.
+  --_evaluation_depth;
+  if (_evaluation_depth == 0 && _scratch_buffer) {
+    _scratch_buffer->release();
+  }
+
   // Store the result in the cache
   _cached_expression_results.insert(cached_result_iter, {expression_ptr, result});
 
@@ -331,13 +356,11 @@ ExpressionEvaluator::_evaluate_like_expression<ExpressionEvaluator::Bool>(const
     }
   } else if (!left_results->is_literal() && right_results->is_literal()) {
     // E.g., `a LIKE '%hello%'` -- A single matcher for all rows
-    LikeMatcher like_matcher{right_results->values.front()};
-
-    for (auto row_idx = ChunkOffset{0}; row_idx < result_size; ++row_idx) {
-      like_matcher.resolve(invert_results, [&](const auto& matcher) {
+    LikeMatcher{right_results->values.front()}.resolve(invert_results, [&](const auto& matcher) {
+      for (auto row_idx = ChunkOffset{0}; row_idx < result_size; ++row_idx) {
         result_values[row_idx] = matcher(left_results->values[row_idx]);
-      });
-    }
+      }
+    });
   } else {
     // E.g., `'hello' LIKE b` -- A new matcher for each row but the value to check is constant
     for (auto row_idx = ChunkOffset{0}; row_idx < result_size; ++row_idx) {
@@ -645,38 +668,106 @@ template <typename Result>
 std::shared_ptr<ExpressionResult<Result>> ExpressionEvaluator::_evaluate_case_expression(
     const CaseExpression& case_expression) {
   const auto when = evaluate_expression_to_result<ExpressionEvaluator::Bool>(*case_expression.when());
+  const auto& then_expression = *case_expression.then();
+  const auto& else_expression = *case_expression.otherwise();
 
-  pmr_vector<Result> values;
-  pmr_vector<bool> nulls;
+  // If all rows take the same branch, the other one is not evaluated at all.
+  if (when->is_literal()) {
+    return _evaluate_case_branch<Result>(when->value(0) && !when->is_null(0) ? then_expression : else_expression);
+  }
 
-  _resolve_to_expression_results(
-      *case_expression.then(), *case_expression.otherwise(), [&](const auto& then_result, const auto& else_result) {
-        using ThenResultType = typename std::decay_t<decltype(then_result)>::Type;
-        using ElseResultType = typename std::decay_t<decltype(else_result)>::Type;
+  const auto row_count = static_cast<ChunkOffset>(when->size());
+  if (row_count == 0) {
+    return std::make_shared<ExpressionResult<Result>>();
+  }
 
-        if constexpr (CaseEvaluator::supports_v<Result, ThenResultType, ElseResultType>) {
-          const auto result_size = _result_size(when->size(), then_result.size(), else_result.size());
-          values.resize(result_size);
-          nulls.resize(result_size);
+  auto then_chunk_offsets = pmr_vector<ChunkOffset>(&_scratch_memory_resource());
+  auto else_chunk_offsets = pmr_vector<ChunkOffset>(&_scratch_memory_resource());
+  then_chunk_offsets.reserve(row_count);
+  else_chunk_offsets.reserve(row_count);
+  for (auto chunk_offset = ChunkOffset{0}; chunk_offset < row_count; ++chunk_offset) {
+    if (when->values[chunk_offset] && !when->is_null(chunk_offset)) {
+      then_chunk_offsets.emplace_back(chunk_offset);
+    } else {
+      else_chunk_offsets.emplace_back(chunk_offset);
+    }
+  }
 
-          for (auto chunk_offset = ChunkOffset{0}; chunk_offset < static_cast<ChunkOffset>(result_size);
-               ++chunk_offset) {
-            if (when->value(chunk_offset) && !when->is_null(chunk_offset)) {
-              values[chunk_offset] = to_value<Result>(then_result.value(chunk_offset));
-              nulls[chunk_offset] = then_result.is_null(chunk_offset);
-            } else {
-              values[chunk_offset] = to_value<Result>(else_result.value(chunk_offset));
-              nulls[chunk_offset] = else_result.is_null(chunk_offset);
-            }
-          }
-        } else {
-          Fail("Illegal operands for CaseExpression");
-        }
-      });
+  if (else_chunk_offsets.empty()) {
+    return _evaluate_case_branch<Result>(then_expression);
+  }
+  if (then_chunk_offsets.empty()) {
+    return _evaluate_case_branch<Result>(else_expression);
+  }
+
+  // Otherwise, a branch taken by few rows is evaluated by an evaluator for these rows, which gathers their column
+  // values. A branch taken by many rows is evaluated for all rows, reusing the columns materialized for the WHEN
+  // condition. Then, the values of the rows taking the branch are copied to the result.
+  auto values = pmr_vector<Result>(row_count);
+  auto nulls = pmr_vector<bool>{};
+  auto nullable = false;
+  const auto scatter_branch = [&](const AbstractExpression& branch_expression,
+                                  const pmr_vector<ChunkOffset>& branch_chunk_offsets) {
+    const auto branch_share = static_cast<double>(branch_chunk_offsets.size()) / static_cast<double>(row_count);
+    const auto evaluate_subset = branch_share <= MAX_CASE_BRANCH_SUBSET_SHARE;
+    auto branch_result = std::shared_ptr<ExpressionResult<Result>>{};
+    if (evaluate_subset) {
+      auto branch_evaluator = ExpressionEvaluator{*this, branch_chunk_offsets};
+      branch_result = branch_evaluator._evaluate_case_branch<Result>(branch_expression);
+    } else {
+      branch_result = _evaluate_case_branch<Result>(branch_expression);
+    }
+
+    const auto branch_row_count = static_cast<ChunkOffset>(branch_chunk_offsets.size());
+    for (auto branch_offset = ChunkOffset{0}; branch_offset < branch_row_count; ++branch_offset) {
+      const auto chunk_offset = branch_chunk_offsets[branch_offset];
+      values[chunk_offset] = branch_result->value(evaluate_subset ? branch_offset : chunk_offset);
+    }
+
+    if (branch_result->is_nullable()) {
+      if (!nullable) {
+        nulls.resize(row_count);
+        nullable = true;
+      }
+      for (auto branch_offset = ChunkOffset{0}; branch_offset < branch_row_count; ++branch_offset) {
+        const auto chunk_offset = branch_chunk_offsets[branch_offset];
+        nulls[chunk_offset] = branch_result->is_null(evaluate_subset ? branch_offset : chunk_offset);
+      }
+    }
+  };
+
+  scatter_branch(then_expression, then_chunk_offsets);
+  scatter_branch(else_expression, else_chunk_offsets);
 
   return std::make_shared<ExpressionResult<Result>>(std::move(values), std::move(nulls));
 }
 
+template <typename Result>
+std::shared_ptr<ExpressionResult<Result>> ExpressionEvaluator::_evaluate_case_branch(
+    const AbstractExpression& branch_expression) {
+  if (branch_expression.data_type() == data_type_from_type<Result>()) {
+    return evaluate_expression_to_result<Result>(branch_expression);
+  }
+
+  // The branch has a different data type than the CaseExpression (e.g., an int THEN and a float ELSE), or is NULL.
+  auto result = std::shared_ptr<ExpressionResult<Result>>{};
+  _resolve_to_expression_result(branch_expression, [&](const auto& branch_result) {
+    using BranchResultType = typename std::decay_t<decltype(branch_result)>::Type;
+
+    if constexpr (CaseEvaluator::supports_v<Result, BranchResultType, BranchResultType> ||
+                  std::is_same_v<BranchResultType, NullValue>) {
+      auto values = pmr_vector<Result>(branch_result.size());
+      for (auto branch_offset = size_t{0}; branch_offset < branch_result.size(); ++branch_offset) {
+        values[branch_offset] = to_value<Result>(branch_result.values[branch_offset]);
+      }
+      result = std::make_shared<ExpressionResult<Result>>(std::move(values), branch_result.nulls);
+    } else {
+      Fail("Illegal operands for CaseExpression");
+    }
+  });
+  return result;
+}
+
 template <typename Result>
 std::shared_ptr<ExpressionResult<Result>> ExpressionEvaluator::_evaluate_cast_expression(
     const CastExpression& cast_expression) {
@@ -1007,27 +1098,35 @@ std::shared_ptr<const Table> ExpressionEvaluator::_evaluate_subquery_expression_
 std::shared_ptr<BaseValueSegment> ExpressionEvaluator::evaluate_expression_to_segment(
     const AbstractExpression& expression) {
   std::shared_ptr<BaseValueSegment> segment;
-  pmr_vector<bool> nulls;
 
-  _resolve_to_expression_result_view(expression, [&](const auto& view) {
-    using ColumnDataType = typename std::decay_t<decltype(view)>::Type;
+  // The values and nulls are copied as a whole rather than row by row through an ExpressionResultView. The result
+  // itself cannot be moved into the segment because it might still be referenced by _cached_expression_results.
+  _resolve_to_expression_result(expression, [&](const auto& result) {
+    using ColumnDataType = typename std::decay_t<decltype(result)>::Type;
 
     if constexpr (std::is_same_v<ColumnDataType, NullValue>) {
       Fail("Can't create a Segment from a NULL");
     } else {
-      pmr_vector<ColumnDataType> values(_output_row_count);
-
-      for (auto chunk_offset = ChunkOffset{0}; chunk_offset < static_cast<ChunkOffset>(_output_row_count);
-           ++chunk_offset) {
-        values[chunk_offset] = std::move(view.value(chunk_offset));
+      const auto null_literal = result.nulls.size() == 1 && result.nulls.front();
+
+      if (result.is_literal() || null_literal) {
+        // Literals are broadcast to all rows of the chunk.
+        auto values = pmr_vector<ColumnDataType>(_output_row_count, result.values.front());
+        if (null_literal) {
+          segment = std::make_shared<ValueSegment<ColumnDataType>>(std::move(values),
+                                                                   pmr_vector<bool>(_output_row_count, true));
+        } else {
+          segment = std::make_shared<ValueSegment<ColumnDataType>>(std::move(values));
+        }
+        return;
       }
 
-      if (view.is_nullable()) {
-        nulls.resize(_output_row_count);
-        for (auto chunk_offset = ChunkOffset{0}; chunk_offset < static_cast<ChunkOffset>(_output_row_count);
-             ++chunk_offset) {
-          nulls[chunk_offset] = view.is_null(chunk_offset);
-        }
+      DebugAssert(result.values.size() == _output_row_count, "Expected one value per row");
+      auto values = pmr_vector<ColumnDataType>{result.values};
+
+      if (result.is_nullable()) {
+        auto nulls = result.nulls.size() == _output_row_count ? pmr_vector<bool>{result.nulls}
+                                                              : pmr_vector<bool>(_output_row_count, false);
         segment = std::make_shared<ValueSegment<ColumnDataType>>(std::move(values), std::move(nulls));
       } else {
         segment = std::make_shared<ValueSegment<ColumnDataType>>(std::move(values));
@@ -1409,6 +1508,13 @@ pmr_vector<bool> ExpressionEvaluator::_evaluate_default_null_logic(const pmr_vec
   return right;
 }
 
+boost::container::pmr::memory_resource& ExpressionEvaluator::_scratch_memory_resource() {
+  if (!_scratch_buffer) {
+    _scratch_buffer = std::make_unique<boost::container::pmr::monotonic_buffer_resource>();
+  }
+  return *_scratch_buffer;
+}
+
 void ExpressionEvaluator::_materialize_segment_if_not_yet_materialized(const ColumnID column_id) {
   Assert(_chunk, "Cannot access columns in this Expression as it doesn't operate on a Table/Chunk");
 
@@ -1416,6 +1522,36 @@ void ExpressionEvaluator::_materialize_segment_if_not_yet_materialized(const Col
     return;
   }
 
+  if (_parent_evaluator) {
+    // Gather the rows of this evaluator from the parent's materialization.
+    _parent_evaluator->_materialize_segment_if_not_yet_materialized(column_id);
+    resolve_data_type(_table->column_data_type(column_id), [&](const auto column_data_type_t) {
+      using ColumnDataType = typename decltype(column_data_type_t)::type;
+
+      const auto& parent_materialization = static_cast<const ExpressionResult<ColumnDataType>&>(
+          *_parent_evaluator->_segment_materializations[column_id]);
+      const auto& parent_chunk_offsets = *_parent_chunk_offsets;
+      const auto row_count = parent_chunk_offsets.size();
+
+      auto values = pmr_vector<ColumnDataType>(row_count);
+      for (auto chunk_offset = size_t{0}; chunk_offset < row_count; ++chunk_offset) {
+        values[chunk_offset] = parent_materialization.values[parent_chunk_offsets[chunk_offset]];
+      }
+
+      auto nulls = pmr_vector<bool>{};
+      if (parent_materialization.is_nullable()) {
+        nulls.resize(row_count);
+        for (auto chunk_offset = size_t{0}; chunk_offset < row_count; ++chunk_offset) {
+          nulls[chunk_offset] = parent_materialization.is_null(parent_chunk_offsets[chunk_offset]);
+        }
+      }
+
+      _segment_materializations[column_id] =
+          std::make_shared<ExpressionResult<ColumnDataType>>(std::move(values), std::move(nulls));
+    });
+    return;
+  }
+
   const auto& segment = *_chunk->get_segment(column_id);
 
   resolve_data_type(segment.data_type(), [&](const auto column_data_type_t) {
@@ -3,6 +3,7 @@
 #include <memory>
 #include <vector>
 
+#include <boost/container/pmr/monotonic_buffer_resource.hpp>
 #include <boost/variant.hpp>
 
 #include "all_type_variant.hpp"
@@ -83,6 +84,10 @@ class ExpressionEvaluator final {
       const std::vector<std::shared_ptr<PQPSubqueryExpression>>& expressions);
 
  private:
+  // Evaluates expressions for the rows of @param parent_evaluator at @param parent_chunk_offsets only, see
+  // _evaluate_case_expression(). Columns are materialized by the parent and gathered from there.
+  ExpressionEvaluator(ExpressionEvaluator& parent_evaluator, const pmr_vector<ChunkOffset>& parent_chunk_offsets);
+
   template <typename Result>
   std::shared_ptr<ExpressionResult<Result>> _evaluate_arithmetic_expression(const ArithmeticExpression& expression);
 
@@ -122,6 +127,10 @@ class ExpressionEvaluator final {
   template <typename Result>
   std::shared_ptr<ExpressionResult<Result>> _evaluate_case_expression(const CaseExpression& case_expression);
 
+  // Evaluates the THEN or ELSE branch of a CaseExpression and converts it to the CaseExpression's data type.
+  template <typename Result>
+  std::shared_ptr<ExpressionResult<Result>> _evaluate_case_branch(const AbstractExpression& branch_expression);
+
   template <typename Result>
   std::shared_ptr<ExpressionResult<Result>> _evaluate_cast_expression(const CastExpression& cast_expression);
 
@@ -186,6 +195,14 @@ class ExpressionEvaluator final {
 
   void _materialize_segment_if_not_yet_materialized(const ColumnID column_id);
 
+  /**
+   * Memory resource for short-lived buffers (e.g., the rows that take a branch of a CaseExpression) that are only
+   * needed while a single expression is evaluated. It is never used for the values or nulls of an ExpressionResult, as
+   * those are cached and may outlive the evaluation. The resource is released whenever the outermost call of
+   * evaluate_expression_to_result() returns.
+   */
+  boost::container::pmr::memory_resource& _scratch_memory_resource();
+
   std::shared_ptr<ExpressionResult<pmr_string>> _evaluate_substring(
       const std::vector<std::shared_ptr<AbstractExpression>>& arguments);
   std::shared_ptr<ExpressionResult<pmr_string>> _evaluate_concatenate(
@@ -210,6 +227,16 @@ class ExpressionEvaluator final {
   // Some expressions can be reused, either in the same result column (SELECT (a+3)*(a+3)), or across columns
   // (TPC-H Q1)
   ConstExpressionUnorderedMap<std::shared_ptr<BaseExpressionResult>> _cached_expression_results;
+
+  // Lazily created, see _scratch_memory_resource()
+  std::unique_ptr<boost::container::pmr::monotonic_buffer_resource> _scratch_buffer;
+
+  // Number of nested evaluate_expression_to_result() calls, used to release the _scratch_buffer.
+  size_t _evaluation_depth{0};
+
+  // Set if this evaluator only evaluates a subset of the rows of another evaluator.
+  ExpressionEvaluator* const _parent_evaluator{nullptr};
+  const pmr_vector<ChunkOffset>* const _parent_chunk_offsets{nullptr};
 };
 
 }  // namespace hyrise
@@ -1,18 +1,209 @@
 #include "like_matcher.hpp"
 
+#include <algorithm>
+#include <cstring>
 #include <optional>
+#include <string_view>
 #include <utility>
 
-#include <boost/algorithm/string/replace.hpp>
+#ifdef __SSE2__
+#include <emmintrin.h>
+#endif
 
 #include "utils/assert.hpp"
 
+namespace {
+
+using namespace hyrise;  // NOLINT
+
+// Checks whether the pattern segment, in which '_' matches any character, matches `string` at `position`.
+bool segment_matches_at(const pmr_string& segment, const std::string_view string, const size_t position) {
+  if (position + segment.size() > string.size()) {
+    return false;
+  }
+
+  const auto segment_size = segment.size();
+  for (auto index = size_t{0}; index < segment_size; ++index) {
+    if (segment[index] != '_' && segment[index] != string[position + index]) {
+      return false;
+    }
+  }
+  return true;
+}
+
+// Returns the first position at or after `offset` at which the segment matches, or std::string_view::npos.
+size_t find_segment(const LikeMatcher::GeneralPattern::Segment& segment, const std::string_view string,
+                    const size_t offset) {
+  const auto& anchor = segment.anchor.needle();
+  if (anchor.empty()) {
+    // The segment consists of '_' only.
+    return offset + segment.string.size() <= string.size() ? offset : std::string_view::npos;
+  }
+
+  auto anchor_position = offset + segment.anchor_offset;
+  while (true) {
+    anchor_position = segment.anchor.find(string, anchor_position);
+    if (anchor_position == std::string_view::npos) {
+      return std::string_view::npos;
+    }
+
+    const auto segment_position = anchor_position - segment.anchor_offset;
+    if (segment_position + segment.string.size() > string.size()) {
+      return std::string_view::npos;
+    }
+
+    if (segment_matches_at(segment.string, string, segment_position)) {
+      return segment_position;
+    }
+    ++anchor_position;
+  }
+}
+
+}  // namespace
+
 namespace hyrise {
 
-LikeMatcher::LikeMatcher(const pmr_string& pattern) {
-  _pattern_variant = pattern_string_to_pattern_variant(pattern);
+LikeMatcher::SubstringSearcher::SubstringSearcher(const std::string_view needle) : _needle{needle} {}
+
+size_t LikeMatcher::SubstringSearcher::find(const std::string_view haystack, const size_t offset) const {
+  const auto needle_size = _needle.size();
+  if (offset > haystack.size() || needle_size > haystack.size() - offset) {
+    return std::string_view::npos;
+  }
+
+  if (needle_size == 0) {
+    return offset;
+  }
+
+  const auto* const data = haystack.data();
+  const auto* const needle = _needle.data();
+  const auto last_candidate = haystack.size() - needle_size;
+  auto position = offset;
+
+#ifdef __SSE2__
+  // Compare the first and the last character of the needle with 16 candidate positions at once. Only for the
+  // positions where both match, the characters in between are compared.
+  constexpr auto BLOCK_SIZE = size_t{16};
+  const auto first_character = _mm_set1_epi8(needle[0]);
+  const auto last_character = _mm_set1_epi8(needle[needle_size - 1]);
+
+  while (position + BLOCK_SIZE <= last_candidate + 1) {
+    const auto block_first = _mm_loadu_si128(reinterpret_cast<const __m128i*>(data + position));
+    const auto block_last = _mm_loadu_si128(reinterpret_cast<const __m128i*>(data + position + needle_size - 1));
+    const auto equal = _mm_and_si128(_mm_cmpeq_epi8(first_character, block_first),
+                                     _mm_cmpeq_epi8(last_character, block_last));
+    auto mask = static_cast<uint32_t>(_mm_movemask_epi8(equal));
+
+    while (mask != 0) {
+      const auto candidate = position + static_cast<size_t>(__builtin_ctz(mask));
+      if (needle_size <= 2 || std::memcmp(data + candidate + 1, needle + 1, needle_size - 2) == 0) {
+        return candidate;
+      }
+      mask &= mask - 1;
+    }
+
+    position += BLOCK_SIZE;
+  }
+#endif
+
+  // Remaining candidates (or all of them if SSE2 is not available)
+  while (position <= last_candidate) {
+    const auto* const match =
+        static_cast<const char*>(std::memchr(data + position, needle[0], last_candidate - position + 1));
+    if (!match) {
+      return std::string_view::npos;
+    }
+
+    position = static_cast<size_t>(match - data);
+    if (std::memcmp(data + position + 1, needle + 1, needle_size - 1) == 0) {
+      return position;
+    }
+    ++position;
+  }
+
+  return std::string_view::npos;
 }
 
+const pmr_string& LikeMatcher::SubstringSearcher::needle() const {
+  return _needle;
+}
+
+LikeMatcher::GeneralPattern::Segment::Segment(const pmr_string& init_string)
+    : string{init_string}, anchor{std::string_view{}} {
+  // Find the longest run of characters without '_'.
+  auto longest_run_offset = size_t{0};
+  auto longest_run_size = size_t{0};
+  auto run_offset = size_t{0};
+  while (run_offset < string.size()) {
+    auto run_end = string.find('_', run_offset);
+    if (run_end == pmr_string::npos) {
+      run_end = string.size();
+    }
+
+    if (run_end - run_offset > longest_run_size) {
+      longest_run_offset = run_offset;
+      longest_run_size = run_end - run_offset;
+    }
+    run_offset = run_end + 1;
+  }
+
+  anchor = SubstringSearcher{std::string_view{string}.substr(longest_run_offset, longest_run_size)};
+  anchor_offset = longest_run_offset;
+}
+
+LikeMatcher::GeneralPattern::GeneralPattern(const pmr_string& pattern) {
+  auto segments = std::vector<pmr_string>{};
+  auto segment_begin = size_t{0};
+  while (true) {
+    const auto segment_end = pattern.find('%', segment_begin);
+    segments.emplace_back(pattern.substr(segment_begin, segment_end - segment_begin));
+    if (segment_end == pmr_string::npos) {
+      break;
+    }
+    segment_begin = segment_end + 1;
+  }
+
+  prefix = segments.front();
+  if (segments.size() == 1) {
+    return;
+  }
+
+  contains_any_chars = true;
+  suffix = segments.back();
+  for (auto segment_idx = size_t{1}; segment_idx < segments.size() - 1; ++segment_idx) {
+    // Consecutive '%' lead to empty segments, which always match.
+    if (!segments[segment_idx].empty()) {
+      infixes.emplace_back(segments[segment_idx]);
+    }
+  }
+}
+
+bool LikeMatcher::GeneralPattern::matches(const std::string_view string) const {
+  if (!contains_any_chars) {
+    return string.size() == prefix.size() && segment_matches_at(prefix, string, 0);
+  }
+
+  if (string.size() < prefix.size() + suffix.size() || !segment_matches_at(prefix, string, 0) ||
+      !segment_matches_at(suffix, string, string.size() - suffix.size())) {
+    return false;
+  }
+
+  // The infixes must not overlap with the prefix and suffix.
+  const auto infix_area = string.substr(0, string.size() - suffix.size());
+  auto position = prefix.size();
+  for (const auto& infix : infixes) {
+    position = find_segment(infix, infix_area, position);
+    if (position == std::string_view::npos) {
+      return false;
+    }
+    position += infix.string.size();
+  }
+
+  return true;
+}
+
+LikeMatcher::LikeMatcher(const pmr_string& pattern) : _pattern_variant{pattern_string_to_pattern_variant(pattern)} {}
+
 size_t LikeMatcher::get_index_of_next_wildcard(const pmr_string& pattern, const size_t offset) {
   return pattern.find_first_of("_%", offset);
 }
@@ -87,20 +278,20 @@ LikeMatcher::AllPatternVariant LikeMatcher::pattern_string_to_pattern_variant(co
   if (tokens.size() == 3 && tokens[0] == PatternToken{Wildcard::AnyChars} &&
       std::holds_alternative<pmr_string>(tokens[1]) && tokens[2] == PatternToken{Wildcard::AnyChars}) {
     // Pattern has the form '%hello%'
-    return ContainsPattern{std::get<pmr_string>(tokens[1])};
+    return ContainsPattern{SubstringSearcher{std::get<pmr_string>(tokens[1])}};
   }
 
   /**
    * Pattern is either MultipleContainsPattern, e.g., '%hello%world%how%are%you%' or we fall back to
-   * using a regex matcher.
+   * the GeneralPattern.
    *
    * A MultipleContainsPattern begins and ends with '%' and  contains only strings and '%'.
    */
 
-  // Pick ContainsMultiple or Regex
-  auto pattern_is_contains_multiple = true;  // Set to false if tokens don't match %(, string, %)* pattern
-  auto strings = std::vector<pmr_string>{};  // arguments used for ContainsMultiple, if it gets used
-  auto expect_any_chars = true;              // If true, expect '%', if false, expect a string
+  // Pick ContainsMultiple or GeneralPattern
+  auto pattern_is_contains_multiple = true;           // Set to false if tokens don't match %(, string, %)* pattern
+  auto searchers = std::vector<SubstringSearcher>{};  // arguments used for ContainsMultiple, if it gets used
+  auto expect_any_chars = true;                       // If true, expect '%', if false, expect a string
 
   // Check if the tokens match the layout expected for MultipleContainsPattern - or break and set
   // pattern_is_contains_multiple to false once they don't
@@ -114,42 +305,18 @@ LikeMatcher::AllPatternVariant LikeMatcher::pattern_string_to_pattern_variant(co
       break;
     }
     if (!expect_any_chars) {
-      strings.emplace_back(std::get<pmr_string>(token));
+      searchers.emplace_back(std::get<pmr_string>(token));
     }
 
     expect_any_chars = !expect_any_chars;
   }
 
-  if (pattern_is_contains_multiple) {
-    return MultipleContainsPattern{strings};
+  // The pattern has to end with '%' as well, i.e., the last token was a '%' and a string is expected next.
+  if (pattern_is_contains_multiple && !expect_any_chars) {
+    return MultipleContainsPattern{std::move(searchers)};
   }
 
-  return std::regex(sql_like_to_regex(pattern));
-}
-
-std::string LikeMatcher::sql_like_to_regex(pmr_string sql_like) {
-  // Do substitution of <backslash> with <backslash><backslash> FIRST, because otherwise it will also replace
-  // backslashes introduced by the other substitutions
-  constexpr auto REPLACE_BY = std::array<std::pair<const char*, const char*>, 14u>{{{"\\", "\\\\"},
-                                                                                    {".", "\\."},
-                                                                                    {"^", "\\^"},
-                                                                                    {"$", "\\$"},
-                                                                                    {"+", "\\+"},
-                                                                                    {"?", "\\?"},
-                                                                                    {"(", "\\("},
-                                                                                    {")", "\\)"},
-                                                                                    {"{", "\\{"},
-                                                                                    {"}", "\\}"},
-                                                                                    {"|", "\\|"},
-                                                                                    {"*", "\\*"},
-                                                                                    {"%", ".*"},
-                                                                                    {"_", "."}}};
-
-  for (const auto& pair : REPLACE_BY) {
-    boost::replace_all(sql_like, pair.first, pair.second);
-  }
-
-  return std::string{"^" + sql_like + "$"};
+  return GeneralPattern{pattern};
 }
 
 std::ostream& operator<<(std::ostream& stream, const LikeMatcher::Wildcard& wildcard) {
@@ -1,9 +1,8 @@
 #pragma once
 
-#include <experimental/functional>
 #include <optional>
-#include <regex>
 #include <string>
+#include <string_view>
 #include <utility>
 #include <variant>
 #include <vector>
@@ -20,18 +19,26 @@ namespace hyrise {
  * check.
  */
 class LikeMatcher {
-  // A faster search algorithm than the typical byte-wise search if we can reuse the searcher
-#ifdef __GLIBCXX__
-  using Searcher = std::boyer_moore_searcher<pmr_string::const_iterator>;
-#else
-  using Searcher = std::experimental::boyer_moore_searcher<pmr_string::const_iterator>;
-#endif
-
  public:
   /**
-   * Turn SQL LIKE-pattern into a C++ regex.
+   * Finds occurrences of a fixed string. On x86, the search compares 16 candidate positions at once: it looks for
+   * positions where both the first and the last character of the needle match (using SSE2) and compares the remaining
+   * characters only for these candidates. Unlike std::boyer_moore_searcher, the searcher owns a copy of the needle, so
+   * it can be stored in the pattern and does not have to be rebuilt for each resolve() call.
    */
-  static std::string sql_like_to_regex(pmr_string sql_like);
+  class SubstringSearcher {
+   public:
+    explicit SubstringSearcher(const std::string_view needle);
+
+    // Returns the position of the first occurrence of the needle in `haystack` that starts at or after `offset`, or
+    // std::string_view::npos.
+    size_t find(const std::string_view haystack, const size_t offset = 0) const;
+
+    const pmr_string& needle() const;
+
+   private:
+    pmr_string _needle;
+  };
 
   static size_t get_index_of_next_wildcard(const pmr_string& pattern, const size_t offset = 0);
   static bool contains_wildcard(const pmr_string& pattern);
@@ -59,7 +66,7 @@ class LikeMatcher {
 
   /**
    * To speed up LIKE there are special implementations available for simple, common patterns.
-   * Any other pattern will fall back to regex.
+   * Any other pattern is handled by the GeneralPattern.
    */
   // 'hello%'
   struct StartsWithPattern final {
@@ -73,20 +80,50 @@ class LikeMatcher {
 
   // '%hello%'
   struct ContainsPattern final {
-    pmr_string string;
+    SubstringSearcher searcher;
   };
 
   // '%hello%world%nice%weather%'
   struct MultipleContainsPattern final {
-    std::vector<pmr_string> strings;
+    std::vector<SubstringSearcher> searchers;
   };
 
   /**
-   * Contains one of the specialised patterns from above (StartsWithPattern, ...) or falls back to std::regex for a
-   * general pattern.
+   * Any other pattern, e.g., 'H_llo%W%ld' or 'a%b'. The pattern is split at each '%' into segments that consist of
+   * characters and '_'. The first segment has to match at the beginning of the string, the last one at its end. The
+   * segments in between are matched from left to right, each at the first position after the previous one. Taking the
+   * leftmost position never prevents a match of the following segments, so no backtracking is needed. To find the
+   * candidate positions of a segment, we search for its longest run of characters without '_' (its anchor) using a
+   * SubstringSearcher.
+   */
+  struct GeneralPattern final {
+    struct Segment {
+      explicit Segment(const pmr_string& init_string);
+
+      // The segment's characters, where '_' matches any single character
+      pmr_string string;
+
+      // The longest substring of `string` without '_' and its position in `string`
+      SubstringSearcher anchor;
+      size_t anchor_offset{0};
+    };
+
+    explicit GeneralPattern(const pmr_string& pattern);
+
+    bool matches(const std::string_view string) const;
+
+    // If the pattern does not contain '%', `prefix` holds the entire pattern and `suffix` and `infixes` are empty.
+    bool contains_any_chars{false};
+    pmr_string prefix;
+    std::vector<Segment> infixes;
+    pmr_string suffix;
+  };
+
+  /**
+   * Contains one of the specialised patterns from above (StartsWithPattern, ...) or the GeneralPattern.
    */
   using AllPatternVariant =
-      std::variant<std::regex, StartsWithPattern, EndsWithPattern, ContainsPattern, MultipleContainsPattern>;
+      std::variant<GeneralPattern, StartsWithPattern, EndsWithPattern, ContainsPattern, MultipleContainsPattern>;
 
   static AllPatternVariant pattern_string_to_pattern_variant(const pmr_string& pattern);
 
@@ -118,39 +155,31 @@ class LikeMatcher {
       });
 
     } else if (std::holds_alternative<ContainsPattern>(_pattern_variant)) {
-      const auto& contains_str = std::get<ContainsPattern>(_pattern_variant).string;
-      // It's really hard to store the searcher in the pattern as it only holds iterators into the string that easily
-      // get invalidated when the pattern is passed around.
-      const auto searcher = Searcher{contains_str.begin(), contains_str.end()};
+      const auto& searcher = std::get<ContainsPattern>(_pattern_variant).searcher;
       functor([&](const auto& string) -> bool {
-        return (std::search(string.begin(), string.end(), searcher) != string.end()) ^ invert_results;
+        return (searcher.find(std::string_view{string.data(), string.size()}) != std::string_view::npos) ^
+               invert_results;
       });
 
     } else if (std::holds_alternative<MultipleContainsPattern>(_pattern_variant)) {
-      const auto& contains_strs = std::get<MultipleContainsPattern>(_pattern_variant).strings;
-      std::vector<Searcher> searchers;
-      searchers.reserve(contains_strs.size());
-      for (const auto& contains_str : contains_strs) {
-        searchers.emplace_back(Searcher(contains_str.begin(), contains_str.end()));
-      }
-
+      const auto& searchers = std::get<MultipleContainsPattern>(_pattern_variant).searchers;
       functor([&](const auto& string) -> bool {
-        auto current_position = string.begin();
-        for (auto searcher_idx = size_t{0}; searcher_idx < searchers.size(); ++searcher_idx) {
-          current_position = std::search(current_position, string.end(), searchers[searcher_idx]);
-          if (current_position == string.end()) {
+        const auto string_view = std::string_view{string.data(), string.size()};
+        auto current_position = size_t{0};
+        for (const auto& searcher : searchers) {
+          current_position = searcher.find(string_view, current_position);
+          if (current_position == std::string_view::npos) {
             return invert_results;
           }
-          current_position += contains_strs[searcher_idx].size();
+          current_position += searcher.needle().size();
         }
         return !invert_results;
       });
 
-    } else if (std::holds_alternative<std::regex>(_pattern_variant)) {
-      const auto& regex = std::get<std::regex>(_pattern_variant);
-
+    } else if (std::holds_alternative<GeneralPattern>(_pattern_variant)) {
+      const auto& general_pattern = std::get<GeneralPattern>(_pattern_variant);
       functor([&](const auto& string) -> bool {
-        return std::regex_match(string.cbegin(), string.cend(), regex) ^ invert_results;
+        return general_pattern.matches(std::string_view{string.data(), string.size()}) ^ invert_results;
       });
 
     } else {
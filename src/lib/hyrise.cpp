@@ -1,5 +1,8 @@
 #include "hyrise.hpp"
 
+#include "operators/table_scan/predicate_compiler.hpp"
+#include "statistics/statistics_refresher.hpp"
+
 namespace hyrise {
 
 Hyrise::Hyrise() {
@@ -20,10 +23,14 @@ Hyrise::Hyrise() {
   settings_manager = SettingsManager{};
   log_manager = LogManager{};
   topology = Topology{};
+  predicate_compiler = std::make_shared<PredicateCompiler>();
   _scheduler = std::make_shared<ImmediateExecutionScheduler>();
 }
 
 void Hyrise::reset() {
+  // The StatisticsRefresher accesses the StorageManager from its own thread. Stop it before the StorageManager is
+  // reset.
+  Hyrise::get().statistics_refresher = nullptr;
   Hyrise::get().scheduler()->finish();
   get() = Hyrise{};
 }
@@ -17,6 +17,11 @@ namespace hyrise {
 
 class AbstractScheduler;
 class BenchmarkRunner;
+class CardinalityFeedback;
+struct CostModelCoefficients;
+class PredicateCompiler;
+class SQLResultCache;
+class StatisticsRefresher;
 
 // This should be the only singleton in the src/lib world. It provides a unified way of accessing components like the
 // storage manager, the transaction manager, and more. Encapsulating this in one class avoids the static initialization
@@ -53,6 +58,33 @@ class Hyrise : public Singleton<Hyrise> {
   std::shared_ptr<SQLPhysicalPlanCache> default_pqp_cache;
   std::shared_ptr<SQLLogicalPlanCache> default_lqp_cache;
 
+  // Cache for the plans of prepared statements that the server shares between sessions. Can be nullptr.
+  std::shared_ptr<SQLPreparedPlanCache> default_prepared_plan_cache;
+
+  // Cache for the plans of automatically parameterized statements (see ParameterizedPlan) used by the
+  // SQLPipelineBuilder if `with_parameterized_plan_cache()` is not used. Can be nullptr.
+  std::shared_ptr<SQLParameterizedPlanCache> default_parameterized_plan_cache;
+
+  // Cache for the results of joins and aggregates (see SQLResultCache) used by the SQLPipelineBuilder if
+  // `with_result_cache()` is not used. Can be nullptr.
+  std::shared_ptr<SQLResultCache> default_result_cache;
+
+  // Cardinalities observed during the execution of operators that the CardinalityEstimator prefers over its estimations
+  // (see CardinalityFeedback). Can be nullptr.
+  std::shared_ptr<CardinalityFeedback> cardinality_feedback;
+
+  // Coefficients of the calibrated cost model (see CostEstimatorCalibrated), e.g., loaded from the output of
+  // hyriseCostModelCalibration. If set, the default optimizer and the LQPTranslator use the calibrated cost model.
+  // Can be nullptr.
+  std::shared_ptr<const CostModelCoefficients> cost_model_coefficients;
+
+  // Refreshes the statistics of stored tables in the background after inserts (see StatisticsRefresher). Can be
+  // nullptr.
+  std::shared_ptr<StatisticsRefresher> statistics_refresher;
+
+  // Compiles complex TableScan predicates if enabled, see operators/table_scan/predicate_compiler.hpp. Never nullptr.
+  std::shared_ptr<PredicateCompiler> predicate_compiler;
+
   // The BenchmarkRunner is available here so that non-benchmark components can add information to the benchmark
   // result JSON.
   std::weak_ptr<BenchmarkRunner> benchmark_runner;
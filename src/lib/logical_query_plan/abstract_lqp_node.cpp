@@ -26,6 +26,53 @@ using namespace hyrise;  // NOLINT
 
 void collect_lqps_in_plan(const AbstractLQPNode& lqp, std::unordered_set<std::shared_ptr<AbstractLQPNode>>& lqps);
 
+/**
+ * Unique constraints and FDs derived while the outermost derivation is running, see
+ * AbstractLQPNode::unique_constraints(). Thread-local, as LQPs might be optimized in parallel (see
+ * AbstractRule::apply_to_plan()).
+ */
+struct DerivedPropertyMemo {
+  size_t scope_depth{0};
+  std::unordered_map<const AbstractLQPNode*, std::shared_ptr<LQPUniqueConstraints>> unique_constraints;
+  std::unordered_map<const AbstractLQPNode*, std::vector<FunctionalDependency>> functional_dependencies;
+  std::unordered_map<const AbstractLQPNode*, std::vector<FunctionalDependency>> non_trivial_functional_dependencies;
+};
+
+thread_local auto derived_property_memo = DerivedPropertyMemo{};
+
+// Clears the memo when the outermost derivation returns (or throws).
+class DerivedPropertyMemoScope : private Noncopyable {
+ public:
+  DerivedPropertyMemoScope() {
+    ++derived_property_memo.scope_depth;
+  }
+
+  ~DerivedPropertyMemoScope() {
+    if (--derived_property_memo.scope_depth > 0) {
+      return;
+    }
+
+    derived_property_memo.unique_constraints.clear();
+    derived_property_memo.functional_dependencies.clear();
+    derived_property_memo.non_trivial_functional_dependencies.clear();
+  }
+};
+
+template <typename Property, typename Functor>
+Property memoize_derived_property(std::unordered_map<const AbstractLQPNode*, Property>& memoized_properties,
+                                  const AbstractLQPNode& node, const Functor& derive_property) {
+  const auto scope = DerivedPropertyMemoScope{};
+
+  const auto memoized_property_iter = memoized_properties.find(&node);
+  if (memoized_property_iter != memoized_properties.end()) {
+    return memoized_property_iter->second;
+  }
+
+  auto property = derive_property();
+  memoized_properties.emplace(&node, property);
+  return property;
+}
+
 /**
  * Utility for operator<<(std::ostream, AbstractLQPNode)
  * Put all LQPs found in an @param expression into @param lqps
@@ -301,46 +348,59 @@ bool AbstractLQPNode::has_matching_unique_constraint(const ExpressionUnorderedSe
   return contains_matching_unique_constraint(unique_constraints, expressions);
 }
 
+std::shared_ptr<LQPUniqueConstraints> AbstractLQPNode::unique_constraints() const {
+  return memoize_derived_property(derived_property_memo.unique_constraints, *this,
+                                  [&]() { return _on_unique_constraints(); });
+}
+
 std::vector<FunctionalDependency> AbstractLQPNode::functional_dependencies() const {
-  // (1) Gather non-trivial FDs and perform sanity checks
-  auto non_trivial_fds = non_trivial_functional_dependencies();
-  if constexpr (HYRISE_DEBUG) {
-    auto fds_set = std::unordered_set<FunctionalDependency>{};
-    const auto& output_expressions = this->output_expressions();
-    const auto& output_expressions_set = ExpressionUnorderedSet{output_expressions.cbegin(), output_expressions.cend()};
-
-    for (const auto& fd : non_trivial_fds) {
-      auto [_, inserted] = fds_set.insert(fd);
-      Assert(inserted, "FDs with the same set of determinant expressions should be merged.");
-
-      for (const auto& fd_determinant_expression : fd.determinants) {
-        Assert(output_expressions_set.contains(fd_determinant_expression),
-               "Expected FD's determinant expressions to be a subset of the node's output expressions.");
-        Assert(!is_column_nullable(get_column_id(*fd_determinant_expression)),
-               "Expected FD's determinant expressions to be non-nullable.");
+  return memoize_derived_property(derived_property_memo.functional_dependencies, *this, [&]() {
+    // (1) Gather non-trivial FDs and perform sanity checks
+    auto non_trivial_fds = non_trivial_functional_dependencies();
+    if constexpr (HYRISE_DEBUG) {
+      auto fds_set = std::unordered_set<FunctionalDependency>{};
+      const auto& output_expressions = this->output_expressions();
+      const auto& output_expressions_set =
+          ExpressionUnorderedSet{output_expressions.cbegin(), output_expressions.cend()};
+
+      for (const auto& fd : non_trivial_fds) {
+        auto [_, inserted] = fds_set.insert(fd);
+        Assert(inserted, "FDs with the same set of determinant expressions should be merged.");
+
+        for (const auto& fd_determinant_expression : fd.determinants) {
+          Assert(output_expressions_set.contains(fd_determinant_expression),
+                 "Expected FD's determinant expressions to be a subset of the node's output expressions.");
+          Assert(!is_column_nullable(get_column_id(*fd_determinant_expression)),
+                 "Expected FD's determinant expressions to be non-nullable.");
+        }
+        Assert(std::all_of(fd.dependents.cbegin(), fd.dependents.cend(),
+                           [&output_expressions_set](const auto& fd_dependent_expression) {
+                             return output_expressions_set.contains(fd_dependent_expression);
+                           }),
+               "Expected the FD's dependent expressions to be a subset of the node's output expressions.");
       }
-      Assert(std::all_of(fd.dependents.cbegin(), fd.dependents.cend(),
-                         [&output_expressions_set](const auto& fd_dependent_expression) {
-                           return output_expressions_set.contains(fd_dependent_expression);
-                         }),
-             "Expected the FD's dependent expressions to be a subset of the node's output expressions.");
     }
-  }
 
-  // (2) Derive trivial FDs from the node's unique constraints
-  const auto& unique_constraints = this->unique_constraints();
-  // Early exit, if there are no unique constraints
-  if (unique_constraints->empty()) {
-    return non_trivial_fds;
-  }
+    // (2) Derive trivial FDs from the node's unique constraints
+    const auto& unique_constraints = this->unique_constraints();
+    // Early exit, if there are no unique constraints
+    if (unique_constraints->empty()) {
+      return non_trivial_fds;
+    }
 
-  auto trivial_fds = fds_from_unique_constraints(shared_from_this(), unique_constraints);
+    auto trivial_fds = fds_from_unique_constraints(shared_from_this(), unique_constraints);
 
-  // (3) Merge and return FDs
-  return union_fds(non_trivial_fds, trivial_fds);
+    // (3) Merge and return FDs
+    return union_fds(non_trivial_fds, trivial_fds);
+  });
 }
 
 std::vector<FunctionalDependency> AbstractLQPNode::non_trivial_functional_dependencies() const {
+  return memoize_derived_property(derived_property_memo.non_trivial_functional_dependencies, *this,
+                                  [&]() { return _on_non_trivial_functional_dependencies(); });
+}
+
+std::vector<FunctionalDependency> AbstractLQPNode::_on_non_trivial_functional_dependencies() const {
   if (left_input()) {
     Assert(!right_input(), "Expected single input node for implicit FD forwarding. Please override this function.");
     return left_input()->non_trivial_functional_dependencies();
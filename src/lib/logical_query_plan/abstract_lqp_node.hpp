@@ -181,8 +181,14 @@ class AbstractLQPNode : public std::enable_shared_from_this<AbstractLQPNode> {
 
   /**
    * @return Unique constraints valid for the current LQP. See lqp_unique_constraint.hpp for more documentation.
+   *
+   * Unique constraints and FDs are derived recursively from the input nodes, often multiple times for the same node
+   * (e.g., JoinNodes request both the unique constraints and the FDs of their inputs). Thus, the results of all nodes
+   * are memoized until the outermost call of unique_constraints(), functional_dependencies(), or
+   * non_trivial_functional_dependencies() returns. They are not kept any longer since rules modify LQPs (including
+   * node_expressions) in many ways that we could not track to invalidate them.
    */
-  virtual std::shared_ptr<LQPUniqueConstraints> unique_constraints() const = 0;
+  std::shared_ptr<LQPUniqueConstraints> unique_constraints() const;
 
   /**
    * @return True, if there is a unique constraint matching the given subset of output expressions.
@@ -201,18 +207,11 @@ class AbstractLQPNode : public std::enable_shared_from_this<AbstractLQPNode> {
   std::vector<FunctionalDependency> functional_dependencies() const;
 
   /**
-   * This is a helper method that returns non-trivial FDs valid for the current node.
-   * We consider FDs as non-trivial if we cannot derive them from the current node's unique constraints.
-   *
-   * @return The default implementation returns non-trivial FDs from the left input node, if available. Otherwise
-   * an empty vector.
-   *
-   * Nodes should override this function
-   *  - to add additional non-trivial FDs. For example, {a} -> {a + 1} (which is not yet implemented).
-   *  - to discard non-trivial FDs from the input nodes, if necessary.
-   *  - to specify forwarding of non-trivial FDs in case of two input nodes.
+   * This is a helper method that returns non-trivial FDs valid for the current node (memoized like
+   * unique_constraints()). We consider FDs as non-trivial if we cannot derive them from the current node's unique
+   * constraints.
    */
-  virtual std::vector<FunctionalDependency> non_trivial_functional_dependencies() const;
+  std::vector<FunctionalDependency> non_trivial_functional_dependencies() const;
 
   /**
    * Perform a deep equality check
@@ -254,6 +253,20 @@ class AbstractLQPNode : public std::enable_shared_from_this<AbstractLQPNode> {
   virtual std::shared_ptr<AbstractLQPNode> _on_shallow_copy(LQPNodeMapping& node_mapping) const = 0;
   virtual bool _on_shallow_equals(const AbstractLQPNode& rhs, const LQPNodeMapping& node_mapping) const = 0;
 
+  // Derives the unique constraints of this node, see unique_constraints().
+  virtual std::shared_ptr<LQPUniqueConstraints> _on_unique_constraints() const = 0;
+
+  /**
+   * @return The default implementation returns non-trivial FDs from the left input node, if available. Otherwise
+   * an empty vector.
+   *
+   * Nodes should override this function
+   *  - to add additional non-trivial FDs. For example, {a} -> {a + 1} (which is not yet implemented).
+   *  - to discard non-trivial FDs from the input nodes, if necessary.
+   *  - to specify forwarding of non-trivial FDs in case of two input nodes.
+   */
+  virtual std::vector<FunctionalDependency> _on_non_trivial_functional_dependencies() const;
+
   /**
    * This is a helper method for node types that do not have an effect on the unique constraints from input nodes.
    * @return All unique constraints from the left input node.
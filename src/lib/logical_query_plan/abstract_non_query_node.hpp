@@ -14,9 +14,11 @@ class AbstractNonQueryNode : public AbstractLQPNode {
   using AbstractLQPNode::AbstractLQPNode;
 
   std::vector<std::shared_ptr<AbstractExpression>> output_expressions() const override;
-  std::shared_ptr<LQPUniqueConstraints> unique_constraints() const override;
-  std::vector<FunctionalDependency> non_trivial_functional_dependencies() const override;
   bool is_column_nullable(const ColumnID column_id) const override;
+
+ protected:
+  std::shared_ptr<LQPUniqueConstraints> _on_unique_constraints() const override;
+  std::vector<FunctionalDependency> _on_non_trivial_functional_dependencies() const override;
 };
 
 }  // namespace hyrise
@@ -94,7 +94,7 @@ bool AggregateNode::is_column_nullable(const ColumnID column_id) const {
   return node_expressions[column_id]->is_nullable_on_lqp(*left_input());
 }
 
-std::shared_ptr<LQPUniqueConstraints> AggregateNode::unique_constraints() const {
+std::shared_ptr<LQPUniqueConstraints> AggregateNode::_on_unique_constraints() const {
   auto unique_constraints = std::make_shared<LQPUniqueConstraints>();
 
   /**
@@ -160,7 +160,7 @@ std::shared_ptr<LQPUniqueConstraints> AggregateNode::unique_constraints() const
   return unique_constraints;
 }
 
-std::vector<FunctionalDependency> AggregateNode::non_trivial_functional_dependencies() const {
+std::vector<FunctionalDependency> AggregateNode::_on_non_trivial_functional_dependencies() const {
   auto non_trivial_fds = left_input()->non_trivial_functional_dependencies();
 
   // In AggregateNode, some expressions get wrapped inside of AggregateExpressions. Therefore, we have to discard
@@ -36,7 +36,7 @@ std::vector<std::shared_ptr<AbstractExpression>> AliasNode::output_expressions()
   return node_expressions;
 }
 
-std::shared_ptr<LQPUniqueConstraints> AliasNode::unique_constraints() const {
+std::shared_ptr<LQPUniqueConstraints> AliasNode::_on_unique_constraints() const {
   return _forward_left_unique_constraints();
 }
 
@@ -19,12 +19,12 @@ class AliasNode : public EnableMakeForLQPNode<AliasNode>, public AbstractLQPNode
   std::string description(const DescriptionMode mode = DescriptionMode::Short) const override;
   std::vector<std::shared_ptr<AbstractExpression>> output_expressions() const override;
 
-  // Forwards unique constraints from the left input node
-  std::shared_ptr<LQPUniqueConstraints> unique_constraints() const override;
-
   const std::vector<std::string> aliases;
 
  protected:
+  // Forwards unique constraints from the left input node
+  std::shared_ptr<LQPUniqueConstraints> _on_unique_constraints() const override;
+
   size_t _on_shallow_hash() const override;
   std::shared_ptr<AbstractLQPNode> _on_shallow_copy(LQPNodeMapping& node_mapping) const override;
   bool _on_shallow_equals(const AbstractLQPNode& rhs, const LQPNodeMapping& node_mapping) const override;
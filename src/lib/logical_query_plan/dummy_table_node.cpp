@@ -24,7 +24,7 @@ bool DummyTableNode::is_column_nullable(const ColumnID column_id) const {
   Fail("DummyTable does not output any columns");
 }
 
-std::shared_ptr<LQPUniqueConstraints> DummyTableNode::unique_constraints() const {
+std::shared_ptr<LQPUniqueConstraints> DummyTableNode::_on_unique_constraints() const {
   return std::make_shared<LQPUniqueConstraints>();
 }
 
@@ -28,13 +28,13 @@ bool ExceptNode::is_column_nullable(const ColumnID column_id) const {
   return left_input()->is_column_nullable(column_id) || right_input()->is_column_nullable(column_id);
 }
 
-std::shared_ptr<LQPUniqueConstraints> ExceptNode::unique_constraints() const {
+std::shared_ptr<LQPUniqueConstraints> ExceptNode::_on_unique_constraints() const {
   // Because EXCEPT acts as a pure filter for the left input table, all unique constraints from the left input node
   // remain valid.
   return _forward_left_unique_constraints();
 }
 
-std::vector<FunctionalDependency> ExceptNode::non_trivial_functional_dependencies() const {
+std::vector<FunctionalDependency> ExceptNode::_on_non_trivial_functional_dependencies() const {
   // The right input node is used for filtering only. It does not contribute any FDs.
   return left_input()->non_trivial_functional_dependencies();
 }
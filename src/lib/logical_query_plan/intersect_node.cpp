@@ -28,7 +28,7 @@ bool IntersectNode::is_column_nullable(const ColumnID column_id) const {
   return left_input()->is_column_nullable(column_id) || right_input()->is_column_nullable(column_id);
 }
 
-std::shared_ptr<LQPUniqueConstraints> IntersectNode::unique_constraints() const {
+std::shared_ptr<LQPUniqueConstraints> IntersectNode::_on_unique_constraints() const {
   /**
    * Because INTERSECT acts as a pure filter for both input tables, all unique constraints remain valid.
    *
@@ -39,7 +39,7 @@ std::shared_ptr<LQPUniqueConstraints> IntersectNode::unique_constraints() const
   return _forward_left_unique_constraints();
 }
 
-std::vector<FunctionalDependency> IntersectNode::non_trivial_functional_dependencies() const {
+std::vector<FunctionalDependency> IntersectNode::_on_non_trivial_functional_dependencies() const {
   Fail("Merging of FDs should be implemented.");
 }
 
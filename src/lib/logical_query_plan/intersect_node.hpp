@@ -29,13 +29,14 @@ class IntersectNode : public EnableMakeForLQPNode<IntersectNode>, public Abstrac
   std::vector<std::shared_ptr<AbstractExpression>> output_expressions() const override;
   bool is_column_nullable(const ColumnID column_id) const override;
 
-  // Forwards unique constraints from the left input node
-  std::shared_ptr<LQPUniqueConstraints> unique_constraints() const override;
-  std::vector<FunctionalDependency> non_trivial_functional_dependencies() const override;
-
   const SetOperationMode set_operation_mode;
 
  protected:
+  // Forwards unique constraints from the left input node
+  std::shared_ptr<LQPUniqueConstraints> _on_unique_constraints() const override;
+
+  std::vector<FunctionalDependency> _on_non_trivial_functional_dependencies() const override;
+
   size_t _on_shallow_hash() const override;
   std::shared_ptr<AbstractLQPNode> _on_shallow_copy(LQPNodeMapping& node_mapping) const override;
   bool _on_shallow_equals(const AbstractLQPNode& rhs, const LQPNodeMapping& node_mapping) const override;
@@ -73,7 +73,7 @@ std::vector<std::shared_ptr<AbstractExpression>> JoinNode::output_expressions()
   return output_expressions;
 }
 
-std::shared_ptr<LQPUniqueConstraints> JoinNode::unique_constraints() const {
+std::shared_ptr<LQPUniqueConstraints> JoinNode::_on_unique_constraints() const {
   // Semi- and Anti-Joins act as mere filters for input_left().
   // Therefore, existing unique constraints remain valid.
   if (join_mode == JoinMode::Semi || join_mode == JoinMode::AntiNullAsTrue || join_mode == JoinMode::AntiNullAsFalse) {
@@ -140,7 +140,7 @@ std::shared_ptr<LQPUniqueConstraints> JoinNode::_output_unique_constraints(
   return std::make_shared<LQPUniqueConstraints>();
 }
 
-std::vector<FunctionalDependency> JoinNode::non_trivial_functional_dependencies() const {
+std::vector<FunctionalDependency> JoinNode::_on_non_trivial_functional_dependencies() const {
   /**
    * In the case of Semi- & Anti-Joins, this node acts as a filter for the left input node. The number of output
    * expressions does not change and therefore we should forward non-trivial FDs as follows:
@@ -31,25 +31,6 @@ class JoinNode : public EnableMakeForLQPNode<JoinNode>, public AbstractLQPNode {
   std::vector<std::shared_ptr<AbstractExpression>> output_expressions() const override;
   bool is_column_nullable(const ColumnID column_id) const override;
 
-  /**
-   * (1) Forwards left input node's unique constraints for JoinMode::Semi and JoinMode::AntiNullAsTrue/False
-   * (2) Discards all input unique constraints for Cross Joins, Multi-Predicate Joins and Non-Equi-Joins
-   * (3) Forwards selected input unique constraints for Inner and Outer Equi-Joins based on join column uniqueness.
-   */
-  std::shared_ptr<LQPUniqueConstraints> unique_constraints() const override;
-
-  /**
-   * (a) Semi- & Anti-Joins:
-   *      - Forwards left input node's non-trivial FDs
-   * (b) Cross-Joins:
-   *      - Forwards non-trivial FDs from both input nodes.
-   * (c) Inner-/Outer-Joins:
-   *      - Forwards non-trivial FDs from both input nodes whose determinant expressions stay non-nullable.
-   *      - Turns derived, trivial FDs from the left and/or right input node into non-trivial FDs if the underlying
-   *        unique constraints do not survive the join.
-   */
-  std::vector<FunctionalDependency> non_trivial_functional_dependencies() const override;
-
   const std::vector<std::shared_ptr<AbstractExpression>>& join_predicates() const;
 
   /**
@@ -76,6 +57,25 @@ class JoinNode : public EnableMakeForLQPNode<JoinNode>, public AbstractLQPNode {
   JoinMode join_mode;
 
  protected:
+  /**
+   * (1) Forwards left input node's unique constraints for JoinMode::Semi and JoinMode::AntiNullAsTrue/False
+   * (2) Discards all input unique constraints for Cross Joins, Multi-Predicate Joins and Non-Equi-Joins
+   * (3) Forwards selected input unique constraints for Inner and Outer Equi-Joins based on join column uniqueness.
+   */
+  std::shared_ptr<LQPUniqueConstraints> _on_unique_constraints() const override;
+
+  /**
+   * (a) Semi- & Anti-Joins:
+   *      - Forwards left input node's non-trivial FDs
+   * (b) Cross-Joins:
+   *      - Forwards non-trivial FDs from both input nodes.
+   * (c) Inner-/Outer-Joins:
+   *      - Forwards non-trivial FDs from both input nodes whose determinant expressions stay non-nullable.
+   *      - Turns derived, trivial FDs from the left and/or right input node into non-trivial FDs if the underlying
+   *        unique constraints do not survive the join.
+   */
+  std::vector<FunctionalDependency> _on_non_trivial_functional_dependencies() const override;
+
   /**
    * The following data members are only relevant for semi joins added by the SemiJoinReductionRule. For details,
    * read the documentation of ::mark_as_semi_reduction and ::get_or_find_reduced_join_node.
@@ -15,12 +15,12 @@ class LimitNode : public EnableMakeForLQPNode<LimitNode>, public AbstractLQPNode
 
   std::string description(const DescriptionMode mode = DescriptionMode::Short) const override;
 
-  // Forwards unique constraints from the left input node
-  std::shared_ptr<LQPUniqueConstraints> unique_constraints() const override;
-
   std::shared_ptr<AbstractExpression> num_rows_expression() const;
 
  protected:
+  // Forwards unique constraints from the left input node
+  std::shared_ptr<LQPUniqueConstraints> _on_unique_constraints() const override;
+
   std::shared_ptr<AbstractLQPNode> _on_shallow_copy(LQPNodeMapping& node_mapping) const override;
   bool _on_shallow_equals(const AbstractLQPNode& rhs, const LQPNodeMapping& node_mapping) const override;
 };
@@ -16,11 +16,11 @@ std::shared_ptr<AbstractLQPNode> LogicalPlanRootNode::_on_shallow_copy(LQPNodeMa
   return make();
 }
 
-std::shared_ptr<LQPUniqueConstraints> LogicalPlanRootNode::unique_constraints() const {
+std::shared_ptr<LQPUniqueConstraints> LogicalPlanRootNode::_on_unique_constraints() const {
   Fail("LogicalPlanRootNode is not expected to be queried for unique constraints.");
 }
 
-std::vector<FunctionalDependency> LogicalPlanRootNode::non_trivial_functional_dependencies() const {
+std::vector<FunctionalDependency> LogicalPlanRootNode::_on_non_trivial_functional_dependencies() const {
   Fail("LogicalPlanRootNode is not expected to be queried for functional dependencies.");
 }
 
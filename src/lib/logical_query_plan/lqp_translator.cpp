@@ -1,7 +1,11 @@
 #include "lqp_translator.hpp"
 
+#include <algorithm>
 #include <memory>
+#include <optional>
 #include <string>
+#include <type_traits>
+#include <utility>
 #include <vector>
 
 #include <boost/hana/for_each.hpp>
@@ -14,6 +18,7 @@
 #include "create_prepared_plan_node.hpp"
 #include "create_table_node.hpp"
 #include "create_view_node.hpp"
+#include "cost_estimation/cost_estimator_calibrated.hpp"
 #include "delete_node.hpp"
 #include "drop_table_node.hpp"
 #include "drop_view_node.hpp"
@@ -21,7 +26,9 @@
 #include "export_node.hpp"
 #include "expression/abstract_expression.hpp"
 #include "expression/abstract_predicate_expression.hpp"
+#include "expression/binary_predicate_expression.hpp"
 #include "expression/expression_utils.hpp"
+#include "expression/logical_expression.hpp"
 #include "expression/lqp_column_expression.hpp"
 #include "expression/lqp_subquery_expression.hpp"
 #include "expression/pqp_column_expression.hpp"
@@ -33,6 +40,7 @@
 #include "intersect_node.hpp"
 #include "join_node.hpp"
 #include "limit_node.hpp"
+#include "lqp_utils.hpp"
 #include "operators/aggregate_hash.hpp"
 #include "operators/alias_operator.hpp"
 #include "operators/change_meta_table.hpp"
@@ -66,12 +74,62 @@
 #include "projection_node.hpp"
 #include "sort_node.hpp"
 #include "static_table_node.hpp"
+#include "statistics/cardinality_estimator.hpp"
 #include "stored_table_node.hpp"
 #include "union_node.hpp"
 #include "update_node.hpp"
 
 using namespace std::string_literals;  // NOLINT
 
+namespace {
+
+using namespace hyrise;  // NOLINT
+
+bool contains_predicate_node(const std::shared_ptr<AbstractLQPNode>& lqp) {
+  auto contains_predicate = false;
+  visit_lqp(lqp, [&](const auto& node) {
+    if (node->type == LQPNodeType::Predicate) {
+      contains_predicate = true;
+      return LQPVisitation::DoNotVisitInputs;
+    }
+    return LQPVisitation::VisitInputs;
+  });
+  return contains_predicate;
+}
+
+// Returns the StoredTableNode if `node` is a chain of PredicateNodes and ValidateNodes on top of it and none of these
+// nodes is used elsewhere in the plan. Only then, its GetTable can be pruned for a single join.
+std::shared_ptr<StoredTableNode> dynamically_prunable_stored_table_node(const std::shared_ptr<AbstractLQPNode>& node) {
+  auto current_node = node;
+  while (current_node->output_count() == 1) {
+    if (current_node->type == LQPNodeType::StoredTable) {
+      const auto stored_table_node = std::static_pointer_cast<StoredTableNode>(current_node);
+      return Hyrise::get().storage_manager.has_table(stored_table_node->table_name) ? stored_table_node : nullptr;
+    }
+
+    if (current_node->type != LQPNodeType::Predicate && current_node->type != LQPNodeType::Validate) {
+      return nullptr;
+    }
+    current_node = current_node->left_input();
+  }
+
+  return nullptr;
+}
+
+template <typename JoinOperator>
+constexpr OperatorType join_operator_type() {
+  if constexpr (std::is_same_v<JoinOperator, JoinHash>) {
+    return OperatorType::JoinHash;
+  } else if constexpr (std::is_same_v<JoinOperator, JoinSortMerge>) {
+    return OperatorType::JoinSortMerge;
+  } else {
+    static_assert(std::is_same_v<JoinOperator, JoinNestedLoop>, "Unexpected join operator.");
+    return OperatorType::JoinNestedLoop;
+  }
+}
+
+}  // namespace
+
 namespace hyrise {
 
 std::shared_ptr<AbstractOperator> LQPTranslator::translate_node(const std::shared_ptr<AbstractLQPNode>& node) const {
@@ -193,6 +251,90 @@ std::shared_ptr<AbstractOperator> LQPTranslator::_translate_predicate_node_to_in
   // Our IndexScan implementation does not work on reference segments yet.
   Assert(node->left_input()->type == LQPNodeType::StoredTable, "IndexScan must follow a StoredTableNode.");
 
+  const auto stored_table = Hyrise::get().storage_manager.get_table(
+      std::static_pointer_cast<StoredTableNode>(node->left_input())->table_name);
+
+  // Conjunctions of equality predicates on all key columns of the PrimaryKeyIndex are looked up in that index (see
+  // IndexScanRule). As for table indexes below, the key is looked up without casting the values, so they have to be
+  // non-NULL literals of the columns' data types.
+  if (const auto primary_key_index = stored_table->primary_key_index()) {
+    const auto key_predicates = flatten_logical_expressions(node->predicate(), LogicalOperator::And);
+    auto key_column_ids = std::vector<ColumnID>{};
+    auto stored_key_column_ids = std::vector<ColumnID>{};
+    auto key_values = std::vector<AllTypeVariant>{};
+    for (const auto& key_predicate : key_predicates) {
+      const auto binary_predicate = std::dynamic_pointer_cast<BinaryPredicateExpression>(key_predicate);
+      if (!binary_predicate || binary_predicate->predicate_condition != PredicateCondition::Equals) {
+        break;
+      }
+
+      auto column_expression = std::dynamic_pointer_cast<LQPColumnExpression>(binary_predicate->left_operand());
+      auto value_expression = std::dynamic_pointer_cast<ValueExpression>(binary_predicate->right_operand());
+      if (!column_expression || !value_expression) {
+        column_expression = std::dynamic_pointer_cast<LQPColumnExpression>(binary_predicate->right_operand());
+        value_expression = std::dynamic_pointer_cast<ValueExpression>(binary_predicate->left_operand());
+      }
+      if (!column_expression || !value_expression || column_expression->original_node.lock() != node->left_input() ||
+          variant_is_null(value_expression->value) ||
+          data_type_from_all_type_variant(value_expression->value) != column_expression->data_type()) {
+        break;
+      }
+
+      key_column_ids.emplace_back(node->left_input()->get_column_id(*column_expression));
+      stored_key_column_ids.emplace_back(column_expression->original_column_id);
+      key_values.emplace_back(value_expression->value);
+    }
+
+    // The predicates have to cover exactly the key columns, possibly in a different order.
+    std::sort(stored_key_column_ids.begin(), stored_key_column_ids.end());
+    auto primary_key_column_ids = primary_key_index->column_ids();
+    std::sort(primary_key_column_ids.begin(), primary_key_column_ids.end());
+    if (key_column_ids.size() == key_predicates.size() && stored_key_column_ids == primary_key_column_ids) {
+      const auto index_scan = std::make_shared<IndexScan>(input_operator, SegmentIndexType::GroupKey, key_column_ids,
+                                                          PredicateCondition::Equals, key_values);
+      index_scan->lqp_node = node;
+      return index_scan;
+    }
+
+    // The index paths below only handle single predicates. A TableScan evaluates the whole conjunction instead.
+    if (key_predicates.size() > 1) {
+      return _translate_predicate_node_to_table_scan(node, input_operator);
+    }
+  }
+
+  // If the stored table has a table index on the column, a single IndexScan handles all chunks (see IndexScanRule).
+  const auto operator_predicates = OperatorScanPredicate::from_expression(*node->predicate(), *node);
+  if (operator_predicates && operator_predicates->size() == 1) {
+    const auto& operator_predicate = (*operator_predicates)[0];
+    const auto column_expression = std::dynamic_pointer_cast<LQPColumnExpression>(
+        node->left_input()->output_expressions()[operator_predicate.column_id]);
+
+    // The index is probed without casting the values, so they have to be non-NULL literals of the column's data type
+    // (as checked by IndexScanRule::_is_table_index_scan_applicable()). Otherwise, we fall back to the chunk indexes.
+    const auto is_column_typed_literal = [&](const AllParameterVariant& value) {
+      if (!is_variant(value)) {
+        return false;
+      }
+      const auto& variant = boost::get<AllTypeVariant>(value);
+      return !variant_is_null(variant) && data_type_from_all_type_variant(variant) == column_expression->data_type();
+    };
+
+    if (column_expression && is_column_typed_literal(operator_predicate.value) &&
+        (!operator_predicate.value2 || is_column_typed_literal(*operator_predicate.value2)) &&
+        stored_table->get_table_index(column_expression->original_column_id, operator_predicate.predicate_condition)) {
+      auto right_values2 = std::vector<AllTypeVariant>{};
+      if (operator_predicate.value2) {
+        right_values2.emplace_back(boost::get<AllTypeVariant>(*operator_predicate.value2));
+      }
+      const auto index_scan = std::make_shared<IndexScan>(
+          input_operator, SegmentIndexType::GroupKey, std::vector<ColumnID>{operator_predicate.column_id},
+          operator_predicate.predicate_condition,
+          std::vector<AllTypeVariant>{boost::get<AllTypeVariant>(operator_predicate.value)}, right_values2);
+      index_scan->lqp_node = node;
+      return index_scan;
+    }
+  }
+
   const auto predicate = std::dynamic_pointer_cast<AbstractPredicateExpression>(node->predicate());
   Assert(predicate, "Expected predicate");
   Assert(!predicate->arguments.empty(), "Expected arguments");
@@ -328,14 +470,11 @@ std::shared_ptr<AbstractOperator> LQPTranslator::_translate_sort_node(
 
 std::shared_ptr<AbstractOperator> LQPTranslator::_translate_join_node(
     const std::shared_ptr<AbstractLQPNode>& node) const {
-  const auto left_input_operator = translate_node(node->left_input());
-  const auto right_input_operator = translate_node(node->right_input());
-
   auto join_node = std::dynamic_pointer_cast<JoinNode>(node);
 
   if (join_node->join_mode == JoinMode::Cross) {
     PerformanceWarning("CROSS join used");
-    return std::make_shared<Product>(left_input_operator, right_input_operator);
+    return std::make_shared<Product>(translate_node(node->left_input()), translate_node(node->right_input()));
   }
 
   Assert(!join_node->join_predicates().empty(), "Need predicate for non Cross Join");
@@ -355,20 +494,39 @@ std::shared_ptr<AbstractOperator> LQPTranslator::_translate_join_node(
   const auto& primary_join_predicate = join_predicates.front();
   std::vector<OperatorJoinPredicate> secondary_join_predicates(join_predicates.cbegin() + 1, join_predicates.cend());
 
+  const auto input_operators = _translate_join_inputs(*join_node, primary_join_predicate);
+  const auto& left_input_operator = input_operators.first;
+  const auto& right_input_operator = input_operators.second;
+
   auto join_operator = std::shared_ptr<AbstractOperator>{};
 
   const auto left_data_type = join_node->join_predicates().front()->arguments[0]->data_type();
   const auto right_data_type = join_node->join_predicates().front()->arguments[1]->data_type();
 
-  // Lacking a proper cost model, we assume JoinHash is always faster than JoinSortMerge, which is faster than
-  // JoinNestedLoop and thus check for an operator compatible with the JoinNode in that order
+  // With a calibrated cost model, we choose the cheapest join operator compatible with the JoinNode if its inputs are
+  // guaranteed to be small (see CostEstimatorCalibrated::cheapest_join_operator()). Otherwise, we assume JoinHash is
+  // always faster than JoinSortMerge, which is faster than JoinNestedLoop and thus check for an operator compatible
+  // with the JoinNode in that order
   constexpr auto JOIN_OPERATOR_PREFERENCE_ORDER =
       hana::to_tuple(hana::tuple_t<JoinHash, JoinSortMerge, JoinNestedLoop>);
 
+  auto cheapest_join_operator_type = std::optional<OperatorType>{};
+  if (const auto& cost_model_coefficients = Hyrise::get().cost_model_coefficients) {
+    // All joins of the plan share one estimator. As the LQP is not modified during its translation, the estimator
+    // caches the cardinalities of the inputs.
+    if (!_join_cost_estimator) {
+      _join_cost_estimator =
+          std::make_shared<CostEstimatorCalibrated>(std::make_shared<CardinalityEstimator>(), cost_model_coefficients);
+      _join_cost_estimator->guarantee_bottom_up_construction();
+    }
+    cheapest_join_operator_type = _join_cost_estimator->cheapest_join_operator(join_node);
+  }
+
   boost::hana::for_each(JOIN_OPERATOR_PREFERENCE_ORDER, [&](const auto join_operator_t) {
     using JoinOperator = typename decltype(join_operator_t)::type;
 
-    if (join_operator) {
+    if (join_operator ||
+        (cheapest_join_operator_type && join_operator_type<JoinOperator>() != *cheapest_join_operator_type)) {
       return;
     }
 
@@ -386,6 +544,84 @@ std::shared_ptr<AbstractOperator> LQPTranslator::_translate_join_node(
   return join_operator;
 }
 
+std::pair<std::shared_ptr<AbstractOperator>, std::shared_ptr<AbstractOperator>> LQPTranslator::_translate_join_inputs(
+    const JoinNode& join_node, const OperatorJoinPredicate& primary_join_predicate) const {
+  const auto& left_input = join_node.left_input();
+  const auto& right_input = join_node.right_input();
+
+  // Rows without a join partner do not contribute to the result of inner joins or to the left input of semi joins.
+  // Thus, chunks that do not contain any join key of the other input can be skipped. As the GetTable has to wait for
+  // the other input, we only prune if that input is filtered and likely to have few join keys.
+  auto left_stored_table_node = std::shared_ptr<StoredTableNode>{};
+  auto right_stored_table_node = std::shared_ptr<StoredTableNode>{};
+  if (primary_join_predicate.predicate_condition == PredicateCondition::Equals &&
+      (join_node.join_mode == JoinMode::Inner || join_node.join_mode == JoinMode::Semi)) {
+    if (contains_predicate_node(right_input)) {
+      left_stored_table_node = dynamically_prunable_stored_table_node(left_input);
+    }
+    if (join_node.join_mode == JoinMode::Inner && contains_predicate_node(left_input)) {
+      right_stored_table_node = dynamically_prunable_stored_table_node(right_input);
+    }
+  }
+
+  // If both inputs qualify, prune the larger table.
+  if (left_stored_table_node && right_stored_table_node) {
+    const auto& storage_manager = Hyrise::get().storage_manager;
+    if (storage_manager.get_table(left_stored_table_node->table_name)->row_count() >=
+        storage_manager.get_table(right_stored_table_node->table_name)->row_count()) {
+      right_stored_table_node = nullptr;
+    } else {
+      left_stored_table_node = nullptr;
+    }
+  }
+
+  const auto& [left_column_id, right_column_id] = primary_join_predicate.column_ids;
+  if (left_stored_table_node) {
+    const auto right_input_operator = translate_node(right_input);
+    return {_translate_dynamically_pruned_input(left_input, right_input_operator, right_column_id, left_column_id),
+            right_input_operator};
+  }
+
+  if (right_stored_table_node) {
+    const auto left_input_operator = translate_node(left_input);
+    return {left_input_operator,
+            _translate_dynamically_pruned_input(right_input, left_input_operator, left_column_id, right_column_id)};
+  }
+
+  return {translate_node(left_input), translate_node(right_input)};
+}
+
+std::shared_ptr<AbstractOperator> LQPTranslator::_translate_dynamically_pruned_input(
+    const std::shared_ptr<AbstractLQPNode>& node, const std::shared_ptr<AbstractOperator>& build_input_operator,
+    const ColumnID build_column_id, const ColumnID column_id) const {
+  auto pqp = std::shared_ptr<AbstractOperator>{};
+  if (node->type == LQPNodeType::StoredTable) {
+    const auto get_table = std::static_pointer_cast<GetTable>(_translate_stored_table_node(node));
+    get_table->set_dynamic_pruning_input({build_input_operator, build_column_id, column_id});
+    pqp = get_table;
+  } else {
+    // The nodes above the StoredTableNode do not change the columns. Hence, column_id is valid for all of them.
+    const auto input_operator =
+        _translate_dynamically_pruned_input(node->left_input(), build_input_operator, build_column_id, column_id);
+    if (node->type == LQPNodeType::Validate) {
+      pqp = std::make_shared<Validate>(input_operator);
+    } else {
+      const auto predicate_node = std::static_pointer_cast<PredicateNode>(node);
+      switch (predicate_node->scan_type) {
+        case ScanType::TableScan:
+          pqp = _translate_predicate_node_to_table_scan(predicate_node, input_operator);
+          break;
+        case ScanType::IndexScan:
+          pqp = _translate_predicate_node_to_index_scan(predicate_node, input_operator);
+          break;
+      }
+    }
+  }
+
+  pqp->lqp_node = node;
+  return pqp;
+}
+
 std::shared_ptr<AbstractOperator> LQPTranslator::_translate_aggregate_node(
     const std::shared_ptr<AbstractLQPNode>& node) const {
   const auto aggregate_node = std::dynamic_pointer_cast<AggregateNode>(node);
@@ -2,6 +2,7 @@
 
 #include <memory>
 #include <unordered_map>
+#include <utility>
 
 #include "abstract_lqp_node.hpp"
 #include "all_type_variant.hpp"
@@ -10,8 +11,10 @@
 namespace hyrise {
 
 class AbstractOperator;
+class CostEstimatorCalibrated;
 class TransactionContext;
 class AbstractExpression;
+class JoinNode;
 class PredicateNode;
 class TableScan;
 struct OperatorScanPredicate;
@@ -41,6 +44,17 @@ class LQPTranslator {
   std::shared_ptr<AbstractOperator> _translate_projection_node(const std::shared_ptr<AbstractLQPNode>& node) const;
   std::shared_ptr<AbstractOperator> _translate_sort_node(const std::shared_ptr<AbstractLQPNode>& node) const;
   std::shared_ptr<AbstractOperator> _translate_join_node(const std::shared_ptr<AbstractLQPNode>& node) const;
+
+  // Translates the inputs of a join. If one input is a table that is only filtered (and validated), its GetTable prunes
+  // chunks at runtime using the join keys of the other input (see GetTable::DynamicPruningInput).
+  std::pair<std::shared_ptr<AbstractOperator>, std::shared_ptr<AbstractOperator>> _translate_join_inputs(
+      const JoinNode& join_node, const OperatorJoinPredicate& primary_join_predicate) const;
+
+  // Translates a chain of PredicateNodes and ValidateNodes on top of a StoredTableNode without using the operator
+  // cache. The GetTable is exclusive to the join and can thus be pruned with the join keys of `build_input_operator`.
+  std::shared_ptr<AbstractOperator> _translate_dynamically_pruned_input(
+      const std::shared_ptr<AbstractLQPNode>& node, const std::shared_ptr<AbstractOperator>& build_input_operator,
+      const ColumnID build_column_id, const ColumnID column_id) const;
   std::shared_ptr<AbstractOperator> _translate_aggregate_node(const std::shared_ptr<AbstractLQPNode>& node) const;
   std::shared_ptr<AbstractOperator> _translate_limit_node(const std::shared_ptr<AbstractLQPNode>& node) const;
   std::shared_ptr<AbstractOperator> _translate_insert_node(const std::shared_ptr<AbstractLQPNode>& node) const;
@@ -80,6 +94,9 @@ class LQPTranslator {
   //   - identical operators (operators below a diamond shape)
   //   - equal but not identical operators
   mutable LQPNodeUnorderedMap<std::shared_ptr<AbstractOperator>> _operator_by_lqp_node;
+
+  // Chooses the join operators if Hyrise::get().cost_model_coefficients is set. Created on the first JoinNode.
+  mutable std::shared_ptr<CostEstimatorCalibrated> _join_cost_estimator;
 };
 
 }  // namespace hyrise
@@ -73,7 +73,7 @@ void MockNode::set_pruned_column_ids(const std::vector<ColumnID>& pruned_column_
   _output_expressions.reset();
 }
 
-std::shared_ptr<LQPUniqueConstraints> MockNode::unique_constraints() const {
+std::shared_ptr<LQPUniqueConstraints> MockNode::_on_unique_constraints() const {
   auto unique_constraints = std::make_shared<LQPUniqueConstraints>();
 
   for (const auto& table_key_constraint : _table_key_constraints) {
@@ -141,7 +141,7 @@ void MockNode::set_non_trivial_functional_dependencies(const std::vector<Functio
   _functional_dependencies = fds;
 }
 
-std::vector<FunctionalDependency> MockNode::non_trivial_functional_dependencies() const {
+std::vector<FunctionalDependency> MockNode::_on_non_trivial_functional_dependencies() const {
   return _functional_dependencies;
 }
 
@@ -35,9 +35,6 @@ class MockNode : public EnableMakeForLQPNode<MockNode>, public AbstractLQPNode {
   std::vector<std::shared_ptr<AbstractExpression>> output_expressions() const override;
   bool is_column_nullable(const ColumnID column_id) const override;
 
-  // Generates unique constraints from table's key constraints and pays respect to pruned columns.
-  std::shared_ptr<LQPUniqueConstraints> unique_constraints() const override;
-
   /**
    * @defgroup ColumnIDs to be pruned from the mocked Table.
    * Vector passed to `set_pruned_column_ids()` needs to be sorted and unique
@@ -57,12 +54,16 @@ class MockNode : public EnableMakeForLQPNode<MockNode>, public AbstractLQPNode {
   const TableKeyConstraints& key_constraints() const;
 
   void set_non_trivial_functional_dependencies(const std::vector<FunctionalDependency>& fds);
-  // Returns the specified set of non-trivial FDs.
-  std::vector<FunctionalDependency> non_trivial_functional_dependencies() const override;
 
   std::optional<std::string> name;
 
  protected:
+  // Generates unique constraints from table's key constraints and pays respect to pruned columns.
+  std::shared_ptr<LQPUniqueConstraints> _on_unique_constraints() const override;
+
+  // Returns the specified set of non-trivial FDs.
+  std::vector<FunctionalDependency> _on_non_trivial_functional_dependencies() const override;
+
   size_t _on_shallow_hash() const override;
   std::shared_ptr<AbstractLQPNode> _on_shallow_copy(LQPNodeMapping& node_mapping) const override;
   bool _on_shallow_equals(const AbstractLQPNode& rhs, const LQPNodeMapping& node_mapping) const override;
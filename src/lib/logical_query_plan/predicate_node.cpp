@@ -28,7 +28,7 @@ std::string PredicateNode::description(const DescriptionMode mode) const {
   return stream.str();
 }
 
-std::shared_ptr<LQPUniqueConstraints> PredicateNode::unique_constraints() const {
+std::shared_ptr<LQPUniqueConstraints> PredicateNode::_on_unique_constraints() const {
   return _forward_left_unique_constraints();
 }
 
@@ -32,7 +32,7 @@ bool ProjectionNode::is_column_nullable(const ColumnID column_id) const {
   return node_expressions[column_id]->is_nullable_on_lqp(*left_input());
 }
 
-std::shared_ptr<LQPUniqueConstraints> ProjectionNode::unique_constraints() const {
+std::shared_ptr<LQPUniqueConstraints> ProjectionNode::_on_unique_constraints() const {
   auto unique_constraints = std::make_shared<LQPUniqueConstraints>();
   unique_constraints->reserve(node_expressions.size());
 
@@ -56,7 +56,7 @@ std::shared_ptr<LQPUniqueConstraints> ProjectionNode::unique_constraints() const
   return unique_constraints;
 }
 
-std::vector<FunctionalDependency> ProjectionNode::non_trivial_functional_dependencies() const {
+std::vector<FunctionalDependency> ProjectionNode::_on_non_trivial_functional_dependencies() const {
   auto non_trivial_fds = left_input()->non_trivial_functional_dependencies();
 
   // Currently, we remove non-trivial FDs whose expressions are no longer part of the node's output expressions.
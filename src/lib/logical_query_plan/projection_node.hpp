@@ -15,16 +15,16 @@ class ProjectionNode : public EnableMakeForLQPNode<ProjectionNode>, public Abstr
   std::vector<std::shared_ptr<AbstractExpression>> output_expressions() const override;
   bool is_column_nullable(const ColumnID column_id) const override;
 
+ protected:
   /**
    * Forwards unique constraints from the left input node that fulfill the following criteria:
    *  - unique constraint's expressions remain part of the ProjectionNode's output expressions
    */
-  std::shared_ptr<LQPUniqueConstraints> unique_constraints() const override;
+  std::shared_ptr<LQPUniqueConstraints> _on_unique_constraints() const override;
 
   // Returns non-trivial FDs from the left input node that remain valid.
-  std::vector<FunctionalDependency> non_trivial_functional_dependencies() const override;
+  std::vector<FunctionalDependency> _on_non_trivial_functional_dependencies() const override;
 
- protected:
   std::shared_ptr<AbstractLQPNode> _on_shallow_copy(LQPNodeMapping& node_mapping) const override;
   bool _on_shallow_equals(const AbstractLQPNode& rhs, const LQPNodeMapping& node_mapping) const override;
 };
@@ -49,7 +49,7 @@ std::vector<std::shared_ptr<AbstractExpression>> StaticTableNode::output_express
   return *_output_expressions;
 }
 
-std::shared_ptr<LQPUniqueConstraints> StaticTableNode::unique_constraints() const {
+std::shared_ptr<LQPUniqueConstraints> StaticTableNode::_on_unique_constraints() const {
   // Generate from table key constraints
   auto unique_constraints = std::make_shared<LQPUniqueConstraints>();
   const auto table_key_constraints = table->soft_key_constraints();
@@ -21,12 +21,12 @@ class StaticTableNode : public EnableMakeForLQPNode<StaticTableNode>, public Abs
   std::vector<std::shared_ptr<AbstractExpression>> output_expressions() const override;
   bool is_column_nullable(const ColumnID column_id) const override;
 
-  // Generates unique constraints from table's key constraints.
-  std::shared_ptr<LQPUniqueConstraints> unique_constraints() const override;
-
   const std::shared_ptr<Table> table;
 
  protected:
+  // Generates unique constraints from table's key constraints.
+  std::shared_ptr<LQPUniqueConstraints> _on_unique_constraints() const override;
+
   mutable std::optional<std::vector<std::shared_ptr<AbstractExpression>>> _output_expressions;
 
   size_t _on_shallow_hash() const override;
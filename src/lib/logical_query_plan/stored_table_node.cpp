@@ -98,7 +98,7 @@ bool StoredTableNode::is_column_nullable(const ColumnID column_id) const {
   return table->column_is_nullable(column_id);
 }
 
-std::shared_ptr<LQPUniqueConstraints> StoredTableNode::unique_constraints() const {
+std::shared_ptr<LQPUniqueConstraints> StoredTableNode::_on_unique_constraints() const {
   auto unique_constraints = std::make_shared<LQPUniqueConstraints>();
 
   // We create unique constraints from selected table key constraints
@@ -35,7 +35,7 @@ bool UnionNode::is_column_nullable(const ColumnID column_id) const {
   return left_input()->is_column_nullable(column_id) || right_input()->is_column_nullable(column_id);
 }
 
-std::shared_ptr<LQPUniqueConstraints> UnionNode::unique_constraints() const {
+std::shared_ptr<LQPUniqueConstraints> UnionNode::_on_unique_constraints() const {
   switch (set_operation_mode) {
     case SetOperationMode::Positions: {
       /**
@@ -65,7 +65,7 @@ std::shared_ptr<LQPUniqueConstraints> UnionNode::unique_constraints() const {
   Fail("Unhandled UnionMode");
 }
 
-std::vector<FunctionalDependency> UnionNode::non_trivial_functional_dependencies() const {
+std::vector<FunctionalDependency> UnionNode::_on_non_trivial_functional_dependencies() const {
   switch (set_operation_mode) {
     case SetOperationMode::All: {
       /**
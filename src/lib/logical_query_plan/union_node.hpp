@@ -25,20 +25,20 @@ class UnionNode : public EnableMakeForLQPNode<UnionNode>, public AbstractLQPNode
   std::vector<std::shared_ptr<AbstractExpression>> output_expressions() const override;
   bool is_column_nullable(const ColumnID column_id) const override;
 
+  const SetOperationMode set_operation_mode;
+
+ protected:
   /**
    * (1) Forwards unique constraints from the left input node in case of SetOperationMode::Positions.
    *     (unique constraints of both, left and right input node are identical)
    * (2) Discards all input unique constraints for SetOperationMode::All and
    * (3) Fails for SetOperationMode::Unique, which is not yet implemented.
    */
-  std::shared_ptr<LQPUniqueConstraints> unique_constraints() const override;
+  std::shared_ptr<LQPUniqueConstraints> _on_unique_constraints() const override;
 
   // Implementation is limited to SetOperationMode::Positions only. Passes FDs from the left input node.
-  std::vector<FunctionalDependency> non_trivial_functional_dependencies() const override;
+  std::vector<FunctionalDependency> _on_non_trivial_functional_dependencies() const override;
 
-  const SetOperationMode set_operation_mode;
-
- protected:
   size_t _on_shallow_hash() const override;
   std::shared_ptr<AbstractLQPNode> _on_shallow_copy(LQPNodeMapping& node_mapping) const override;
   bool _on_shallow_equals(const AbstractLQPNode& rhs, const LQPNodeMapping& node_mapping) const override;
@@ -10,7 +10,7 @@ std::string ValidateNode::description(const DescriptionMode mode) const {
   return "[Validate]";
 }
 
-std::shared_ptr<LQPUniqueConstraints> ValidateNode::unique_constraints() const {
+std::shared_ptr<LQPUniqueConstraints> ValidateNode::_on_unique_constraints() const {
   return _forward_left_unique_constraints();
 }
 
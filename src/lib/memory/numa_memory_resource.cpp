@@ -0,0 +1,65 @@
+#include "numa_memory_resource.hpp"
+
+#if HYRISE_NUMA_SUPPORT
+
+#include <numa.h>
+
+#endif
+
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <string>
+
+#include "utils/assert.hpp"
+
+namespace hyrise {
+
+NUMAMemoryResource* NUMAMemoryResource::get(const NodeID node_id) {
+  // Yes, this leaks, see class comment.
+  // NOLINTNEXTLINE(cppcoreguidelines-avoid-non-const-global-variables,cppcoreguidelines-owning-memory)
+  static auto* resources = new std::deque<std::unique_ptr<NUMAMemoryResource>>();
+  static auto mutex = std::mutex{};
+
+  const auto lock = std::lock_guard<std::mutex>{mutex};
+  while (resources->size() <= static_cast<size_t>(node_id)) {
+    // The constructor is protected, so we cannot use std::make_unique.
+    // NOLINTNEXTLINE(cppcoreguidelines-owning-memory)
+    resources->emplace_back(new NUMAMemoryResource(NodeID{static_cast<NodeID::base_type>(resources->size())}));
+  }
+  return (*resources)[node_id].get();
+}
+
+NUMAMemoryResource::NUMAMemoryResource(const NodeID node_id) : _node_id(node_id) {}
+
+NodeID NUMAMemoryResource::node_id() const {
+  return _node_id;
+}
+
+void* NUMAMemoryResource::do_allocate(std::size_t bytes, std::size_t alignment) {
+#if HYRISE_NUMA_SUPPORT
+  if (numa_available() >= 0) {
+    // numa_alloc_onnode allocates whole pages, which satisfies all alignments that we use.
+    auto* pointer = numa_alloc_onnode(bytes, static_cast<int>(_node_id));
+    Assert(pointer, "Failed to allocate memory on NUMA node " + std::to_string(_node_id) + ".");
+    return pointer;
+  }
+#endif
+  return boost::container::pmr::get_default_resource()->allocate(bytes, alignment);
+}
+
+void NUMAMemoryResource::do_deallocate(void* pointer, std::size_t bytes, std::size_t alignment) {
+#if HYRISE_NUMA_SUPPORT
+  if (numa_available() >= 0) {
+    numa_free(pointer, bytes);
+    return;
+  }
+#endif
+  boost::container::pmr::get_default_resource()->deallocate(pointer, bytes, alignment);
+}
+
+bool NUMAMemoryResource::do_is_equal(const memory_resource& other) const noexcept {
+  return &other == this;
+}
+
+}  // namespace hyrise
@@ -0,0 +1,33 @@
+#pragma once
+
+#include <boost/container/pmr/memory_resource.hpp>
+
+#include "types.hpp"
+
+namespace hyrise {
+
+/**
+ * Memory resource that allocates memory on a specific NUMA node. Used for placing chunks on NUMA nodes (see
+ * place_chunks_on_numa_nodes). Without NUMA support, memory is allocated from the default resource.
+ *
+ * Instances are retrieved via NUMAMemoryResource::get(node_id). They are never destroyed, as segments allocated with
+ * them might outlive any owner we could give them (the same reasoning applies to the default memory resource, see
+ * boost_default_memory_resource.cpp).
+ */
+class NUMAMemoryResource : public boost::container::pmr::memory_resource, private Noncopyable {
+ public:
+  static NUMAMemoryResource* get(const NodeID node_id);
+
+  NodeID node_id() const;
+
+ protected:
+  explicit NUMAMemoryResource(const NodeID node_id);
+
+  void* do_allocate(std::size_t bytes, std::size_t alignment) override;
+  void do_deallocate(void* pointer, std::size_t bytes, std::size_t alignment) override;
+  bool do_is_equal(const memory_resource& other) const noexcept override;
+
+  const NodeID _node_id;
+};
+
+}  // namespace hyrise
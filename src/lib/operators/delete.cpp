@@ -102,6 +102,7 @@ void Delete::_on_commit_records(const CommitID commit_id) {
 
       referenced_chunk->mvcc_data()->set_end_cid(row_id.chunk_offset, commit_id);
       referenced_chunk->increase_invalid_row_count(ChunkOffset{1});
+      referenced_chunk->update_last_modification_commit_id(commit_id);
       // We do not unlock the rows so subsequent transactions properly fail when attempting to update these rows.
     }
   }
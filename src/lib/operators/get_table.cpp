@@ -1,15 +1,137 @@
 #include "get_table.hpp"
 
 #include <algorithm>
+#include <functional>
 #include <memory>
+#include <optional>
 #include <sstream>
 #include <string>
 #include <unordered_set>
 #include <vector>
 
 #include "hyrise.hpp"
+#include "lossless_cast.hpp"
+#include "resolve_type.hpp"
+#include "statistics/base_attribute_statistics.hpp"
+#include "storage/dictionary_segment.hpp"
+#include "storage/segment_iterate.hpp"
 #include "types.hpp"
 
+namespace {
+
+using namespace hyrise;  // NOLINT
+
+// Build sides with more distinct join keys are not used for dynamic pruning. Collecting and looking up the keys would
+// cost more than it saves, and such build sides rarely exclude any chunk.
+constexpr auto MAX_DYNAMIC_PRUNING_KEY_COUNT = size_t{100'000};
+
+// For segments without a dictionary, we look up individual keys in the pruning statistics (e.g., in a BloomFilter)
+// only if there are few of them. Otherwise, only the range of the keys is checked.
+constexpr auto MAX_DYNAMIC_PRUNING_KEY_COUNT_FOR_STATISTICS = size_t{64};
+
+// Returns the sorted, distinct, non-NULL values of a column, converted to T. Values that cannot be converted
+// losslessly are never equal to a value of type T and are dropped. Returns std::nullopt if there are too many values.
+template <typename T>
+std::optional<std::vector<T>> collect_join_keys(const Table& table, const ColumnID column_id) {
+  auto keys = std::vector<T>{};
+  auto too_many_keys = false;
+
+  resolve_data_type(table.column_data_type(column_id), [&](const auto data_type_t) {
+    using BuildColumnDataType = typename decltype(data_type_t)::type;
+
+    // Strings are only joined with strings (see JoinHash::supports).
+    if constexpr (std::is_same_v<BuildColumnDataType, pmr_string> != std::is_same_v<T, pmr_string>) {
+      too_many_keys = true;
+    } else {
+      const auto chunk_count = table.chunk_count();
+      for (auto chunk_id = ChunkID{0}; chunk_id < chunk_count && !too_many_keys; ++chunk_id) {
+        const auto chunk = table.get_chunk(chunk_id);
+        if (!chunk) {
+          continue;
+        }
+
+        segment_iterate<BuildColumnDataType>(*chunk->get_segment(column_id), [&](const auto& position) {
+          if (position.is_null()) {
+            return;
+          }
+
+          if constexpr (std::is_same_v<BuildColumnDataType, T>) {
+            keys.emplace_back(position.value());
+          } else {
+            const auto key = lossless_cast<T>(position.value());
+            if (key) {
+              keys.emplace_back(*key);
+            }
+          }
+        });
+
+        if (keys.size() > MAX_DYNAMIC_PRUNING_KEY_COUNT) {
+          std::sort(keys.begin(), keys.end());
+          keys.erase(std::unique(keys.begin(), keys.end()), keys.end());
+          too_many_keys = keys.size() > MAX_DYNAMIC_PRUNING_KEY_COUNT;
+        }
+      }
+    }
+  });
+
+  if (too_many_keys) {
+    return std::nullopt;
+  }
+
+  std::sort(keys.begin(), keys.end());
+  keys.erase(std::unique(keys.begin(), keys.end()), keys.end());
+  return keys;
+}
+
+// Returns true if the segment of `column_id` does not contain any of the sorted `keys`.
+template <typename T>
+bool chunk_contains_no_key(const Chunk& chunk, const ColumnID column_id, const std::vector<T>& keys) {
+  if (keys.empty()) {
+    return true;
+  }
+
+  // Mutable chunks are still being appended to and have no pruning statistics.
+  if (chunk.is_mutable()) {
+    return false;
+  }
+
+  const auto& segment = chunk.get_segment(column_id);
+  if (const auto dictionary_segment = std::dynamic_pointer_cast<const DictionarySegment<T>>(segment)) {
+    // The dictionary is sorted. Thus, we only look up the keys within its range.
+    const auto& dictionary = *dictionary_segment->dictionary();
+    if (dictionary.empty()) {
+      return true;
+    }
+
+    const auto keys_begin = std::lower_bound(keys.begin(), keys.end(), dictionary.front());
+    const auto keys_end = std::upper_bound(keys_begin, keys.end(), dictionary.back());
+    return std::none_of(keys_begin, keys_end, [&](const auto& key) {
+      return std::binary_search(dictionary.begin(), dictionary.end(), key);
+    });
+  }
+
+  const auto& pruning_statistics = chunk.pruning_statistics();
+  if (!pruning_statistics) {
+    return false;
+  }
+
+  const auto& segment_statistics = *(*pruning_statistics)[column_id];
+  if (segment_statistics.does_not_contain(PredicateCondition::BetweenInclusive, AllTypeVariant{keys.front()},
+                                          AllTypeVariant{keys.back()})) {
+    return true;
+  }
+
+  if (keys.size() > MAX_DYNAMIC_PRUNING_KEY_COUNT_FOR_STATISTICS) {
+    return false;
+  }
+
+  return std::all_of(keys.begin(), keys.end(), [&](const auto& key) {
+    return segment_statistics.does_not_contain(PredicateCondition::Equals, AllTypeVariant{key});
+  });
+}
+
+}  // namespace
+
 namespace hyrise {
 
 GetTable::GetTable(const std::string& name) : GetTable(name, {}, {}) {}
@@ -51,6 +173,12 @@ std::string GetTable::description(DescriptionMode description_mode) const {
   }
   stream << separator;
   stream << _pruned_column_ids.size() << "/" << stored_table->column_count() << " column(s)";
+  if (_dynamic_pruning_input && executed()) {
+    if (description_mode == DescriptionMode::SingleLine) {
+      stream << ",";
+    }
+    stream << separator << _dynamically_pruned_chunk_count << " chunk(s) at runtime";
+  }
 
   return stream.str();
 }
@@ -67,11 +195,31 @@ const std::vector<ColumnID>& GetTable::pruned_column_ids() const {
   return _pruned_column_ids;
 }
 
+void GetTable::set_dynamic_pruning_input(const DynamicPruningInput& dynamic_pruning_input) {
+  Assert(!_dynamic_pruning_input, "GetTable already has a dynamic pruning input.");
+  Assert(dynamic_pruning_input.build_input, "Dynamic pruning requires a build input.");
+  _dynamic_pruning_input = dynamic_pruning_input;
+  _dynamic_pruning_input->build_input->register_consumer();
+}
+
+const std::optional<GetTable::DynamicPruningInput>& GetTable::dynamic_pruning_input() const {
+  return _dynamic_pruning_input;
+}
+
+size_t GetTable::dynamically_pruned_chunk_count() const {
+  return _dynamically_pruned_chunk_count;
+}
+
 std::shared_ptr<AbstractOperator> GetTable::_on_deep_copy(
     const std::shared_ptr<AbstractOperator>& copied_left_input,
     const std::shared_ptr<AbstractOperator>& copied_right_input,
     std::unordered_map<const AbstractOperator*, std::shared_ptr<AbstractOperator>>& copied_ops) const {
-  return std::make_shared<GetTable>(_name, _pruned_chunk_ids, _pruned_column_ids);
+  const auto copy = std::make_shared<GetTable>(_name, _pruned_chunk_ids, _pruned_column_ids);
+  if (_dynamic_pruning_input) {
+    copy->set_dynamic_pruning_input({_dynamic_pruning_input->build_input->deep_copy(copied_ops),
+                                     _dynamic_pruning_input->build_column_id, _dynamic_pruning_input->column_id});
+  }
+  return copy;
 }
 
 void GetTable::_on_set_parameters(const std::unordered_map<ParameterID, AllTypeVariant>& parameters) {}
@@ -102,6 +250,34 @@ std::shared_ptr<const Table> GetTable::_on_execute() {
   // flag, too, it needs to be forwarded here; otherwise it would be completely invisible in the PQP.
   DebugAssert(stored_table->value_clustered_by().empty(), "GetTable does not forward value_clustered_by");
 
+  // Collect the join keys of the dynamic pruning input, if it has been executed.
+  auto chunk_contains_no_join_key = std::function<bool(const Chunk&)>{};
+  _dynamically_pruned_chunk_count = 0;
+  if (_dynamic_pruning_input && _dynamic_pruning_input->build_input->executed()) {
+    // Map the output column to the column in the stored table.
+    auto stored_column_id = _dynamic_pruning_input->column_id;
+    for (const auto pruned_column_id : _pruned_column_ids) {
+      if (pruned_column_id <= stored_column_id) {
+        ++stored_column_id;
+      }
+    }
+
+    const auto& build_table = *_dynamic_pruning_input->build_input->get_output();
+    resolve_data_type(stored_table->column_data_type(stored_column_id), [&](const auto data_type_t) {
+      using ColumnDataType = typename decltype(data_type_t)::type;
+      auto keys = collect_join_keys<ColumnDataType>(build_table, _dynamic_pruning_input->build_column_id);
+      if (keys) {
+        chunk_contains_no_join_key = [keys = std::move(*keys), stored_column_id](const Chunk& chunk) {
+          return chunk_contains_no_key(chunk, stored_column_id, keys);
+        };
+      }
+    });
+
+    // The join keys have been collected, so we no longer need the output of the dynamic pruning input. If it has not
+    // been executed, we keep the registration because an operator cannot be cleared before it is executed.
+    _dynamic_pruning_input->build_input->deregister_consumer();
+  }
+
   auto excluded_chunk_ids = std::vector<ChunkID>{};
   auto pruned_chunk_ids_iter = _pruned_chunk_ids.begin();
   for (ChunkID stored_chunk_id{0}; stored_chunk_id < chunk_count; ++stored_chunk_id) {
@@ -132,6 +308,13 @@ std::shared_ptr<const Table> GetTable::_on_execute() {
       excluded_chunk_ids.emplace_back(stored_chunk_id);
       continue;
     }
+
+    // Skip chunks that cannot contain any join key of the dynamic pruning input
+    if (chunk_contains_no_join_key && chunk_contains_no_join_key(*chunk)) {
+      excluded_chunk_ids.emplace_back(stored_chunk_id);
+      ++_dynamically_pruned_chunk_count;
+      continue;
+    }
   }
 
   // We cannot create a Table without columns - since Chunks rely on their first column to determine their row count
@@ -1,6 +1,7 @@
 #pragma once
 
 #include <memory>
+#include <optional>
 #include <string>
 #include <vector>
 
@@ -17,6 +18,11 @@ namespace hyrise {
 // have to deal with tables that change their chunk count while they are being looked at. However, rows added to a chunk
 // within that stored table that was already present when GetTable was executed will be visible when calling
 // get_output().
+//
+// Additionally, GetTable can prune chunks at runtime. When it feeds the probe side of an equi-join, the translator
+// passes it the build side's input. Once that input is executed, GetTable skips all chunks that cannot contain any of
+// the build side's join keys (see DynamicPruningInput). For selective build sides (e.g., a filtered dimension table),
+// this avoids reading most chunks of large fact tables, even if the predicate is not on the fact table itself.
 
 class GetTable : public AbstractReadOnlyOperator {
  public:
@@ -34,6 +40,23 @@ class GetTable : public AbstractReadOnlyOperator {
   const std::vector<ChunkID>& pruned_chunk_ids() const;
   const std::vector<ColumnID>& pruned_column_ids() const;
 
+  // Join keys of an operator that is executed before GetTable (usually the build side of a join). GetTable only
+  // outputs chunks whose segment of `column_id` (an output column of GetTable) may contain one of the non-NULL values
+  // in `build_column_id` of the operator's output. GetTable registers as a consumer of the operator so that its output
+  // is not cleared before GetTable is executed. The scheduler must execute the operator first (see OperatorTask). If it
+  // has not been executed, no chunks are pruned.
+  struct DynamicPruningInput {
+    std::shared_ptr<AbstractOperator> build_input;
+    ColumnID build_column_id;
+    ColumnID column_id;
+  };
+
+  void set_dynamic_pruning_input(const DynamicPruningInput& dynamic_pruning_input);
+  const std::optional<DynamicPruningInput>& dynamic_pruning_input() const;
+
+  // Number of chunks pruned during the last execution using the dynamic pruning input.
+  size_t dynamically_pruned_chunk_count() const;
+
   std::shared_ptr<AbstractOperator> _on_deep_copy(
       const std::shared_ptr<AbstractOperator>& copied_left_input,
       const std::shared_ptr<AbstractOperator>& copied_right_input,
@@ -47,5 +70,8 @@ class GetTable : public AbstractReadOnlyOperator {
   const std::string _name;
   const std::vector<ChunkID> _pruned_chunk_ids;
   const std::vector<ColumnID> _pruned_column_ids;
+
+  std::optional<DynamicPruningInput> _dynamic_pruning_input;
+  size_t _dynamically_pruned_chunk_count{0};
 };
 }  // namespace hyrise
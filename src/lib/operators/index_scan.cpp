@@ -4,12 +4,14 @@
 
 #include "expression/between_expression.hpp"
 
+#include "get_table.hpp"
 #include "hyrise.hpp"
 
 #include "scheduler/abstract_task.hpp"
 #include "scheduler/job_task.hpp"
 
 #include "storage/index/abstract_index.hpp"
+#include "storage/index/table_index/abstract_table_index.hpp"
 #include "storage/reference_segment.hpp"
 
 #include "utils/assert.hpp"
@@ -38,6 +40,10 @@ std::shared_ptr<const Table> IndexScan::_on_execute() {
 
   _out_table = std::make_shared<Table>(_in_table->column_definitions(), TableType::References);
 
+  if (_scan_table_index()) {
+    return _out_table;
+  }
+
   std::mutex output_mutex;
 
   auto jobs = std::vector<std::shared_ptr<AbstractTask>>{};
@@ -115,6 +121,102 @@ void IndexScan::_validate_input() {
   Assert(_in_table->type() == TableType::Data, "IndexScan only supports persistent tables right now.");
 }
 
+bool IndexScan::_scan_table_index() {
+  // Table indexes belong to the tables in the StorageManager. The input table is only a copy of the stored table
+  // created by the GetTable operator, in which chunks and columns might be pruned. As the RowIDs of the index refer to
+  // the stored table, we map the scanned column to the stored table and reference the stored table in the output.
+  const auto get_table = std::dynamic_pointer_cast<const GetTable>(left_input());
+  if (!get_table || !included_chunk_ids.empty()) {
+    return false;
+  }
+
+  const auto stored_table = Hyrise::get().storage_manager.get_table(get_table->table_name());
+  const auto& pruned_column_ids = get_table->pruned_column_ids();
+  auto stored_column_ids = std::vector<ColumnID>{};
+  stored_column_ids.reserve(_in_table->column_count());
+  const auto stored_column_count = stored_table->column_count();
+  for (auto stored_column_id = ColumnID{0}; stored_column_id < stored_column_count; ++stored_column_id) {
+    if (!std::binary_search(pruned_column_ids.cbegin(), pruned_column_ids.cend(), stored_column_id)) {
+      stored_column_ids.emplace_back(stored_column_id);
+    }
+  }
+
+  auto matches = RowIDPosList{};
+  if (!_lookup_primary_key_index(*stored_table, stored_column_ids, matches)) {
+    if (_left_column_ids.size() != 1) {
+      return false;
+    }
+
+    const auto table_index =
+        stored_table->get_table_index(stored_column_ids[_left_column_ids[0]], _predicate_condition);
+    if (!table_index) {
+      return false;
+    }
+
+    const auto value2 = _right_values2.empty() ? std::nullopt : std::optional<AllTypeVariant>{_right_values2[0]};
+    table_index->lookup(_predicate_condition, _right_values[0], value2, matches);
+  }
+  std::sort(matches.begin(), matches.end());
+
+  // Write one output chunk per referenced chunk. Pruned chunks are skipped, just as chunks that were physically
+  // deleted.
+  const auto& pruned_chunk_ids = get_table->pruned_chunk_ids();
+  auto chunk_matches_begin = matches.cbegin();
+  while (chunk_matches_begin != matches.cend()) {
+    const auto chunk_id = chunk_matches_begin->chunk_id;
+    const auto chunk_matches_end = std::find_if(chunk_matches_begin, matches.cend(),
+                                                [&](const auto& row_id) { return row_id.chunk_id != chunk_id; });
+
+    const auto chunk = stored_table->get_chunk(chunk_id);
+    if (chunk && !std::binary_search(pruned_chunk_ids.cbegin(), pruned_chunk_ids.cend(), chunk_id)) {
+      const auto pos_list = std::make_shared<RowIDPosList>(chunk_matches_begin, chunk_matches_end);
+      pos_list->guarantee_single_chunk();
+
+      auto segments = Segments{};
+      segments.reserve(stored_column_ids.size());
+      for (const auto stored_column_id : stored_column_ids) {
+        segments.emplace_back(std::make_shared<ReferenceSegment>(stored_table, stored_column_id, pos_list));
+      }
+      _out_table->append_chunk(segments, nullptr, chunk->get_allocator());
+    }
+
+    chunk_matches_begin = chunk_matches_end;
+  }
+
+  return true;
+}
+
+bool IndexScan::_lookup_primary_key_index(const Table& stored_table, const std::vector<ColumnID>& stored_column_ids,
+                                          RowIDPosList& matches) const {
+  const auto primary_key_index = stored_table.primary_key_index();
+  if (!primary_key_index || _predicate_condition != PredicateCondition::Equals) {
+    return false;
+  }
+
+  // The scanned columns have to be exactly the key columns, possibly in a different order.
+  const auto& key_column_ids = primary_key_index->column_ids();
+  const auto key_column_count = key_column_ids.size();
+  if (_left_column_ids.size() != key_column_count) {
+    return false;
+  }
+
+  auto key = PrimaryKeyIndex::Key(key_column_count);
+  for (auto key_column_idx = size_t{0}; key_column_idx < key_column_count; ++key_column_idx) {
+    const auto left_column_iter =
+        std::find_if(_left_column_ids.cbegin(), _left_column_ids.cend(), [&](const auto left_column_id) {
+          return stored_column_ids[left_column_id] == key_column_ids[key_column_idx];
+        });
+    if (left_column_iter == _left_column_ids.cend()) {
+      return false;
+    }
+
+    key[key_column_idx] = _right_values[std::distance(_left_column_ids.cbegin(), left_column_iter)];
+  }
+
+  primary_key_index->lookup(key, matches);
+  return true;
+}
+
 RowIDPosList IndexScan::_scan_chunk(const ChunkID chunk_id) {
   const auto to_row_id = [chunk_id](ChunkOffset chunk_offset) { return RowID{chunk_id, chunk_offset}; };
 
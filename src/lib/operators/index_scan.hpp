@@ -18,6 +18,12 @@ class AbstractTask;
  * Operator that performs a predicate search using indexes
  *
  * Note: Scans only the set of chunks passed to the constructor
+ *
+ * If the input is a GetTable, no chunks are explicitly included, and the stored table has a table index on the
+ * scanned column that supports the predicate (see AbstractTableIndex), this index is used instead of the chunk
+ * indexes of type `index_type`. The output then references the stored table. Likewise, if the predicate condition is
+ * Equals and the scanned columns are the key columns of the stored table's PrimaryKeyIndex, the key is looked up in
+ * that index. In this case, `right_values` holds one value for each of the `left_column_ids`.
  */
 class IndexScan : public AbstractReadOnlyOperator {
  public:
@@ -43,6 +49,13 @@ class IndexScan : public AbstractReadOnlyOperator {
   std::shared_ptr<AbstractTask> _create_job(const ChunkID chunk_id, std::mutex& output_mutex);
   RowIDPosList _scan_chunk(const ChunkID chunk_id);
 
+  // Returns false if neither a table index nor the primary key index can be used
+  bool _scan_table_index();
+
+  // Returns false if the scanned columns and predicate do not form a lookup of the primary key
+  bool _lookup_primary_key_index(const Table& stored_table, const std::vector<ColumnID>& stored_column_ids,
+                                 RowIDPosList& matches) const;
+
  private:
   const SegmentIndexType _index_type;
   const std::vector<ColumnID> _left_column_ids;
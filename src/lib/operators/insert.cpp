@@ -93,6 +93,11 @@ std::shared_ptr<const Table> Insert::_on_execute(std::shared_ptr<TransactionCont
            "Cannot handle inserts into column of different type");
   }
 
+  // Table::table_indexes() and Table::primary_key_index() acquire the append mutex, so we have to retrieve the indexes
+  // before locking it below.
+  const auto target_table_indexes = _target_table->table_indexes();
+  const auto primary_key_index = _target_table->primary_key_index();
+
   /**
    * 1. Allocate the required rows in the target Table, without actually copying data to them.
    *    Do so while locking the table to prevent multiple threads modifying the table's size simultaneously.
@@ -218,6 +223,37 @@ std::shared_ptr<const Table> Insert::_on_execute(std::shared_ptr<TransactionCont
     }
   }
 
+  /**
+   * 3. Add the rows to the table indexes. They are added before the transaction commits. Until then, the rows are not
+   *    visible to other transactions (see AbstractTableIndex).
+   */
+  for (const auto& table_index : target_table_indexes) {
+    for (const auto& target_chunk_range : _target_chunk_ranges) {
+      const auto target_chunk = _target_table->get_chunk(target_chunk_range.chunk_id);
+      table_index->insert_entries(target_chunk_range.chunk_id, *target_chunk->get_segment(table_index->column_id()),
+                                  target_chunk_range.begin_chunk_offset, target_chunk_range.end_chunk_offset);
+    }
+  }
+  _target_table_indexes = target_table_indexes;
+
+  /**
+   * 4. Check the uniqueness of the primary key while adding the rows to the primary key index. If another row already
+   *    holds a key, the transaction conflicts. Rows that have been added so far are removed on rollback.
+   */
+  if (primary_key_index) {
+    _primary_key_index = primary_key_index;
+    for (const auto& target_chunk_range : _target_chunk_ranges) {
+      const auto unique =
+          primary_key_index->insert_entries(*_target_table, target_chunk_range.chunk_id,
+                                            target_chunk_range.begin_chunk_offset,
+                                            target_chunk_range.end_chunk_offset, context->transaction_id());
+      if (!unique) {
+        _mark_as_failed();
+        return nullptr;
+      }
+    }
+  }
+
   return nullptr;
 }
 
@@ -225,6 +261,7 @@ void Insert::_on_commit_records(const CommitID cid) {
   for (const auto& target_chunk_range : _target_chunk_ranges) {
     const auto target_chunk = _target_table->get_chunk(target_chunk_range.chunk_id);
     auto mvcc_data = target_chunk->mvcc_data();
+    target_chunk->update_last_modification_commit_id(cid);
 
     for (auto chunk_offset = target_chunk_range.begin_chunk_offset; chunk_offset < target_chunk_range.end_chunk_offset;
          ++chunk_offset) {
@@ -242,6 +279,16 @@ void Insert::_on_rollback_records() {
     const auto target_chunk = _target_table->get_chunk(target_chunk_range.chunk_id);
     auto mvcc_data = target_chunk->mvcc_data();
 
+    // The rows were never visible to other transactions, so they can be removed from the table indexes right away.
+    for (const auto& table_index : _target_table_indexes) {
+      table_index->remove_entries(target_chunk_range.chunk_id, *target_chunk->get_segment(table_index->column_id()),
+                                  target_chunk_range.begin_chunk_offset, target_chunk_range.end_chunk_offset);
+    }
+    if (_primary_key_index) {
+      _primary_key_index->remove_entries(*target_chunk, target_chunk_range.chunk_id,
+                                         target_chunk_range.begin_chunk_offset, target_chunk_range.end_chunk_offset);
+    }
+
     /**
      * !!! Crucial comment, PLEASE READ AND _UNDERSTAND_ before altering any of the following code !!!
      *
@@ -10,6 +10,8 @@
 
 namespace hyrise {
 
+class AbstractTableIndex;
+class PrimaryKeyIndex;
 class TransactionContext;
 
 /**
@@ -18,6 +20,9 @@ class TransactionContext;
  * the values to insert in a separate table using the same column layout.
  *
  * Assumption: The input has been validated before.
+ *
+ * If the target table has a PrimaryKeyIndex, the operator fails (and the transaction conflicts) when an inserted key
+ * is already held by another row.
  */
 class Insert : public AbstractReadWriteOperator {
  public:
@@ -49,6 +54,11 @@ class Insert : public AbstractReadWriteOperator {
   std::vector<ChunkRange> _target_chunk_ranges;
 
   std::shared_ptr<Table> _target_table;
+
+  // Table indexes and primary key index of the target table that the inserted rows were added to. They are removed
+  // on rollback.
+  std::vector<std::shared_ptr<AbstractTableIndex>> _target_table_indexes;
+  std::shared_ptr<PrimaryKeyIndex> _primary_key_index;
 };
 
 }  // namespace hyrise
@@ -416,6 +416,7 @@ RadixContainer<T> materialize_input(const std::shared_ptr<const Table>& in_table
       materialize();
     } else {
       jobs.emplace_back(std::make_shared<JobTask>(materialize));
+      jobs.back()->set_preferred_node_id(chunk_in->numa_node_id());
     }
   }
   Hyrise::get().scheduler()->schedule_and_wait_for_tasks(jobs);
@@ -9,10 +9,15 @@
 #include <vector>
 
 #include "all_type_variant.hpp"
+#include "get_table.hpp"
+#include "hyrise.hpp"
 #include "join_nested_loop.hpp"
 #include "multi_predicate_join/multi_predicate_join_evaluator.hpp"
 #include "resolve_type.hpp"
 #include "storage/index/abstract_index.hpp"
+#include "storage/index/table_index/abstract_table_index.hpp"
+#include "storage/index/table_index/hash_table_index.hpp"
+#include "storage/index/table_index/ordered_table_index.hpp"
 #include "storage/segment_iterate.hpp"
 #include "type_comparison.hpp"
 #include "utils/assert.hpp"
@@ -202,37 +207,47 @@ std::shared_ptr<const Table> JoinIndex::_on_execute() {
       }
     }
   } else {  // DATA JOIN since only inner joins are supported for a reference table on the index side
-    // Scan all chunks for index input
-    const auto chunk_count_index_input_table = _index_input_table->chunk_count();
-    for (ChunkID index_chunk_id{0}; index_chunk_id < chunk_count_index_input_table; ++index_chunk_id) {
-      const auto index_chunk = _index_input_table->get_chunk(index_chunk_id);
-      Assert(index_chunk, "Physically deleted chunk should not reach this point, see get_chunk / #1686.");
+    // A table index covers all chunks of the index side. It is used for equi-joins if one exists, see
+    // _table_index_for_data_join(). Matches in the index side are not tracked for table indexes, so they are not used
+    // for joins that emit unmatched index side rows.
+    const auto table_index = track_index_matches ? nullptr : _table_index_for_data_join();
+    if (table_index) {
+      _data_join_using_table_index(*table_index);
+      index_joining_duration += timer.lap();
+      join_index_performance_data.chunks_scanned_with_index += _index_input_table->chunk_count();
+    } else {
+      // Scan all chunks for index input
+      const auto chunk_count_index_input_table = _index_input_table->chunk_count();
+      for (ChunkID index_chunk_id{0}; index_chunk_id < chunk_count_index_input_table; ++index_chunk_id) {
+        const auto index_chunk = _index_input_table->get_chunk(index_chunk_id);
+        Assert(index_chunk, "Physically deleted chunk should not reach this point, see get_chunk / #1686.");
 
-      const auto& indexes =
-          index_chunk->get_indexes(std::vector<ColumnID>{_adjusted_primary_predicate.column_ids.second});
+        const auto& indexes =
+            index_chunk->get_indexes(std::vector<ColumnID>{_adjusted_primary_predicate.column_ids.second});
 
-      if (!indexes.empty()) {
-        // We assume the first index to be efficient for our join
-        // as we do not want to spend time on evaluating the best index inside of this join loop
-        const auto& index = indexes.front();
+        if (!indexes.empty()) {
+          // We assume the first index to be efficient for our join
+          // as we do not want to spend time on evaluating the best index inside of this join loop
+          const auto& index = indexes.front();
 
-        // Scan all chunks from the probe side input
-        const auto chunk_count_probe_input_table = _probe_input_table->chunk_count();
-        for (ChunkID probe_chunk_id{0}; probe_chunk_id < chunk_count_probe_input_table; ++probe_chunk_id) {
-          const auto chunk = _probe_input_table->get_chunk(probe_chunk_id);
-          Assert(chunk, "Physically deleted chunk should not reach this point, see get_chunk / #1686.");
+          // Scan all chunks from the probe side input
+          const auto chunk_count_probe_input_table = _probe_input_table->chunk_count();
+          for (ChunkID probe_chunk_id{0}; probe_chunk_id < chunk_count_probe_input_table; ++probe_chunk_id) {
+            const auto chunk = _probe_input_table->get_chunk(probe_chunk_id);
+            Assert(chunk, "Physically deleted chunk should not reach this point, see get_chunk / #1686.");
 
-          const auto& probe_segment = chunk->get_segment(_adjusted_primary_predicate.column_ids.first);
-          segment_with_iterators(*probe_segment, [&](auto probe_iter, const auto probe_end) {
-            _data_join_two_segments_using_index(probe_iter, probe_end, probe_chunk_id, index_chunk_id, index);
-          });
+            const auto& probe_segment = chunk->get_segment(_adjusted_primary_predicate.column_ids.first);
+            segment_with_iterators(*probe_segment, [&](auto probe_iter, const auto probe_end) {
+              _data_join_two_segments_using_index(probe_iter, probe_end, probe_chunk_id, index_chunk_id, index);
+            });
+          }
+          index_joining_duration += timer.lap();
+          join_index_performance_data.chunks_scanned_with_index++;
+        } else {
+          _fallback_nested_loop(index_chunk_id, track_probe_matches, track_index_matches, is_semi_or_anti_join,
+                                secondary_predicate_evaluator);
+          nested_loop_joining_duration += timer.lap();
         }
-        index_joining_duration += timer.lap();
-        join_index_performance_data.chunks_scanned_with_index++;
-      } else {
-        _fallback_nested_loop(index_chunk_id, track_probe_matches, track_index_matches, is_semi_or_anti_join,
-                              secondary_predicate_evaluator);
-        nested_loop_joining_duration += timer.lap();
       }
     }
 
@@ -459,6 +474,115 @@ void JoinIndex::_append_matches(const AbstractIndex::Iterator& range_begin, cons
   }
 }
 
+std::shared_ptr<AbstractTableIndex> JoinIndex::_table_index_for_data_join() const {
+  if (_adjusted_primary_predicate.predicate_condition != PredicateCondition::Equals ||
+      _mode == JoinMode::AntiNullAsTrue) {
+    return nullptr;
+  }
+
+  const auto probe_column_id = _adjusted_primary_predicate.column_ids.first;
+  const auto index_column_id = _adjusted_primary_predicate.column_ids.second;
+  if (_probe_input_table->column_data_type(probe_column_id) != _index_input_table->column_data_type(index_column_id)) {
+    return nullptr;
+  }
+
+  // The RowIDs of a table index refer to the stored table. We can only use them for the index side input if it holds
+  // exactly the stored table's chunks, i.e., if it is the output of a GetTable that neither pruned columns nor chunks.
+  const auto& index_side_operator = _index_side == IndexSide::Left ? left_input() : right_input();
+  const auto get_table = std::dynamic_pointer_cast<const GetTable>(index_side_operator);
+  if (!get_table || !get_table->pruned_column_ids().empty()) {
+    return nullptr;
+  }
+
+  const auto stored_table = Hyrise::get().storage_manager.get_table(get_table->table_name());
+  const auto chunk_count = _index_input_table->chunk_count();
+  if (stored_table->chunk_count() < chunk_count) {
+    return nullptr;
+  }
+
+  for (auto chunk_id = ChunkID{0}; chunk_id < chunk_count; ++chunk_id) {
+    if (_index_input_table->get_chunk(chunk_id) != stored_table->get_chunk(chunk_id)) {
+      return nullptr;
+    }
+  }
+
+  return stored_table->get_table_index(index_column_id, PredicateCondition::Equals);
+}
+
+void JoinIndex::_data_join_using_table_index(const AbstractTableIndex& table_index) {
+  const auto index_chunk_count = _index_input_table->chunk_count();
+  const auto probe_column_id = _adjusted_primary_predicate.column_ids.first;
+  auto index_matches = RowIDPosList{};
+
+  // The index is locked once for all probes, see AbstractTableIndex::acquire_shared_lock().
+  const auto lock = table_index.acquire_shared_lock();
+
+  resolve_data_type(_probe_input_table->column_data_type(probe_column_id), [&](const auto data_type_t) {
+    using ColumnDataType = typename decltype(data_type_t)::type;
+
+    // The probe and index columns have the same data type (see _table_index_for_data_join()), so the probe values are
+    // looked up without conversion.
+    const auto probe = [&](const auto& typed_table_index) {
+      const auto chunk_count_probe_input_table = _probe_input_table->chunk_count();
+      for (ChunkID probe_chunk_id{0}; probe_chunk_id < chunk_count_probe_input_table; ++probe_chunk_id) {
+        const auto chunk = _probe_input_table->get_chunk(probe_chunk_id);
+        Assert(chunk, "Physically deleted chunk should not reach this point, see get_chunk / #1686.");
+
+        const auto& probe_segment = chunk->get_segment(probe_column_id);
+        segment_with_iterators<ColumnDataType>(*probe_segment, [&](auto probe_iter, const auto probe_end) {
+          for (; probe_iter != probe_end; ++probe_iter) {
+            const auto probe_side_position = *probe_iter;
+            if (probe_side_position.is_null()) {
+              continue;
+            }
+
+            index_matches.clear();
+            typed_table_index.lookup_equals(probe_side_position.value(), index_matches);
+
+            // Rows appended to the stored table after the index side input was retrieved are not part of the input.
+            index_matches.erase(
+                std::remove_if(index_matches.begin(), index_matches.end(),
+                               [&](const auto& row_id) { return row_id.chunk_id >= index_chunk_count; }),
+                index_matches.end());
+            _append_table_index_matches(index_matches, probe_side_position.chunk_offset(), probe_chunk_id);
+          }
+        });
+      }
+    };
+
+    switch (table_index.type()) {
+      case TableIndexType::Hash:
+        probe(static_cast<const HashTableIndex<ColumnDataType>&>(table_index));
+        break;
+      case TableIndexType::Ordered:
+        probe(static_cast<const OrderedTableIndex<ColumnDataType>&>(table_index));
+        break;
+    }
+  });
+}
+
+void JoinIndex::_append_table_index_matches(const RowIDPosList& index_matches, const ChunkOffset probe_chunk_offset,
+                                            const ChunkID probe_chunk_id) {
+  if (index_matches.empty()) {
+    return;
+  }
+
+  const auto is_semi_or_anti_join =
+      _mode == JoinMode::Semi || _mode == JoinMode::AntiNullAsFalse || _mode == JoinMode::AntiNullAsTrue;
+
+  // Remember the matches for non-inner joins
+  if (((is_semi_or_anti_join || _mode == JoinMode::Left) && _index_side == IndexSide::Right) ||
+      (_mode == JoinMode::Right && _index_side == IndexSide::Left) || _mode == JoinMode::FullOuter) {
+    _probe_matches[probe_chunk_id][probe_chunk_offset] = true;
+  }
+
+  if (!is_semi_or_anti_join) {
+    // we replicate the probe side value for each index side value
+    std::fill_n(std::back_inserter(*_probe_pos_list), index_matches.size(), RowID{probe_chunk_id, probe_chunk_offset});
+    _index_pos_list->insert(_index_pos_list->end(), index_matches.cbegin(), index_matches.cend());
+  }
+}
+
 void JoinIndex::_append_matches_dereferenced(const ChunkID& probe_chunk_id, const ChunkOffset& probe_chunk_offset,
                                              const RowIDPosList& index_table_matches) {
   for (const auto& index_side_row_id : index_table_matches) {
@@ -13,6 +13,7 @@
 
 namespace hyrise {
 
+class AbstractTableIndex;
 class MultiPredicateJoinEvaluator;
 using IndexRange = std::pair<AbstractIndex::Iterator, AbstractIndex::Iterator>;
 
@@ -27,6 +28,10 @@ using IndexRange = std::pair<AbstractIndex::Iterator, AbstractIndex::Iterator>;
    * scanned with index in the performance data.
    *
    * Note: An index needs to be present on the index side table in order to execute an index join.
+   *
+   * For equi-joins on data tables, a table index (see AbstractTableIndex) of the stored index side table is used
+   * instead of the chunk indexes if the index side input is a GetTable without pruned columns or chunks. A single
+   * lookup per probe value then finds the matches in all chunks.
    */
 class JoinIndex : public AbstractJoinOperator {
  public:
@@ -84,6 +89,14 @@ class JoinIndex : public AbstractJoinOperator {
                        const ChunkOffset probe_chunk_offset, const ChunkID probe_chunk_id,
                        const ChunkID index_chunk_id);
 
+  // Returns nullptr if no table index can be used for the index side, see class comment.
+  std::shared_ptr<AbstractTableIndex> _table_index_for_data_join() const;
+
+  void _data_join_using_table_index(const AbstractTableIndex& table_index);
+
+  void _append_table_index_matches(const RowIDPosList& index_matches, const ChunkOffset probe_chunk_offset,
+                                   const ChunkID probe_chunk_id);
+
   void _append_matches_dereferenced(const ChunkID& probe_chunk_id, const ChunkOffset& probe_chunk_offset,
                                     const RowIDPosList& index_table_matches);
 
@@ -203,6 +203,7 @@ std::shared_ptr<const Table> Projection::_on_execute() {
     constexpr auto JOB_SPAWN_THRESHOLD = ChunkOffset{500};
     if (input_chunk->size() >= JOB_SPAWN_THRESHOLD) {
       auto job_task = std::make_shared<JobTask>(perform_projection_evaluation);
+      job_task->set_preferred_node_id(input_chunk->numa_node_id());
       jobs.push_back(job_task);
     } else {
       perform_projection_evaluation();
@@ -296,6 +297,9 @@ std::shared_ptr<const Table> Projection::_on_execute() {
       }
     }
 
+    // The output chunk lives where its input was processed, so successive operators keep the NUMA affinity.
+    chunk->set_numa_node_id(input_chunk->numa_node_id());
+
     // Forward sorted_by flags, mapping column ids
     const auto& sorted_by = input_chunk->individually_sorted_by();
     if (!sorted_by.empty()) {
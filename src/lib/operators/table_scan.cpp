@@ -33,6 +33,7 @@
 #include "table_scan/column_like_table_scan_impl.hpp"
 #include "table_scan/column_vs_column_table_scan_impl.hpp"
 #include "table_scan/column_vs_value_table_scan_impl.hpp"
+#include "table_scan/compiled_predicate_table_scan_impl.hpp"
 #include "table_scan/expression_evaluator_table_scan_impl.hpp"
 #include "utils/assert.hpp"
 #include "utils/lossless_predicate_cast.hpp"
@@ -210,6 +211,7 @@ std::shared_ptr<const Table> TableScan::_on_execute() {
       }
 
       const auto chunk = std::make_shared<Chunk>(out_segments, nullptr, chunk_in->get_allocator());
+      chunk->set_numa_node_id(chunk_in->numa_node_id());
       chunk->finalize();
       if (keep_chunk_sort_order && !chunk_in->individually_sorted_by().empty()) {
         chunk->set_individually_sorted_by(chunk_in->individually_sorted_by());
@@ -222,6 +224,7 @@ std::shared_ptr<const Table> TableScan::_on_execute() {
     constexpr auto JOB_SPAWN_THRESHOLD = ChunkOffset{500};
     if (chunk_in->size() >= JOB_SPAWN_THRESHOLD) {
       auto job_task = std::make_shared<JobTask>(perform_table_scan);
+      job_task->set_preferred_node_id(chunk_in->numa_node_id());
       jobs.push_back(job_task);
     } else {
       perform_table_scan();
@@ -330,11 +333,15 @@ std::unique_ptr<AbstractTableScanImpl> TableScan::create_impl() {
    * use lossless casts to guarantee safe type conversions. This was introduced by #1550.
    *
    * Use the ExpressionEvaluator as a powerful, but slower fallback if no dedicated scanning implementation exists for
-   * an expression.
+   * an expression. If the PredicateCompiler is enabled, complex predicates are compiled instead.
    */
 
   const auto resolved_predicate = _resolve_uncorrelated_subqueries(_predicate);
+  return _create_impl(resolved_predicate, true);
+}
 
+std::unique_ptr<AbstractTableScanImpl> TableScan::_create_impl(
+    const std::shared_ptr<const AbstractExpression>& resolved_predicate, const bool allow_compilation) {
   if (const auto binary_predicate_expression =
           std::dynamic_pointer_cast<const BinaryPredicateExpression>(resolved_predicate)) {
     auto predicate_condition = binary_predicate_expression->predicate_condition;
@@ -456,6 +463,21 @@ std::unique_ptr<AbstractTableScanImpl> TableScan::create_impl() {
     }
   }
 
+  // Predicate pattern: Complex predicates without subqueries, e.g., `a = 1 OR b < 2` or `a + b > 5`. The simple parts
+  // of the compiled predicate are delegated to the impls above.
+  auto& predicate_compiler = *Hyrise::get().predicate_compiler;
+  if (allow_compilation && predicate_compiler.enabled() && _uncorrelated_subquery_expressions.empty()) {
+    auto [compiled_predicate, parameters] = predicate_compiler.compile(resolved_predicate);
+    if (compiled_predicate) {
+      auto delegated_impls = std::vector<std::unique_ptr<AbstractTableScanImpl>>{};
+      for (const auto& delegated_predicate : compiled_predicate->bind_delegated_predicates(parameters)) {
+        delegated_impls.emplace_back(_create_impl(delegated_predicate, false));
+      }
+      return std::make_unique<CompiledPredicateTableScanImpl>(left_input_table(), compiled_predicate,
+                                                              std::move(parameters), std::move(delegated_impls));
+    }
+  }
+
   // Predicate pattern: Everything else. Fall back to ExpressionEvaluator.
   const auto& uncorrelated_subquery_results =
       ExpressionEvaluator::populate_uncorrelated_subquery_results_cache(_uncorrelated_subquery_expressions);
@@ -85,6 +85,11 @@ class TableScan : public AbstractReadOnlyOperator {
   std::shared_ptr<const AbstractExpression> _resolve_uncorrelated_subqueries(
       const std::shared_ptr<const AbstractExpression>& predicate);
 
+  // Creates the impl for a predicate whose uncorrelated subqueries were already resolved. Compilation is not allowed for
+  // the predicates that a CompiledPredicate delegates, as they would otherwise be compiled again.
+  std::unique_ptr<AbstractTableScanImpl> _create_impl(
+      const std::shared_ptr<const AbstractExpression>& resolved_predicate, const bool allow_compilation);
+
  private:
   const std::shared_ptr<AbstractExpression> _predicate;
   std::vector<std::shared_ptr<PQPSubqueryExpression>> _uncorrelated_subquery_expressions;
@@ -4,13 +4,16 @@
 #include <x86intrin.h>
 #endif
 
+#include <algorithm>
 #include <array>
 #include <atomic>
+#include <bit>
 
 #include "operators/operator_performance_data.hpp"
 #include "storage/pos_lists/row_id_pos_list.hpp"
 #include "storage/segment_iterables.hpp"
 #include "storage/segment_iterables/any_segment_iterator.hpp"
+#include "storage/vector_compression/bitpacking/bitpacking_vector.hpp"
 #include "types.hpp"
 #include "utils/performance_warning.hpp"
 
@@ -238,6 +241,44 @@ class AbstractTableScanImpl {
     // The remainder is now done by the regular scan
   }
 
+  // Scans a bit-packed attribute vector without iterators. Blocks of value IDs are decoded into a buffer that stays in
+  // the L1 cache, and the predicate is evaluated on the decoded value IDs. Only used without a position filter.
+  template <bool CheckForNull, typename ValueIDPredicate>
+  static void __attribute__((hot, flatten, noinline))
+  _scan_bit_packed_attribute_vector(const ValueIDPredicate predicate, const BitPackingVector& attribute_vector,
+                                    const ValueID null_value_id, const ChunkID chunk_id, RowIDPosList& matches_out) {
+    constexpr auto BLOCK_SIZE = BitPackingVector::BLOCK_SIZE;
+    static_assert(BLOCK_SIZE <= 64, "The matches of a block are collected in a 64-bit mask.");
+
+    const auto size = attribute_vector.size();
+    const auto block_count = (size + BLOCK_SIZE - 1) / BLOCK_SIZE;
+    auto value_ids = std::array<uint32_t, BLOCK_SIZE>{};
+
+    for (auto block_index = size_t{0}; block_index < block_count; ++block_index) {
+      attribute_vector.decode_block(block_index, value_ids);
+      const auto block_begin = block_index * BLOCK_SIZE;
+      const auto block_size = std::min(BLOCK_SIZE, size - block_begin);
+
+      auto mask = uint64_t{0};
+
+      // NOLINTNEXTLINE
+      {}  // clang-format off
+      #pragma omp simd reduction(|:mask) safelen(BLOCK_SIZE)
+      // clang-format on
+      for (auto index = size_t{0}; index < block_size; ++index) {
+        const auto value_id = ValueID{value_ids[index]};
+        mask |= static_cast<uint64_t>((!CheckForNull | (value_id != null_value_id)) & predicate(value_id)) << index;
+      }
+
+      // Append the offsets of all set bits.
+      while (mask) {
+        const auto index = static_cast<size_t>(std::countr_zero(mask));
+        matches_out.emplace_back(RowID{chunk_id, static_cast<ChunkOffset>(block_begin + index)});
+        mask &= mask - 1;
+      }
+    }
+  }
+
   /**@}*/
 };
 
@@ -171,8 +171,20 @@ void ColumnBetweenTableScanImpl::_scan_dictionary_segment(
     return (position.value() - lower_bound_value_id) < value_id_diff;
   };
 
+  // No need to check for NULL because NULL would be represented as a value ID outside of our range. Bit-packed
+  // attribute vectors are scanned block by block (see _scan_bit_packed_attribute_vector).
+  const auto& attribute_vector = *segment.attribute_vector();
+  if (!position_filter && attribute_vector.type() == CompressedVectorType::BitPacking) {
+    const auto value_id_predicate = [lower_bound_value_id, value_id_diff](const ValueID value_id) {
+      return (value_id - lower_bound_value_id) < value_id_diff;
+    };
+    _scan_bit_packed_attribute_vector<false>(value_id_predicate, static_cast<const BitPackingVector&>(attribute_vector),
+                                             segment.null_value_id(), chunk_id, matches);
+    segment.access_counter[SegmentAccessCounter::AccessType::Sequential] += attribute_vector.size();
+    return;
+  }
+
   attribute_vector_iterable.with_iterators(position_filter, [&](auto left_it, auto left_end) {
-    // No need to check for NULL because NULL would be represented as a value ID outside of our range
     _scan_with_iterators<false>(comparator, left_it, left_end, chunk_id, matches);
   });
 }
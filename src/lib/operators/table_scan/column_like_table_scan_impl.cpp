@@ -4,7 +4,6 @@
 #include <array>
 #include <map>
 #include <memory>
-#include <regex>
 #include <sstream>
 #include <string>
 #include <utility>
@@ -90,6 +89,7 @@ void ColumnLikeTableScanImpl::_scan_dictionary_segment(const BaseDictionarySegme
 
   // LIKE matches all rows, but we still need to check for NULL
   if (match_count == dictionary_matches.size()) {
+    ++num_chunks_with_all_rows_matching;
     attribute_vector_iterable.with_iterators(position_filter, [&](auto iter, auto end) {
       static const auto always_true = [](const auto&) { return true; };
       _scan_with_iterators<true>(always_true, iter, end, chunk_id, matches);
@@ -150,21 +150,43 @@ void ColumnVsValueTableScanImpl::_scan_dictionary_segment(
     return;
   }
 
+  // dictionary.size() represents a NULL in the AttributeVector. For some PredicateConditions, we can avoid explicitly
+  // checking for it, since the condition (e.g., LessThan) would never return true for dictionary.size() anyway.
+  const auto check_for_null = predicate_condition != PredicateCondition::Equals &&
+                              predicate_condition != PredicateCondition::LessThanEquals &&
+                              predicate_condition != PredicateCondition::LessThan;
+
+  // Bit-packed attribute vectors are scanned block by block (see _scan_bit_packed_attribute_vector).
+  const auto& attribute_vector = *segment.attribute_vector();
+  if (!position_filter && attribute_vector.type() == CompressedVectorType::BitPacking) {
+    const auto& bit_packed_attribute_vector = static_cast<const BitPackingVector&>(attribute_vector);
+    _with_operator_for_dict_segment_scan([&](auto predicate_comparator) {
+      const auto value_id_predicate = [predicate_comparator, search_value_id](const ValueID value_id) {
+        return predicate_comparator(value_id, search_value_id);
+      };
+
+      if (check_for_null) {
+        _scan_bit_packed_attribute_vector<true>(value_id_predicate, bit_packed_attribute_vector,
+                                                segment.null_value_id(), chunk_id, matches);
+      } else {
+        _scan_bit_packed_attribute_vector<false>(value_id_predicate, bit_packed_attribute_vector,
+                                                 segment.null_value_id(), chunk_id, matches);
+      }
+    });
+    segment.access_counter[SegmentAccessCounter::AccessType::Sequential] += attribute_vector.size();
+    return;
+  }
+
   _with_operator_for_dict_segment_scan([&](auto predicate_comparator) {
     auto comparator = [predicate_comparator, search_value_id](const auto& position) {
       return predicate_comparator(position.value(), search_value_id);
     };
 
     iterable.with_iterators(position_filter, [&](auto it, auto end) {
-      // dictionary.size() represents a NULL in the AttributeVector. For some PredicateConditions, we can
-      // avoid explicitly checking for it, since the condition (e.g., LessThan) would never return true for
-      // dictionary.size() anyway.
-      if (predicate_condition == PredicateCondition::Equals ||
-          predicate_condition == PredicateCondition::LessThanEquals ||
-          predicate_condition == PredicateCondition::LessThan) {
-        _scan_with_iterators<false>(comparator, it, end, chunk_id, matches);
-      } else {
+      if (check_for_null) {
         _scan_with_iterators<true>(comparator, it, end, chunk_id, matches);
+      } else {
+        _scan_with_iterators<false>(comparator, it, end, chunk_id, matches);
       }
     });
   });
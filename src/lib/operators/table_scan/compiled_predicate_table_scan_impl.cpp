@@ -0,0 +1,38 @@
+#include "compiled_predicate_table_scan_impl.hpp"
+
+#include <sstream>
+
+#include "storage/table.hpp"
+#include "utils/assert.hpp"
+
+namespace hyrise {
+
+CompiledPredicateTableScanImpl::CompiledPredicateTableScanImpl(
+    const std::shared_ptr<const Table>& in_table, const std::shared_ptr<const CompiledPredicate>& compiled_predicate,
+    std::vector<AllTypeVariant> parameters, std::vector<std::unique_ptr<AbstractTableScanImpl>> delegated_impls)
+    : _in_table(in_table),
+      _compiled_predicate(compiled_predicate),
+      _parameters(std::move(parameters)),
+      _delegated_impls(std::move(delegated_impls)) {
+  Assert(_delegated_impls.size() == _compiled_predicate->delegated_predicates().size(),
+         "Expected one TableScanImpl per delegated predicate");
+}
+
+std::string CompiledPredicateTableScanImpl::description() const {
+  auto stream = std::stringstream{};
+  stream << "CompiledPredicate (" << _compiled_predicate->kernel_count() << " kernels";
+  for (const auto& delegated_impl : _delegated_impls) {
+    stream << ", " << delegated_impl->description();
+  }
+  stream << ")";
+  return stream.str();
+}
+
+std::shared_ptr<RowIDPosList> CompiledPredicateTableScanImpl::scan_chunk(ChunkID chunk_id) {
+  const auto chunk = _in_table->get_chunk(chunk_id);
+  return _compiled_predicate->scan(chunk_id, *chunk, _parameters, [&](const size_t delegated_predicate_idx) {
+    return _delegated_impls[delegated_predicate_idx]->scan_chunk(chunk_id);
+  });
+}
+
+}  // namespace hyrise
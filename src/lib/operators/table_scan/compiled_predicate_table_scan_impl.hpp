@@ -0,0 +1,36 @@
+#pragma once
+
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "abstract_table_scan_impl.hpp"
+#include "predicate_compiler.hpp"
+
+namespace hyrise {
+
+class Table;
+
+/**
+ * Scans a chunk using a CompiledPredicate (see predicate_compiler.hpp) with the values of @param parameters. The
+ * predicates that the CompiledPredicate delegates are evaluated by the @param delegated_impls, which are expected in
+ * the order of CompiledPredicate::delegated_predicates().
+ */
+class CompiledPredicateTableScanImpl : public AbstractTableScanImpl {
+ public:
+  CompiledPredicateTableScanImpl(const std::shared_ptr<const Table>& in_table,
+                                 const std::shared_ptr<const CompiledPredicate>& compiled_predicate,
+                                 std::vector<AllTypeVariant> parameters,
+                                 std::vector<std::unique_ptr<AbstractTableScanImpl>> delegated_impls);
+
+  std::string description() const override;
+  std::shared_ptr<RowIDPosList> scan_chunk(ChunkID chunk_id) override;
+
+ private:
+  std::shared_ptr<const Table> _in_table;
+  const std::shared_ptr<const CompiledPredicate> _compiled_predicate;
+  const std::vector<AllTypeVariant> _parameters;
+  const std::vector<std::unique_ptr<AbstractTableScanImpl>> _delegated_impls;
+};
+
+}  // namespace hyrise
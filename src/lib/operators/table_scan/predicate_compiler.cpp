@@ -0,0 +1,835 @@
+#include "predicate_compiler.hpp"
+
+#include <algorithm>
+#include <functional>
+#include <optional>
+#include <span>
+#include <type_traits>
+#include <unordered_map>
+#include <utility>
+
+#include <boost/container/pmr/monotonic_buffer_resource.hpp>
+
+#include "expression/arithmetic_expression.hpp"
+#include "expression/between_expression.hpp"
+#include "expression/binary_predicate_expression.hpp"
+#include "expression/correlated_parameter_expression.hpp"
+#include "expression/expression_utils.hpp"
+#include "expression/is_null_expression.hpp"
+#include "expression/logical_expression.hpp"
+#include "expression/pqp_column_expression.hpp"
+#include "expression/value_expression.hpp"
+#include "hyrise.hpp"
+#include "resolve_type.hpp"
+#include "storage/chunk.hpp"
+#include "storage/segment_iterate.hpp"
+#include "storage/value_segment.hpp"
+#include "type_comparison.hpp"
+#include "utils/assert.hpp"
+
+namespace hyrise {
+
+struct CompiledPredicateContext {
+  const Chunk& chunk;
+  const ChunkOffset row_count;
+  const std::vector<AllTypeVariant>& parameters;
+  boost::container::pmr::memory_resource* memory_resource;
+  const CompiledPredicate::DelegatedScan& delegated_scan;
+};
+
+class AbstractCompiledPredicateNode {
+ public:
+  virtual ~AbstractCompiledPredicateNode() = default;
+
+  // Sets the mask to 1 for all rows that satisfy the predicate and to 0 for all others, including those for which the
+  // predicate is NULL. As NOT is not supported, this two-valued logic is sufficient for AND and OR.
+  virtual void evaluate(CompiledPredicateContext& context, pmr_vector<uint8_t>& mask) const = 0;
+};
+
+}  // namespace hyrise
+
+namespace {
+
+using namespace hyrise;  // NOLINT
+
+/**
+ * The values of an operand for all rows of a chunk. The spans either point into a ValueSegment, a literal, or into the
+ * buffers, which are allocated from the context's memory resource. As all buffers of a context share that resource,
+ * moving a buffer to another OperandValues does not invalidate the spans. `nulls` is empty if the operand cannot be
+ * NULL. Literals, and operands computed from literals only, hold a single value (and null) that applies to all rows.
+ * For chunks with a single row, both representations are the same.
+ */
+template <typename T>
+struct OperandValues {
+  explicit OperandValues(boost::container::pmr::memory_resource* memory_resource)
+      : buffer(memory_resource), null_buffer(memory_resource) {}
+
+  pmr_vector<T> buffer;
+  pmr_vector<uint8_t> null_buffer;
+
+  std::span<const T> values;
+  std::span<const uint8_t> nulls;
+};
+
+// Calls @param functor with a function that returns the value of @param operand for a chunk offset. Literals are read
+// from their single value instead of being broadcast to all rows. The functor is instantiated for both cases.
+template <typename T, typename Functor>
+void with_value_accessor(const OperandValues<T>& operand, const Functor& functor) {
+  if (operand.values.size() == 1) {
+    const auto& value = operand.values.front();
+    functor([&value](const ChunkOffset /* chunk_offset */) -> const T& { return value; });
+  } else {
+    const auto* const values = operand.values.data();
+    functor([values](const ChunkOffset chunk_offset) -> const T& { return values[chunk_offset]; });
+  }
+}
+
+template <typename T>
+class AbstractOperandKernel {
+ public:
+  virtual ~AbstractOperandKernel() = default;
+
+  virtual OperandValues<T> evaluate(CompiledPredicateContext& context) const = 0;
+};
+
+// Reads a column of type ColumnDataType as T
+template <typename T, typename ColumnDataType>
+class ColumnKernel : public AbstractOperandKernel<T> {
+ public:
+  explicit ColumnKernel(const ColumnID column_id) : _column_id(column_id) {}
+
+  OperandValues<T> evaluate(CompiledPredicateContext& context) const final {
+    auto result = OperandValues<T>{context.memory_resource};
+    const auto segment = context.chunk.get_segment(_column_id);
+
+    if constexpr (std::is_same_v<T, ColumnDataType>) {
+      // Unencoded values are read in place.
+      if (const auto value_segment = std::dynamic_pointer_cast<const ValueSegment<T>>(segment)) {
+        result.values = std::span<const T>{value_segment->values().data(), context.row_count};
+        if (value_segment->is_nullable()) {
+          const auto& null_values = value_segment->null_values();
+          result.null_buffer.assign(null_values.begin(), null_values.begin() + context.row_count);
+          result.nulls = result.null_buffer;
+        }
+        return result;
+      }
+    }
+
+    // The segment might have grown since the context was created, so we size the buffers for all of its rows.
+    const auto buffer_size = std::max(static_cast<size_t>(context.row_count), static_cast<size_t>(segment->size()));
+    result.buffer.resize(buffer_size);
+    result.null_buffer.resize(buffer_size);
+
+    segment_iterate<ColumnDataType>(*segment, [&](const auto& position) {
+      const auto chunk_offset = position.chunk_offset();
+      result.buffer[chunk_offset] = static_cast<T>(position.value());
+      result.null_buffer[chunk_offset] = position.is_null();
+    });
+
+    result.values = std::span<const T>{result.buffer.data(), context.row_count};
+    result.nulls = std::span<const uint8_t>{result.null_buffer.data(), context.row_count};
+    return result;
+  }
+
+ private:
+  const ColumnID _column_id;
+};
+
+// A value that is known when compiling the predicate, e.g., a CAST of a literal
+template <typename T>
+class LiteralKernel : public AbstractOperandKernel<T> {
+ public:
+  explicit LiteralKernel(const T& value) : _value(value) {}
+
+  OperandValues<T> evaluate(CompiledPredicateContext& context) const final {
+    auto result = OperandValues<T>{context.memory_resource};
+    result.values = std::span<const T>{&_value, 1};
+    return result;
+  }
+
+ private:
+  const T _value;
+};
+
+// A literal or a correlated parameter that was abstracted from the predicate (see parameterize_predicate()). Its value
+// of type ValueDataType is bound when scanning and might be NULL for correlated parameters.
+template <typename T, typename ValueDataType>
+class ParameterKernel : public AbstractOperandKernel<T> {
+ public:
+  explicit ParameterKernel(const ParameterID parameter_id) : _parameter_id(parameter_id) {}
+
+  OperandValues<T> evaluate(CompiledPredicateContext& context) const final {
+    auto result = OperandValues<T>{context.memory_resource};
+    const auto& value = context.parameters[static_cast<size_t>(_parameter_id)];
+
+    if (variant_is_null(value)) {
+      result.buffer.resize(1);
+      result.null_buffer.assign(1, uint8_t{1});
+      result.values = result.buffer;
+      result.nulls = result.null_buffer;
+      return result;
+    }
+
+    if constexpr (std::is_same_v<T, ValueDataType>) {
+      result.values = std::span<const T>{&boost::get<T>(value), 1};
+    } else {
+      result.buffer.assign(1, static_cast<T>(boost::get<ValueDataType>(value)));
+      result.values = result.buffer;
+    }
+    return result;
+  }
+
+ private:
+  const ParameterID _parameter_id;
+};
+
+template <typename T, typename From>
+class CastKernel : public AbstractOperandKernel<T> {
+ public:
+  explicit CastKernel(std::unique_ptr<const AbstractOperandKernel<From>> input) : _input(std::move(input)) {}
+
+  OperandValues<T> evaluate(CompiledPredicateContext& context) const final {
+    auto input = _input->evaluate(context);
+
+    auto result = OperandValues<T>{context.memory_resource};
+    const auto result_size = input.values.size();
+    result.buffer.resize(result_size);
+    for (auto offset = size_t{0}; offset < result_size; ++offset) {
+      result.buffer[offset] = static_cast<T>(input.values[offset]);
+    }
+    result.values = result.buffer;
+
+    result.nulls = input.nulls;
+    result.null_buffer = std::move(input.null_buffer);
+    return result;
+  }
+
+ private:
+  const std::unique_ptr<const AbstractOperandKernel<From>> _input;
+};
+
+// "Default null logic": If either operand is NULL, so is the result. Expects the result's values to be set already.
+template <typename L, typename R, typename T>
+void merge_nulls(const OperandValues<L>& left, const OperandValues<R>& right, OperandValues<T>& result) {
+  if (left.nulls.empty() && right.nulls.empty()) {
+    return;
+  }
+
+  const auto result_size = result.values.size();
+  result.null_buffer.resize(result_size);
+  for (const auto& nulls : {left.nulls, right.nulls}) {
+    if (nulls.size() == 1) {
+      // A NULL literal makes all rows NULL.
+      if (nulls.front()) {
+        std::fill(result.null_buffer.begin(), result.null_buffer.end(), uint8_t{1});
+      }
+    } else if (!nulls.empty()) {
+      for (auto offset = size_t{0}; offset < result_size; ++offset) {
+        result.null_buffer[offset] |= nulls[offset];
+      }
+    }
+  }
+  result.nulls = result.null_buffer;
+}
+
+template <typename T, typename Functor>
+class ArithmeticKernel : public AbstractOperandKernel<T> {
+ public:
+  ArithmeticKernel(std::unique_ptr<const AbstractOperandKernel<T>> left,
+                   std::unique_ptr<const AbstractOperandKernel<T>> right)
+      : _left(std::move(left)), _right(std::move(right)) {}
+
+  OperandValues<T> evaluate(CompiledPredicateContext& context) const final {
+    const auto left = _left->evaluate(context);
+    const auto right = _right->evaluate(context);
+
+    // The result of two literals is a literal as well.
+    const auto result_size = left.values.size() == 1 && right.values.size() == 1 ? ChunkOffset{1} : context.row_count;
+    auto result = OperandValues<T>{context.memory_resource};
+    result.buffer.resize(result_size);
+
+    auto* const result_values = result.buffer.data();
+    with_value_accessor(left, [&](const auto& left_value) {
+      with_value_accessor(right, [&](const auto& right_value) {
+        for (auto chunk_offset = ChunkOffset{0}; chunk_offset < result_size; ++chunk_offset) {
+          result_values[chunk_offset] = Functor{}(left_value(chunk_offset), right_value(chunk_offset));
+        }
+      });
+    });
+    result.values = result.buffer;
+
+    merge_nulls(left, right, result);
+    return result;
+  }
+
+ private:
+  const std::unique_ptr<const AbstractOperandKernel<T>> _left;
+  const std::unique_ptr<const AbstractOperandKernel<T>> _right;
+};
+
+template <typename T, typename Comparator>
+class ComparisonNode : public AbstractCompiledPredicateNode {
+ public:
+  ComparisonNode(std::unique_ptr<const AbstractOperandKernel<T>> left,
+                 std::unique_ptr<const AbstractOperandKernel<T>> right)
+      : _left(std::move(left)), _right(std::move(right)) {}
+
+  void evaluate(CompiledPredicateContext& context, pmr_vector<uint8_t>& mask) const final {
+    const auto left = _left->evaluate(context);
+    const auto right = _right->evaluate(context);
+
+    // Comparisons with a NULL literal never match.
+    if ((left.nulls.size() == 1 && left.nulls.front()) || (right.nulls.size() == 1 && right.nulls.front())) {
+      std::fill(mask.begin(), mask.end(), uint8_t{0});
+      return;
+    }
+
+    auto* const mask_values = mask.data();
+    with_value_accessor(left, [&](const auto& left_value) {
+      with_value_accessor(right, [&](const auto& right_value) {
+        for (auto chunk_offset = ChunkOffset{0}; chunk_offset < context.row_count; ++chunk_offset) {
+          mask_values[chunk_offset] = Comparator{}(left_value(chunk_offset), right_value(chunk_offset));
+        }
+      });
+    });
+
+    for (const auto& nulls : {left.nulls, right.nulls}) {
+      if (nulls.size() < context.row_count) {
+        // Either not nullable or a literal that is not NULL
+        continue;
+      }
+      for (auto chunk_offset = ChunkOffset{0}; chunk_offset < context.row_count; ++chunk_offset) {
+        mask_values[chunk_offset] &= nulls[chunk_offset] ^ uint8_t{1};
+      }
+    }
+  }
+
+ private:
+  const std::unique_ptr<const AbstractOperandKernel<T>> _left;
+  const std::unique_ptr<const AbstractOperandKernel<T>> _right;
+};
+
+template <typename T>
+class IsNullNode : public AbstractCompiledPredicateNode {
+ public:
+  IsNullNode(std::unique_ptr<const AbstractOperandKernel<T>> operand, const PredicateCondition predicate_condition)
+      : _operand(std::move(operand)), _is_not_null(predicate_condition == PredicateCondition::IsNotNull) {}
+
+  void evaluate(CompiledPredicateContext& context, pmr_vector<uint8_t>& mask) const final {
+    const auto operand = _operand->evaluate(context);
+    if (operand.nulls.size() < context.row_count) {
+      // Either not nullable or a literal, which is NULL for all rows or for none
+      const auto is_null = !operand.nulls.empty() && operand.nulls.front();
+      std::fill(mask.begin(), mask.end(), static_cast<uint8_t>(is_null) ^ static_cast<uint8_t>(_is_not_null));
+      return;
+    }
+
+    for (auto chunk_offset = ChunkOffset{0}; chunk_offset < context.row_count; ++chunk_offset) {
+      mask[chunk_offset] = operand.nulls[chunk_offset] ^ static_cast<uint8_t>(_is_not_null);
+    }
+  }
+
+ private:
+  const std::unique_ptr<const AbstractOperandKernel<T>> _operand;
+  const bool _is_not_null;
+};
+
+class LogicalNode : public AbstractCompiledPredicateNode {
+ public:
+  LogicalNode(const LogicalOperator logical_operator, std::unique_ptr<const AbstractCompiledPredicateNode> left,
+              std::unique_ptr<const AbstractCompiledPredicateNode> right)
+      : _logical_operator(logical_operator), _left(std::move(left)), _right(std::move(right)) {}
+
+  void evaluate(CompiledPredicateContext& context, pmr_vector<uint8_t>& mask) const final {
+    _left->evaluate(context, mask);
+
+    // Short-circuit if the right side cannot change the result
+    const auto deciding_value = _logical_operator == LogicalOperator::And ? uint8_t{1} : uint8_t{0};
+    if (std::find(mask.begin(), mask.end(), deciding_value) == mask.end()) {
+      return;
+    }
+
+    auto right_mask = pmr_vector<uint8_t>(context.row_count, context.memory_resource);
+    _right->evaluate(context, right_mask);
+
+    if (_logical_operator == LogicalOperator::And) {
+      for (auto chunk_offset = ChunkOffset{0}; chunk_offset < context.row_count; ++chunk_offset) {
+        mask[chunk_offset] &= right_mask[chunk_offset];
+      }
+    } else {
+      for (auto chunk_offset = ChunkOffset{0}; chunk_offset < context.row_count; ++chunk_offset) {
+        mask[chunk_offset] |= right_mask[chunk_offset];
+      }
+    }
+  }
+
+ private:
+  const LogicalOperator _logical_operator;
+  const std::unique_ptr<const AbstractCompiledPredicateNode> _left;
+  const std::unique_ptr<const AbstractCompiledPredicateNode> _right;
+};
+
+class DelegatedNode : public AbstractCompiledPredicateNode {
+ public:
+  explicit DelegatedNode(const size_t delegated_predicate_idx) : _delegated_predicate_idx(delegated_predicate_idx) {}
+
+  void evaluate(CompiledPredicateContext& context, pmr_vector<uint8_t>& mask) const final {
+    std::fill(mask.begin(), mask.end(), uint8_t{0});
+
+    const auto matches = context.delegated_scan(_delegated_predicate_idx);
+    for (const auto& match : *matches) {
+      mask[match.chunk_offset] = 1;
+    }
+  }
+
+ private:
+  const size_t _delegated_predicate_idx;
+};
+
+// Unlike expression_get_value_or_parameter(), this does not require the values of the placeholders to be set.
+bool is_value_or_parameter(const AbstractExpression& expression) {
+  if (expression.type == ExpressionType::Value || expression.type == ExpressionType::CorrelatedParameter) {
+    return true;
+  }
+  return expression.type == ExpressionType::Cast && expression_get_value_or_parameter(expression);
+}
+
+/**
+ * Replaces the literals and correlated parameters in a copy of @param predicate with placeholders, i.e.,
+ * CorrelatedParameterExpressions without a value, whose ParameterIDs are the indexes into the returned values. Thus,
+ * predicates that only differ in their values share a CompiledPredicate, and the values are bound when scanning. The
+ * data types of the values are part of the structure, as the kernels depend on them. NULL literals and CASTs of
+ * literals are kept, because the compilation depends on their values.
+ */
+std::pair<std::shared_ptr<AbstractExpression>, std::vector<AllTypeVariant>> parameterize_predicate(
+    const AbstractExpression& predicate) {
+  auto parameterized_predicate = predicate.deep_copy();
+  auto parameters = std::vector<AllTypeVariant>{};
+
+  visit_expression(parameterized_predicate, [&](auto& sub_expression) {
+    auto value = std::optional<AllTypeVariant>{};
+    if (sub_expression->type == ExpressionType::Value) {
+      value = static_cast<const ValueExpression&>(*sub_expression).value;
+      if (variant_is_null(*value)) {
+        return ExpressionVisitation::DoNotVisitArguments;
+      }
+    } else if (sub_expression->type == ExpressionType::CorrelatedParameter) {
+      value = static_cast<const CorrelatedParameterExpression&>(*sub_expression).value();
+      DebugAssert(value, "CorrelatedParameterExpression doesn't have a value set");
+    } else if (sub_expression->type == ExpressionType::Cast) {
+      return ExpressionVisitation::DoNotVisitArguments;
+    } else {
+      return ExpressionVisitation::VisitArguments;
+    }
+
+    const auto parameter_id = ParameterID{static_cast<ParameterID::base_type>(parameters.size())};
+    const auto referenced_expression_info =
+        CorrelatedParameterExpression::ReferencedExpressionInfo{sub_expression->data_type(), "?"};
+    sub_expression = std::make_shared<CorrelatedParameterExpression>(parameter_id, referenced_expression_info);
+    parameters.emplace_back(*value);
+    return ExpressionVisitation::DoNotVisitArguments;
+  });
+
+  return {parameterized_predicate, std::move(parameters)};
+}
+
+// Returns true for the predicate patterns that TableScan::create_impl() maps to a dedicated TableScanImpl
+bool is_delegatable(const AbstractExpression& expression) {
+  if (const auto* binary_predicate = dynamic_cast<const BinaryPredicateExpression*>(&expression)) {
+    const auto& left_operand = *binary_predicate->left_operand();
+    const auto& right_operand = *binary_predicate->right_operand();
+    const auto left_is_column = left_operand.type == ExpressionType::PQPColumn;
+    const auto right_is_column = right_operand.type == ExpressionType::PQPColumn;
+
+    const auto predicate_condition = binary_predicate->predicate_condition;
+    if (predicate_condition == PredicateCondition::Like || predicate_condition == PredicateCondition::NotLike) {
+      return left_is_column && is_value_or_parameter(right_operand);
+    }
+
+    return (left_is_column && (right_is_column || is_value_or_parameter(right_operand))) ||
+           (right_is_column && is_value_or_parameter(left_operand));
+  }
+
+  if (const auto* is_null_expression = dynamic_cast<const IsNullExpression*>(&expression)) {
+    return is_null_expression->operand()->type == ExpressionType::PQPColumn;
+  }
+
+  if (const auto* between_expression = dynamic_cast<const BetweenExpression*>(&expression)) {
+    return between_expression->value()->type == ExpressionType::PQPColumn &&
+           is_value_or_parameter(*between_expression->lower_bound()) &&
+           is_value_or_parameter(*between_expression->upper_bound());
+  }
+
+  return false;
+}
+
+template <typename A, typename B>
+constexpr bool are_compatible_v = std::is_same_v<A, pmr_string> == std::is_same_v<B, pmr_string>;
+
+class Compilation {
+ public:
+  std::unique_ptr<const AbstractCompiledPredicateNode> compile_predicate(
+      const std::shared_ptr<const AbstractExpression>& expression) {
+    if (is_delegatable(*expression)) {
+      delegated_predicates.emplace_back(expression);
+      return std::make_unique<DelegatedNode>(delegated_predicates.size() - 1);
+    }
+
+    if (const auto logical_expression = std::dynamic_pointer_cast<const LogicalExpression>(expression)) {
+      auto left = compile_predicate(logical_expression->left_operand());
+      auto right = compile_predicate(logical_expression->right_operand());
+      if (!left || !right) {
+        return nullptr;
+      }
+      ++kernel_count;
+      return std::make_unique<LogicalNode>(logical_expression->logical_operator, std::move(left), std::move(right));
+    }
+
+    if (const auto binary_predicate = std::dynamic_pointer_cast<const BinaryPredicateExpression>(expression)) {
+      return _compile_comparison(binary_predicate->predicate_condition, *binary_predicate->left_operand(),
+                                 *binary_predicate->right_operand());
+    }
+
+    if (const auto between_expression = std::dynamic_pointer_cast<const BetweenExpression>(expression)) {
+      // `a BETWEEN b AND c` --> `a >= b AND a <= c`
+      const auto [lower_condition, upper_condition] = between_to_conditions(between_expression->predicate_condition);
+      auto lower = _compile_comparison(lower_condition, *between_expression->value(),
+                                       *between_expression->lower_bound());
+      auto upper = _compile_comparison(upper_condition, *between_expression->value(),
+                                       *between_expression->upper_bound());
+      if (!lower || !upper) {
+        return nullptr;
+      }
+      ++kernel_count;
+      return std::make_unique<LogicalNode>(LogicalOperator::And, std::move(lower), std::move(upper));
+    }
+
+    if (const auto is_null_expression = std::dynamic_pointer_cast<const IsNullExpression>(expression)) {
+      const auto& operand = *is_null_expression->operand();
+      if (operand.data_type() == DataType::Null) {
+        return nullptr;
+      }
+
+      auto node = std::unique_ptr<const AbstractCompiledPredicateNode>{};
+      resolve_data_type(operand.data_type(), [&](const auto data_type_t) {
+        using OperandDataType = typename decltype(data_type_t)::type;
+        auto operand_kernel = compile_operand<OperandDataType>(operand);
+        if (operand_kernel) {
+          node = std::make_unique<IsNullNode<OperandDataType>>(std::move(operand_kernel),
+                                                               is_null_expression->predicate_condition);
+          ++kernel_count;
+        }
+      });
+      return node;
+    }
+
+    return nullptr;
+  }
+
+  template <typename T>
+  std::unique_ptr<const AbstractOperandKernel<T>> compile_operand(const AbstractExpression& expression) {
+    const auto data_type = expression.data_type();
+    if (data_type == DataType::Null) {
+      return nullptr;
+    }
+
+    auto kernel = std::unique_ptr<const AbstractOperandKernel<T>>{};
+
+    if (expression.type == ExpressionType::PQPColumn) {
+      // Type conversions of columns are done while reading them.
+      const auto column_id = static_cast<const PQPColumnExpression&>(expression).column_id;
+      resolve_data_type(data_type, [&](const auto data_type_t) {
+        using ColumnDataType = typename decltype(data_type_t)::type;
+        if constexpr (are_compatible_v<T, ColumnDataType>) {
+          kernel = std::make_unique<ColumnKernel<T, ColumnDataType>>(column_id);
+          ++kernel_count;
+        }
+      });
+      return kernel;
+    }
+
+    if (expression.type == ExpressionType::CorrelatedParameter) {
+      const auto parameter_id = static_cast<const CorrelatedParameterExpression&>(expression).parameter_id;
+      resolve_data_type(data_type, [&](const auto data_type_t) {
+        using ValueDataType = typename decltype(data_type_t)::type;
+        if constexpr (are_compatible_v<T, ValueDataType>) {
+          kernel = std::make_unique<ParameterKernel<T, ValueDataType>>(parameter_id);
+          ++kernel_count;
+        }
+      });
+      return kernel;
+    }
+
+    if (is_value_or_parameter(expression)) {
+      const auto value = *expression_get_value_or_parameter(expression);
+      if (variant_is_null(value)) {
+        return nullptr;
+      }
+
+      resolve_data_type(data_type_from_all_type_variant(value), [&](const auto data_type_t) {
+        using ValueDataType = typename decltype(data_type_t)::type;
+        if constexpr (are_compatible_v<T, ValueDataType>) {
+          kernel = std::make_unique<LiteralKernel<T>>(static_cast<T>(boost::get<ValueDataType>(value)));
+          ++kernel_count;
+        }
+      });
+      return kernel;
+    }
+
+    if (data_type != data_type_from_type<T>()) {
+      // Like the ExpressionEvaluator, we compute the operand in its own type and convert the result afterwards.
+      resolve_data_type(data_type, [&](const auto data_type_t) {
+        using OperandDataType = typename decltype(data_type_t)::type;
+        if constexpr (are_compatible_v<T, OperandDataType>) {
+          auto input = compile_operand<OperandDataType>(expression);
+          if (input) {
+            kernel = std::make_unique<CastKernel<T, OperandDataType>>(std::move(input));
+            ++kernel_count;
+          }
+        }
+      });
+      return kernel;
+    }
+
+    if constexpr (std::is_arithmetic_v<T>) {
+      if (expression.type == ExpressionType::Arithmetic) {
+        return _compile_arithmetic<T>(static_cast<const ArithmeticExpression&>(expression));
+      }
+    }
+
+    return nullptr;
+  }
+
+  std::vector<std::shared_ptr<const AbstractExpression>> delegated_predicates;
+  size_t kernel_count{0};
+
+ private:
+  std::unique_ptr<const AbstractCompiledPredicateNode> _compile_comparison(const PredicateCondition predicate_condition,
+                                                                           const AbstractExpression& left_operand,
+                                                                           const AbstractExpression& right_operand) {
+    if (!is_binary_predicate_condition(predicate_condition) || predicate_condition == PredicateCondition::Like ||
+        predicate_condition == PredicateCondition::NotLike) {
+      return nullptr;
+    }
+
+    const auto left_data_type = left_operand.data_type();
+    const auto right_data_type = right_operand.data_type();
+    if (left_data_type == DataType::Null || right_data_type == DataType::Null) {
+      return nullptr;
+    }
+
+    auto node = std::unique_ptr<const AbstractCompiledPredicateNode>{};
+    resolve_data_type(left_data_type, [&](const auto left_data_type_t) {
+      using LeftDataType = typename decltype(left_data_type_t)::type;
+
+      resolve_data_type(right_data_type, [&](const auto right_data_type_t) {
+        using RightDataType = typename decltype(right_data_type_t)::type;
+
+        if constexpr (are_compatible_v<LeftDataType, RightDataType>) {
+          // The ExpressionEvaluator compares in the common type of both operands, see STLComparisonFunctorWrapper.
+          using ComparisonDataType = std::common_type_t<LeftDataType, RightDataType>;
+
+          auto left_kernel = compile_operand<ComparisonDataType>(left_operand);
+          auto right_kernel = compile_operand<ComparisonDataType>(right_operand);
+          if (!left_kernel || !right_kernel) {
+            return;
+          }
+
+          with_comparator(predicate_condition, [&](const auto comparator) {
+            using Comparator = std::decay_t<decltype(comparator)>;
+            node = std::make_unique<ComparisonNode<ComparisonDataType, Comparator>>(std::move(left_kernel),
+                                                                                    std::move(right_kernel));
+          });
+          ++kernel_count;
+        }
+      });
+    });
+    return node;
+  }
+
+  template <typename T>
+  std::unique_ptr<const AbstractOperandKernel<T>> _compile_arithmetic(const ArithmeticExpression& expression) {
+    // Division and modulo by zero yield NULL, which is not implemented here.
+    const auto arithmetic_operator = expression.arithmetic_operator;
+    if (arithmetic_operator == ArithmeticOperator::Division || arithmetic_operator == ArithmeticOperator::Modulo) {
+      return nullptr;
+    }
+
+    const auto& left_operand = *expression.left_operand();
+    const auto& right_operand = *expression.right_operand();
+    if (left_operand.data_type() == DataType::Null || right_operand.data_type() == DataType::Null) {
+      return nullptr;
+    }
+
+    // The ExpressionEvaluator computes `a + b` in std::common_type_t<A, B> and then converts it to the result type of
+    // the ArithmeticExpression (see STLArithmeticFunctorWrapper). These types only differ for long and float, which
+    // are computed as float, but stored as double. We do not compile that case, so that the results do not differ.
+    const auto left_data_type = left_operand.data_type();
+    const auto right_data_type = right_operand.data_type();
+    if ((left_data_type == DataType::Long && right_data_type == DataType::Float) ||
+        (left_data_type == DataType::Float && right_data_type == DataType::Long)) {
+      return nullptr;
+    }
+
+    auto left_kernel = compile_operand<T>(left_operand);
+    auto right_kernel = compile_operand<T>(right_operand);
+    if (!left_kernel || !right_kernel) {
+      return nullptr;
+    }
+
+    ++kernel_count;
+    if (arithmetic_operator == ArithmeticOperator::Addition) {
+      return std::make_unique<ArithmeticKernel<T, std::plus<T>>>(std::move(left_kernel), std::move(right_kernel));
+    }
+    if (arithmetic_operator == ArithmeticOperator::Subtraction) {
+      return std::make_unique<ArithmeticKernel<T, std::minus<T>>>(std::move(left_kernel), std::move(right_kernel));
+    }
+    return std::make_unique<ArithmeticKernel<T, std::multiplies<T>>>(std::move(left_kernel), std::move(right_kernel));
+  }
+};
+
+}  // namespace
+
+namespace hyrise {
+
+CompiledPredicate::CompiledPredicate(std::unique_ptr<const AbstractCompiledPredicateNode> root,
+                                     std::vector<std::shared_ptr<const AbstractExpression>> delegated_predicates,
+                                     const size_t kernel_count)
+    : _root(std::move(root)), _delegated_predicates(std::move(delegated_predicates)), _kernel_count(kernel_count) {
+  Assert(_root, "CompiledPredicate requires a root node");
+}
+
+CompiledPredicate::~CompiledPredicate() = default;
+
+const std::vector<std::shared_ptr<const AbstractExpression>>& CompiledPredicate::delegated_predicates() const {
+  return _delegated_predicates;
+}
+
+size_t CompiledPredicate::kernel_count() const {
+  return _kernel_count;
+}
+
+std::vector<std::shared_ptr<AbstractExpression>> CompiledPredicate::bind_delegated_predicates(
+    const std::vector<AllTypeVariant>& parameters) const {
+  auto parameters_by_id = std::unordered_map<ParameterID, AllTypeVariant>{};
+  const auto parameter_count = parameters.size();
+  for (auto parameter_idx = size_t{0}; parameter_idx < parameter_count; ++parameter_idx) {
+    const auto parameter_id = ParameterID{static_cast<ParameterID::base_type>(parameter_idx)};
+    parameters_by_id.emplace(parameter_id, parameters[parameter_idx]);
+  }
+
+  auto bound_predicates = std::vector<std::shared_ptr<AbstractExpression>>{};
+  bound_predicates.reserve(_delegated_predicates.size());
+  for (const auto& delegated_predicate : _delegated_predicates) {
+    auto bound_predicate = delegated_predicate->deep_copy();
+    expression_set_parameters(bound_predicate, parameters_by_id);
+    bound_predicates.emplace_back(std::move(bound_predicate));
+  }
+  return bound_predicates;
+}
+
+std::shared_ptr<RowIDPosList> CompiledPredicate::scan(const ChunkID chunk_id, const Chunk& chunk,
+                                                      const std::vector<AllTypeVariant>& parameters,
+                                                      const DelegatedScan& delegated_scan) const {
+  // All intermediate buffers are allocated from this resource and released at once when the chunk is done.
+  auto memory_resource = boost::container::pmr::monotonic_buffer_resource{};
+  auto context = CompiledPredicateContext{chunk, chunk.size(), parameters, &memory_resource, delegated_scan};
+
+  auto mask = pmr_vector<uint8_t>(context.row_count, &memory_resource);
+  _root->evaluate(context, mask);
+
+  auto matches = std::make_shared<RowIDPosList>();
+  matches->reserve(std::count(mask.begin(), mask.end(), uint8_t{1}));
+  for (auto chunk_offset = ChunkOffset{0}; chunk_offset < context.row_count; ++chunk_offset) {
+    if (mask[chunk_offset]) {
+      matches->emplace_back(RowID{chunk_id, chunk_offset});
+    }
+  }
+
+  return matches;
+}
+
+bool PredicateCompiler::enabled() const {
+  return _enabled.load();
+}
+
+void PredicateCompiler::set_enabled(const bool enabled) {
+  _enabled = enabled;
+}
+
+std::pair<std::shared_ptr<const CompiledPredicate>, std::vector<AllTypeVariant>> PredicateCompiler::compile(
+    const std::shared_ptr<const AbstractExpression>& predicate) {
+  // Predicates with subqueries are never compiled. They are not cached either, as the cache would keep their PQPs
+  // alive.
+  auto has_subquery = false;
+  const auto mutable_predicate = std::const_pointer_cast<AbstractExpression>(predicate);
+  visit_expression(mutable_predicate, [&](const auto& sub_expression) {
+    if (sub_expression->type == ExpressionType::PQPSubquery) {
+      has_subquery = true;
+      return ExpressionVisitation::DoNotVisitArguments;
+    }
+    return ExpressionVisitation::VisitArguments;
+  });
+  if (has_subquery) {
+    return {nullptr, {}};
+  }
+
+  // The parameterized predicate is a copy, so it is not affected if the operator's predicate is modified later on
+  // (e.g., by TableScan::_on_set_parameters).
+  auto [parameterized_predicate, parameters] = parameterize_predicate(*predicate);
+
+  {
+    const auto lock = std::lock_guard<std::mutex>{_cache_mutex};
+    const auto cache_iter = _cache.find(parameterized_predicate);
+    if (cache_iter != _cache.end()) {
+      return {cache_iter->second, std::move(parameters)};
+    }
+  }
+
+  auto compiled_predicate = std::shared_ptr<const CompiledPredicate>{};
+  if (!is_delegatable(*parameterized_predicate)) {
+    auto compilation = Compilation{};
+    auto root = compilation.compile_predicate(parameterized_predicate);
+    if (root) {
+      compiled_predicate = std::make_shared<CompiledPredicate>(
+          std::move(root), std::move(compilation.delegated_predicates), compilation.kernel_count);
+    }
+  }
+
+  const auto lock = std::lock_guard<std::mutex>{_cache_mutex};
+  if (_cache.size() >= CACHE_CAPACITY) {
+    _cache.clear();
+  }
+  _cache.emplace(parameterized_predicate, compiled_predicate);
+
+  return {compiled_predicate, std::move(parameters)};
+}
+
+size_t PredicateCompiler::cache_size() const {
+  const auto lock = std::lock_guard<std::mutex>{_cache_mutex};
+  return _cache.size();
+}
+
+void PredicateCompiler::clear_cache() {
+  const auto lock = std::lock_guard<std::mutex>{_cache_mutex};
+  _cache.clear();
+}
+
+PredicateCompilerSetting::PredicateCompilerSetting() : AbstractSetting("PredicateCompiler.enabled") {}
+
+const std::string& PredicateCompilerSetting::description() const {
+  static const auto description = std::string{"Compile complex TableScan predicates instead of interpreting them"};
+  return description;
+}
+
+const std::string& PredicateCompilerSetting::get() {
+  _value = Hyrise::get().predicate_compiler->enabled() ? "true" : "false";
+  return _value;
+}
+
+void PredicateCompilerSetting::set(const std::string& value) {
+  Assert(value == "true" || value == "false", "Invalid value for " + name + ", expected 'true' or 'false'.");
+  Hyrise::get().predicate_compiler->set_enabled(value == "true");
+}
+
+}  // namespace hyrise
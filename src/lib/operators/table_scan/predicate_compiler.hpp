@@ -0,0 +1,126 @@
+#pragma once
+
+#include <atomic>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "all_type_variant.hpp"
+#include "expression/abstract_expression.hpp"
+#include "storage/pos_lists/row_id_pos_list.hpp"
+#include "types.hpp"
+#include "utils/settings/abstract_setting.hpp"
+
+namespace hyrise {
+
+class AbstractCompiledPredicateNode;
+class Chunk;
+
+/**
+ * A scan predicate that the PredicateCompiler translated into a tree of kernels. Each kernel is specialized for the
+ * data types of its operands and, when reading a segment, for the segment's encoding (via segment_iterate). A kernel
+ * processes all rows of a chunk in a tight loop. Predicates are combined through byte masks (one byte per row). No
+ * ExpressionResults or PosLists are materialized for intermediate results.
+ *
+ * Simple predicates such as `a < 5`, `a BETWEEN 1 AND 3`, or `b LIKE '%foo%'` are not compiled. They are delegated
+ * to the dedicated TableScanImpls, which are faster for them (e.g., because they scan dictionary-encoded segments on
+ * their value IDs). Their matches are written into the mask.
+ *
+ * A CompiledPredicate only refers to ColumnIDs and data types, not to a specific table or to the values of literals
+ * and correlated parameters. These values are passed as parameters when scanning. A CompiledPredicate is immutable and
+ * can be used by multiple threads and TableScans at the same time.
+ */
+class CompiledPredicate : public Noncopyable {
+ public:
+  // Called with the index of a delegated predicate (see delegated_predicates()) and returns its matches in the chunk.
+  using DelegatedScan = std::function<std::shared_ptr<RowIDPosList>(const size_t delegated_predicate_idx)>;
+
+  CompiledPredicate(std::unique_ptr<const AbstractCompiledPredicateNode> root,
+                    std::vector<std::shared_ptr<const AbstractExpression>> delegated_predicates,
+                    const size_t kernel_count);
+  ~CompiledPredicate();
+
+  // Predicates that are not compiled but should be evaluated by a dedicated TableScanImpl. Their values are
+  // placeholders, use bind_delegated_predicates() to obtain predicates that can be scanned.
+  const std::vector<std::shared_ptr<const AbstractExpression>>& delegated_predicates() const;
+
+  // Copies of the delegated_predicates() with the @param parameters that PredicateCompiler::compile() returned
+  std::vector<std::shared_ptr<AbstractExpression>> bind_delegated_predicates(
+      const std::vector<AllTypeVariant>& parameters) const;
+
+  // Number of compiled kernels, excluding the delegated predicates
+  size_t kernel_count() const;
+
+  std::shared_ptr<RowIDPosList> scan(const ChunkID chunk_id, const Chunk& chunk,
+                                     const std::vector<AllTypeVariant>& parameters,
+                                     const DelegatedScan& delegated_scan) const;
+
+ private:
+  const std::unique_ptr<const AbstractCompiledPredicateNode> _root;
+  const std::vector<std::shared_ptr<const AbstractExpression>> _delegated_predicates;
+  const size_t _kernel_count;
+};
+
+/**
+ * Compiles complex scan predicates, e.g., `a = 1 OR b < 2`, `a + b > c * 2`, or `(a < 3 AND b > 5) OR c IS NULL`, into
+ * CompiledPredicates. Without the compiler, these predicates are evaluated by the ExpressionEvaluatorTableScanImpl.
+ * That impl materializes a full ExpressionResult for each subexpression and merges the PosLists of OR predicates.
+ *
+ * Supported are AND/OR, the six comparison operators, BETWEEN, IS [NOT] NULL, and +, -, * on columns, literals, and
+ * correlated parameters. Arithmetic and comparisons follow the type semantics of the ExpressionEvaluator. Division and
+ * modulo are not supported because of their NULL semantics. Neither are subqueries, functions, CASE, CAST, IN, or
+ * LIKE on anything but a column. Predicates containing these are not compiled.
+ *
+ * We do not generate machine code. The compiler instantiates pre-compiled kernel templates instead, one for each
+ * combination of data types. Compiled predicates are cached by the structure of the predicate expression (i.e.,
+ * AbstractExpression::hash() and operator==) with its literals and correlated parameters abstracted away. Thus,
+ * `a + b > 5` and `a + b > 7` share a CompiledPredicate, while `a + b > 5.0` does not, as its literal has a different
+ * data type. Predicates that cannot be compiled are cached as well, so they are not analyzed again.
+ *
+ * The compiler is disabled by default. It can be enabled through set_enabled() or the PredicateCompilerSetting.
+ */
+class PredicateCompiler : public Noncopyable {
+ public:
+  // If more predicates are compiled, the cache is cleared before the next insertion.
+  static constexpr auto CACHE_CAPACITY = size_t{1'024};
+
+  bool enabled() const;
+  void set_enabled(const bool enabled);
+
+  // Returns the CompiledPredicate and the values of the predicate's literals and correlated parameters, which have to
+  // be passed to CompiledPredicate::scan(). The CompiledPredicate is nullptr if the predicate is not supported or if
+  // it is simple enough to be handled by a dedicated TableScanImpl on its own.
+  std::pair<std::shared_ptr<const CompiledPredicate>, std::vector<AllTypeVariant>> compile(
+      const std::shared_ptr<const AbstractExpression>& predicate);
+
+  size_t cache_size() const;
+  void clear_cache();
+
+ private:
+  std::atomic_bool _enabled{false};
+
+  mutable std::mutex _cache_mutex;
+  ConstExpressionUnorderedMap<std::shared_ptr<const CompiledPredicate>> _cache;
+};
+
+/**
+ * Exposes PredicateCompiler::enabled() of Hyrise::get().predicate_compiler as "PredicateCompiler.enabled". Valid
+ * values are "true" and "false". The setting is not registered by default. Components that want to make it
+ * changeable, e.g., through the meta_settings table, have to create and register it.
+ */
+class PredicateCompilerSetting : public AbstractSetting {
+ public:
+  PredicateCompilerSetting();
+
+  const std::string& description() const final;
+  const std::string& get() final;
+  void set(const std::string& value) final;
+
+ private:
+  std::string _value;
+};
+
+}  // namespace hyrise
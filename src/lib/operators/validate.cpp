@@ -125,10 +125,13 @@ std::shared_ptr<const Table> Validate::_on_execute(std::shared_ptr<TransactionCo
         _validate_chunks(input_table, job_start_chunk_id, job_end_chunk_id, our_tid, snapshot_commit_id, output_chunks,
                          output_mutex);
       } else {
-        jobs.push_back(std::make_shared<JobTask>([=, this, &output_chunks, &output_mutex] {
+        auto job = std::make_shared<JobTask>([=, this, &output_chunks, &output_mutex] {
           _validate_chunks(input_table, job_start_chunk_id, job_end_chunk_id, our_tid, snapshot_commit_id,
                            output_chunks, output_mutex);
-        }));
+        });
+        // Jobs usually cover a single chunk. If small chunks are bundled, the first chunk determines the node.
+        job->set_preferred_node_id(input_table->get_chunk(job_start_chunk_id)->numa_node_id());
+        jobs.push_back(job);
 
         // Prepare next job
         job_start_chunk_id = job_end_chunk_id + 1;
@@ -286,6 +289,7 @@ void Validate::_validate_chunks(const std::shared_ptr<const Table>& input_table,
       // The validate operator does not affect the sorted_by property. If a chunk has been sorted before, it still is
       // after the validate operator.
       const auto chunk = std::make_shared<Chunk>(output_segments);
+      chunk->set_numa_node_id(chunk_in->numa_node_id());
       chunk->finalize();
 
       const auto& sorted_by = chunk_in->individually_sorted_by();
@@ -0,0 +1,256 @@
+#include "iterative_dp_ccp.hpp"
+
+#include <algorithm>
+#include <functional>
+#include <limits>
+#include <map>
+#include <optional>
+
+#include "cost_estimation/abstract_cost_estimator.hpp"
+#include "dp_ccp.hpp"
+#include "join_graph.hpp"
+#include "logical_query_plan/predicate_node.hpp"
+#include "statistics/abstract_cardinality_estimator.hpp"
+#include "utils/assert.hpp"
+
+namespace hyrise {
+
+IterativeDpCcp::IterativeDpCcp(const size_t block_size) : _block_size(block_size) {
+  Assert(_block_size >= 2, "Blocks must consist of at least two vertices.");
+}
+
+std::shared_ptr<AbstractLQPNode> IterativeDpCcp::operator()(
+    const JoinGraph& join_graph, const std::shared_ptr<AbstractCostEstimator>& cost_estimator) {
+  DebugAssert(!join_graph.vertices.empty(), "Code below relies on there being at least one vertex");
+
+  /**
+   * 1. Initialize the blocks with the vertices and their local predicates. As in DpCcp, uncorrelated predicates (i.e.,
+   *    predicates that do not reference any vertex) are placed on the largest vertex, below its local predicates.
+   */
+  const auto vertex_count = join_graph.vertices.size();
+  auto vertex_plans = join_graph.vertices;
+
+  auto uncorrelated_predicates = std::vector<std::shared_ptr<AbstractExpression>>{};
+  for (const auto& edge : join_graph.edges) {
+    if (edge.vertex_set.none()) {
+      uncorrelated_predicates.insert(uncorrelated_predicates.end(), edge.predicates.begin(), edge.predicates.end());
+    }
+  }
+
+  if (!uncorrelated_predicates.empty()) {
+    const auto& cardinality_estimator = cost_estimator->cardinality_estimator;
+    auto largest_vertex_idx = size_t{0};
+    auto largest_vertex_cardinality = cardinality_estimator->estimate_cardinality(vertex_plans.front());
+    for (auto vertex_idx = size_t{1}; vertex_idx < vertex_count; ++vertex_idx) {
+      const auto vertex_cardinality = cardinality_estimator->estimate_cardinality(vertex_plans[vertex_idx]);
+      if (vertex_cardinality > largest_vertex_cardinality) {
+        largest_vertex_idx = vertex_idx;
+        largest_vertex_cardinality = vertex_cardinality;
+      }
+    }
+
+    for (const auto& uncorrelated_predicate : uncorrelated_predicates) {
+      vertex_plans[largest_vertex_idx] = PredicateNode::make(uncorrelated_predicate, vertex_plans[largest_vertex_idx]);
+    }
+  }
+
+  auto blocks = std::vector<Block>{};
+  blocks.reserve(vertex_count);
+  for (auto vertex_idx = size_t{0}; vertex_idx < vertex_count; ++vertex_idx) {
+    auto vertex_set = JoinGraphVertexSet{vertex_count};
+    vertex_set.set(vertex_idx);
+    const auto plan =
+        _add_predicates_to_plan(vertex_plans[vertex_idx], join_graph.find_local_predicates(vertex_idx), cost_estimator);
+    blocks.emplace_back(Block{vertex_set, plan});
+  }
+
+  /**
+   * 2. Main loop of the algorithm. Each iteration replaces the selected blocks with a new block that joins them.
+   */
+  while (blocks.size() > 1) {
+    auto block_indices = _select_blocks(join_graph, blocks, cost_estimator);
+    auto combined_block = std::optional<Block>{};
+
+    if (!block_indices.empty()) {
+      combined_block = _combine_blocks(join_graph, blocks, block_indices, cost_estimator);
+    } else {
+      /**
+       * 2.1 No two blocks are connected by a binary edge, e.g., because the remaining blocks are only connected by
+       *     hyperedges or not at all. DpCcp cannot handle these cases. Thus, we join the two blocks that result in
+       *     the lowest cardinality, using a cross join if necessary.
+       */
+      auto lowest_cardinality = std::numeric_limits<Cardinality>::max();
+      const auto block_count = blocks.size();
+      for (auto left_block_idx = size_t{0}; left_block_idx < block_count; ++left_block_idx) {
+        for (auto right_block_idx = left_block_idx + 1; right_block_idx < block_count; ++right_block_idx) {
+          const auto& left_block = blocks[left_block_idx];
+          const auto& right_block = blocks[right_block_idx];
+          const auto join_predicates = join_graph.find_join_predicates(left_block.vertex_set, right_block.vertex_set);
+          const auto plan = _add_join_to_plan(left_block.plan, right_block.plan, join_predicates, cost_estimator);
+          const auto cardinality = cost_estimator->cardinality_estimator->estimate_cardinality(plan);
+          if (!combined_block || cardinality < lowest_cardinality) {
+            lowest_cardinality = cardinality;
+            combined_block = Block{left_block.vertex_set | right_block.vertex_set, plan};
+            block_indices = {left_block_idx, right_block_idx};
+          }
+        }
+      }
+    }
+
+    /**
+     * 2.2 Replace the selected blocks with the new one. Erase from the back so that the indices remain valid.
+     */
+    std::sort(block_indices.begin(), block_indices.end(), std::greater<>{});
+    for (const auto block_idx : block_indices) {
+      blocks.erase(blocks.begin() + static_cast<std::ptrdiff_t>(block_idx));
+    }
+    blocks.emplace_back(std::move(*combined_block));
+  }
+
+  Assert(blocks.front().vertex_set.all(), "No block for all vertices generated.");
+  return blocks.front().plan;
+}
+
+std::vector<size_t> IterativeDpCcp::_select_blocks(const JoinGraph& join_graph, const std::vector<Block>& blocks,
+                                                   const std::shared_ptr<AbstractCostEstimator>& cost_estimator) const {
+  /**
+   * 1. Find the pairs of blocks that are connected by an edge. DpCcp ignores edges between more than two blocks when it
+   *    enumerates the candidate joins. Hence, only binary edges connect blocks.
+   */
+  const auto block_count = blocks.size();
+  auto adjacent_blocks = std::vector<std::vector<bool>>(block_count, std::vector<bool>(block_count));
+  for (const auto& edge : join_graph.edges) {
+    auto edge_block_indices = std::vector<size_t>{};
+    for (auto block_idx = size_t{0}; block_idx < block_count; ++block_idx) {
+      if ((edge.vertex_set & blocks[block_idx].vertex_set).any()) {
+        edge_block_indices.emplace_back(block_idx);
+      }
+    }
+
+    if (edge_block_indices.size() == 2) {
+      adjacent_blocks[edge_block_indices[0]][edge_block_indices[1]] = true;
+      adjacent_blocks[edge_block_indices[1]][edge_block_indices[0]] = true;
+    }
+  }
+
+  const auto& cardinality_estimator = cost_estimator->cardinality_estimator;
+
+  /**
+   * 2. Start with the two adjacent blocks whose join has the lowest cardinality.
+   */
+  auto block_indices = std::vector<size_t>{};
+  auto vertex_set = JoinGraphVertexSet{};
+  auto plan = std::shared_ptr<AbstractLQPNode>{};
+  auto lowest_cardinality = std::numeric_limits<Cardinality>::max();
+  for (auto left_block_idx = size_t{0}; left_block_idx < block_count; ++left_block_idx) {
+    for (auto right_block_idx = left_block_idx + 1; right_block_idx < block_count; ++right_block_idx) {
+      if (!adjacent_blocks[left_block_idx][right_block_idx]) {
+        continue;
+      }
+
+      const auto& left_block = blocks[left_block_idx];
+      const auto& right_block = blocks[right_block_idx];
+      const auto join_predicates = join_graph.find_join_predicates(left_block.vertex_set, right_block.vertex_set);
+      const auto candidate_plan = _add_join_to_plan(left_block.plan, right_block.plan, join_predicates, cost_estimator);
+      const auto cardinality = cardinality_estimator->estimate_cardinality(candidate_plan);
+      if (!plan || cardinality < lowest_cardinality) {
+        block_indices = {left_block_idx, right_block_idx};
+        vertex_set = left_block.vertex_set | right_block.vertex_set;
+        plan = candidate_plan;
+        lowest_cardinality = cardinality;
+      }
+    }
+  }
+
+  if (!plan) {
+    return {};
+  }
+
+  /**
+   * 3. Add the adjacent block that results in the lowest cardinality when joined with the selected ones until the
+   *    block size is reached. DpCcp will find a better order for the selected blocks than this greedy one.
+   */
+  while (block_indices.size() < _block_size) {
+    auto next_block_idx = std::optional<size_t>{};
+    auto next_plan = std::shared_ptr<AbstractLQPNode>{};
+    lowest_cardinality = std::numeric_limits<Cardinality>::max();
+
+    for (auto block_idx = size_t{0}; block_idx < block_count; ++block_idx) {
+      const auto is_adjacent = std::any_of(block_indices.cbegin(), block_indices.cend(), [&](const auto selected_idx) {
+        return adjacent_blocks[selected_idx][block_idx];
+      });
+      if (!is_adjacent || (blocks[block_idx].vertex_set & vertex_set).any()) {
+        continue;
+      }
+
+      const auto join_predicates = join_graph.find_join_predicates(vertex_set, blocks[block_idx].vertex_set);
+      const auto candidate_plan = _add_join_to_plan(plan, blocks[block_idx].plan, join_predicates, cost_estimator);
+      const auto cardinality = cardinality_estimator->estimate_cardinality(candidate_plan);
+      if (!next_plan || cardinality < lowest_cardinality) {
+        next_block_idx = block_idx;
+        next_plan = candidate_plan;
+        lowest_cardinality = cardinality;
+      }
+    }
+
+    if (!next_block_idx) {
+      break;
+    }
+
+    block_indices.emplace_back(*next_block_idx);
+    vertex_set |= blocks[*next_block_idx].vertex_set;
+    plan = next_plan;
+  }
+
+  return block_indices;
+}
+
+IterativeDpCcp::Block IterativeDpCcp::_combine_blocks(const JoinGraph& join_graph, const std::vector<Block>& blocks,
+                                                      const std::vector<size_t>& block_indices,
+                                                      const std::shared_ptr<AbstractCostEstimator>& cost_estimator) {
+  /**
+   * Build a JoinGraph with the selected blocks as vertices. Its edges are the edges between the selected blocks, with
+   * their vertex sets translated to the indices of the blocks. Edges within a block have been applied when the block
+   * was created. Edges to other blocks are applied when the new block is joined with them.
+   */
+  const auto selected_block_count = block_indices.size();
+  auto vertices = std::vector<std::shared_ptr<AbstractLQPNode>>{};
+  vertices.reserve(selected_block_count);
+  auto vertex_set = JoinGraphVertexSet{blocks.front().vertex_set.size()};
+  for (const auto block_idx : block_indices) {
+    vertices.emplace_back(blocks[block_idx].plan);
+    vertex_set |= blocks[block_idx].vertex_set;
+  }
+
+  auto predicates_by_block_set = std::map<JoinGraphVertexSet, std::vector<std::shared_ptr<AbstractExpression>>>{};
+  for (const auto& edge : join_graph.edges) {
+    if (edge.vertex_set.none() || !edge.vertex_set.is_subset_of(vertex_set)) {
+      continue;
+    }
+
+    auto block_set = JoinGraphVertexSet{selected_block_count};
+    for (auto selected_block_idx = size_t{0}; selected_block_idx < selected_block_count; ++selected_block_idx) {
+      if ((edge.vertex_set & blocks[block_indices[selected_block_idx]].vertex_set).any()) {
+        block_set.set(selected_block_idx);
+      }
+    }
+
+    if (block_set.count() < 2) {
+      continue;
+    }
+
+    auto& predicates = predicates_by_block_set[block_set];
+    predicates.insert(predicates.end(), edge.predicates.cbegin(), edge.predicates.cend());
+  }
+
+  auto edges = std::vector<JoinGraphEdge>{};
+  edges.reserve(predicates_by_block_set.size());
+  for (const auto& [block_set, predicates] : predicates_by_block_set) {
+    edges.emplace_back(block_set, predicates);
+  }
+
+  const auto block_join_graph = JoinGraph{vertices, edges};
+  return Block{vertex_set, DpCcp{}(block_join_graph, cost_estimator)};  // NOLINT - doesn't like `{}()`
+}
+
+}  // namespace hyrise
@@ -0,0 +1,55 @@
+#pragma once
+
+#include <memory>
+#include <vector>
+
+#include "abstract_join_ordering_algorithm.hpp"
+#include "join_graph_edge.hpp"
+
+namespace hyrise {
+
+class AbstractCostEstimator;
+class JoinGraph;
+
+/**
+ * Join ordering algorithm for JoinGraphs that are too large for DpCcp, derived from "Iterative Dynamic Programming: A
+ * New Class of Query Optimization Algorithms" (Kossmann and Stocker, https://dl.acm.org/doi/10.1145/352958.352982).
+ *
+ * The vertices are combined into "blocks". Initially, each block consists of a single vertex and its local predicates.
+ * In each iteration, we greedily select up to block_size connected blocks: we start with the two blocks whose join has
+ * the lowest cardinality (as GreedyOperatorOrdering does) and repeatedly add the block that results in the lowest
+ * cardinality when joined with the selected ones. DpCcp then finds the optimal plan for the selected blocks, which
+ * replaces them as a new block. Once at most block_size blocks remain, DpCcp joins them.
+ *
+ * Thus, the runtime grows polynomially with the number of vertices, but the plans for subgraphs of up to block_size
+ * blocks are optimal. For block_size >= #vertices, the algorithm equals DpCcp.
+ */
+class IterativeDpCcp final : public AbstractJoinOrderingAlgorithm {
+ public:
+  static constexpr auto DEFAULT_BLOCK_SIZE = size_t{8};
+
+  explicit IterativeDpCcp(const size_t block_size = DEFAULT_BLOCK_SIZE);
+
+  std::shared_ptr<AbstractLQPNode> operator()(const JoinGraph& join_graph,
+                                              const std::shared_ptr<AbstractCostEstimator>& cost_estimator) override;
+
+ private:
+  // Subplan for a set of vertices with all predicates between them.
+  struct Block {
+    JoinGraphVertexSet vertex_set;
+    std::shared_ptr<AbstractLQPNode> plan;
+  };
+
+  // Returns the indices of up to _block_size connected blocks.
+  std::vector<size_t> _select_blocks(const JoinGraph& join_graph, const std::vector<Block>& blocks,
+                                     const std::shared_ptr<AbstractCostEstimator>& cost_estimator) const;
+
+  // Joins the selected blocks using DpCcp.
+  static Block _combine_blocks(const JoinGraph& join_graph, const std::vector<Block>& blocks,
+                               const std::vector<size_t>& block_indices,
+                               const std::shared_ptr<AbstractCostEstimator>& cost_estimator);
+
+  const size_t _block_size;
+};
+
+}  // namespace hyrise
@@ -3,9 +3,11 @@
 #include <memory>
 #include <unordered_set>
 
+#include "cost_estimation/cost_estimator_calibrated.hpp"
 #include "cost_estimation/cost_estimator_logical.hpp"
 #include "expression/expression_utils.hpp"
 #include "expression/lqp_subquery_expression.hpp"
+#include "hyrise.hpp"
 #include "logical_query_plan/logical_plan_root_node.hpp"
 #include "logical_query_plan/lqp_utils.hpp"
 #include "strategy/between_composition_rule.hpp"
@@ -35,7 +37,12 @@ namespace hyrise {
  * optimization costs reasonable.
  */
 std::shared_ptr<Optimizer> Optimizer::create_default_optimizer() {
-  auto optimizer = std::make_shared<Optimizer>();
+  // Use the calibrated cost model if its coefficients are available. Otherwise, fall back to the logical cost model.
+  const auto& cost_model_coefficients = Hyrise::get().cost_model_coefficients;
+  auto optimizer = cost_model_coefficients
+                       ? std::make_shared<Optimizer>(std::make_shared<CostEstimatorCalibrated>(
+                             std::make_shared<CardinalityEstimator>(), cost_model_coefficients))
+                       : std::make_shared<Optimizer>();
 
   optimizer->add_rule(std::make_unique<ExpressionReductionRule>());
 
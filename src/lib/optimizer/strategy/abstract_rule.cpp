@@ -4,8 +4,31 @@
 
 #include "expression/expression_utils.hpp"
 #include "expression/lqp_subquery_expression.hpp"
+#include "hyrise.hpp"
 #include "logical_query_plan/abstract_lqp_node.hpp"
 #include "logical_query_plan/logical_plan_root_node.hpp"
+#include "logical_query_plan/lqp_utils.hpp"
+#include "scheduler/job_task.hpp"
+
+namespace {
+
+using namespace hyrise;  // NOLINT
+
+bool contains_subquery(const std::shared_ptr<AbstractLQPNode>& lqp) {
+  auto found_subquery = false;
+  visit_lqp(lqp, [&](const auto& node) {
+    for (const auto& expression : node->node_expressions) {
+      visit_expression(expression, [&](const auto& sub_expression) {
+        found_subquery |= sub_expression->type == ExpressionType::LQPSubquery;
+        return found_subquery ? ExpressionVisitation::DoNotVisitArguments : ExpressionVisitation::VisitArguments;
+      });
+    }
+    return found_subquery ? LQPVisitation::DoNotVisitInputs : LQPVisitation::VisitInputs;
+  });
+  return found_subquery;
+}
+
+}  // namespace
 
 namespace hyrise {
 
@@ -13,14 +36,11 @@ void AbstractRule::apply_to_plan(const std::shared_ptr<LogicalPlanRootNode>& lqp
   // (1) Optimize root LQP
   _apply_to_plan_without_subqueries(lqp_root);
 
-  // (2) Optimize distinct subquery LQPs, one-by-one.
-  auto subquery_expressions_by_lqp = collect_lqp_subquery_expressions_by_lqp(lqp_root);
-  for (const auto& [lqp, subquery_expressions] : subquery_expressions_by_lqp) {
-    if (std::all_of(subquery_expressions.cbegin(), subquery_expressions.cend(),
-                    [](auto subquery_expression) { return subquery_expression.expired(); })) {
-      continue;
-    }
-
+  // (2) Optimize distinct subquery LQPs. Subquery LQPs without nested subqueries do not share nodes with any other LQP
+  //     that is optimized in the meantime. Thus, they are optimized in parallel. Subquery LQPs with nested subqueries
+  //     are optimized one-by-one afterwards, as rules might read or modify the nested LQPs (e.g., the
+  //     SubqueryToJoinRule).
+  const auto optimize_subquery_lqp = [&](const auto& lqp, const auto& subquery_expressions) {
     // (2.1) Optimize subplan
     const auto local_lqp_root = LogicalPlanRootNode::make(lqp);
     _apply_to_plan_without_subqueries(local_lqp_root);
@@ -32,6 +52,36 @@ void AbstractRule::apply_to_plan(const std::shared_ptr<LogicalPlanRootNode>& lqp
 
     // (2.3) Untie the root node before it goes out of scope so that the outputs of the LQP remain correct.
     local_lqp_root->set_left_input(nullptr);
+  };
+
+  auto subquery_expressions_by_lqp = collect_lqp_subquery_expressions_by_lqp(lqp_root);
+  auto jobs = std::vector<std::shared_ptr<AbstractTask>>{};
+  auto lqps_with_nested_subqueries = std::vector<std::shared_ptr<AbstractLQPNode>>{};
+  for (const auto& [lqp, subquery_expressions] : subquery_expressions_by_lqp) {
+    if (std::all_of(subquery_expressions.cbegin(), subquery_expressions.cend(),
+                    [](auto subquery_expression) { return subquery_expression.expired(); })) {
+      continue;
+    }
+
+    if (contains_subquery(lqp)) {
+      lqps_with_nested_subqueries.emplace_back(lqp);
+      continue;
+    }
+
+    jobs.emplace_back(std::make_shared<JobTask>([&, lqp = lqp]() {
+      optimize_subquery_lqp(lqp, subquery_expressions_by_lqp.at(lqp));
+    }));
+  }
+
+  // Scheduling a single job does not pay off.
+  if (jobs.size() > 1) {
+    Hyrise::get().scheduler()->schedule_and_wait_for_tasks(jobs);
+  } else if (jobs.size() == 1) {
+    jobs.front()->execute();
+  }
+
+  for (const auto& lqp : lqps_with_nested_subqueries) {
+    optimize_subquery_lqp(lqp, subquery_expressions_by_lqp.at(lqp));
   }
 }
 
@@ -21,7 +21,9 @@ class AbstractRule {
    * This function applies the concrete Optimizer Rule to an LQP.
    * The default implementation
    *  (1) optimizes the root LQP
-   *  (2) optimizes all (nested) subquery LQPs of the optimized root LQP, one-by-one.
+   *  (2) optimizes all (nested) subquery LQPs of the optimized root LQP. Subquery LQPs without nested subqueries are
+   *      optimized in parallel, the others one-by-one. Thus, rules that keep state across invocations of
+   *      _apply_to_plan_without_subqueries() have to synchronize access to it (see, e.g., the ChunkPruningRule).
    *
    *      IMPORTANT NOTES ON OPTIMIZING SUBQUERY LQPS:
    *
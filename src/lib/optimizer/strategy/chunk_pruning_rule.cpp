@@ -6,6 +6,9 @@
 #include "all_parameter_variant.hpp"
 #include "constant_mappings.hpp"
 #include "expression/expression_utils.hpp"
+#include "expression/in_expression.hpp"
+#include "expression/list_expression.hpp"
+#include "expression/value_expression.hpp"
 #include "hyrise.hpp"
 #include "logical_query_plan/abstract_lqp_node.hpp"
 #include "logical_query_plan/join_node.hpp"
@@ -14,8 +17,6 @@
 #include "lossless_cast.hpp"
 #include "resolve_type.hpp"
 #include "statistics/attribute_statistics.hpp"
-#include "statistics/statistics_objects/min_max_filter.hpp"
-#include "statistics/statistics_objects/range_filter.hpp"
 #include "statistics/table_statistics.hpp"
 #include "storage/table.hpp"
 #include "utils/assert.hpp"
@@ -209,14 +210,16 @@ std::set<ChunkID> ChunkPruningRule::_compute_exclude_list(
   std::set<ChunkID> excluded_chunk_ids;
   for (const auto& predicate_node : predicate_pruning_chain) {
     // Determine the set of chunks that can be excluded for the given PredicateNode's predicate.
-    auto excluded_chunk_ids_iter =
-
-        _excluded_chunk_ids_by_predicate_node_cache.find(std::make_pair(stored_table_node, predicate_node));
-    if (excluded_chunk_ids_iter != _excluded_chunk_ids_by_predicate_node_cache.end()) {
-      // Shortcut: The given PredicateNode is part of multiple predicate pruning chains and the set of excluded chunks
-      //           has already been calculated.
-      excluded_chunk_ids.insert(excluded_chunk_ids_iter->second.begin(), excluded_chunk_ids_iter->second.end());
-      continue;
+    {
+      const auto lock = std::lock_guard<std::mutex>{_excluded_chunk_ids_by_predicate_node_cache_mutex};
+      const auto excluded_chunk_ids_iter =
+          _excluded_chunk_ids_by_predicate_node_cache.find(std::make_pair(stored_table_node, predicate_node));
+      if (excluded_chunk_ids_iter != _excluded_chunk_ids_by_predicate_node_cache.end()) {
+        // Shortcut: The given PredicateNode is part of multiple predicate pruning chains and the set of excluded
+        //           chunks has already been calculated.
+        excluded_chunk_ids.insert(excluded_chunk_ids_iter->second.begin(), excluded_chunk_ids_iter->second.end());
+        continue;
+      }
     }
 
     auto& predicate = *predicate_node->predicate();
@@ -231,6 +234,21 @@ std::set<ChunkID> ChunkPruningRule::_compute_exclude_list(
     stored_table_node_without_column_pruning->set_pruned_column_ids({});
     const auto predicate_without_column_pruning = expression_copy_and_adapt_to_different_lqp(
         predicate, {{stored_table_node, stored_table_node_without_column_pruning}});
+    auto table = Hyrise::get().storage_manager.get_table(stored_table_node->table_name);
+
+    // IN predicates cannot be expressed as OperatorScanPredicates. We prune them on their own.
+    if (const auto in_expression = std::dynamic_pointer_cast<InExpression>(predicate_without_column_pruning)) {
+      const auto in_list_excluded_chunk_ids =
+          _compute_in_list_exclude_list(*in_expression, *stored_table_node_without_column_pruning, *table);
+      if (in_list_excluded_chunk_ids) {
+        const auto lock = std::lock_guard<std::mutex>{_excluded_chunk_ids_by_predicate_node_cache_mutex};
+        _excluded_chunk_ids_by_predicate_node_cache.emplace(std::make_pair(stored_table_node, predicate_node),
+                                                            *in_list_excluded_chunk_ids);
+        excluded_chunk_ids.insert(in_list_excluded_chunk_ids->begin(), in_list_excluded_chunk_ids->end());
+        continue;
+      }
+    }
+
     const auto operator_predicates = OperatorScanPredicate::from_expression(*predicate_without_column_pruning,
                                                                             *stored_table_node_without_column_pruning);
     // End of hacky
@@ -240,7 +258,6 @@ std::set<ChunkID> ChunkPruningRule::_compute_exclude_list(
     }
 
     std::set<ChunkID> current_excluded_chunk_ids;
-    auto table = Hyrise::get().storage_manager.get_table(stored_table_node->table_name);
 
     const auto stored_table_node_output_expressions = stored_table_node_without_column_pruning->output_expressions();
     for (const auto& operator_predicate : *operator_predicates) {
@@ -312,6 +329,7 @@ std::set<ChunkID> ChunkPruningRule::_compute_exclude_list(
     }
 
     // Cache result
+    const auto lock = std::lock_guard<std::mutex>{_excluded_chunk_ids_by_predicate_node_cache_mutex};
     _excluded_chunk_ids_by_predicate_node_cache.emplace(std::make_pair(stored_table_node, predicate_node),
                                                         current_excluded_chunk_ids);
     // Add to global excluded list because we collect excluded chunks for the whole predicate pruning chain
@@ -324,33 +342,61 @@ std::set<ChunkID> ChunkPruningRule::_compute_exclude_list(
 bool ChunkPruningRule::_can_prune(const BaseAttributeStatistics& base_segment_statistics,
                                   const PredicateCondition predicate_condition, const AllTypeVariant& variant_value,
                                   const std::optional<AllTypeVariant>& variant_value2) {
-  auto can_prune = false;
+  return base_segment_statistics.does_not_contain(predicate_condition, variant_value, variant_value2);
+}
 
-  resolve_data_type(base_segment_statistics.data_type, [&](const auto data_type_t) {
-    using ColumnDataType = typename decltype(data_type_t)::type;
+std::optional<std::set<ChunkID>> ChunkPruningRule::_compute_in_list_exclude_list(
+    const InExpression& in_expression, const StoredTableNode& stored_table_node, const Table& table) {
+  if (in_expression.is_negated() || in_expression.set()->type != ExpressionType::List) {
+    return std::nullopt;
+  }
 
-    const auto& segment_statistics = static_cast<const AttributeStatistics<ColumnDataType>&>(base_segment_statistics);
+  const auto column_id = stored_table_node.find_column_id(*in_expression.value());
+  if (!column_id) {
+    return std::nullopt;
+  }
 
-    // Range filters are only available for arithmetic (non-string) types.
-    if constexpr (std::is_arithmetic_v<ColumnDataType>) {
-      if (segment_statistics.range_filter) {
-        if (segment_statistics.range_filter->does_not_contain(predicate_condition, variant_value, variant_value2)) {
-          can_prune = true;
-        }
-      }
-      // RangeFilters contain all the information stored in a MinMaxFilter. There is no point in having both.
-      DebugAssert(!segment_statistics.min_max_filter,
-                  "Segment should not have a MinMaxFilter and a RangeFilter at the same time");
+  // Collect the list's values. As for other predicates, we only prune if all values can be converted losslessly to
+  // the column's data type. NULL values never match and are skipped.
+  const auto column_data_type = in_expression.value()->data_type();
+  auto values = std::vector<AllTypeVariant>{};
+  for (const auto& element : static_cast<const ListExpression&>(*in_expression.set()).elements()) {
+    if (element->type != ExpressionType::Value) {
+      return std::nullopt;
     }
 
-    if (segment_statistics.min_max_filter) {
-      if (segment_statistics.min_max_filter->does_not_contain(predicate_condition, variant_value, variant_value2)) {
-        can_prune = true;
-      }
+    const auto& value = static_cast<const ValueExpression&>(*element).value;
+    if (variant_is_null(value)) {
+      continue;
     }
-  });
 
-  return can_prune;
+    const auto casted_value = lossless_variant_cast(value, column_data_type);
+    if (!casted_value) {
+      return std::nullopt;
+    }
+    values.emplace_back(*casted_value);
+  }
+
+  // A chunk can be pruned if it contains none of the values. We do not adapt the table statistics, as they cannot
+  // represent IN predicates. This overestimates the cardinality of the pruned StoredTableNode.
+  auto excluded_chunk_ids = std::set<ChunkID>{};
+  const auto chunk_count = table.chunk_count();
+  for (auto chunk_id = ChunkID{0}; chunk_id < chunk_count; ++chunk_id) {
+    const auto chunk = table.get_chunk(chunk_id);
+    if (!chunk || !chunk->pruning_statistics()) {
+      continue;
+    }
+
+    const auto& segment_statistics = *(*chunk->pruning_statistics())[*column_id];
+    const auto can_prune = std::all_of(values.cbegin(), values.cend(), [&](const auto& value) {
+      return _can_prune(segment_statistics, PredicateCondition::Equals, value, std::nullopt);
+    });
+    if (can_prune) {
+      excluded_chunk_ids.insert(chunk_id);
+    }
+  }
+
+  return excluded_chunk_ids;
 }
 
 std::shared_ptr<TableStatistics> ChunkPruningRule::_prune_table_statistics(const TableStatistics& old_statistics,
@@ -1,6 +1,8 @@
 #pragma once
 
 #include <memory>
+#include <mutex>
+#include <optional>
 #include <set>
 #include <string>
 #include <vector>
@@ -15,6 +17,7 @@ namespace hyrise {
 class AbstractLQPNode;
 class ChunkStatistics;
 class AbstractExpression;
+class InExpression;
 class StoredTableNode;
 class PredicateNode;
 class Table;
@@ -44,6 +47,12 @@ class ChunkPruningRule : public AbstractRule {
                          const PredicateCondition predicate_condition, const AllTypeVariant& variant_value,
                          const std::optional<AllTypeVariant>& variant_value2);
 
+  // Determines the chunks that contain none of the values of an IN list. Returns std::nullopt if the predicate is not
+  // of the form `<column> IN (<value>, ...)`.
+  static std::optional<std::set<ChunkID>> _compute_in_list_exclude_list(const InExpression& in_expression,
+                                                                         const StoredTableNode& stored_table_node,
+                                                                         const Table& table);
+
   static std::shared_ptr<TableStatistics> _prune_table_statistics(const TableStatistics& old_statistics,
                                                                   OperatorScanPredicate predicate,
                                                                   size_t num_rows_pruned);
@@ -54,11 +63,13 @@ class ChunkPruningRule : public AbstractRule {
   /**
    * Caches intermediate results.
    * Mutable because it needs to be called from the _apply_to_plan_without_subqueries function, which is const.
+   * Guarded by a mutex, as subquery LQPs might be optimized in parallel (see AbstractRule::apply_to_plan()).
    */
   using StoredTableNodePredicateNodePair = std::pair<std::shared_ptr<StoredTableNode>, std::shared_ptr<PredicateNode>>;
   mutable std::unordered_map<StoredTableNodePredicateNodePair, std::set<ChunkID>,
                              boost::hash<StoredTableNodePredicateNodePair>>
       _excluded_chunk_ids_by_predicate_node_cache;
+  mutable std::mutex _excluded_chunk_ids_by_predicate_node_cache_mutex;
 };
 
 }  // namespace hyrise
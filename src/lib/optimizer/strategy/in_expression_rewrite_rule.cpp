@@ -107,6 +107,7 @@ std::string InExpressionRewriteRule::name() const {
 }
 
 std::shared_ptr<AbstractCardinalityEstimator> InExpressionRewriteRule::_cardinality_estimator() const {
+  const auto lock = std::lock_guard<std::mutex>{_cardinality_estimator_mutex};
   if (!_cardinality_estimator_internal) {
     _cardinality_estimator_internal = cost_estimator->cardinality_estimator->new_instance();
   }
@@ -1,5 +1,7 @@
 #pragma once
 
+#include <mutex>
+
 #include "abstract_rule.hpp"
 
 namespace hyrise {
@@ -44,6 +46,9 @@ class InExpressionRewriteRule : public AbstractRule {
   std::shared_ptr<AbstractCardinalityEstimator> _cardinality_estimator() const;
 
   mutable std::shared_ptr<AbstractCardinalityEstimator> _cardinality_estimator_internal;
+
+  // Subquery LQPs might be optimized in parallel (see AbstractRule::apply_to_plan()).
+  mutable std::mutex _cardinality_estimator_mutex;
 };
 
 }  // namespace hyrise
@@ -3,18 +3,27 @@
 #include <algorithm>
 #include <iostream>
 #include <memory>
+#include <optional>
 #include <string>
 #include <vector>
 
 #include "all_parameter_variant.hpp"
 #include "constant_mappings.hpp"
 #include "cost_estimation/abstract_cost_estimator.hpp"
+#include "cost_estimation/cost_estimator_calibrated.hpp"
+#include "expression/binary_predicate_expression.hpp"
+#include "expression/expression_utils.hpp"
+#include "expression/logical_expression.hpp"
+#include "expression/lqp_column_expression.hpp"
+#include "expression/value_expression.hpp"
+#include "hyrise.hpp"
 #include "logical_query_plan/abstract_lqp_node.hpp"
 #include "logical_query_plan/lqp_utils.hpp"
 #include "logical_query_plan/predicate_node.hpp"
 #include "logical_query_plan/stored_table_node.hpp"
 #include "operators/operator_scan_predicate.hpp"
 #include "statistics/cardinality_estimator.hpp"
+#include "storage/index/table_index/abstract_table_index.hpp"
 #include "utils/assert.hpp"
 
 namespace {
@@ -26,6 +35,34 @@ constexpr float INDEX_SCAN_SELECTIVITY_THRESHOLD = 0.01f;
 // Only if the number of input rows exceeds num_input_rows, the ScanType can be set to IndexScan.
 // The number is taken from: Fast Lookups for In-Memory Column Stores: Group-Key Indices, Lookup and Maintenance.
 constexpr float INDEX_SCAN_ROW_COUNT_THRESHOLD = 1000.0f;
+
+using namespace hyrise;  // NOLINT
+
+// Returns the original ColumnID if the predicate has the form `<column of stored_table_node> = <literal>` and the
+// literal is of the column's data type.
+std::optional<ColumnID> equals_literal_column_id(const AbstractExpression& predicate,
+                                                 const std::shared_ptr<StoredTableNode>& stored_table_node) {
+  const auto* const binary_predicate = dynamic_cast<const BinaryPredicateExpression*>(&predicate);
+  if (!binary_predicate || binary_predicate->predicate_condition != PredicateCondition::Equals) {
+    return std::nullopt;
+  }
+
+  auto column_expression = std::dynamic_pointer_cast<LQPColumnExpression>(binary_predicate->left_operand());
+  auto value_expression = std::dynamic_pointer_cast<ValueExpression>(binary_predicate->right_operand());
+  if (!column_expression || !value_expression) {
+    column_expression = std::dynamic_pointer_cast<LQPColumnExpression>(binary_predicate->right_operand());
+    value_expression = std::dynamic_pointer_cast<ValueExpression>(binary_predicate->left_operand());
+  }
+
+  if (!column_expression || !value_expression || column_expression->original_node.lock() != stored_table_node ||
+      variant_is_null(value_expression->value) ||
+      data_type_from_all_type_variant(value_expression->value) != column_expression->data_type()) {
+    return std::nullopt;
+  }
+
+  return column_expression->original_column_id;
+}
+
 }  // namespace
 
 namespace hyrise {
@@ -39,6 +76,8 @@ void IndexScanRule::_apply_to_plan_without_subqueries(const std::shared_ptr<Abst
   DebugAssert(cost_estimator, "IndexScanRule requires cost estimator to be set");
   Assert(lqp_root->type == LQPNodeType::Root, "ExpressionReductionRule needs root to hold onto");
 
+  _apply_primary_key_lookups(lqp_root);
+
   visit_lqp(lqp_root, [&](const auto& node) {
     if (node->type == LQPNodeType::Predicate) {
       const auto& child = node->left_input();
@@ -47,6 +86,11 @@ void IndexScanRule::_apply_to_plan_without_subqueries(const std::shared_ptr<Abst
         const auto predicate_node = std::dynamic_pointer_cast<PredicateNode>(node);
         const auto stored_table_node = std::dynamic_pointer_cast<StoredTableNode>(child);
 
+        if (_is_table_index_scan_applicable(stored_table_node, predicate_node)) {
+          predicate_node->scan_type = ScanType::IndexScan;
+          return LQPVisitation::VisitInputs;
+        }
+
         const auto indexes_statistics = stored_table_node->indexes_statistics();
         for (const auto& index_statistics : indexes_statistics) {
           if (_is_index_scan_applicable(index_statistics, predicate_node)) {
@@ -60,6 +104,60 @@ void IndexScanRule::_apply_to_plan_without_subqueries(const std::shared_ptr<Abst
   });
 }
 
+void IndexScanRule::_apply_primary_key_lookups(const std::shared_ptr<AbstractLQPNode>& lqp_root) {
+  // Collect the StoredTableNodes first, as the plan is modified below.
+  const auto stored_table_nodes = lqp_find_nodes_by_type(lqp_root, LQPNodeType::StoredTable);
+  for (const auto& node : stored_table_nodes) {
+    const auto stored_table_node = std::static_pointer_cast<StoredTableNode>(node);
+    const auto primary_key_index =
+        Hyrise::get().storage_manager.get_table(stored_table_node->table_name)->primary_key_index();
+    if (!primary_key_index) {
+      continue;
+    }
+
+    // Walk up the chain of PredicateNodes and ValidateNodes above the StoredTableNode and look for an equality
+    // predicate on each key column.
+    const auto& key_column_ids = primary_key_index->column_ids();
+    auto key_predicate_nodes = std::vector<std::shared_ptr<PredicateNode>>(key_column_ids.size());
+    auto current_node = node;
+    while (current_node->outputs().size() == 1) {
+      const auto output_node = current_node->outputs()[0];
+      if (output_node->type == LQPNodeType::Predicate) {
+        const auto predicate_node = std::static_pointer_cast<PredicateNode>(output_node);
+        const auto column_id = equals_literal_column_id(*predicate_node->predicate(), stored_table_node);
+        const auto key_column_iter = std::find(key_column_ids.cbegin(), key_column_ids.cend(), column_id);
+        if (column_id && key_column_iter != key_column_ids.cend()) {
+          auto& key_predicate_node = key_predicate_nodes[std::distance(key_column_ids.cbegin(), key_column_iter)];
+          if (!key_predicate_node) {
+            key_predicate_node = predicate_node;
+          }
+        }
+      } else if (output_node->type != LQPNodeType::Validate) {
+        break;
+      }
+      current_node = output_node;
+    }
+
+    if (std::any_of(key_predicate_nodes.cbegin(), key_predicate_nodes.cend(),
+                    [](const auto& predicate_node) { return !predicate_node; })) {
+      continue;
+    }
+
+    // Replace the predicates with a single conjunction directly above the StoredTableNode. It is translated to an
+    // IndexScan that looks up the key in the PrimaryKeyIndex.
+    auto key_predicates = std::vector<std::shared_ptr<AbstractExpression>>{};
+    key_predicates.reserve(key_predicate_nodes.size());
+    for (const auto& key_predicate_node : key_predicate_nodes) {
+      key_predicates.emplace_back(key_predicate_node->predicate());
+      lqp_remove_node(key_predicate_node);
+    }
+
+    const auto lookup_node = PredicateNode::make(inflate_logical_expressions(key_predicates, LogicalOperator::And));
+    lookup_node->scan_type = ScanType::IndexScan;
+    lqp_insert_node_above(stored_table_node, lookup_node);
+  }
+}
+
 bool IndexScanRule::_is_index_scan_applicable(const IndexStatistics& index_statistics,
                                               const std::shared_ptr<PredicateNode>& predicate_node) const {
   if (!_is_single_segment_index(index_statistics)) {
@@ -78,8 +176,9 @@ bool IndexScanRule::_is_index_scan_applicable(const IndexStatistics& index_stati
 
   const auto& operator_predicate = (*operator_predicates)[0];
 
-  // Currently, we do not support two-column predicates
-  if (is_column_id(operator_predicate.value)) {
+  // Currently, we do not support two-column predicates. The IndexScan also requires literal values, i.e., no
+  // (correlated) parameters.
+  if (!is_variant(operator_predicate.value) || (operator_predicate.value2 && !is_variant(*operator_predicate.value2))) {
     return false;
   }
 
@@ -87,6 +186,57 @@ bool IndexScanRule::_is_index_scan_applicable(const IndexStatistics& index_stati
     return false;
   }
 
+  return _is_selective_enough(predicate_node);
+}
+
+bool IndexScanRule::_is_table_index_scan_applicable(const std::shared_ptr<StoredTableNode>& stored_table_node,
+                                                    const std::shared_ptr<PredicateNode>& predicate_node) const {
+  const auto operator_predicates =
+      OperatorScanPredicate::from_expression(*predicate_node->predicate(), *predicate_node);
+  if (!operator_predicates || operator_predicates->size() != 1) {
+    return false;
+  }
+
+  // Table indexes are probed with literal values. Neither column comparisons nor (correlated) parameters are handled.
+  const auto& operator_predicate = (*operator_predicates)[0];
+  if (!is_variant(operator_predicate.value) ||
+      (operator_predicate.value2 && !is_variant(*operator_predicate.value2))) {
+    return false;
+  }
+
+  const auto column_expression = std::dynamic_pointer_cast<LQPColumnExpression>(
+      stored_table_node->output_expressions()[operator_predicate.column_id]);
+  DebugAssert(column_expression, "Expected the StoredTableNode to output LQPColumnExpressions");
+
+  // The index lookup does not cast the search values, they have to be of the column's data type.
+  const auto& value = boost::get<AllTypeVariant>(operator_predicate.value);
+  if (variant_is_null(value) || data_type_from_all_type_variant(value) != column_expression->data_type()) {
+    return false;
+  }
+
+  if (operator_predicate.value2) {
+    const auto& value2 = boost::get<AllTypeVariant>(*operator_predicate.value2);
+    if (variant_is_null(value2) || data_type_from_all_type_variant(value2) != column_expression->data_type()) {
+      return false;
+    }
+  }
+
+  const auto table = Hyrise::get().storage_manager.get_table(stored_table_node->table_name);
+  if (!table->get_table_index(column_expression->original_column_id, operator_predicate.predicate_condition)) {
+    return false;
+  }
+
+  return _is_selective_enough(predicate_node);
+}
+
+bool IndexScanRule::_is_selective_enough(const std::shared_ptr<PredicateNode>& predicate_node) const {
+  // A calibrated cost model knows the costs of both scan operators on this machine and for the encoding of the scanned
+  // segments. Thus, it replaces the fixed thresholds below.
+  if (const auto calibrated_cost_estimator = std::dynamic_pointer_cast<CostEstimatorCalibrated>(cost_estimator)) {
+    return calibrated_cost_estimator->estimate_scan_cost(predicate_node, ScanType::IndexScan) <
+           calibrated_cost_estimator->estimate_scan_cost(predicate_node, ScanType::TableScan);
+  }
+
   const auto row_count_table =
       cost_estimator->cardinality_estimator->estimate_cardinality(predicate_node->left_input());
   if (row_count_table < INDEX_SCAN_ROW_COUNT_THRESHOLD) {
@@ -12,6 +12,7 @@ namespace hyrise {
 
 class AbstractLQPNode;
 class PredicateNode;
+class StoredTableNode;
 
 /**
  * This optimizer rule finds PredicateNodes whose inputs are StoredTableNodes. These PredicateNodes are candidates
@@ -22,7 +23,19 @@ class PredicateNode;
  * For now this rule is only applicable to single-column indexes. Multi-column predicates (i.e. WHERE a < b) are also
  * not supported. We also assume that if chunks have an index, all of them are of the same type, we do not mix GroupKey
  * and ART indexes. In addition, chains of IndexScans are not possible since an IndexScan's input must be a GetTable.
- * Currently, only GroupKeyIndexes are supported.
+ * Currently, only GroupKeyIndexes are supported as chunk indexes.
+ *
+ * If the stored table has a PrimaryKeyIndex and a chain of predicates above the StoredTableNode compares each key
+ * column with a literal, these predicates are merged into a single PredicateNode directly above the StoredTableNode.
+ * It is executed as an IndexScan that looks up the key in the PrimaryKeyIndex (a point lookup). As the lookup returns
+ * at most one visible row, no cardinality estimation is needed.
+ *
+ * Table indexes (see AbstractTableIndex) are preferred over chunk indexes. They are used if the stored table has a
+ * table index on the predicate's column that supports the predicate condition and if the predicate compares the
+ * column to literal values of the column's data type.
+ *
+ * With a CostEstimatorCalibrated, an index is used if the estimated cost of the IndexScan is below the one of the
+ * TableScan. Otherwise, fixed thresholds for the selectivity and the input row count decide.
  */
 
 class IndexScanRule : public AbstractRule {
@@ -31,8 +44,12 @@ class IndexScanRule : public AbstractRule {
 
  protected:
   void _apply_to_plan_without_subqueries(const std::shared_ptr<AbstractLQPNode>& lqp_root) const override;
+  static void _apply_primary_key_lookups(const std::shared_ptr<AbstractLQPNode>& lqp_root);
   bool _is_index_scan_applicable(const IndexStatistics& index_statistics,
                                  const std::shared_ptr<PredicateNode>& predicate_node) const;
+  bool _is_table_index_scan_applicable(const std::shared_ptr<StoredTableNode>& stored_table_node,
+                                       const std::shared_ptr<PredicateNode>& predicate_node) const;
+  bool _is_selective_enough(const std::shared_ptr<PredicateNode>& predicate_node) const;
   static bool _is_single_segment_index(const IndexStatistics& index_statistics);
 };
 
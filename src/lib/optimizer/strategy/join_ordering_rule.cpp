@@ -4,7 +4,7 @@
 #include "expression/expression_utils.hpp"
 #include "logical_query_plan/projection_node.hpp"
 #include "optimizer/join_ordering/dp_ccp.hpp"
-#include "optimizer/join_ordering/greedy_operator_ordering.hpp"
+#include "optimizer/join_ordering/iterative_dp_ccp.hpp"
 #include "optimizer/join_ordering/join_graph.hpp"
 #include "statistics/abstract_cardinality_estimator.hpp"
 #include "statistics/cardinality_estimation_cache.hpp"
@@ -70,7 +70,9 @@ std::shared_ptr<AbstractLQPNode> JoinOrderingRule::_perform_join_ordering_recurs
 
   /**
    * Select and call the actual Join Ordering Algorithm
-   * Simple heuristic: Use DpCcp for any query with less than X tables and GOO for everything more complex
+   * Simple heuristic: Use DpCcp for any query with less than X tables and IterativeDpCcp for everything more complex.
+   * IterativeDpCcp runs DpCcp on blocks of up to IterativeDpCcp::DEFAULT_BLOCK_SIZE vertices and thus scales to large
+   * JoinGraphs while the plans for these blocks remain optimal.
    */
   // TODO(anybody) Increase X once our costing/cardinality estimation is faster/uses internal caching
   auto result_lqp = std::shared_ptr<AbstractLQPNode>{};
@@ -81,7 +83,7 @@ std::shared_ptr<AbstractLQPNode> JoinOrderingRule::_perform_join_ordering_recurs
   } else if (join_graph->vertices.size() < 9) {
     result_lqp = DpCcp{}(*join_graph, caching_cost_estimator);  // NOLINT - doesn't like `{}()`
   } else {
-    result_lqp = GreedyOperatorOrdering{}(*join_graph, caching_cost_estimator);  // NOLINT - doesn't like `{}()`
+    result_lqp = IterativeDpCcp{}(*join_graph, caching_cost_estimator);  // NOLINT - doesn't like `{}()`
   }
 
   for (const auto& vertex : join_graph->vertices) {
@@ -7,6 +7,8 @@
 
 #include "abstract_scheduler.hpp"
 #include "hyrise.hpp"
+#include "resource_group.hpp"
+#include "task_context.hpp"
 #include "task_queue.hpp"
 #include "worker.hpp"
 
@@ -14,7 +16,8 @@
 
 namespace hyrise {
 
-AbstractTask::AbstractTask(SchedulePriority priority, bool stealable) : _priority(priority), _stealable(stealable) {}
+AbstractTask::AbstractTask(SchedulePriority priority, bool stealable)
+    : _task_context(TaskContext::current()), _priority(priority), _stealable(stealable) {}
 
 TaskID AbstractTask::id() const {
   return _id;
@@ -36,6 +39,13 @@ bool AbstractTask::is_stealable() const {
   return _stealable;
 }
 
+SchedulePriority AbstractTask::priority() const {
+  if (_task_context && _task_context->resource_group()->priority() == SchedulePriority::High) {
+    return SchedulePriority::High;
+  }
+  return _priority;
+}
+
 bool AbstractTask::is_scheduled() const {
   return _state >= TaskState::Scheduled;
 }
@@ -82,6 +92,24 @@ void AbstractTask::set_node_id(NodeID node_id) {
   _node_id = node_id;
 }
 
+NodeID AbstractTask::preferred_node_id() const {
+  return _preferred_node_id;
+}
+
+void AbstractTask::set_preferred_node_id(NodeID preferred_node_id) {
+  DebugAssert(!is_scheduled(), "Possible race: Don't set the preferred node after the Task was scheduled");
+  _preferred_node_id = preferred_node_id;
+}
+
+const std::shared_ptr<TaskContext>& AbstractTask::task_context() const {
+  return _task_context;
+}
+
+void AbstractTask::set_task_context(const std::shared_ptr<TaskContext>& task_context) {
+  DebugAssert(!is_scheduled(), "Possible race: Don't set the task context after the Task was scheduled");
+  _task_context = task_context;
+}
+
 bool AbstractTask::try_mark_as_enqueued() {
   return _try_transition_to(TaskState::Enqueued);
 }
@@ -110,7 +138,7 @@ void AbstractTask::schedule(NodeID preferred_node_id) {
     return;
   }
 
-  Hyrise::get().scheduler()->schedule(shared_from_this(), preferred_node_id, _priority);
+  Hyrise::get().scheduler()->schedule(shared_from_this(), preferred_node_id, priority());
 }
 
 void AbstractTask::_join() {
@@ -137,7 +165,11 @@ void AbstractTask::execute() {
   // _is_scheduled and this assert (potentially in "thread" B) reads it, it is guaranteed that no writes of whoever
   // spawned the task are pushed down to a point where this thread is already running.
 
-  _on_execute();
+  {
+    // Tasks spawned during the execution (e.g., jobs of an operator) inherit this task's context.
+    const auto scoped_task_context = ScopedTaskContext{_task_context};
+    _on_execute();
+  }
 
   {
     auto success_done = _try_transition_to(TaskState::Done);
@@ -162,6 +194,10 @@ TaskState AbstractTask::state() const {
   return _state;
 }
 
+std::optional<std::chrono::steady_clock::time_point> AbstractTask::enqueue_time() const {
+  return _enqueue_time;
+}
+
 void AbstractTask::_on_predecessor_done() {
   Assert(_pending_predecessors > 0, "The count of pending predecessors equals zero and cannot be decremented.");
   auto new_predecessor_count = --_pending_predecessors;  // atomically decrement
@@ -219,6 +255,11 @@ bool AbstractTask::_try_transition_to(TaskState new_state) {
         return false;
       }
       Assert(TaskState::Scheduled, "Illegal state transition to TaskState::Enqueued");
+      // Written while holding the mutex, so that it is visible to the worker that is assigned to the task.
+      _enqueue_time = std::chrono::steady_clock::now();
+      if (_task_context) {
+        _task_context->resource_group()->register_pending_task();
+      }
       break;
     case TaskState::AssignedToWorker:
       if (_state >= TaskState::AssignedToWorker) {
@@ -226,6 +267,9 @@ bool AbstractTask::_try_transition_to(TaskState new_state) {
       }
       Assert(_state == TaskState::Scheduled || _state == TaskState::Enqueued,
              "Illegal state transition to TaskState::AssignedToWorker");
+      if (_state == TaskState::Enqueued && _task_context) {
+        _task_context->resource_group()->unregister_pending_task();
+      }
       break;
     case TaskState::Started:
       Assert(_state == TaskState::Scheduled || _state == TaskState::AssignedToWorker,
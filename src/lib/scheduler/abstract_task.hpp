@@ -1,10 +1,12 @@
 #pragma once
 
 #include <atomic>
+#include <chrono>
 #include <condition_variable>
 #include <functional>
 #include <memory>
 #include <mutex>
+#include <optional>
 #include <string>
 #include <vector>
 
@@ -12,6 +14,7 @@
 
 namespace hyrise {
 
+class TaskContext;
 class Worker;
 
 /**
@@ -107,6 +110,12 @@ class AbstractTask : public std::enable_shared_from_this<AbstractTask> {
    */
   bool is_stealable() const;
 
+  /**
+   * The priority with which the task is scheduled. Tasks of a resource group with high priority are always scheduled
+   * with SchedulePriority::High.
+   */
+  SchedulePriority priority() const;
+
   /**
    * Description for debugging purposes
    */
@@ -139,6 +148,22 @@ class AbstractTask : public std::enable_shared_from_this<AbstractTask> {
    */
   void set_node_id(NodeID node_id);
 
+  /**
+   * The node on which the task would like to be executed, e.g., because it processes a chunk that has been placed on
+   * that NUMA node. Unless a node is explicitly passed to schedule(), the NodeQueueScheduler pushes the task to the
+   * queue of this node. INVALID_NODE_ID (the default) means that the task has no affinity.
+   */
+  NodeID preferred_node_id() const;
+  void set_preferred_node_id(NodeID preferred_node_id);
+
+  /**
+   * The query (and its resource group) that this task belongs to. Initialized with the context that is active on the
+   * creating thread (see TaskContext), nullptr for tasks that are not executed on behalf of a query. Tasks without a
+   * context are not subject to admission control.
+   */
+  const std::shared_ptr<TaskContext>& task_context() const;
+  void set_task_context(const std::shared_ptr<TaskContext>& task_context);
+
   /**
    * Callback to be executed right after the Task finished.
    * Notice the execution of the callback might happen on ANY thread
@@ -175,6 +200,13 @@ class AbstractTask : public std::enable_shared_from_this<AbstractTask> {
 
   TaskState state() const;
 
+  /**
+   * Point in time at which the task was pushed into a TaskQueue or a worker-local queue. Used to measure the
+   * scheduling latency. Only set if the task has been enqueued (see try_mark_as_enqueued). Must only be read by the
+   * worker that successfully called try_mark_as_assigned_to_worker.
+   */
+  std::optional<std::chrono::steady_clock::time_point> enqueue_time() const;
+
  protected:
   virtual void _on_execute() = 0;
 
@@ -199,6 +231,8 @@ class AbstractTask : public std::enable_shared_from_this<AbstractTask> {
 
   std::atomic<TaskID> _id{INVALID_TASK_ID};
   std::atomic<NodeID> _node_id{INVALID_NODE_ID};
+  NodeID _preferred_node_id{INVALID_NODE_ID};
+  std::shared_ptr<TaskContext> _task_context;
   SchedulePriority _priority;
   std::atomic_bool _stealable;
   std::function<void()> _done_callback;
@@ -211,6 +245,7 @@ class AbstractTask : public std::enable_shared_from_this<AbstractTask> {
   // State management
   std::atomic<TaskState> _state{TaskState::Created};
   std::mutex _transition_to_mutex;
+  std::optional<std::chrono::steady_clock::time_point> _enqueue_time;
 
   // For making Tasks join()-able
   std::condition_variable _done_condition_variable;
@@ -16,6 +16,10 @@ const std::vector<std::shared_ptr<TaskQueue>>& ImmediateExecutionScheduler::queu
   return _queues;
 }
 
+const std::vector<std::shared_ptr<Worker>>& ImmediateExecutionScheduler::workers() const {
+  return _workers;
+}
+
 void ImmediateExecutionScheduler::schedule(std::shared_ptr<AbstractTask> task, NodeID preferred_node_id,
                                            SchedulePriority priority) {
   DebugAssert(task->is_scheduled(), "Don't call ImmediateExecutionScheduler::schedule(), call schedule() on the task");
@@ -2,6 +2,7 @@
 #include <cstdlib>
 #include <iostream>
 #include <memory>
+#include <unordered_map>
 #include <utility>
 #include <vector>
 
@@ -76,6 +77,10 @@ void NodeQueueScheduler::finish() {
     for (auto& queue : _queues) {
       Assert(queue->empty(), "NodeQueueScheduler bug: Queue wasn't empty even though all tasks finished");
     }
+    for (const auto& worker : _workers) {
+      Assert(worker->local_queue_empty(),
+             "NodeQueueScheduler bug: Local queue wasn't empty even though all tasks finished");
+    }
   }
 
   _active = false;
@@ -97,6 +102,10 @@ const std::vector<std::shared_ptr<TaskQueue>>& NodeQueueScheduler::queues() cons
   return _queues;
 }
 
+const std::vector<std::shared_ptr<Worker>>& NodeQueueScheduler::workers() const {
+  return _workers;
+}
+
 void NodeQueueScheduler::schedule(std::shared_ptr<AbstractTask> task, NodeID preferred_node_id,
                                   SchedulePriority priority) {
   /**
@@ -112,10 +121,24 @@ void NodeQueueScheduler::schedule(std::shared_ptr<AbstractTask> task, NodeID pre
     return;
   }
 
+  // Tasks that process NUMA-placed data (e.g., per-chunk jobs of the TableScan) carry the node of that data. If the
+  // topology changed after the data was placed, the node might not exist anymore. In that case, we ignore the affinity.
+  const auto task_preferred_node_id = task->preferred_node_id();
+  if (preferred_node_id == CURRENT_NODE_ID && task_preferred_node_id != INVALID_NODE_ID &&
+      static_cast<size_t>(task_preferred_node_id) < _queues.size()) {
+    preferred_node_id = task_preferred_node_id;
+  }
+
   // Lookup node id for current worker.
   if (preferred_node_id == CURRENT_NODE_ID) {
     auto worker = Worker::get_this_thread_worker();
     if (worker) {
+      // Tasks spawned by a running task are kept in the worker's local queue, where they can be stolen by idle workers.
+      // High-priority tasks go to the node's queue, which is always checked before the local queues of other workers.
+      if (priority == SchedulePriority::Default) {
+        worker->push_local(task);
+        return;
+      }
       preferred_node_id = worker->queue()->node_id();
     } else {
       // TODO(all): Actually, this should be ANY_NODE_ID, LIGHT_LOAD_NODE or something
@@ -131,38 +154,38 @@ void NodeQueueScheduler::schedule(std::shared_ptr<AbstractTask> task, NodeID pre
 }
 
 void NodeQueueScheduler::_group_tasks(const std::vector<std::shared_ptr<AbstractTask>>& tasks) const {
-  // Adds predecessor/successor relationships between tasks so that only NUM_GROUPS tasks can be executed in parallel.
-  // The optimal value of NUM_GROUPS depends on the number of cores and the number of queries being executed
+  // Adds predecessor/successor relationships between tasks so that only NUM_GROUPS tasks per node can be executed in
+  // parallel. The optimal value of NUM_GROUPS depends on the number of cores and the number of queries being executed
   // concurrently. The current value has been found with a divining rod.
   //
   // Approach: Skip all tasks that already have predecessors or successors, as adding relationships to these could
   // introduce cyclic dependencies. Again, this is far from perfect, but better than not grouping the tasks.
-
-  auto round_robin_counter = 0;
-  auto common_node_id = std::optional<NodeID>{};
-
-  std::vector<std::shared_ptr<AbstractTask>> grouped_tasks(NUM_GROUPS);
+  //
+  // Successors are usually executed by the worker that finished their predecessor (see Worker::execute_next). Thus,
+  // chaining tasks with different preferred nodes would drag the later tasks of a chain away from their data. We
+  // therefore only chain tasks that prefer the same node. Tasks without an affinity form a group of their own.
   for (const auto& task : tasks) {
     if (!task->predecessors().empty() || !task->successors().empty()) {
       return;
     }
+  }
 
-    if (common_node_id) {
-      // This is not really a hard assertion. As the chain will likely be executed on the same Worker (see
-      // Worker::execute_next), we would ignore all but the first node_id. At the time of writing, we did not do any
-      // smart node assignment. This assertion is only here so that this behavior is understood if we ever assign NUMA
-      // node ids.
-      DebugAssert(task->node_id() == *common_node_id, "Expected all grouped tasks to have the same node_id");
-    } else {
-      common_node_id = task->node_id();
+  auto round_robin_counters = std::unordered_map<NodeID, size_t>{};
+  auto grouped_tasks = std::unordered_map<NodeID, std::vector<std::shared_ptr<AbstractTask>>>{};
+  for (const auto& task : tasks) {
+    const auto node_id = task->preferred_node_id();
+    auto& round_robin_counter = round_robin_counters[node_id];
+    auto& node_groups = grouped_tasks[node_id];
+    if (node_groups.empty()) {
+      node_groups.resize(NUM_GROUPS);
     }
 
     const auto group_id = round_robin_counter % NUM_GROUPS;
-    const auto& first_task_in_group = grouped_tasks[group_id];
+    const auto& first_task_in_group = node_groups[group_id];
     if (first_task_in_group) {
       task->set_as_predecessor_of(first_task_in_group);
     }
-    grouped_tasks[group_id] = task;
+    node_groups[group_id] = task;
     ++round_robin_counter;
   }
 }
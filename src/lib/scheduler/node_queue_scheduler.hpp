@@ -56,20 +56,45 @@ namespace hyrise {
  *
  * WORK STEALING
  *
- * Currently, a simple work stealing is implemented. Work stealing is useful to avoid idle workers (and therefore
- * idle CPUs) while there are still tasks in the system that need to be processed. A worker gets idle if it can not
- * pull a ready task. This occurs in two cases:
- *  1) all tasks in the queue are not ready
- *  2) the queue is empty
- * In both cases, the current worker is checking another queue for a ready task. Checking another queue means accessing
- * another node (remote node). As of the physical distance of nodes, accessing a remote node is ~1.6 times slower than
- * accessing a local node. [1]
- * Therefore, the current worker fetches a task from a remote queue (without removing it). Then, the current worker
- * is sleeping some milliseconds to give any local worker of the remote node the chance to pull that task. If no local
- * worker of the remote node pulled the task, the current worker is pulling the task and therefore steals it.
- * Afterwards, the current worker is checking its local queue gain.
+ * Besides the TaskQueue of its node, each worker owns a local queue. Tasks without a node preference that are scheduled
+ * by a running task (e.g., the jobs of an operator) are pushed to the local queue of the scheduling worker. The worker
+ * pops from its local queue in LIFO order, which keeps recently produced (and thus cache-hot) work on the same core.
+ *
+ * A worker gets idle if it can neither pop a task from its local queue nor pull a ready task from its node's queue.
+ * It then tries to steal, in this order:
+ *  1) from the local queues of the other workers of the same node (in FIFO order, i.e., the oldest tasks),
+ *  2) from the queues of other nodes,
+ *  3) from the local queues of workers of other nodes.
+ * Nodes are visited in the order of their NUMA distance (see Topology::node_distance), so that stolen tasks are
+ * preferably executed close to their data. Accessing a remote node is ~1.6 times slower than accessing a local
+ * node. [1] Tasks that are not stealable are only taken by workers of the same node.
+ *
+ * If nothing could be stolen, the worker backs off adaptively: it first spins (yielding the CPU) for a number of
+ * rounds, which keeps the latency for short bursts of tasks low. Afterwards, it parks on its node's TaskQueue with an
+ * exponentially growing timeout. Pushing a task to a queue (or a local queue of that node) wakes up a parked worker.
+ * Each worker records the time between enqueueing and starting its tasks in a histogram, which is exposed by the
+ * meta table "scheduling_latency".
  *
  * [1] http://frankdenneman.nl/2016/07/13/numa-deep-dive-4-local-memory-optimization/
+ *
+ *
+ * ADMISSION CONTROL AND PRIORITIES
+ *
+ * Tasks carry the TaskContext of the query they belong to, which references the query's ResourceGroup. Before a worker
+ * starts a task, it asks the group for admission. If the group has reached its concurrency limit or its weighted share
+ * of the workers while other groups are waiting, the task is deferred to the end of the node's queue. As workers
+ * decide at every task boundary, a query that floods the queues with per-chunk jobs cannot starve queries that arrive
+ * later. Tasks of high-priority groups are scheduled with SchedulePriority::High and are picked up by workers before
+ * any other task, including tasks in their local queues.
+ *
+ *
+ * DATA AFFINITY
+ *
+ * The StorageManager distributes the chunks of stored tables across the nodes (see place_chunks_on_numa_nodes).
+ * Operators that spawn per-chunk jobs (e.g., TableScan, Projection, Validate, and the materialization of JoinHash)
+ * set the chunk's node as the job's preferred node (AbstractTask::set_preferred_node_id). The scheduler then pushes
+ * the job to the queue of that node. Output chunks inherit the node of their input chunk, so that the affinity is
+ * kept throughout a pipeline.
  */
 
 class Worker;
@@ -96,10 +121,15 @@ class NodeQueueScheduler : public AbstractScheduler {
 
   const std::vector<std::shared_ptr<TaskQueue>>& queues() const override;
 
+  const std::vector<std::shared_ptr<Worker>>& workers() const override;
+
   /**
    * @param task
    * @param preferred_node_id The Task will be initially added to this node, but might get stolen by other Nodes later
    * @param priority Determines whether tasks are inserted at the beginning or end of the queue.
+   *
+   * Tasks without any node preference that are scheduled from within a worker are pushed to that worker's local
+   * queue (see WORK STEALING).
    */
   void schedule(std::shared_ptr<AbstractTask> task, NodeID preferred_node_id = CURRENT_NODE_ID,
                 SchedulePriority priority = SchedulePriority::Default) override;
@@ -6,6 +6,7 @@
 
 #include "operators/abstract_operator.hpp"
 #include "operators/abstract_read_write_operator.hpp"
+#include "operators/get_table.hpp"
 
 #include "scheduler/job_task.hpp"
 
@@ -38,6 +39,16 @@ std::shared_ptr<OperatorTask> add_operator_tasks_recursively(const std::shared_p
     }
   }
 
+  // A GetTable that prunes chunks using the join keys of another operator has to wait for that operator.
+  if (op->type() == OperatorType::GetTable) {
+    const auto& dynamic_pruning_input = static_cast<const GetTable&>(*op).dynamic_pruning_input();
+    if (dynamic_pruning_input) {
+      if (auto build_subtree_root = add_operator_tasks_recursively(dynamic_pruning_input->build_input, tasks)) {
+        build_subtree_root->set_as_predecessor_of(task);
+      }
+    }
+  }
+
   return task;
 }
 
@@ -0,0 +1,90 @@
+#include "resource_group.hpp"
+
+#include <algorithm>
+#include <limits>
+
+#include "utils/assert.hpp"
+
+namespace hyrise {
+
+std::atomic_uint64_t ResourceGroup::_competing_weight{0};
+
+ResourceGroup::ResourceGroup(const std::string& name, const uint32_t weight, const uint32_t max_concurrent_tasks,
+                             const SchedulePriority priority)
+    : _name(name), _weight(weight), _max_concurrent_tasks(max_concurrent_tasks), _priority(priority) {
+  Assert(_weight > 0, "Weight of a resource group must be positive.");
+}
+
+const std::string& ResourceGroup::name() const {
+  return _name;
+}
+
+uint32_t ResourceGroup::weight() const {
+  return _weight;
+}
+
+uint32_t ResourceGroup::max_concurrent_tasks() const {
+  return _max_concurrent_tasks;
+}
+
+SchedulePriority ResourceGroup::priority() const {
+  return _priority;
+}
+
+uint32_t ResourceGroup::running_task_count() const {
+  return _running_task_count;
+}
+
+uint32_t ResourceGroup::pending_task_count() const {
+  return _pending_task_count;
+}
+
+bool ResourceGroup::try_admit(const size_t worker_count) {
+  auto limit = _max_concurrent_tasks > 0 ? _max_concurrent_tasks : std::numeric_limits<uint32_t>::max();
+
+  // The fair share is only enforced while other groups have pending tasks. Every group may run at least one task so
+  // that no group starves if there are more competing groups than workers.
+  const auto competing_weight = _competing_weight.load();
+  if (competing_weight > _weight) {
+    const auto share = std::max(uint64_t{1}, worker_count * _weight / competing_weight);
+    limit = std::min(limit, static_cast<uint32_t>(std::min(share, uint64_t{std::numeric_limits<uint32_t>::max()})));
+  }
+
+  auto running_task_count = _running_task_count.load();
+  do {
+    if (running_task_count >= limit) {
+      return false;
+    }
+  } while (!_running_task_count.compare_exchange_weak(running_task_count, running_task_count + 1));
+
+  return true;
+}
+
+void ResourceGroup::force_admit() {
+  ++_running_task_count;
+}
+
+void ResourceGroup::release() {
+  const auto previous_running_task_count = _running_task_count--;
+  DebugAssert(previous_running_task_count > 0, "Released more tasks than were admitted.");
+}
+
+void ResourceGroup::register_pending_task() {
+  if (_pending_task_count++ == 0) {
+    _competing_weight += _weight;
+  }
+}
+
+void ResourceGroup::unregister_pending_task() {
+  const auto previous_pending_task_count = _pending_task_count--;
+  DebugAssert(previous_pending_task_count > 0, "Unregistered more tasks than were registered.");
+  if (previous_pending_task_count == 1) {
+    _competing_weight -= _weight;
+  }
+}
+
+uint64_t ResourceGroup::competing_weight() {
+  return _competing_weight;
+}
+
+}  // namespace hyrise
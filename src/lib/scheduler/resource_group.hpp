@@ -0,0 +1,78 @@
+#pragma once
+
+#include <atomic>
+#include <string>
+
+#include "types.hpp"
+
+namespace hyrise {
+
+/**
+ * Resource groups control how the workers of the NodeQueueScheduler are shared between concurrently running queries.
+ * Every task that belongs to a query is associated with the query's resource group via its TaskContext.
+ *
+ *  - Weight: While tasks of multiple groups are waiting in the queues, a group may only occupy a share of the workers
+ *    that is proportional to its weight. Once a group exceeds its share, workers defer its tasks at the next task
+ *    boundary and pick up tasks of other groups instead. If no other group is waiting, a group may use all workers.
+ *    Tasks that wait for other tasks (e.g., an OperatorTask waiting for its jobs) do not count against the share.
+ *  - Concurrency limit: The maximum number of tasks of the group that are executed at the same time, regardless of
+ *    other groups. 0 means unlimited.
+ *  - Priority: Tasks of groups with SchedulePriority::High are scheduled as high-priority tasks. Workers check for
+ *    high-priority tasks before they continue with any other work, so that short queries preempt long-running ones at
+ *    task boundaries.
+ *
+ * By default, the SQLPipeline creates a separate group of weight 1 for each statement, so that concurrent queries
+ * share the workers equally. Groups can also be shared by multiple queries (see SQLPipelineBuilder).
+ */
+class ResourceGroup : private Noncopyable {
+ public:
+  explicit ResourceGroup(const std::string& name, const uint32_t weight = 1, const uint32_t max_concurrent_tasks = 0,
+                         const SchedulePriority priority = SchedulePriority::Default);
+
+  const std::string& name() const;
+  uint32_t weight() const;
+  uint32_t max_concurrent_tasks() const;
+  SchedulePriority priority() const;
+
+  uint32_t running_task_count() const;
+  uint32_t pending_task_count() const;
+
+  /**
+   * Called by a worker before it starts a task of this group. Returns false if the group has reached its concurrency
+   * limit or its share of the @param worker_count workers. Otherwise, the task is counted as running until release()
+   * is called.
+   */
+  bool try_admit(const size_t worker_count);
+  void release();
+
+  /**
+   * Counts a task as running regardless of the limits. Used for tasks that a worker executes while it waits for them
+   * and for tasks that resume after waiting. Must be paired with release().
+   */
+  void force_admit();
+
+  /**
+   * Called by AbstractTask when a task of this group is pushed to or taken from a queue. Groups with pending tasks
+   * compete for workers.
+   * @{
+   */
+  void register_pending_task();
+  void unregister_pending_task();
+  /** @} */
+
+  // Sum of the weights of all groups that currently have pending tasks.
+  static uint64_t competing_weight();
+
+ private:
+  const std::string _name;
+  const uint32_t _weight;
+  const uint32_t _max_concurrent_tasks;
+  const SchedulePriority _priority;
+
+  std::atomic_uint32_t _running_task_count{0};
+  std::atomic_uint32_t _pending_task_count{0};
+
+  static std::atomic_uint64_t _competing_weight;
+};
+
+}  // namespace hyrise
@@ -0,0 +1,49 @@
+#include "task_context.hpp"
+
+#include <atomic>
+#include <utility>
+
+#include "resource_group.hpp"
+#include "utils/assert.hpp"
+
+namespace {
+
+std::atomic_uint64_t next_query_id{0};
+
+// The context of the task or query that the current thread works on.
+thread_local std::shared_ptr<hyrise::TaskContext> this_thread_task_context;  // NOLINT (clang-tidy wants this const)
+
+}  // namespace
+
+namespace hyrise {
+
+TaskContext::TaskContext(const std::shared_ptr<ResourceGroup>& resource_group,
+                         const std::optional<uint64_t>& session_id)
+    : _query_id(next_query_id++), _session_id(session_id), _resource_group(resource_group) {
+  Assert(_resource_group, "TaskContext requires a resource group.");
+}
+
+uint64_t TaskContext::query_id() const {
+  return _query_id;
+}
+
+const std::optional<uint64_t>& TaskContext::session_id() const {
+  return _session_id;
+}
+
+const std::shared_ptr<ResourceGroup>& TaskContext::resource_group() const {
+  return _resource_group;
+}
+
+const std::shared_ptr<TaskContext>& TaskContext::current() {
+  return this_thread_task_context;
+}
+
+ScopedTaskContext::ScopedTaskContext(const std::shared_ptr<TaskContext>& task_context)
+    : _previous_task_context(std::exchange(this_thread_task_context, task_context)) {}
+
+ScopedTaskContext::~ScopedTaskContext() {
+  this_thread_task_context = std::move(_previous_task_context);
+}
+
+}  // namespace hyrise
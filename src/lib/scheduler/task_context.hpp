@@ -0,0 +1,55 @@
+#pragma once
+
+#include <memory>
+#include <optional>
+
+#include "types.hpp"
+
+namespace hyrise {
+
+class ResourceGroup;
+
+/**
+ * Identifies the query (and, if the query was issued by a server session, the session) that a task is executed for,
+ * as well as the resource group of the query (see ResourceGroup).
+ *
+ * Tasks inherit the context that is active on the thread that creates them. While a task is executed, its context is
+ * active. Thus, all jobs that an operator spawns (e.g., the per-chunk jobs of the TableScan) are attributed to the same
+ * query without passing the context around explicitly. The SQLPipelineStatement activates its context with a
+ * ScopedTaskContext while it creates the OperatorTasks.
+ */
+class TaskContext {
+ public:
+  explicit TaskContext(const std::shared_ptr<ResourceGroup>& resource_group,
+                       const std::optional<uint64_t>& session_id = std::nullopt);
+
+  // Unique id of the query, assigned on construction.
+  uint64_t query_id() const;
+
+  const std::optional<uint64_t>& session_id() const;
+
+  const std::shared_ptr<ResourceGroup>& resource_group() const;
+
+  // Returns the context that is active on the current thread, nullptr if there is none.
+  static const std::shared_ptr<TaskContext>& current();
+
+ private:
+  const uint64_t _query_id;
+  const std::optional<uint64_t> _session_id;
+  const std::shared_ptr<ResourceGroup> _resource_group;
+};
+
+/**
+ * Activates the given context on the current thread for the lifetime of this object and restores the previously
+ * active context afterwards.
+ */
+class ScopedTaskContext : private Noncopyable {
+ public:
+  explicit ScopedTaskContext(const std::shared_ptr<TaskContext>& task_context);
+  ~ScopedTaskContext();
+
+ private:
+  std::shared_ptr<TaskContext> _previous_task_context;
+};
+
+}  // namespace hyrise
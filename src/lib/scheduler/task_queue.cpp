@@ -34,13 +34,20 @@ void TaskQueue::push(const std::shared_ptr<AbstractTask>& task, uint32_t priorit
   task->set_node_id(_node_id);
   _queues[priority].push(task);
 
-  new_task.notify_one();
+  notify_idle_worker();
 }
 
-std::shared_ptr<AbstractTask> TaskQueue::pull() {
+void TaskQueue::requeue(const std::shared_ptr<AbstractTask>& task) {
+  DebugAssert(task->state() == TaskState::Enqueued, "Only enqueued tasks can be requeued");
+
+  task->set_node_id(_node_id);
+  _queues[static_cast<uint32_t>(task->priority())].push(task);
+}
+
+std::shared_ptr<AbstractTask> TaskQueue::pull(const SchedulePriority lowest_priority) {
   std::shared_ptr<AbstractTask> task;
-  for (auto& queue : _queues) {
-    if (queue.try_pop(task)) {
+  for (auto priority = uint32_t{0}; priority <= static_cast<uint32_t>(lowest_priority); ++priority) {
+    if (_queues[priority].try_pop(task)) {
       return task;
     }
   }
@@ -61,4 +68,32 @@ std::shared_ptr<AbstractTask> TaskQueue::steal() {
   return nullptr;
 }
 
+void TaskQueue::wait_for_task(const std::chrono::microseconds timeout) {
+  auto lock = std::unique_lock<std::mutex>{_mutex};
+  ++_num_idle_workers;
+
+  // Pairs with the fence in notify_idle_worker: Either the pushing thread sees the incremented counter and notifies us,
+  // or we see the pushed task and do not wait at all.
+  std::atomic_thread_fence(std::memory_order_seq_cst);
+  if (empty()) {
+    _new_task.wait_for(lock, timeout);
+  }
+
+  --_num_idle_workers;
+}
+
+void TaskQueue::notify_idle_worker() {
+  std::atomic_thread_fence(std::memory_order_seq_cst);
+  if (_num_idle_workers == 0) {
+    return;
+  }
+
+  // Taking the mutex ensures that a worker that is about to park (i.e., it holds the mutex and has found the queue
+  // empty) has started waiting before we notify it.
+  {
+    const auto lock = std::lock_guard<std::mutex>{_mutex};
+  }
+  _new_task.notify_one();
+}
+
 }  // namespace hyrise
@@ -4,8 +4,10 @@
 #include <tbb/concurrent_queue.h>
 #include <array>
 #include <atomic>
+#include <chrono>
 #include <condition_variable>
 #include <memory>
+#include <mutex>
 
 #include "types.hpp"
 
@@ -29,9 +31,16 @@ class TaskQueue {
   void push(const std::shared_ptr<AbstractTask>& task, uint32_t priority);
 
   /**
-   * Returns a Tasks that is ready to be executed and removes it from the queue
+   * Pushes a task that has already been enqueued before back to the end of the queue. Used by workers to defer tasks
+   * whose resource group exceeds its share of workers.
    */
-  std::shared_ptr<AbstractTask> pull();
+  void requeue(const std::shared_ptr<AbstractTask>& task);
+
+  /**
+   * Returns a Tasks that is ready to be executed and removes it from the queue. Only tasks with at least the priority
+   * @param lowest_priority are considered.
+   */
+  std::shared_ptr<AbstractTask> pull(const SchedulePriority lowest_priority = SchedulePriority::Default);
 
   /**
    * Returns a Tasks that is ready to be executed and removes it from one of the stealable queues
@@ -39,18 +48,26 @@ class TaskQueue {
   std::shared_ptr<AbstractTask> steal();
 
   /**
-   * Notifies one worker as soon as a new task gets pushed into the queue
+   * Parks the calling worker until a task is pushed to this queue, another worker signals new work via
+   * notify_idle_worker(), or the timeout expires.
    */
-  std::condition_variable new_task;
+  void wait_for_task(const std::chrono::microseconds timeout);
 
   /**
-   * Mutex accessed by workers in order to notify them using condition variable
+   * Wakes up one parked worker of this node, if there is any. Pushing a task to the queue does so implicitly. Workers
+   * call this when they make tasks available that other workers can steal.
    */
-  std::mutex lock;
+  void notify_idle_worker();
 
  private:
   NodeID _node_id;
   std::array<tbb::concurrent_queue<std::shared_ptr<AbstractTask>>, NUM_PRIORITY_LEVELS> _queues;
+
+  // Idle workers are parked on the condition variable. Only if at least one worker is parked, pushing a task needs to
+  // take the mutex and notify a single worker. Busy systems thus do not pay for wakeups.
+  std::atomic_uint32_t _num_idle_workers{0};
+  std::condition_variable _new_task;
+  std::mutex _mutex;
 };
 
 }  // namespace hyrise
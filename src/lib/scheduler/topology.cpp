@@ -178,6 +178,32 @@ size_t Topology::num_cpus() const {
   return _num_cpus;
 }
 
+uint32_t Topology::node_distance(NodeID node_a, NodeID node_b) const {
+  // Values as used by the SLIT, see numa(3).
+  constexpr auto LOCAL_DISTANCE = uint32_t{10};
+  constexpr auto REMOTE_DISTANCE = uint32_t{20};
+
+  if (node_a == node_b) {
+    return LOCAL_DISTANCE;
+  }
+
+#if HYRISE_NUMA_SUPPORT
+  if (!_fake_numa_topology && numa_available() >= 0) {
+    const auto distance = numa_distance(static_cast<int>(node_a), static_cast<int>(node_b));
+    // numa_distance returns 0 if the distance cannot be determined.
+    if (distance > 0) {
+      return static_cast<uint32_t>(distance);
+    }
+  }
+#endif
+
+  return REMOTE_DISTANCE;
+}
+
+bool Topology::is_fake_numa_topology() const {
+  return _fake_numa_topology;
+}
+
 void Topology::_clear() {
   _nodes.clear();
   _num_cpus = 0;
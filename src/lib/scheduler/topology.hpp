@@ -73,6 +73,14 @@ class Topology final : public Noncopyable {
 
   size_t num_cpus() const;
 
+  /**
+   * Relative distance between two nodes as reported by the ACPI SLIT (10 for local accesses, larger values for remote
+   * nodes). For fake-NUMA and non-NUMA topologies, all remote nodes are considered equally far away.
+   */
+  uint32_t node_distance(NodeID node_a, NodeID node_b) const;
+
+  bool is_fake_numa_topology() const;
+
  private:
   Topology();
 
@@ -4,17 +4,21 @@
 #include <sched.h>
 #include <unistd.h>
 
+#include <algorithm>
 #include <chrono>
 #include <iostream>
 #include <memory>
 #include <mutex>
 #include <random>
 #include <thread>
+#include <utility>
 #include <vector>
 
 #include "abstract_scheduler.hpp"
 #include "abstract_task.hpp"
 #include "hyrise.hpp"
+#include "resource_group.hpp"
+#include "task_context.hpp"
 #include "task_queue.hpp"
 
 namespace {
@@ -26,8 +30,17 @@ namespace {
 thread_local std::weak_ptr<hyrise::Worker> this_thread_worker;  // NOLINT (clang-tidy wants this const)
 }  // namespace
 
-// The sleep time was determined experimentally
-static constexpr auto WORKER_SLEEP_TIME = std::chrono::microseconds(300);
+// Parameters of the idle backoff, see Worker::_back_off. After SPIN_ROUND_COUNT unsuccessful rounds, the worker parks
+// for MIN_PARK_TIME, doubling the time with every unsuccessful round up to MAX_PARK_TIME. Parked workers are woken up
+// when tasks are pushed to their node. The timeout only matters for tasks that could be stolen from other nodes. The
+// previous fixed sleep time of 300 µs, which was determined experimentally, lies within this range.
+constexpr auto SPIN_ROUND_COUNT = uint32_t{64};
+constexpr auto MIN_PARK_TIME = std::chrono::microseconds{50};
+constexpr auto MAX_PARK_TIME = std::chrono::microseconds{1600};
+
+// Maximum number of tasks that a worker sets aside in one round because their resource groups were denied admission.
+// Bounds the work spent on a queue that holds many tasks of groups that are at their limit.
+constexpr auto MAX_DEFERRED_TASK_COUNT = size_t{16};
 
 namespace hyrise {
 
@@ -61,62 +74,229 @@ void Worker::operator()() {
   this_thread_worker = shared_from_this();
 
   _set_affinity();
+  _initialize_steal_order();
 
   while (Hyrise::get().scheduler()->active()) {
     _work();
   }
 }
 
-void Worker::_work() {
-  // If execute_next has been called, run that task first, otherwise try to retrieve a task from the queue.
+void Worker::_work(const bool waiting_for_own_tasks) {
+  // Admission control: If a task's resource group has reached its concurrency limit or its share of the workers, the
+  // task is set aside and the worker looks for another task. As the set-aside tasks are not in the queues anymore, the
+  // worker moves on to other priorities and groups instead of pulling the same task again. Once the worker found a task
+  // to run (or did not find any), the set-aside tasks are put back to the end of the node's queue.
+  auto deferred_tasks = std::vector<std::shared_ptr<AbstractTask>>{};
+  auto denied_resource_groups = std::vector<std::shared_ptr<ResourceGroup>>{};
   auto task = std::shared_ptr<AbstractTask>{};
-  if (_next_task) {
-    task = std::move(_next_task);
-    _next_task = nullptr;
-  } else {
-    task = _queue->pull();
-  }
+  auto resource_group = std::shared_ptr<ResourceGroup>{};
+  while (deferred_tasks.size() < MAX_DEFERRED_TASK_COUNT) {
+    task = _pull_task();
+    if (!task) {
+      break;
+    }
 
-  if (!task) {
-    // Simple work stealing without explicitly transferring data between nodes.
-    auto work_stealing_successful = false;
-    for (const auto& queue : Hyrise::get().scheduler()->queues()) {
-      if (queue == _queue) {
-        continue;
-      }
+    const auto& task_context = task->task_context();
+    resource_group = task_context ? task_context->resource_group() : nullptr;
+    if (!resource_group) {
+      break;
+    }
 
-      task = queue->steal();
-      if (task) {
-        task->set_node_id(_queue->node_id());
-        work_stealing_successful = true;
-        break;
-      }
+    // Other tasks of a group that was denied in this round are skipped without asking the group again.
+    const auto denied = std::find(denied_resource_groups.cbegin(), denied_resource_groups.cend(), resource_group) !=
+                        denied_resource_groups.cend();
+    if (!denied && resource_group->try_admit(_worker_count)) {
+      break;
     }
 
-    // If there is no ready task neither in our queue nor in any other, worker waits for a new task to be pushed to the
-    // own queue or returns after timer exceeded (whatever occurs first).
-    if (!work_stealing_successful) {
-      {
-        std::unique_lock<std::mutex> unique_lock(_queue->lock);
-        _queue->new_task.wait_for(unique_lock, WORKER_SLEEP_TIME);
-      }
-      return;
+    if (!denied) {
+      denied_resource_groups.emplace_back(resource_group);
     }
+    deferred_tasks.emplace_back(std::move(task));
+    task = nullptr;
   }
 
+  for (const auto& deferred_task : deferred_tasks) {
+    _queue->requeue(deferred_task);
+  }
+
+  if (!task) {
+    _back_off(waiting_for_own_tasks);
+    return;
+  }
+
+  _idle_round_count = 0;
+
   const auto successfully_assigned = task->try_mark_as_assigned_to_worker();
   if (!successfully_assigned) {
     // Some other worker has already started to work on this task - pick a different one.
+    if (resource_group) {
+      resource_group->release();
+    }
     return;
   }
 
-  task->execute();
+  _record_scheduling_latency(*task);
+  {
+    // The group of the executed task is released while the task waits for other tasks (see _wait_for_tasks). Tasks
+    // executed while waiting set their own group, so the previous one is restored afterwards.
+    const auto previous_resource_group = std::exchange(_running_resource_group, resource_group);
+    task->execute();
+    _running_resource_group = previous_resource_group;
+  }
+
+  if (resource_group) {
+    resource_group->release();
+  }
 
   // This is part of the Scheduler shutdown system. Count the number of tasks a Worker executed to allow the
   // Scheduler to determine whether all tasks finished
   _num_finished_tasks++;
 }
 
+std::shared_ptr<AbstractTask> Worker::_pull_task() {
+  // High-priority tasks (e.g., of short queries) are started at the next task boundary. Then, if execute_next has been
+  // called, run that task. Otherwise, try to retrieve a task from the local queue, then from the node's queue, and
+  // finally from other workers and nodes.
+  auto task = _queue->pull(SchedulePriority::High);
+  if (!task && _next_task) {
+    task = std::move(_next_task);
+    _next_task = nullptr;
+  }
+
+  if (!task) {
+    task = _pop_local();
+  }
+
+  if (!task) {
+    task = _queue->pull();
+  }
+
+  if (!task) {
+    task = _steal();
+  }
+
+  return task;
+}
+
+std::shared_ptr<AbstractTask> Worker::_pop_local() {
+  const auto lock = std::lock_guard<std::mutex>{_local_tasks_mutex};
+  if (_local_tasks.empty()) {
+    return nullptr;
+  }
+
+  auto task = std::move(_local_tasks.back());
+  _local_tasks.pop_back();
+  return task;
+}
+
+std::shared_ptr<AbstractTask> Worker::_steal() {
+  // Work stealing without explicitly transferring data between nodes. Workers and queues of close nodes are visited
+  // first, so that tasks are preferably executed on the same or a neighboring node.
+  for (const auto& weak_worker : _steal_order_workers) {
+    const auto worker = weak_worker.lock();
+    if (!worker) {
+      continue;
+    }
+
+    // Tasks that are not stealable must stay on their node, but may be executed by any worker of that node.
+    const auto same_node = worker->queue() == _queue;
+    auto task = worker->steal_local(!same_node);
+    if (task) {
+      task->set_node_id(_queue->node_id());
+      return task;
+    }
+  }
+
+  for (const auto& queue : _steal_order) {
+    auto task = queue->steal();
+    if (task) {
+      task->set_node_id(_queue->node_id());
+      return task;
+    }
+  }
+
+  return nullptr;
+}
+
+void Worker::_back_off(const bool waiting_for_own_tasks) {
+  ++_idle_round_count;
+  if (_idle_round_count <= SPIN_ROUND_COUNT) {
+    std::this_thread::yield();
+    return;
+  }
+
+  auto park_time = MIN_PARK_TIME;
+  if (!waiting_for_own_tasks) {
+    const auto shift = std::min(_idle_round_count - SPIN_ROUND_COUNT - 1, uint32_t{5});
+    park_time = std::min(MIN_PARK_TIME * (uint32_t{1} << shift), MAX_PARK_TIME);
+  }
+
+  _queue->wait_for_task(park_time);
+}
+
+void Worker::_record_scheduling_latency(const AbstractTask& task) {
+  const auto enqueue_time = task.enqueue_time();
+  if (!enqueue_time) {
+    return;
+  }
+
+  const auto latency =
+      std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - *enqueue_time).count();
+  auto bucket = size_t{0};
+  while (bucket + 1 < SCHEDULING_LATENCY_BUCKET_COUNT && latency >= (int64_t{1} << bucket)) {
+    ++bucket;
+  }
+
+  // Only this worker writes to its histogram. Readers (e.g., the meta table) do not need a consistent snapshot.
+  _scheduling_latency_histogram[bucket].fetch_add(1, std::memory_order_relaxed);
+}
+
+std::array<uint64_t, Worker::SCHEDULING_LATENCY_BUCKET_COUNT> Worker::scheduling_latency_histogram() const {
+  auto histogram = std::array<uint64_t, SCHEDULING_LATENCY_BUCKET_COUNT>{};
+  for (auto bucket = size_t{0}; bucket < SCHEDULING_LATENCY_BUCKET_COUNT; ++bucket) {
+    histogram[bucket] = _scheduling_latency_histogram[bucket].load(std::memory_order_relaxed);
+  }
+  return histogram;
+}
+
+void Worker::push_local(const std::shared_ptr<AbstractTask>& task) {
+  DebugAssert(&*get_this_thread_worker() == this, "push_local must be called from the worker's own thread");
+
+  // Someone else was first to enqueue this task? No problem!
+  if (!task->try_mark_as_enqueued()) {
+    return;
+  }
+
+  task->set_node_id(_queue->node_id());
+  {
+    const auto lock = std::lock_guard<std::mutex>{_local_tasks_mutex};
+    _local_tasks.emplace_back(task);
+  }
+
+  // This worker is busy. Give a parked worker of the same node the chance to steal the task.
+  _queue->notify_idle_worker();
+}
+
+std::shared_ptr<AbstractTask> Worker::steal_local(const bool respect_stealable_flag) {
+  const auto lock = std::lock_guard<std::mutex>{_local_tasks_mutex};
+  for (auto iter = _local_tasks.begin(); iter != _local_tasks.end(); ++iter) {
+    if (respect_stealable_flag && !(*iter)->is_stealable()) {
+      continue;
+    }
+
+    auto task = std::move(*iter);
+    _local_tasks.erase(iter);
+    return task;
+  }
+  return nullptr;
+}
+
+bool Worker::local_queue_empty() const {
+  const auto lock = std::lock_guard<std::mutex>{_local_tasks_mutex};
+  return _local_tasks.empty();
+}
+
 void Worker::execute_next(const std::shared_ptr<AbstractTask>& task) {
   DebugAssert(&*get_this_thread_worker() == this,
               "execute_next must be called from the same thread that the worker works in");
@@ -134,7 +314,7 @@ void Worker::execute_next(const std::shared_ptr<AbstractTask>& task) {
     Assert(successfully_enqueued, "Task was already enqueued, expected to be solely responsible for execution");
     _next_task = task;
   } else {
-    _queue->push(task, static_cast<uint32_t>(SchedulePriority::Default));
+    push_local(task);
   }
 }
 
@@ -188,7 +368,8 @@ void Worker::_wait_for_tasks(const std::vector<std::shared_ptr<AbstractTask>>& t
       }
 
       // Run one of our own tasks. First, let everyone know that we are about to execute it. This is necessary because
-      // the task might already be in a queue and some other worker might pull it at the same time.
+      // the task might already be in a queue and some other worker might pull it at the same time. Admission control
+      // does not apply here, as this worker is already occupied by the query that waits for the task.
       const auto successfully_assigned = task->try_mark_as_assigned_to_worker();
       if (!successfully_assigned) {
         // Some other worker has already started to work on this task - pick a different one.
@@ -197,10 +378,25 @@ void Worker::_wait_for_tasks(const std::vector<std::shared_ptr<AbstractTask>>& t
         continue;
       }
 
-      // Actually execute it.
-      task->execute();
+      // Actually execute it. Although it bypasses admission control, it counts as a running task of its group.
+      const auto& task_context = task->task_context();
+      const auto resource_group = task_context ? task_context->resource_group() : nullptr;
+      if (resource_group) {
+        resource_group->force_admit();
+      }
+
+      _record_scheduling_latency(*task);
+      {
+        const auto previous_resource_group = std::exchange(_running_resource_group, resource_group);
+        task->execute();
+        _running_resource_group = previous_resource_group;
+      }
       ++_num_finished_tasks;
 
+      if (resource_group) {
+        resource_group->release();
+      }
+
       // Reset loop so that we re-visit tasks that may have finished in the meantime. We need to decrement `it` because
       // it will be incremented when the loop iteration finishes.
       all_done = true;
@@ -209,11 +405,69 @@ void Worker::_wait_for_tasks(const std::vector<std::shared_ptr<AbstractTask>>& t
     return all_done;
   };
 
+  // While waiting, the task that this worker executes (e.g., an OperatorTask waiting for its jobs) does not occupy the
+  // worker. Thus, it does not count against the share of its resource group. It is counted again once its own tasks
+  // are done, regardless of the group's limits.
+  const auto waiting_resource_group = _running_resource_group;
+  if (waiting_resource_group) {
+    waiting_resource_group->release();
+  }
+
   while (!all_own_tasks_done()) {
     // Run any job. This could be any job that is currently enqueued. Note: This job may internally call wait_for_tasks
     // again, in which case we would first wait for the inner task before the outer task has a chance to proceed.
-    _work();
+    _work(true);
+  }
+
+  if (waiting_resource_group) {
+    waiting_resource_group->force_admit();
+  }
+}
+
+void Worker::_initialize_steal_order() {
+  const auto& topology = Hyrise::get().topology;
+  const auto& queues = Hyrise::get().scheduler()->queues();
+  const auto own_node_id = _queue->node_id();
+  const auto queue_count = queues.size();
+
+  _steal_order.clear();
+  for (const auto& queue : queues) {
+    if (queue != _queue) {
+      _steal_order.emplace_back(queue);
+    }
+  }
+
+  // Ties are broken by the position relative to the own node. Otherwise, all workers would first try to steal from
+  // node 0 on machines with uniform node distances.
+  const auto relative_position = [&](const auto& queue) {
+    return (queue->node_id() + queue_count - own_node_id) % queue_count;
+  };
+  const auto closer = [&](const auto& lhs_queue, const auto& rhs_queue) {
+    const auto lhs_distance = topology.node_distance(own_node_id, lhs_queue->node_id());
+    const auto rhs_distance = topology.node_distance(own_node_id, rhs_queue->node_id());
+    if (lhs_distance != rhs_distance) {
+      return lhs_distance < rhs_distance;
+    }
+    return relative_position(lhs_queue) < relative_position(rhs_queue);
+  };
+  std::sort(_steal_order.begin(), _steal_order.end(), closer);
+
+  auto workers = std::vector<std::shared_ptr<Worker>>{};
+  for (const auto& worker : Hyrise::get().scheduler()->workers()) {
+    if (worker.get() != this) {
+      workers.emplace_back(worker);
+    }
   }
+  // The worker's own queue has the smallest distance, so workers of the same node come first.
+  std::stable_sort(workers.begin(), workers.end(),
+                   [&](const auto& lhs, const auto& rhs) { return closer(lhs->queue(), rhs->queue()); });
+
+  _steal_order_workers.clear();
+  for (const auto& worker : workers) {
+    _steal_order_workers.emplace_back(worker);
+  }
+
+  _worker_count = workers.size() + 1;
 }
 
 void Worker::_set_affinity() {
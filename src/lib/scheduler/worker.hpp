@@ -1,7 +1,10 @@
 #pragma once
 
+#include <array>
 #include <atomic>
+#include <deque>
 #include <memory>
+#include <mutex>
 #include <thread>
 #include <vector>
 
@@ -11,6 +14,7 @@
 
 namespace hyrise {
 
+class ResourceGroup;
 class TaskQueue;
 
 /**
@@ -38,18 +42,43 @@ class Worker : public std::enable_shared_from_this<Worker>, private Noncopyable
   // Try to execute task immediately after this worker finishes the execution of the current task. The goal is to
   // execute the task while the caches are still fresh instead of having to wait for it to be scheduled again. A task
   // can have multiple successors and all of them could become executable at the same time. In that case, the current
-  // worker can only execute one of them immediately. The others are placed into a high priority queue on the same node
-  // so that they are worked on as soon as possible by either this or another worker.
+  // worker can only execute one of them immediately. The others are placed into the worker-local queue so that they
+  // are worked on as soon as possible by either this or another worker.
   void execute_next(const std::shared_ptr<AbstractTask>& task);
 
+  /**
+   * Each worker owns a local queue for tasks that it spawns without a node affinity (e.g., the jobs of an operator that
+   * the worker executes). The owner pushes and pops at the back (LIFO), which keeps recently touched data in the cache.
+   * Other workers steal the oldest tasks from the front (FIFO). As the owner and thieves work on different ends and
+   * stealing is rare compared to local operations, the queue's mutex is hardly ever contended.
+   *
+   * push_local must only be called from the worker's own thread.
+   * @{
+   */
+  void push_local(const std::shared_ptr<AbstractTask>& task);
+  std::shared_ptr<AbstractTask> steal_local(const bool respect_stealable_flag);
+  bool local_queue_empty() const;
+  /** @} */
+
   uint64_t num_finished_tasks() const;
 
+  /**
+   * Histogram of the time that tasks executed by this worker spent in a queue before they were started. Bucket 0
+   * counts latencies below 1 µs, bucket i (i > 0) counts latencies in [2^(i-1), 2^i) µs. The last bucket also counts
+   * all larger latencies.
+   */
+  static constexpr auto SCHEDULING_LATENCY_BUCKET_COUNT = size_t{24};
+  std::array<uint64_t, SCHEDULING_LATENCY_BUCKET_COUNT> scheduling_latency_histogram() const;
+
   void operator=(const Worker&) = delete;
   void operator=(Worker&&) = delete;
 
  protected:
   void operator()();
-  void _work();
+
+  // Executes one task, if there is any. Otherwise, the worker backs off (see _back_off). While waiting for its own
+  // tasks to finish, the worker must not park for long as it would then notice their completion too late.
+  void _work(const bool waiting_for_own_tasks = false);
 
   void _wait_for_tasks(const std::vector<std::shared_ptr<AbstractTask>>& tasks);
 
@@ -60,8 +89,47 @@ class Worker : public std::enable_shared_from_this<Worker>, private Noncopyable
    */
   void _set_affinity();
 
+  /**
+   * Orders the queues of all other nodes by their NUMA distance to this worker's node. Work stealing visits the
+   * queues in that order so that stolen tasks (and the data they touch) stay as close as possible.
+   */
+  void _initialize_steal_order();
+
+  // Returns the next task from the high-priority queue, the task passed to execute_next, the local queue, the node's
+  // queue, or other workers and nodes, in this order.
+  std::shared_ptr<AbstractTask> _pull_task();
+
+  std::shared_ptr<AbstractTask> _pop_local();
+  std::shared_ptr<AbstractTask> _steal();
+
+  /**
+   * Called if no task could be found. For the first SPIN_ROUND_COUNT rounds, the worker only yields its time slice, as
+   * new tasks often arrive within microseconds (e.g., the jobs of the next operator). Afterwards, it parks on its
+   * node's TaskQueue with an exponentially growing timeout. Pushing a task to that queue or into the local queue of a
+   * worker on the same node wakes up one parked worker.
+   */
+  void _back_off(const bool waiting_for_own_tasks);
+
+  void _record_scheduling_latency(const AbstractTask& task);
+
   std::shared_ptr<AbstractTask> _next_task{};
   std::shared_ptr<TaskQueue> _queue;
+  std::vector<std::shared_ptr<TaskQueue>> _steal_order{};
+
+  // Workers whose local queues this worker may steal from, ordered by NUMA distance (workers of the same node first).
+  // These are weak pointers to avoid reference cycles between workers.
+  std::vector<std::weak_ptr<Worker>> _steal_order_workers{};
+
+  std::deque<std::shared_ptr<AbstractTask>> _local_tasks{};
+  mutable std::mutex _local_tasks_mutex;
+
+  uint32_t _idle_round_count{0};
+
+  // Number of workers of the scheduler, used to compute the share of workers of resource groups.
+  size_t _worker_count{1};
+  // Resource group of the task that this worker currently executes, nullptr if there is none or it has no group.
+  std::shared_ptr<ResourceGroup> _running_resource_group{};
+  std::array<std::atomic_uint64_t, SCHEDULING_LATENCY_BUCKET_COUNT> _scheduling_latency_histogram{};
   WorkerID _id;
   CpuID _cpu_id;
   std::thread _thread;
@@ -0,0 +1,64 @@
+#include "message_stream.hpp"
+
+#include <netinet/in.h>
+
+#include <algorithm>
+#include <cstring>
+#include <utility>
+
+#include "postgres_message_type.hpp"
+
+namespace hyrise {
+
+void MessageStream::append_received_data(const char* data, const size_t byte_count) {
+  // Discard the bytes that were read already.
+  _received_data.erase(_received_data.begin(), _received_data.begin() + static_cast<std::ptrdiff_t>(_read_position));
+  _readable_end -= _read_position;
+  _read_position = 0;
+
+  _received_data.insert(_received_data.end(), data, data + byte_count);
+  _frame_messages();
+}
+
+size_t MessageStream::readable_byte_count() const {
+  return _readable_end - _read_position;
+}
+
+std::vector<char> MessageStream::take_written_data() {
+  return std::exchange(_written_data, {});
+}
+
+void MessageStream::_frame_messages() {
+  const auto read_uint32 = [&](const size_t position) {
+    auto network_value = uint32_t{0};
+    std::memcpy(&network_value, _received_data.data() + position, sizeof(uint32_t));
+    return ntohl(network_value);
+  };
+
+  while (true) {
+    // Startup packets begin with their length, all other messages with their type, followed by their length. The
+    // length includes the length field itself, but not the type.
+    const auto length_offset = _expects_startup_packet ? size_t{0} : size_t{1};
+    const auto received_byte_count = _received_data.size() - _readable_end;
+    if (received_byte_count < length_offset + LENGTH_FIELD_SIZE) {
+      return;
+    }
+
+    // Messages with an invalid length field are passed on as well. The handler fails to read them.
+    const auto message_size =
+        length_offset + std::max(size_t{read_uint32(_readable_end + length_offset)}, size_t{LENGTH_FIELD_SIZE});
+    if (received_byte_count < message_size) {
+      return;
+    }
+
+    // Clients send the actual startup packet after the SSL request was denied.
+    if (_expects_startup_packet) {
+      _expects_startup_packet = message_size >= 2 * LENGTH_FIELD_SIZE &&
+                                read_uint32(_readable_end + LENGTH_FIELD_SIZE) == SSL_REQUEST_CODE;
+    }
+
+    _readable_end += message_size;
+  }
+}
+
+}  // namespace hyrise
@@ -0,0 +1,97 @@
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <utility>
+#include <vector>
+
+#include <boost/asio/buffer.hpp>
+#include <boost/asio/error.hpp>
+#include <boost/system/system_error.hpp>
+
+namespace hyrise {
+
+// In-memory stream between the socket of a Session and its PostgresProtocolHandler. The Session receives data from the
+// socket asynchronously and appends it to the stream. The handler only reads messages that were received completely.
+// Thus, reading a message never waits for the network. Likewise, the handler writes its responses into the stream and
+// the Session sends them asynchronously. As MessageStream implements the SyncReadStream and SyncWriteStream concepts of
+// boost::asio, the ReadBuffer and the WriteBuffer use it like a socket.
+class MessageStream {
+ public:
+  // Append data received from the client.
+  void append_received_data(const char* data, const size_t byte_count);
+
+  // Number of received bytes that belong to complete messages and were not read yet.
+  size_t readable_byte_count() const;
+
+  // Return the data written since the last call.
+  std::vector<char> take_written_data();
+
+  // Read at most the readable bytes. If there are none, the message that is read is malformed (e.g., its length field
+  // is too small) and would_block is returned.
+  template <typename MutableBufferSequence>
+  size_t read_some(const MutableBufferSequence& buffers, boost::system::error_code& error_code) {
+    error_code = {};
+    if (readable_byte_count() == 0) {
+      error_code = boost::asio::error::would_block;
+      return 0;
+    }
+
+    auto bytes_read = size_t{0};
+    for (auto buffer_iter = boost::asio::buffer_sequence_begin(buffers);
+         buffer_iter != boost::asio::buffer_sequence_end(buffers) && _read_position < _readable_end; ++buffer_iter) {
+      const auto byte_count = std::min(buffer_iter->size(), _readable_end - _read_position);
+      std::copy_n(_received_data.cbegin() + static_cast<std::ptrdiff_t>(_read_position), byte_count,
+                  static_cast<char*>(buffer_iter->data()));
+      _read_position += byte_count;
+      bytes_read += byte_count;
+    }
+    return bytes_read;
+  }
+
+  template <typename MutableBufferSequence>
+  size_t read_some(const MutableBufferSequence& buffers) {
+    auto error_code = boost::system::error_code{};
+    const auto bytes_read = read_some(buffers, error_code);
+    if (error_code) {
+      throw boost::system::system_error(error_code);
+    }
+    return bytes_read;
+  }
+
+  template <typename ConstBufferSequence>
+  size_t write_some(const ConstBufferSequence& buffers, boost::system::error_code& error_code) {
+    error_code = {};
+    auto bytes_written = size_t{0};
+    for (auto buffer_iter = boost::asio::buffer_sequence_begin(buffers);
+         buffer_iter != boost::asio::buffer_sequence_end(buffers); ++buffer_iter) {
+      const auto* data = static_cast<const char*>(buffer_iter->data());
+      _written_data.insert(_written_data.end(), data, data + buffer_iter->size());
+      bytes_written += buffer_iter->size();
+    }
+    return bytes_written;
+  }
+
+  template <typename ConstBufferSequence>
+  size_t write_some(const ConstBufferSequence& buffers) {
+    auto error_code = boost::system::error_code{};
+    return write_some(buffers, error_code);
+  }
+
+ private:
+  // Move _readable_end past all messages that were received completely.
+  void _frame_messages();
+
+  // The bytes in [_read_position, _readable_end) belong to complete messages that were not read yet. The bytes after
+  // _readable_end belong to a message that was only received partially.
+  std::vector<char> _received_data;
+  size_t _read_position{0};
+  size_t _readable_end{0};
+
+  // Until the connection is established, the client sends startup packets, which have no message type.
+  bool _expects_startup_packet{true};
+
+  std::vector<char> _written_data;
+};
+
+}  // namespace hyrise
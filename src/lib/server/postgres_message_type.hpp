@@ -1,11 +1,16 @@
 #pragma once
 
+#include <cstdint>
+
 namespace hyrise {
 
 // Each message contains a field (4 bytes) indicating the packet's size including itself. Using extra variable here to
 // avoid magic numbers.
 static constexpr auto LENGTH_FIELD_SIZE = 4u;
 
+// Special protocol version number of the startup packet with which clients request SSL, which we deny.
+static constexpr auto SSL_REQUEST_CODE = 80877103u;
+
 // Documentation of the message types can be found here:
 // https://www.postgresql.org/docs/12/protocol-message-formats.html
 enum class PostgresMessageType : unsigned char {
@@ -19,6 +24,7 @@ enum class PostgresMessageType : unsigned char {
   ErrorResponse = 'E',
   EmptyQueryResponse = 'I',
   NoDataResponse = 'n',
+  PortalSuspended = 's',
   ReadyForQuery = 'Z',
   RowDescription = 'T',
   DataRow = 'D',
@@ -51,6 +57,10 @@ enum class TransactionStatusIndicator : unsigned char {
   InFailedTransactionBlock = 'e'
 };
 
+// Format of a parameter or result column as specified in Bind messages. Values in text format are sent as strings,
+// values in binary format in PostgreSQL's binary representation of the column type (e.g., a big-endian int32 for int4).
+enum class PostgresFormatCode : int16_t { Text = 0, Binary = 1 };
+
 // SQL error codes
 constexpr char TRANSACTION_CONFLICT[] = "40001";
 
@@ -1,5 +1,7 @@
 #include "postgres_protocol_handler.hpp"
 
+#include "message_stream.hpp"
+
 namespace hyrise {
 
 template <typename SocketType>
@@ -8,16 +10,22 @@ PostgresProtocolHandler<SocketType>::PostgresProtocolHandler(const std::shared_p
 
 template <typename SocketType>
 uint32_t PostgresProtocolHandler<SocketType>::read_startup_packet_header() {
-  // Special SSL version number that we catch to deny SSL support
-  constexpr auto SSL_REQUEST_CODE = 80877103u;
+  auto body_length = try_read_startup_packet_header();
+  while (!body_length) {
+    body_length = try_read_startup_packet_header();
+  }
+  return *body_length;
+}
 
+template <typename SocketType>
+std::optional<uint32_t> PostgresProtocolHandler<SocketType>::try_read_startup_packet_header() {
   const auto body_length = _read_buffer.template get_value<uint32_t>();
   const auto protocol_version = _read_buffer.template get_value<uint32_t>();
 
   // We currently do not support SSL
   if (protocol_version == SSL_REQUEST_CODE) {
     _ssl_deny();
-    return read_startup_packet_header();
+    return std::nullopt;
   }
 
   // Subtract uint32_t twice since both the packet length and protocol version have been read already.
@@ -56,7 +64,7 @@ void PostgresProtocolHandler<SocketType>::send_ready_for_query() {
   _write_buffer.template put_value(PostgresMessageType::ReadyForQuery);
   _write_buffer.template put_value<uint32_t>(LENGTH_FIELD_SIZE + sizeof(TransactionStatusIndicator::Idle));
   _write_buffer.template put_value(TransactionStatusIndicator::Idle);
-  _write_buffer.flush();
+  // The buffer is not flushed here. The Session flushes it after processing all messages that the client pipelined.
 }
 
 template <typename SocketType>
@@ -89,7 +97,8 @@ void PostgresProtocolHandler<SocketType>::send_row_description_header(const uint
 
 template <typename SocketType>
 void PostgresProtocolHandler<SocketType>::send_row_description(const std::string& column_name, const uint32_t object_id,
-                                                               const int16_t type_width) {
+                                                               const int16_t type_width,
+                                                               const PostgresFormatCode format_code) {
   _write_buffer.put_string(column_name);
   // This field contains the table ID (OID in postgres). We have to set it in order to fulfill the protocol
   // specification. We do not know what it's good for.
@@ -99,7 +108,7 @@ void PostgresProtocolHandler<SocketType>::send_row_description(const std::string
   _write_buffer.template put_value<int32_t>(object_id);   // Object id of type
   _write_buffer.template put_value<int16_t>(type_width);  // Data type size
   _write_buffer.template put_value<int32_t>(-1);          // No modifier
-  _write_buffer.template put_value<int16_t>(0u);          // Text format
+  _write_buffer.template put_value<int16_t>(static_cast<int16_t>(format_code));  // Text or binary format
 }
 
 template <typename SocketType>
@@ -132,6 +141,11 @@ void PostgresProtocolHandler<SocketType>::send_data_row(
   }
 }
 
+template <typename SocketType>
+void PostgresProtocolHandler<SocketType>::send_data_rows(const std::vector<char>& serialized_data_rows) {
+  _write_buffer.put_bytes(serialized_data_rows.data(), serialized_data_rows.size());
+}
+
 template <typename SocketType>
 void PostgresProtocolHandler<SocketType>::send_command_complete(const std::string& command_complete_message) {
   const auto packet_size = LENGTH_FIELD_SIZE + command_complete_message.size() + 1u /* null terminator */;
@@ -165,6 +179,12 @@ void PostgresProtocolHandler<SocketType>::read_sync_packet() {
   _read_buffer.template get_value<uint32_t>();
 }
 
+template <typename SocketType>
+void PostgresProtocolHandler<SocketType>::read_flush_packet() {
+  // Like the sync packet, this packet has no body.
+  _read_buffer.template get_value<uint32_t>();
+}
+
 template <typename SocketType>
 void PostgresProtocolHandler<SocketType>::send_status_message(const PostgresMessageType message_type) {
   _write_buffer.template put_value(message_type);
@@ -207,15 +227,19 @@ PreparedStatementDetails PostgresProtocolHandler<SocketType>::read_bind_packet()
 
   const auto num_result_column_format_codes = _read_buffer.template get_value<int16_t>();
 
-  for (auto format_code = 0; format_code < num_result_column_format_codes; ++format_code) {
-    Assert(_read_buffer.template get_value<int16_t>() == 0, "Assuming all result columns to be in text format (0)");
+  auto result_format_codes = std::vector<PostgresFormatCode>{};
+  result_format_codes.reserve(num_result_column_format_codes);
+  for (auto format_code_index = 0; format_code_index < num_result_column_format_codes; ++format_code_index) {
+    const auto format_code = _read_buffer.template get_value<int16_t>();
+    AssertInput(format_code == 0 || format_code == 1, "Unknown result format code " + std::to_string(format_code));
+    result_format_codes.emplace_back(static_cast<PostgresFormatCode>(format_code));
   }
 
-  return {statement_name, portal, parameter_values};
+  return {statement_name, portal, parameter_values, result_format_codes};
 }
 
 template <typename SocketType>
-std::string PostgresProtocolHandler<SocketType>::read_execute_packet() {
+std::pair<std::string, uint32_t> PostgresProtocolHandler<SocketType>::read_execute_packet() {
   const auto packet_size = _read_buffer.template get_value<uint32_t>();
   auto portal = _read_buffer.get_string(packet_size - 2 * sizeof(uint32_t));
   /* https://www.postgresql.org/docs/12/protocol-flow.html:
@@ -223,8 +247,8 @@ std::string PostgresProtocolHandler<SocketType>::read_execute_packet() {
    the command is always executed to completion, and the row count is ignored.
   */
   const auto row_limit = _read_buffer.template get_value<int32_t>();
-  Assert(row_limit == 0, "Row limit of 0 (unlimited) expected.");
-  return portal;
+  AssertInput(row_limit >= 0, "Row limit must not be negative.");
+  return {portal, static_cast<uint32_t>(row_limit)};
 }
 
 template <typename SocketType>
@@ -272,7 +296,7 @@ void PostgresProtocolHandler<SocketType>::_ssl_deny() {
   _write_buffer.flush();
 }
 
-template class PostgresProtocolHandler<Socket>;
+template class PostgresProtocolHandler<MessageStream>;
 // For testing purposes only. stream_descriptor is used to write data to file
 template class PostgresProtocolHandler<boost::asio::posix::stream_descriptor>;
 
@@ -11,11 +11,14 @@ namespace hyrise {
 
 using ErrorMessages = std::unordered_map<PostgresMessageType, std::string>;
 
-// This struct stores a prepared statement's name, its portal used and the specified parameters.
+// This struct stores a prepared statement's name, its portal used, the specified parameters, and the requested
+// formats of the result columns. As in the Bind message, no format code means that all columns are sent as text, a
+// single format code applies to all columns, and otherwise, there is one format code per column.
 struct PreparedStatementDetails {
   std::string statement_name;
   std::string portal;
   std::vector<AllTypeVariant> parameters;
+  std::vector<PostgresFormatCode> result_format_codes;
 };
 
 // This class extracts information from client messages and serializes the response data according to the PostgreSQL
@@ -25,8 +28,13 @@ class PostgresProtocolHandler {
  public:
   explicit PostgresProtocolHandler(const std::shared_ptr<SocketType>& socket);
 
-  // Handle the startup packet header returning the body's size
+  // Handle the startup packet header returning the body's size. SSL requests are denied and the header of the
+  // following startup packet is read.
   uint32_t read_startup_packet_header();
+
+  // Like read_startup_packet_header(), but returns std::nullopt after denying an SSL request. The client sends the
+  // following startup packet only once it received the denial.
+  std::optional<uint32_t> try_read_startup_packet_header();
   void read_startup_packet_body(const uint32_t size);
 
   // Setup new connection: successful authentication + sending parameters
@@ -36,6 +44,12 @@ class PostgresProtocolHandler {
   // Ready to receive a new packet
   void send_ready_for_query();
 
+  // Returns true if data was received from the client that has not been read yet. Data that is still in the socket's
+  // receive buffer of the operating system is not considered.
+  bool has_received_data() const {
+    return _read_buffer.size() > 0;
+  }
+
   // Read first byte of next packet to determine its type
   PostgresMessageType read_packet_type();
 
@@ -44,14 +58,18 @@ class PostgresProtocolHandler {
 
   // Send query result
   void send_row_description_header(const uint32_t total_column_name_length, const uint16_t column_count);
-  void send_row_description(const std::string& column_name, const uint32_t object_id, const int16_t type_width);
+  void send_row_description(const std::string& column_name, const uint32_t object_id, const int16_t type_width,
+                            const PostgresFormatCode format_code = PostgresFormatCode::Text);
   void send_data_row(const std::vector<std::optional<std::string>>& values_as_strings,
                      const uint32_t string_length_sum);
+  // Send a batch of DataRow messages that were already serialized (see ResultSerializer::send_query_response)
+  void send_data_rows(const std::vector<char>& serialized_data_rows);
   void send_command_complete(const std::string& command_complete_message);
 
   // Messages for parsing prepared statements
   std::pair<std::string, std::string> read_parse_packet();
   void read_sync_packet();
+  void read_flush_packet();
 
   // Send out status message containing PostgresMessageType and length
   void send_status_message(const PostgresMessageType message_type);
@@ -59,7 +77,8 @@ class PostgresProtocolHandler {
   // Series of packets for binding and executing prepared statements
   void read_describe_packet();
   PreparedStatementDetails read_bind_packet();
-  std::string read_execute_packet();
+  // Returns the portal name and the maximum number of rows to return (0 means no limit)
+  std::pair<std::string, uint32_t> read_execute_packet();
 
   // Send error message to client if there is an error during parsing or execution
   void send_error_message(const ErrorMessages& error_messages);
@@ -67,7 +86,7 @@ class PostgresProtocolHandler {
   // Additional (optional) message containing execution times of different components (such as translator or optimizer)
   void send_execution_info(const std::string& execution_information);
 
-  // This method is required for testing. Otherwise we cannot make the protocol handler flush its data.
+  // Send all buffered data. Used for Flush messages and for testing.
   void force_flush() {
     _write_buffer.flush();
   }
@@ -1,7 +1,17 @@
 #include "query_handler.hpp"
 
+#include <cctype>
+
+#include "expression/evaluation/expression_evaluator.hpp"
+#include "expression/expression_utils.hpp"
 #include "expression/value_expression.hpp"
+#include "logical_query_plan/insert_node.hpp"
+#include "operators/insert.hpp"
+#include "operators/table_wrapper.hpp"
 #include "optimizer/optimizer.hpp"
+#include "resolve_type.hpp"
+#include "scheduler/resource_group.hpp"
+#include "scheduler/task_context.hpp"
 #include "sql/sql_pipeline_builder.hpp"
 #include "sql/sql_translator.hpp"
 
@@ -9,7 +19,7 @@ namespace hyrise {
 
 std::pair<ExecutionInformation, std::shared_ptr<TransactionContext>> QueryHandler::execute_pipeline(
     const std::string& query, const SendExecutionInfo send_execution_info,
-    const std::shared_ptr<TransactionContext>& transaction_context) {
+    const std::shared_ptr<TransactionContext>& transaction_context, const std::optional<uint64_t>& session_id) {
   // A simple query command invalidates unnamed statements
   // See: https://postgresql.org/docs/12/protocol-flow.html#PROTOCOL-FLOW-EXT-QUERY
   if (Hyrise::get().storage_manager.has_prepared_plan("")) {
@@ -20,7 +30,11 @@ std::pair<ExecutionInformation, std::shared_ptr<TransactionContext>> QueryHandle
               "Auto-commit transaction contexts should not be passed around this far");
 
   auto execution_info = ExecutionInformation();
-  auto sql_pipeline = SQLPipelineBuilder{query}.with_transaction_context(transaction_context).create_pipeline();
+  auto sql_pipeline_builder = SQLPipelineBuilder{query}.with_transaction_context(transaction_context);
+  if (session_id) {
+    sql_pipeline_builder.with_session_id(*session_id);
+  }
+  auto sql_pipeline = sql_pipeline_builder.create_pipeline();
 
   const auto [pipeline_status, result_table] = sql_pipeline.get_result_table();
 
@@ -57,6 +71,17 @@ void QueryHandler::setup_prepared_plan(const std::string& statement_name, const
     Hyrise::get().storage_manager.drop_prepared_plan(statement_name);
   }
 
+  // Clients such as JDBC drivers prepare the same statements in many connections. Parsing and translating them once
+  // is sufficient. Cached plans are never modified: PreparedPlan::instantiate() works on a copy.
+  const auto& prepared_plan_cache = Hyrise::get().default_prepared_plan_cache;
+  const auto normalized_query = normalize_sql(query);
+  if (prepared_plan_cache) {
+    if (const auto cached_plan = prepared_plan_cache->try_get(normalized_query)) {
+      Hyrise::get().storage_manager.add_prepared_plan(statement_name, *cached_plan);
+      return;
+    }
+  }
+
   auto pipeline = SQLPipelineBuilder{query}.create_pipeline();
   const auto& lqps = pipeline.get_unoptimized_logical_plans();
 
@@ -72,6 +97,12 @@ void QueryHandler::setup_prepared_plan(const std::string& statement_name, const
   auto parameter_ids_of_value_placeholders = translation_info.parameter_ids_of_value_placeholders;
   const auto prepared_plan = std::make_shared<PreparedPlan>(lqp, parameter_ids_of_value_placeholders);
 
+  // The plan is optimized when the parameters are bound, because rules such as the ChunkPruningRule depend on their
+  // values.
+  if (prepared_plan_cache && translation_info.cacheable) {
+    prepared_plan_cache->set(normalized_query, prepared_plan);
+  }
+
   Hyrise::get().storage_manager.add_prepared_plan(statement_name, prepared_plan);
 }
 
@@ -97,8 +128,131 @@ std::shared_ptr<AbstractOperator> QueryHandler::bind_prepared_plan(const Prepare
   return pqp;
 }
 
-std::shared_ptr<const Table> QueryHandler::execute_prepared_plan(
-    const std::shared_ptr<AbstractOperator>& physical_plan) {
+std::optional<std::pair<std::string, std::vector<AllTypeVariant>>> QueryHandler::bind_insert_values(
+    const PreparedStatementDetails& statement_details) {
+  AssertInput(Hyrise::get().storage_manager.has_prepared_plan(statement_details.statement_name),
+              "The specified statement does not exist.");
+
+  const auto prepared_plan = Hyrise::get().storage_manager.get_prepared_plan(statement_details.statement_name);
+
+  // `INSERT INTO <table> VALUES (...)` is translated to an InsertNode on top of a ProjectionNode that casts the values
+  // to the column types on top of a DummyTableNode (see SQLTranslator::_translate_insert).
+  const auto& insert_node = prepared_plan->lqp;
+  if (insert_node->type != LQPNodeType::Insert || insert_node->left_input()->type != LQPNodeType::Projection ||
+      insert_node->left_input()->left_input()->type != LQPNodeType::DummyTable) {
+    return std::nullopt;
+  }
+
+  // Inserts into meta tables are handled by the MetaTableManager and are not coalesced.
+  const auto& table_name = static_cast<const InsertNode&>(*insert_node).table_name;
+  if (!Hyrise::get().storage_manager.has_table(table_name)) {
+    return std::nullopt;
+  }
+
+  for (const auto& expression : insert_node->left_input()->node_expressions) {
+    auto contains_subquery = false;
+    visit_expression(expression, [&](const auto& sub_expression) {
+      if (sub_expression->type == ExpressionType::LQPSubquery) {
+        contains_subquery = true;
+        return ExpressionVisitation::DoNotVisitArguments;
+      }
+      return ExpressionVisitation::VisitArguments;
+    });
+    if (contains_subquery) {
+      return std::nullopt;
+    }
+  }
+
+  const auto parameter_count = statement_details.parameters.size();
+  auto parameter_expressions = std::vector<std::shared_ptr<AbstractExpression>>{parameter_count};
+  for (auto parameter_idx = size_t{0}; parameter_idx < parameter_count; ++parameter_idx) {
+    parameter_expressions[parameter_idx] =
+        std::make_shared<ValueExpression>(statement_details.parameters[parameter_idx]);
+  }
+
+  const auto instantiated_lqp = prepared_plan->instantiate(parameter_expressions);
+  const auto& expressions = instantiated_lqp->left_input()->node_expressions;
+
+  auto values = std::vector<AllTypeVariant>{};
+  values.reserve(expressions.size());
+  for (const auto& expression : expressions) {
+    resolve_data_type(expression->data_type(), [&](const auto data_type_t) {
+      using ColumnDataType = typename decltype(data_type_t)::type;
+      const auto result = ExpressionEvaluator{}.evaluate_expression_to_result<ColumnDataType>(*expression);
+      if (result->is_null(0)) {
+        values.emplace_back(NullValue{});
+      } else {
+        values.emplace_back(result->value(0));
+      }
+    });
+  }
+
+  return std::make_pair(table_name, std::move(values));
+}
+
+void QueryHandler::execute_insert(const std::string& table_name, const std::shared_ptr<Table>& rows,
+                                  const std::shared_ptr<TransactionContext>& transaction_context,
+                                  const std::optional<uint64_t>& session_id) {
+  const auto table_wrapper = std::make_shared<TableWrapper>(rows);
+  const auto insert = std::make_shared<Insert>(table_name, table_wrapper);
+  insert->set_transaction_context_recursively(transaction_context);
+  execute_prepared_plan(insert, session_id);
+}
+
+std::string QueryHandler::normalize_sql(const std::string& query) {
+  auto normalized_query = std::string{};
+  normalized_query.reserve(query.size());
+
+  auto quote = char{0};
+  auto pending_whitespace = false;
+  const auto query_length = query.size();
+  for (auto position = size_t{0}; position < query_length; ++position) {
+    const auto character = query[position];
+    if (quote) {
+      normalized_query += character;
+      if (character == quote) {
+        quote = 0;
+      }
+      continue;
+    }
+
+    // Comments end at the next line break. Like whitespace, they only separate tokens.
+    if (character == '-' && position + 1 < query_length && query[position + 1] == '-') {
+      while (position + 1 < query_length && query[position + 1] != '\n') {
+        ++position;
+      }
+      pending_whitespace = !normalized_query.empty();
+      continue;
+    }
+
+    if (std::isspace(static_cast<unsigned char>(character))) {
+      pending_whitespace = !normalized_query.empty();
+      continue;
+    }
+
+    if (pending_whitespace) {
+      normalized_query += ' ';
+      pending_whitespace = false;
+    }
+    normalized_query += character;
+    if (character == '\'' || character == '"') {
+      quote = character;
+    }
+  }
+
+  while (!normalized_query.empty() && (normalized_query.back() == ';' || normalized_query.back() == ' ')) {
+    normalized_query.pop_back();
+  }
+
+  return normalized_query;
+}
+
+std::shared_ptr<const Table> QueryHandler::execute_prepared_plan(const std::shared_ptr<AbstractOperator>& physical_plan,
+                                                                 const std::optional<uint64_t>& session_id) {
+  // Prepared plans bypass the SQLPipeline. Thus, we attach the query's identity to its tasks here.
+  const auto task_context = std::make_shared<TaskContext>(std::make_shared<ResourceGroup>("statement"), session_id);
+  const auto scoped_task_context = ScopedTaskContext{task_context};
+
   const auto& [tasks, root_operator_task] = OperatorTask::make_tasks_from_operator(physical_plan);
   Hyrise::get().scheduler()->schedule_and_wait_for_tasks(tasks);
   return root_operator_task->get_operator()->get_output();
@@ -1,6 +1,11 @@
 #pragma once
 
+#include <optional>
+#include <string>
+#include <utility>
 #include <variant>
+#include <vector>
+
 #include "hyrise.hpp"
 #include "operators/abstract_operator.hpp"
 #include "postgres_protocol_handler.hpp"
@@ -24,15 +29,36 @@ struct ExecutionInformation {
 // error handling happens in this class.
 class QueryHandler {
  public:
+  // The optional session id is attached to all tasks of the query (see TaskContext).
   static std::pair<ExecutionInformation, std::shared_ptr<TransactionContext>> execute_pipeline(
       const std::string& query, const SendExecutionInfo send_execution_info,
-      const std::shared_ptr<TransactionContext>& transaction_context);
+      const std::shared_ptr<TransactionContext>& transaction_context,
+      const std::optional<uint64_t>& session_id = std::nullopt);
 
+  // Translates the query into a PreparedPlan. If Hyrise::get().default_prepared_plan_cache is set, the plans are shared
+  // between all sessions. Statements are identified by their normalized SQL (see normalize_sql()).
   static void setup_prepared_plan(const std::string& statement_name, const std::string& query);
 
   static std::shared_ptr<AbstractOperator> bind_prepared_plan(const PreparedStatementDetails& statement_details);
 
-  static std::shared_ptr<const Table> execute_prepared_plan(const std::shared_ptr<AbstractOperator>& physical_plan);
+  // If the prepared statement is a plain `INSERT INTO <table> [(<columns>)] VALUES (...)`, returns the name of the
+  // target table and the row to insert for the given parameters. The rows of multiple executions can then be inserted
+  // with a single Insert operator (see execute_insert()) instead of optimizing and executing a plan for each row.
+  // Otherwise, returns std::nullopt.
+  static std::optional<std::pair<std::string, std::vector<AllTypeVariant>>> bind_insert_values(
+      const PreparedStatementDetails& statement_details);
+
+  // Inserts all rows of the given table, which has the same columns as the target table.
+  static void execute_insert(const std::string& table_name, const std::shared_ptr<Table>& rows,
+                             const std::shared_ptr<TransactionContext>& transaction_context,
+                             const std::optional<uint64_t>& session_id = std::nullopt);
+
+  // Removes comments, collapses whitespace outside of quotes, and removes leading and trailing whitespace and
+  // semicolons, so that statements that differ only in their formatting share a cached plan.
+  static std::string normalize_sql(const std::string& query);
+
+  static std::shared_ptr<const Table> execute_prepared_plan(const std::shared_ptr<AbstractOperator>& physical_plan,
+                                                            const std::optional<uint64_t>& session_id = std::nullopt);
 
  private:
   static void _handle_transaction_statement_message(ExecutionInformation& execution_info, SQLPipeline& sql_pipeline);
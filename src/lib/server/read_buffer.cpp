@@ -1,6 +1,7 @@
 #include "read_buffer.hpp"
 
 #include "client_disconnect_exception.hpp"
+#include "message_stream.hpp"
 
 namespace hyrise {
 
@@ -111,7 +112,7 @@ void ReadBuffer<SocketType>::_receive_if_necessary(const size_t bytes_required)
   std::advance(_current_position, bytes_read);
 }
 
-template class ReadBuffer<Socket>;
+template class ReadBuffer<MessageStream>;
 template class ReadBuffer<boost::asio::posix::stream_descriptor>;
 
 }  // namespace hyrise
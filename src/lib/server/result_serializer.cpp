@@ -1,13 +1,101 @@
 #include "result_serializer.hpp"
-#include "lossy_cast.hpp"
+
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <charconv>
+#include <limits>
+
+#include <boost/endian/conversion.hpp>
+
+#include "message_stream.hpp"
 #include "query_handler.hpp"
+#include "resolve_type.hpp"
+#include "storage/segment_iterate.hpp"
+
+namespace {
+
+using namespace hyrise;  // NOLINT
+
+// The values of a segment in their wire format. value_lengths contains the number of bytes of each value or -1 for
+// NULL values.
+struct SerializedColumn {
+  std::vector<char> values;
+  std::vector<int32_t> value_lengths;
+};
+
+template <typename T>
+void append_network_value(std::vector<char>& buffer, const T value) {
+  const auto network_value = boost::endian::native_to_big(value);
+  const auto* const bytes = reinterpret_cast<const char*>(&network_value);
+  buffer.insert(buffer.end(), bytes, bytes + sizeof(T));
+}
+
+template <typename T>
+void append_value(std::vector<char>& buffer, const T& value, const PostgresFormatCode format_code) {
+  if constexpr (std::is_same_v<T, pmr_string>) {
+    // Strings look the same in the text and the binary format.
+    buffer.insert(buffer.end(), value.cbegin(), value.cend());
+  } else if (format_code == PostgresFormatCode::Binary) {
+    // PostgreSQL sends int4, int8, float4, and float8 values in network byte order.
+    if constexpr (std::is_floating_point_v<T>) {
+      using Bits = std::conditional_t<sizeof(T) == sizeof(uint32_t), uint32_t, uint64_t>;
+      append_network_value(buffer, std::bit_cast<Bits>(value));
+    } else {
+      append_network_value(buffer, value);
+    }
+  } else {
+    // Large enough for all int64_t values and for doubles with max_digits10 significant digits.
+    auto characters = std::array<char, 32>{};
+    auto result = std::to_chars_result{};
+    if constexpr (std::is_floating_point_v<T>) {
+      // Like boost::lexical_cast, print as many digits as needed to restore the exact value.
+      result = std::to_chars(characters.data(), characters.data() + characters.size(), value,
+                             std::chars_format::general, std::numeric_limits<T>::max_digits10);
+    } else {
+      result = std::to_chars(characters.data(), characters.data() + characters.size(), value);
+    }
+    DebugAssert(result.ec == std::errc{}, "Could not convert value to string.");
+    buffer.insert(buffer.end(), characters.data(), result.ptr);
+  }
+}
+
+// Serializes the values at the offsets [begin_offset, end_offset) of the segment.
+void serialize_column(const AbstractSegment& segment, const DataType data_type, const PostgresFormatCode format_code,
+                      const ChunkOffset begin_offset, const ChunkOffset end_offset,
+                      SerializedColumn& serialized_column) {
+  serialized_column.values.clear();
+  serialized_column.value_lengths.clear();
+
+  resolve_data_type(data_type, [&](const auto data_type_t) {
+    using ColumnDataType = typename decltype(data_type_t)::type;
+
+    segment_with_iterators<ColumnDataType>(segment, [&](const auto segment_begin, const auto /* segment_end */) {
+      const auto end = segment_begin + end_offset;
+      for (auto iter = segment_begin + begin_offset; iter != end; ++iter) {
+        if (iter->is_null()) {
+          serialized_column.value_lengths.emplace_back(-1);
+          continue;
+        }
+
+        const auto previous_size = serialized_column.values.size();
+        append_value(serialized_column.values, iter->value(), format_code);
+        const auto value_length = serialized_column.values.size() - previous_size;
+        serialized_column.value_lengths.emplace_back(static_cast<int32_t>(value_length));
+      }
+    });
+  });
+}
+
+}  // namespace
 
 namespace hyrise {
 
 template <typename SocketType>
 void ResultSerializer::send_table_description(
     const std::shared_ptr<const Table>& table,
-    const std::shared_ptr<PostgresProtocolHandler<SocketType>>& postgres_protocol_handler) {
+    const std::shared_ptr<PostgresProtocolHandler<SocketType>>& postgres_protocol_handler,
+    const std::vector<PostgresFormatCode>& result_format_codes) {
   // Calculate sum of length of all column names
   uint32_t column_name_length_sum = 0;
   for (auto& column_name : table->column_names()) {
@@ -49,46 +137,98 @@ void ResultSerializer::send_table_description(
       case DataType::Null:
         Fail("Bad DataType");
     }
-    postgres_protocol_handler->send_row_description(table->column_name(column_id), object_id, type_width);
+    postgres_protocol_handler->send_row_description(table->column_name(column_id), object_id, type_width,
+                                                    format_code(result_format_codes, column_id, column_count));
   }
 }
 
 template <typename SocketType>
 void ResultSerializer::send_query_response(
     const std::shared_ptr<const Table>& table,
-    const std::shared_ptr<PostgresProtocolHandler<SocketType>>& postgres_protocol_handler) {
-  auto values_as_strings = std::vector<std::optional<std::string>>(table->column_count());
+    const std::shared_ptr<PostgresProtocolHandler<SocketType>>& postgres_protocol_handler,
+    const std::vector<PostgresFormatCode>& result_format_codes) {
+  auto position = RowID{ChunkID{0}, ChunkOffset{0}};
+  send_query_response_rows(table, postgres_protocol_handler, result_format_codes, position, 0);
+}
 
-  const auto chunk_count = table->chunk_count();
+template <typename SocketType>
+uint64_t ResultSerializer::send_query_response_rows(
+    const std::shared_ptr<const Table>& table,
+    const std::shared_ptr<PostgresProtocolHandler<SocketType>>& postgres_protocol_handler,
+    const std::vector<PostgresFormatCode>& result_format_codes, RowID& position, const uint64_t row_limit) {
+  const auto column_count = table->column_count();
+  auto serialized_columns = std::vector<SerializedColumn>(column_count);
+  auto read_positions = std::vector<size_t>(column_count);
+
+  auto data_rows = std::vector<char>{};
+  data_rows.reserve(DATA_ROW_BATCH_SIZE);
 
-  // Iterate over each chunk in result table
-  for (ChunkID chunk_id{0}; chunk_id < chunk_count; chunk_id++) {
-    const auto chunk = table->get_chunk(chunk_id);
+  auto sent_row_count = uint64_t{0};
+  const auto chunk_count = table->chunk_count();
+  while (position.chunk_id < chunk_count && (row_limit == 0 || sent_row_count < row_limit)) {
+    const auto chunk = table->get_chunk(position.chunk_id);
     const auto chunk_size = chunk->size();
+    const auto begin_offset = position.chunk_offset;
+    auto end_offset = chunk_size;
+    if (row_limit != 0) {
+      const auto remaining_row_count = row_limit - sent_row_count;
+      end_offset = static_cast<ChunkOffset>(std::min(uint64_t{chunk_size}, begin_offset + remaining_row_count));
+    }
 
-    const auto column_count = table->column_count();
-    auto segments = Segments(column_count);
-    for (auto column_id = ColumnID{0}; column_id < column_count; column_id++) {
-      segments[column_id] = chunk->get_segment(column_id);
+    for (auto column_id = ColumnID{0}; column_id < column_count; ++column_id) {
+      serialize_column(*chunk->get_segment(column_id), table->column_data_type(column_id),
+                       format_code(result_format_codes, column_id, column_count), begin_offset, end_offset,
+                       serialized_columns[column_id]);
+      read_positions[column_id] = 0;
     }
 
-    // Iterate over each row in chunk
-    for (auto chunk_offset = ChunkOffset{0}; chunk_offset < chunk_size; ++chunk_offset) {
-      auto string_length_sum = uint32_t{0};
-      // Iterate over each attribute in row
-      for (auto segment_id = ColumnID{0}; segment_id < column_count; segment_id++) {
-        const auto attribute_value = (*segments[segment_id])[chunk_offset];
-        // The PostgreSQL protocol requires the conversion of values to strings
-        const auto string_value = lossy_variant_cast<pmr_string>(attribute_value);
-        if (string_value.has_value()) {
-          // Sum up string lengths for a row to save an extra loop during serialization
-          string_length_sum += static_cast<uint32_t>(string_value.value().size());
+    // Assemble the DataRow messages. The documentation of their fields can be found at:
+    // https://www.postgresql.org/docs/12/static/protocol-message-formats.html
+    const auto row_count = static_cast<size_t>(end_offset - begin_offset);
+    for (auto row_id = size_t{0}; row_id < row_count; ++row_id) {
+      // Length field, column count, and one length field per value
+      auto message_length =
+          LENGTH_FIELD_SIZE + sizeof(uint16_t) + static_cast<size_t>(column_count) * LENGTH_FIELD_SIZE;
+      for (auto column_id = ColumnID{0}; column_id < column_count; ++column_id) {
+        message_length += std::max(serialized_columns[column_id].value_lengths[row_id], int32_t{0});
+      }
+
+      data_rows.emplace_back(static_cast<char>(PostgresMessageType::DataRow));
+      append_network_value(data_rows, static_cast<uint32_t>(message_length));
+      append_network_value(data_rows, static_cast<uint16_t>(column_count));
+
+      for (auto column_id = ColumnID{0}; column_id < column_count; ++column_id) {
+        const auto& serialized_column = serialized_columns[column_id];
+        const auto value_length = serialized_column.value_lengths[row_id];
+        // NULL values are represented by a length of -1
+        append_network_value(data_rows, value_length);
+        if (value_length > 0) {
+          const auto value_begin = serialized_column.values.cbegin() + read_positions[column_id];
+          data_rows.insert(data_rows.end(), value_begin, value_begin + value_length);
+          read_positions[column_id] += value_length;
         }
-        values_as_strings[segment_id] = string_value;
       }
-      postgres_protocol_handler->send_data_row(values_as_strings, string_length_sum);
+
+      // The socket write blocks if the client does not keep up. This way, a slow client throttles the serialization.
+      if (data_rows.size() >= DATA_ROW_BATCH_SIZE) {
+        postgres_protocol_handler->send_data_rows(data_rows);
+        data_rows.clear();
+      }
+    }
+    sent_row_count += row_count;
+
+    if (end_offset == chunk_size) {
+      position = RowID{ChunkID{position.chunk_id + 1}, ChunkOffset{0}};
+    } else {
+      position.chunk_offset = end_offset;
     }
   }
+
+  if (!data_rows.empty()) {
+    postgres_protocol_handler->send_data_rows(data_rows);
+  }
+
+  return sent_row_count;
 }
 
 std::string ResultSerializer::build_command_complete_message(const ExecutionInformation& execution_information,
@@ -123,18 +263,46 @@ std::string ResultSerializer::build_command_complete_message(const OperatorType
   }
 }
 
-template void ResultSerializer::send_table_description<Socket>(const std::shared_ptr<const Table>&,
-                                                               const std::shared_ptr<PostgresProtocolHandler<Socket>>&);
+PostgresFormatCode ResultSerializer::format_code(const std::vector<PostgresFormatCode>& result_format_codes,
+                                                 const ColumnID column_id, const ColumnCount column_count) {
+  if (result_format_codes.empty()) {
+    return PostgresFormatCode::Text;
+  }
+
+  if (result_format_codes.size() == 1) {
+    return result_format_codes.front();
+  }
+
+  AssertInput(result_format_codes.size() == column_count,
+              "Expected one result format code per column, got " + std::to_string(result_format_codes.size()) + ".");
+  return result_format_codes[column_id];
+}
+
+template void ResultSerializer::send_table_description<MessageStream>(
+    const std::shared_ptr<const Table>&, const std::shared_ptr<PostgresProtocolHandler<MessageStream>>&,
+    const std::vector<PostgresFormatCode>&);
 
 template void ResultSerializer::send_table_description<boost::asio::posix::stream_descriptor>(
     const std::shared_ptr<const Table>&,
-    const std::shared_ptr<PostgresProtocolHandler<boost::asio::posix::stream_descriptor>>&);
+    const std::shared_ptr<PostgresProtocolHandler<boost::asio::posix::stream_descriptor>>&,
+    const std::vector<PostgresFormatCode>&);
 
-template void ResultSerializer::send_query_response<Socket>(const std::shared_ptr<const Table>&,
-                                                            const std::shared_ptr<PostgresProtocolHandler<Socket>>&);
+template void ResultSerializer::send_query_response<MessageStream>(
+    const std::shared_ptr<const Table>&, const std::shared_ptr<PostgresProtocolHandler<MessageStream>>&,
+    const std::vector<PostgresFormatCode>&);
 
 template void ResultSerializer::send_query_response<boost::asio::posix::stream_descriptor>(
     const std::shared_ptr<const Table>&,
-    const std::shared_ptr<PostgresProtocolHandler<boost::asio::posix::stream_descriptor>>&);
+    const std::shared_ptr<PostgresProtocolHandler<boost::asio::posix::stream_descriptor>>&,
+    const std::vector<PostgresFormatCode>&);
+
+template uint64_t ResultSerializer::send_query_response_rows<MessageStream>(
+    const std::shared_ptr<const Table>&, const std::shared_ptr<PostgresProtocolHandler<MessageStream>>&,
+    const std::vector<PostgresFormatCode>&, RowID&, const uint64_t);
+
+template uint64_t ResultSerializer::send_query_response_rows<boost::asio::posix::stream_descriptor>(
+    const std::shared_ptr<const Table>&,
+    const std::shared_ptr<PostgresProtocolHandler<boost::asio::posix::stream_descriptor>>&,
+    const std::vector<PostgresFormatCode>&, RowID&, const uint64_t);
 
 }  // namespace hyrise
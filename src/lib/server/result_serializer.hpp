@@ -1,6 +1,8 @@
 #pragma once
 
 #include <memory>
+#include <vector>
+
 #include "operators/abstract_operator.hpp"
 #include "postgres_protocol_handler.hpp"
 #include "storage/table.hpp"
@@ -10,24 +12,47 @@ namespace hyrise {
 struct ExecutionInformation;
 
 // The ResultSerializer serializes the result data returned by Hyrise according to PostgreSQL Wire Protocol.
+//
+// The result_format_codes are interpreted as in the Bind message (see PreparedStatementDetails). Simple queries always
+// return text.
 class ResultSerializer {
  public:
+  // DataRow messages are collected in batches of (at least) this size before they are handed to the WriteBuffer.
+  static constexpr auto DATA_ROW_BATCH_SIZE = size_t{1'048'576};
+
   // Serialize information about the result table
   template <typename SocketType>
   static void send_table_description(
       const std::shared_ptr<const Table>& table,
-      const std::shared_ptr<PostgresProtocolHandler<SocketType>>& postgres_protocol_handler);
+      const std::shared_ptr<PostgresProtocolHandler<SocketType>>& postgres_protocol_handler,
+      const std::vector<PostgresFormatCode>& result_format_codes = {});
 
+  // Serialize the result table chunk by chunk. Within a chunk, the values are serialized column by column, using
+  // the segment's iterators and the column's data type, and then assembled into DataRow messages. The messages are
+  // sent in batches of DATA_ROW_BATCH_SIZE bytes.
   template <typename SocketType>
-  // Cast attributes of the result table and send them row-wise
   static void send_query_response(
       const std::shared_ptr<const Table>& table,
-      const std::shared_ptr<PostgresProtocolHandler<SocketType>>& postgres_protocol_handler);
+      const std::shared_ptr<PostgresProtocolHandler<SocketType>>& postgres_protocol_handler,
+      const std::vector<PostgresFormatCode>& result_format_codes = {});
+
+  // Like send_query_response, but sends at most row_limit rows (0 means no limit), starting at position. Afterwards,
+  // position points to the first row that was not sent, or to RowID{table->chunk_count(), ChunkOffset{0}} if all rows
+  // were sent. Returns the number of sent rows. Used for portals that are executed with a row limit and suspended.
+  template <typename SocketType>
+  static uint64_t send_query_response_rows(
+      const std::shared_ptr<const Table>& table,
+      const std::shared_ptr<PostgresProtocolHandler<SocketType>>& postgres_protocol_handler,
+      const std::vector<PostgresFormatCode>& result_format_codes, RowID& position, const uint64_t row_limit);
 
   // Build completion message after query execution containing the statement type and the number of rows affected
   static std::string build_command_complete_message(const ExecutionInformation& execution_information,
                                                     const uint64_t row_count);
   static std::string build_command_complete_message(const OperatorType root_operator_type, const uint64_t row_count);
+
+  // Returns the format of the given column according to the format codes of a Bind message
+  static PostgresFormatCode format_code(const std::vector<PostgresFormatCode>& result_format_codes,
+                                        const ColumnID column_id, const ColumnCount column_count);
 };
 
 }  // namespace hyrise
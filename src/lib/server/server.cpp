@@ -27,10 +27,31 @@ void Server::run() {
   // Set caches
   Hyrise::get().default_pqp_cache = std::make_shared<SQLPhysicalPlanCache>();
   Hyrise::get().default_lqp_cache = std::make_shared<SQLLogicalPlanCache>();
+  Hyrise::get().default_prepared_plan_cache = std::make_shared<SQLPreparedPlanCache>();
+  Hyrise::get().default_parameterized_plan_cache = std::make_shared<SQLParameterizedPlanCache>();
 
   _is_initialized = true;
   _accept_new_session();
+
+  // The calling thread is one of the I/O threads.
+  for (auto thread_id = uint32_t{1}; thread_id < IO_THREAD_COUNT; ++thread_id) {
+    _io_threads.emplace_back([&, thread_id]() {
+      const auto thread_name = "server_io_" + std::to_string(thread_id);
+#ifdef __APPLE__
+      pthread_setname_np(thread_name.c_str());
+#elif __linux__
+      pthread_setname_np(pthread_self(), thread_name.c_str());
+#endif
+      _io_service.run();
+    });
+  }
+
   _io_service.run();
+
+  for (auto& io_thread : _io_threads) {
+    io_thread.join();
+  }
+  _io_threads.clear();
 }
 
 void Server::_accept_new_session() {
@@ -45,30 +66,12 @@ void Server::_accept_new_session() {
 void Server::_start_session(const std::shared_ptr<Session>& new_session, const boost::system::error_code& error) {
   Assert(!error, error.message());
 
-  std::thread session_thread([session = new_session, &num_running_sessions = this->_num_running_sessions]() mutable {
-    const std::string thread_name = "server_p_" + std::to_string(session->socket()->remote_endpoint().port());
-#ifdef __APPLE__
-    pthread_setname_np(thread_name.c_str());
-#elif __linux__
-    pthread_setname_np(pthread_self(), thread_name.c_str());
-#endif
-
-    ++num_running_sessions;
-
-    session->run();
-
-    // Destroy the session before reducing the number of running sessions. This makes sure that the server has not shut
-    // down yet. In case session.use_count is not yet zero, this makes sure that the destructor is not called in
-    // the detached thread.
-    session.reset();
-    --num_running_sessions;
-  });
+  // We ensure that all sessions are closed before the server is shut down by tracking the number of running sessions.
+  // The session does not occupy a thread while it waits for messages. Thus, the number of sessions is not limited by
+  // the number of threads.
+  ++_num_running_sessions;
+  new_session->start([&num_running_sessions = _num_running_sessions]() { --num_running_sessions; });
 
-  // We ensure that all threads are completed before the server is shut down by tracking the number of running threads
-  // in _num_running_sessions. The alternative would be to store the std::thread objects in some kind of data structure
-  // and call join() on all of them before shutting down the server. This would result in a growing number of completed
-  // threads waiting to be joined and the need for a cleanup procedure.
-  session_thread.detach();
   _accept_new_session();
 }
 
@@ -1,5 +1,8 @@
 #pragma once
 
+#include <thread>
+#include <vector>
+
 #include <boost/asio/io_service.hpp>
 #include <boost/asio/ip/tcp.hpp>
 
@@ -10,9 +13,13 @@ namespace hyrise {
 
 /* In the following a short description of the classes used for the server implementation.
 
-*  Server - Opens and binds a server socket. Starts a new session per client.
+*  Server - Opens and binds a server socket. Starts a new session per client. A small, fixed number of I/O threads
+*           handles the network events of all sessions.
 *  Session - Creates a data socket for client server communication. It is responsible for the message flow and holds
-*            session-specific data.
+*            session-specific data. The socket is only read and written asynchronously, queries are executed and their
+*            results serialized on the scheduler's workers.
+*  MessageStream - In-memory stream between the socket and the PostgresProtocolHandler. It holds complete received
+*                  messages and the serialized responses.
 *  PostgresProtocolHandler - This class operates on the message level. It serializes and de-serializes information from
 *                            messages.
 *  PostgresMessageTypes - Set of different message types supported by Hyrise.
@@ -29,6 +36,11 @@ namespace hyrise {
 
 class Server {
  public:
+  // Number of threads that run the io_service, i.e., that accept connections, read messages, and send responses. As all
+  // socket operations are asynchronous, these threads never wait for a client. The queries themselves are executed on
+  // the workers of the scheduler.
+  static constexpr auto IO_THREAD_COUNT = uint32_t{2};
+
   Server(const boost::asio::ip::address& address, const uint16_t port, const SendExecutionInfo send_execution_info);
 
   // Start server to accept new sessions.
@@ -53,6 +65,7 @@ class Server {
 
   std::atomic_uint64_t _num_running_sessions{0};
   boost::asio::io_service _io_service;
+  std::vector<std::thread> _io_threads;
   boost::asio::ip::tcp::acceptor _acceptor;
   const SendExecutionInfo _send_execution_info;
   std::atomic_bool _is_initialized{false};
@@ -1,149 +1,315 @@
 #include "session.hpp"
 
+#include <algorithm>
+#include <atomic>
+#include <iterator>
+#include <optional>
+#include <stdexcept>
+#include <string>
+#include <utility>
+
+#include <boost/asio/post.hpp>
+#include <boost/asio/write.hpp>
+
 #include "client_disconnect_exception.hpp"
 #include "postgres_message_type.hpp"
 #include "query_handler.hpp"
 #include "result_serializer.hpp"
+#include "scheduler/job_task.hpp"
+
+namespace {
+
+std::atomic_uint64_t next_session_id{0};
+
+}  // namespace
 
 namespace hyrise {
 
 Session::Session(boost::asio::io_service& io_service, const SendExecutionInfo send_execution_info)
     : _socket(std::make_shared<Socket>(io_service)),
-      _postgres_protocol_handler(std::make_shared<PostgresProtocolHandler<Socket>>(_socket)),
-      _send_execution_info(send_execution_info) {}
+      _message_stream(std::make_shared<MessageStream>()),
+      _postgres_protocol_handler(std::make_shared<PostgresProtocolHandler<MessageStream>>(_message_stream)),
+      _send_execution_info(send_execution_info),
+      _session_id(next_session_id++) {}
 
 std::shared_ptr<Socket> Session::socket() {
   return _socket;
 }
 
-void Session::run() {
+void Session::start(const std::function<void()>& on_close) {
+  _on_close = on_close;
   // Set TCP_NODELAY in order to disable Nagle's algorithm. It handles congestion control in TCP networks. Therefore,
   // small packets are buffered and sent out later as one large packet. This might introduce a delay of up to 40 ms
   // which we have to avoid. Further reading: https://howdoesinternetwork.com/2015/nagles-algorithm
   _socket->set_option(boost::asio::ip::tcp::no_delay(true));
-  _establish_connection();
-  while (!_terminate_session) {
+  _receive_requests();
+}
+
+void Session::_receive_requests() {
+  _socket->async_read_some(
+      boost::asio::buffer(_receive_buffer),
+      [session = shared_from_this()](const boost::system::error_code& error, const size_t bytes_received) {
+        if (error) {
+          session->_close();
+          return;
+        }
+
+        session->_message_stream->append_received_data(session->_receive_buffer.data(), bytes_received);
+
+        // Wait for the rest of a message that was received only partially.
+        if (!session->_has_received_request()) {
+          session->_receive_requests();
+          return;
+        }
+
+        session->_process_requests();
+      });
+}
+
+bool Session::_has_received_request() const {
+  return _postgres_protocol_handler->has_received_data() || _message_stream->readable_byte_count() > 0;
+}
+
+void Session::_process_requests() {
+  try {
+    while (!_connection_established && _has_received_request()) {
+      _establish_connection();
+    }
+
+    // Messages are usually sent in groups (e.g., Parse, Bind, Describe, Execute, and Sync). Process all messages that
+    // were received completely.
+    while (_connection_established && !_terminate_session && _has_received_request()) {
+      auto execution = RequestExecution{};
+      try {
+        execution = _handle_request();
+      } catch (const ClientDisconnectException& /* exception */) {
+        throw;
+      } catch (const std::exception& e) {
+        _send_error(e.what());
+      }
+
+      if (execution) {
+        _execute(std::move(execution));
+        return;
+      }
+    }
+  } catch (const ClientDisconnectException& /* exception */) {
+    // Reading a malformed message fails like reading from a closed connection.
+    _terminate_session = true;
+  }
+
+  if (_terminate_session) {
+    _close();
+    return;
+  }
+
+  // Responses to pipelined messages are sent together once all received messages were processed.
+  _send_responses();
+}
+
+void Session::_send_responses() {
+  _postgres_protocol_handler->force_flush();
+  const auto responses = std::make_shared<std::vector<char>>(_message_stream->take_written_data());
+  if (responses->empty()) {
+    _receive_requests();
+    return;
+  }
+
+  // A client that does not read its responses only delays this write. The I/O threads keep serving other sessions.
+  boost::asio::async_write(*_socket, boost::asio::buffer(*responses),
+                           [session = shared_from_this(), responses](const boost::system::error_code& error,
+                                                                     const size_t /* bytes_sent */) {
+                             if (error) {
+                               session->_close();
+                               return;
+                             }
+
+                             session->_receive_requests();
+                           });
+}
+
+void Session::_execute(RequestExecution execution) {
+  // The session does not process other messages until the request is done. Thus, the session's state is never
+  // accessed concurrently.
+  const auto task = std::make_shared<JobTask>([session = shared_from_this(), execution = std::move(execution)]() {
+    auto send_response = std::function<void()>{};
+    auto error_message = std::optional<std::string>{};
     try {
-      _handle_request();
-    } catch (const ClientDisconnectException& /* exception */) {
-      return;
+      send_response = execution();
     } catch (const std::exception& e) {
-      std::cerr << "Exception in session with client port " << _socket->remote_endpoint().port() << ":" << std::endl
-                << e.what() << std::endl;
-      const auto error_messages = ErrorMessages{{PostgresMessageType::HumanReadableError, e.what()}};
-      _postgres_protocol_handler->send_error_message(error_messages);
-      _postgres_protocol_handler->send_ready_for_query();
-      // In case of an error, an error message has to be send to the client followed by a "ReadyForQuery" message.
-      // Messages that have already been received are processed further. A "sync" message makes the server send another
-      // "ReadyForQuery" message. In order to avoid this, we set this flag for further operations. As soon as a new
-      // query arrives it must be set to false again to ensure correct message flow.
-      _sync_send_after_error = true;
+      error_message = e.what();
     }
+
+    // Serializing the result only writes to the MessageStream. Thus, it is done on the worker as well.
+    session->_send_response(send_response, error_message);
+    boost::asio::post(session->_socket->get_executor(), [session]() { session->_process_requests(); });
+  });
+  task->schedule();
+}
+
+void Session::_send_response(const std::function<void()>& send_response,
+                             const std::optional<std::string>& error_message) {
+  try {
+    // Responses that were held back until the pending rows were inserted precede the response to this request.
+    for (const auto& send_released_response : std::exchange(_released_responses, {})) {
+      send_released_response();
+    }
+
+    if (error_message) {
+      _send_error(*error_message);
+    } else {
+      send_response();
+    }
+  } catch (const std::exception& e) {
+    _send_error(e.what());
+  }
+}
+
+void Session::_send_error(const std::string& error_message) {
+  // Rows that were collected but not inserted yet are discarded together with the deferred responses. For the client,
+  // the error occurred at the first of these rows.
+  _pending_insert_rows = nullptr;
+  _deferred_responses.clear();
+
+  // The client might have closed the connection already. Then, the port is reported as 0.
+  auto endpoint_error = boost::system::error_code{};
+  const auto endpoint = _socket->remote_endpoint(endpoint_error);
+  std::cerr << "Exception in session with client port " << endpoint.port() << ":" << std::endl
+            << error_message << std::endl;
+  const auto error_messages = ErrorMessages{{PostgresMessageType::HumanReadableError, error_message}};
+  _postgres_protocol_handler->send_error_message(error_messages);
+  _postgres_protocol_handler->send_ready_for_query();
+  // In case of an error, an error message has to be send to the client followed by a "ReadyForQuery" message.
+  // Messages that have already been received are processed further. A "sync" message makes the server send another
+  // "ReadyForQuery" message. In order to avoid this, we set this flag for further operations. As soon as a new query
+  // arrives it must be set to false again to ensure correct message flow.
+  _sync_send_after_error = true;
+}
+
+void Session::_close() {
+  auto error = boost::system::error_code{};
+  _socket->close(error);
+  if (_on_close) {
+    // Reset _on_close before calling it, so the session is not reported as closed twice.
+    const auto on_close = std::exchange(_on_close, nullptr);
+    on_close();
   }
 }
 
 void Session::_establish_connection() {
-  const auto body_length = _postgres_protocol_handler->read_startup_packet_header();
+  // After denying an SSL request, the client sends the actual startup packet once it received the denial.
+  const auto body_length = _postgres_protocol_handler->try_read_startup_packet_header();
+  if (!body_length) {
+    return;
+  }
 
   // Currently, the information available in the start up packet body (such as db name, user name) is ignored
-  _postgres_protocol_handler->read_startup_packet_body(body_length);
+  _postgres_protocol_handler->read_startup_packet_body(*body_length);
   _postgres_protocol_handler->send_authentication_response();
   _postgres_protocol_handler->send_parameter("server_version", "12");
   _postgres_protocol_handler->send_parameter("server_encoding", "UTF8");
   _postgres_protocol_handler->send_parameter("client_encoding", "UTF8");
   _postgres_protocol_handler->send_parameter("DateStyle", "ISO, DMY");
   _postgres_protocol_handler->send_ready_for_query();
+  _connection_established = true;
 }
 
-void Session::_handle_request() {
+Session::RequestExecution Session::_handle_request() {
   const auto header = _postgres_protocol_handler->read_packet_type();
 
   switch (header) {
     case PostgresMessageType::TerminateCommand: {
       _terminate_session = true;
-      break;
+      return {};
     }
     case PostgresMessageType::SimpleQueryCommand: {
       _sync_send_after_error = false;
-      _handle_simple_query();
-      break;
+      return _handle_simple_query();
     }
     case PostgresMessageType::ParseCommand: {
       _sync_send_after_error = false;
-      _handle_parse_command();
-      break;
+      return _handle_parse_command();
     }
     case PostgresMessageType::SyncCommand: {
       if (!_sync_send_after_error) {
-        _sync();
-      } else {
-        _postgres_protocol_handler->read_sync_packet();
+        return _sync();
       }
-      break;
+      _postgres_protocol_handler->read_sync_packet();
+      return {};
     }
     case PostgresMessageType::BindCommand: {
       _sync_send_after_error = false;
-      _handle_bind_command();
-      break;
+      return _handle_bind_command();
     }
     case PostgresMessageType::DescribeCommand: {
       // The contents of this packet are not used for further processing. The actual "describe" happens after
       // executing the PQP.
       _postgres_protocol_handler->read_describe_packet();
-      break;
+      return {};
     }
     case PostgresMessageType::ExecuteCommand: {
-      _handle_execute();
-      break;
+      return _handle_execute();
+    }
+    case PostgresMessageType::FlushCommand: {
+      return _handle_flush();
     }
     default:
       Fail("Unknown packet type");
   }
 }
 
-void Session::_handle_simple_query() {
-  const auto& query = _postgres_protocol_handler->read_query_packet();
+Session::RequestExecution Session::_handle_simple_query() {
+  const auto query = _postgres_protocol_handler->read_query_packet();
 
-  // A simple query command invalidates unnamed portals
-  _portals.erase("");
+  return [this, query]() -> std::function<void()> {
+    // A simple query command invalidates unnamed portals
+    _portals.erase("");
 
-  ExecutionInformation execution_information;
+    _insert_pending_rows();
 
-  std::tie(execution_information, _transaction_context) =
-      QueryHandler::execute_pipeline(query, _send_execution_info, _transaction_context);
+    auto execution_information = ExecutionInformation{};
+    std::tie(execution_information, _transaction_context) =
+        QueryHandler::execute_pipeline(query, _send_execution_info, _transaction_context, _session_id);
 
-  if (!execution_information.error_messages.empty()) {
-    _postgres_protocol_handler->send_error_message(execution_information.error_messages);
-  } else {
-    uint64_t row_count = 0;
-    // If there is no result table, e.g. after an INSERT command, we cannot send row data. Otherwise, the result table
-    // of the last statement will be send back.
-    if (execution_information.result_table) {
-      ResultSerializer::send_table_description(execution_information.result_table, _postgres_protocol_handler);
-      ResultSerializer::send_query_response(execution_information.result_table, _postgres_protocol_handler);
-      row_count = execution_information.result_table->row_count();
-    }
-    if (_send_execution_info == SendExecutionInfo::Yes) {
-      _postgres_protocol_handler->send_execution_info(execution_information.pipeline_metrics);
-    }
-    _postgres_protocol_handler->send_command_complete(
-        ResultSerializer::build_command_complete_message(execution_information, row_count));
-  }
+    return [this, execution_information = std::move(execution_information)]() {
+      if (!execution_information.error_messages.empty()) {
+        _postgres_protocol_handler->send_error_message(execution_information.error_messages);
+      } else {
+        uint64_t row_count = 0;
+        // If there is no result table, e.g. after an INSERT command, we cannot send row data. Otherwise, the result
+        // table of the last statement will be send back.
+        if (execution_information.result_table) {
+          ResultSerializer::send_table_description(execution_information.result_table, _postgres_protocol_handler);
+          ResultSerializer::send_query_response(execution_information.result_table, _postgres_protocol_handler);
+          row_count = execution_information.result_table->row_count();
+        }
+        if (_send_execution_info == SendExecutionInfo::Yes) {
+          _postgres_protocol_handler->send_execution_info(execution_information.pipeline_metrics);
+        }
+        _postgres_protocol_handler->send_command_complete(
+            ResultSerializer::build_command_complete_message(execution_information, row_count));
+      }
 
-  _postgres_protocol_handler->send_ready_for_query();
+      _postgres_protocol_handler->send_ready_for_query();
+    };
+  };
 }
 
-void Session::_handle_parse_command() {
-  const auto [statement_name, query] = _postgres_protocol_handler->read_parse_packet();
-  QueryHandler::setup_prepared_plan(statement_name, query);
+Session::RequestExecution Session::_handle_parse_command() {
+  auto [statement_name, query] = _postgres_protocol_handler->read_parse_packet();
 
-  _postgres_protocol_handler->send_status_message(PostgresMessageType::ParseComplete);
+  return [this, statement_name = std::move(statement_name), query = std::move(query)]() -> std::function<void()> {
+    QueryHandler::setup_prepared_plan(statement_name, query);
 
-  // Ready for query + flush will be done after reading sync message
+    // Ready for query + flush will be done after reading sync message
+    return [this]() {
+      _send_or_defer([this]() { _postgres_protocol_handler->send_status_message(PostgresMessageType::ParseComplete); });
+    };
+  };
 }
 
-void Session::_handle_bind_command() {
-  const auto parameters = _postgres_protocol_handler->read_bind_packet();
+Session::RequestExecution Session::_handle_bind_command() {
+  auto parameters = _postgres_protocol_handler->read_bind_packet();
 
   // Named portals must be explicitly closed before they can be redefined by another Bind message,
   // but this is not required for the unnamed portal.
@@ -155,65 +321,220 @@ void Session::_handle_bind_command() {
   }
 
   // Since bind and execute packet usually arrive together, we still have to handle the execute packet. Therefore,
-  // we first store a nullptr in the portals map to signalize an error. However, if binding succeeds in the next step
-  // this nullptr gets replaced by the correct pqp. Before executing the prepared statement we make a check for errors.
-  _portals.emplace(parameters.portal, nullptr);
-
-  const auto pqp = QueryHandler::bind_prepared_plan(parameters);
+  // we first store a portal without a pqp to signalize an error. However, if binding succeeds in the next step, this
+  // portal gets replaced by one with the correct pqp. Before executing the prepared statement we check for errors.
+  _portals.emplace(parameters.portal, Portal{});
+
+  return [this, parameters = std::move(parameters)]() -> std::function<void()> {
+    auto portal = Portal{};
+    portal.result_format_codes = parameters.result_format_codes;
+    portal.insert_row = QueryHandler::bind_insert_values(parameters);
+    if (!portal.insert_row) {
+      portal.physical_plan = QueryHandler::bind_prepared_plan(parameters);
+    }
 
-  _portals[parameters.portal] = pqp;
-  _postgres_protocol_handler->send_status_message(PostgresMessageType::BindComplete);
+    _portals[parameters.portal] = std::move(portal);
 
-  // Ready for query + flush will be done after reading sync message
+    // Ready for query + flush will be done after reading sync message
+    return [this]() {
+      _send_or_defer([this]() { _postgres_protocol_handler->send_status_message(PostgresMessageType::BindComplete); });
+    };
+  };
 }
 
-void Session::_sync() {
+Session::RequestExecution Session::_sync() {
   _postgres_protocol_handler->read_sync_packet();
-  if (_transaction_context) {
-    _transaction_context->commit();
-    _transaction_context.reset();
-  }
-  _postgres_protocol_handler->send_ready_for_query();
+
+  return [this]() -> std::function<void()> {
+    try {
+      _insert_pending_rows();
+    } catch (const std::exception& e) {
+      // The transaction was rolled back. Instead of the completion of the inserted rows, the client receives the error,
+      // followed by the "ReadyForQuery" message this Sync message asks for.
+      return [this, error_message = std::string{e.what()}]() {
+        _send_error(error_message);
+        _sync_send_after_error = false;
+      };
+    }
+
+    if (_transaction_context) {
+      _transaction_context->commit();
+      _transaction_context.reset();
+    }
+
+    return [this]() { _postgres_protocol_handler->send_ready_for_query(); };
+  };
 }
 
-void Session::_handle_execute() {
-  const std::string& portal_name = _postgres_protocol_handler->read_execute_packet();
+Session::RequestExecution Session::_handle_execute() {
+  auto [portal_name, row_limit] = _postgres_protocol_handler->read_execute_packet();
 
   auto portal_it = _portals.find(portal_name);
   AssertInput(portal_it != _portals.end(), "The specified portal does not exist.");
+  auto& portal = portal_it->second;
 
   // In case of an error occured during binding there is no pqp available. Hence, early return here since there is
   // nothing to execute.
-  if (!portal_it->second) {
+  if (!portal.physical_plan && !portal.insert_row) {
     _portals.erase(portal_it);
-    return;
+    return {};
+  }
+
+  if (portal.insert_row) {
+    const auto& table_name = portal.insert_row->first;
+    if (_pending_insert_rows && _pending_insert_table_name != table_name) {
+      // Inserting the collected rows requires the scheduler. The row of this portal is collected afterwards.
+      return [this, portal_name = std::move(portal_name)]() -> std::function<void()> {
+        _insert_pending_rows();
+        _collect_insert_row(portal_name);
+        return [] {};
+      };
+    }
+
+    _collect_insert_row(portal_name);
+    return {};
   }
 
-  const auto physical_plan = portal_it->second;
+  // The plan of a suspended portal was already executed. Only its remaining rows are sent. Pending rows have to be
+  // inserted first so that their completion is sent before.
+  if (portal.result_table && !_pending_insert_rows) {
+    _send_portal_rows(portal_name, row_limit);
+    return {};
+  }
+
+  return [this, portal_name = std::move(portal_name), row_limit = row_limit]() -> std::function<void()> {
+    // Other statements have to see the rows inserted before.
+    _insert_pending_rows();
+
+    auto& portal = _portals.at(portal_name);
+    if (portal.result_table) {
+      return [this, portal_name, row_limit]() { _send_portal_rows(portal_name, row_limit); };
+    }
+
+    if (!_transaction_context) {
+      _transaction_context = Hyrise::get().transaction_manager.new_transaction_context(AutoCommit::No);
+    }
+    portal.physical_plan->set_transaction_context_recursively(_transaction_context);
+    portal.result_table = QueryHandler::execute_prepared_plan(portal.physical_plan, _session_id);
+
+    return [this, portal_name, row_limit]() {
+      auto portal_it = _portals.find(portal_name);
+      auto& portal = portal_it->second;
+
+      // If there is no result table, e.g. after an INSERT command, we cannot send row data
+      if (!portal.result_table) {
+        _postgres_protocol_handler->send_status_message(PostgresMessageType::NoDataResponse);
+        _postgres_protocol_handler->send_command_complete(
+            ResultSerializer::build_command_complete_message(portal.physical_plan->type(), 0));
+        if (portal_name.empty()) {
+          _portals.erase(portal_it);
+        }
+        // Ready for query + flush will be done after reading sync message
+        return;
+      }
+
+      ResultSerializer::send_table_description(portal.result_table, _postgres_protocol_handler,
+                                               portal.result_format_codes);
+      _send_portal_rows(portal_name, row_limit);
+    };
+  };
+}
+
+void Session::_send_portal_rows(const std::string& portal_name, const uint32_t row_limit) {
+  auto portal_it = _portals.find(portal_name);
+  auto& portal = portal_it->second;
+
+  const auto row_count = ResultSerializer::send_query_response_rows(
+      portal.result_table, _postgres_protocol_handler, portal.result_format_codes, portal.next_row, row_limit);
+
+  if (portal.next_row.chunk_id < portal.result_table->chunk_count()) {
+    // The row limit was reached before all rows were sent. The client can fetch the remaining rows with further
+    // Execute messages for this portal.
+    _postgres_protocol_handler->send_status_message(PostgresMessageType::PortalSuspended);
+    return;
+  }
 
+  _postgres_protocol_handler->send_command_complete(
+      ResultSerializer::build_command_complete_message(portal.physical_plan->type(), row_count));
   if (portal_name.empty()) {
     _portals.erase(portal_it);
+  } else {
+    // Named portals stay until they are closed. Executing them again returns no further rows, as in PostgreSQL.
+    portal.next_row = RowID{portal.result_table->chunk_count(), ChunkOffset{0}};
+  }
+  // Ready for query + flush will be done after reading sync message
+}
+
+void Session::_collect_insert_row(const std::string& portal_name) {
+  const auto portal_it = _portals.find(portal_name);
+  const auto& [table_name, values] = *portal_it->second.insert_row;
+
+  if (!_pending_insert_rows) {
+    const auto target_table = Hyrise::get().storage_manager.get_table(table_name);
+    _pending_insert_rows = std::make_shared<Table>(target_table->column_definitions(), TableType::Data);
+    _pending_insert_table_name = table_name;
   }
+  _pending_insert_rows->append(values);
+  _portals.erase(portal_it);
 
+  _deferred_responses.emplace_back([this]() {
+    _postgres_protocol_handler->send_status_message(PostgresMessageType::NoDataResponse);
+    _postgres_protocol_handler->send_command_complete(
+        ResultSerializer::build_command_complete_message(OperatorType::Insert, 1));
+  });
+}
+
+void Session::_insert_pending_rows() {
+  if (!_pending_insert_rows) {
+    return;
+  }
+
+  const auto rows = std::exchange(_pending_insert_rows, nullptr);
   if (!_transaction_context) {
     _transaction_context = Hyrise::get().transaction_manager.new_transaction_context(AutoCommit::No);
   }
-  physical_plan->set_transaction_context_recursively(_transaction_context);
 
-  const auto result_table = QueryHandler::execute_prepared_plan(physical_plan);
+  try {
+    QueryHandler::execute_insert(_pending_insert_table_name, rows, _transaction_context, _session_id);
+    // If the Insert fails, e.g., because of a unique constraint, its OperatorTask rolls back the transaction.
+    if (_transaction_context->aborted()) {
+      throw std::runtime_error(
+          "Transaction conflict, transaction was rolled back. Failed statement: INSERT INTO " +
+          _pending_insert_table_name);
+    }
+  } catch (const std::exception& /* exception */) {
+    _deferred_responses.clear();
+    if (_transaction_context->phase() == TransactionPhase::Active) {
+      _transaction_context->rollback(RollbackReason::User);
+    }
+    _transaction_context.reset();
+    throw;
+  }
 
-  uint64_t row_count = 0;
-  // If there is no result table, e.g. after an INSERT command, we cannot send row data
-  if (result_table) {
-    ResultSerializer::send_table_description(result_table, _postgres_protocol_handler);
-    ResultSerializer::send_query_response(result_table, _postgres_protocol_handler);
-    row_count = result_table->row_count();
-  } else {
-    _postgres_protocol_handler->send_status_message(PostgresMessageType::NoDataResponse);
+  std::move(_deferred_responses.begin(), _deferred_responses.end(), std::back_inserter(_released_responses));
+  _deferred_responses.clear();
+}
+
+void Session::_send_or_defer(std::function<void()> send_response) {
+  if (_pending_insert_rows) {
+    _deferred_responses.emplace_back(std::move(send_response));
+    return;
   }
 
-  _postgres_protocol_handler->send_command_complete(
-      ResultSerializer::build_command_complete_message(physical_plan->type(), row_count));
-  // Ready for query + flush will be done after reading sync message
+  send_response();
+}
+
+Session::RequestExecution Session::_handle_flush() {
+  _postgres_protocol_handler->read_flush_packet();
+  if (!_pending_insert_rows) {
+    _postgres_protocol_handler->force_flush();
+    return {};
+  }
+
+  // The collected rows are inserted so that their completion can be sent.
+  return [this]() -> std::function<void()> {
+    _insert_pending_rows();
+    return [this]() { _postgres_protocol_handler->force_flush(); };
+  };
 }
 }  // namespace hyrise
@@ -1,57 +1,152 @@
 #pragma once
 
+#include <array>
+#include <functional>
+#include <memory>
+#include <optional>
+#include <string>
+#include <utility>
+#include <vector>
+
 #include "concurrency/transaction_context.hpp"
+#include "message_stream.hpp"
 #include "operators/abstract_operator.hpp"
 #include "postgres_protocol_handler.hpp"
 #include "scheduler/operator_task.hpp"
 
 namespace hyrise {
 
+// A bound prepared statement. If an Execute message limits the number of rows to return, the portal is suspended: it
+// keeps the result table and the position of the next row to send. For plain `INSERT INTO ... VALUES` statements,
+// the portal holds the target table and the row to insert instead of a physical plan (see
+// QueryHandler::bind_insert_values). If binding failed, the portal has neither.
+struct Portal {
+  std::shared_ptr<AbstractOperator> physical_plan;
+  std::vector<PostgresFormatCode> result_format_codes;
+  std::shared_ptr<const Table> result_table;
+  RowID next_row{ChunkID{0}, ChunkOffset{0}};
+  std::optional<std::pair<std::string, std::vector<AllTypeVariant>>> insert_row;
+};
+
 // The session class implements the communication flow and stores session-specific information such as portals. Those
 // portals are required by the PostgreSQL message protocol for the execution of prepared statements. However, named
 // portals used for CURSOR operations are currently not supported by Hyrise. For further documentation see here:
 // https://www.postgresql.org/docs/12/protocol-overview.html#PROTOCOL-QUERY-CONCEPTS
 // Example usage can be found here: https://stackoverflow.com/questions/52479293/postgresql-refcursor-and-portal-name
-class Session {
+//
+// Sessions do not own a thread, and no thread ever waits for the network on behalf of a session. The socket is only
+// read and written asynchronously on the server's io_service. Received data is buffered in a MessageStream, and
+// requests are only processed once they were received completely. Their responses are written into the MessageStream
+// and sent with a single asynchronous write. Requests that execute queries are handed to the scheduler as a JobTask,
+// which also serializes the result. Thus, neither many connections nor slow clients (e.g., ones that do not read their
+// results) occupy the server's I/O threads or the scheduler's workers.
+class Session : public std::enable_shared_from_this<Session> {
  public:
   explicit Session(boost::asio::io_service& io_service, const SendExecutionInfo send_execution_info);
 
-  // Start new session.
-  void run();
+  // Start new session. on_close is called once the connection is closed.
+  void start(const std::function<void()>& on_close);
 
   std::shared_ptr<Socket> socket();
 
  private:
-  // Establish new connection by exchanging parameters.
+  // The part of a request that runs on a scheduler worker. It returns the function that writes the response into the
+  // MessageStream, which is called on the worker as well.
+  using RequestExecution = std::function<std::function<void()>()>;
+
+  // Receive data from the client asynchronously until at least one message is complete, then process the messages.
+  void _receive_requests();
+
+  // Returns true if a complete message was received that has not been processed yet.
+  bool _has_received_request() const;
+
+  // Process all messages that were received completely, then send the responses or close the session. Stops early if
+  // a request's execution is handed to the scheduler, which continues processing once the request is done.
+  void _process_requests();
+
+  // Send the responses written so far asynchronously, then receive further requests.
+  void _send_responses();
+
+  // Run @param execution on a scheduler worker, write its response, and continue processing further messages on an I/O
+  // thread.
+  void _execute(RequestExecution execution);
+
+  // Write the response of an executed request or, if it failed, @param error_message.
+  void _send_response(const std::function<void()>& send_response, const std::optional<std::string>& error_message);
+
+  // Send an error message followed by "ReadyForQuery".
+  void _send_error(const std::string& error_message);
+
+  void _close();
+
+  // Establish new connection by exchanging parameters. If the client requested SSL, the request is denied and the
+  // connection is established with the next startup packet.
   void _establish_connection();
 
-  // Determine message and call the appropriate method.
-  void _handle_request();
+  // Determine message and call the appropriate method. The handlers read their message and return the work that has
+  // to be done on the scheduler, if any.
+  RequestExecution _handle_request();
 
   // Execute plain SQL statement.
-  void _handle_simple_query();
+  RequestExecution _handle_simple_query();
 
   // Parse prepared statement.
-  void _handle_parse_command();
+  RequestExecution _handle_parse_command();
 
   // Bind prepared statement.
-  void _handle_bind_command();
+  RequestExecution _handle_bind_command();
 
   // Read describe message. Row description will be send after execution.
   void _handle_describe();
 
-  // Execute prepared statement and send row description.
-  void _handle_execute();
+  // Execute prepared statement and send row description. With a row limit, the portal may be suspended.
+  RequestExecution _handle_execute();
+
+  // Send out buffered messages, e.g., the rows of a suspended portal, without waiting for a sync message.
+  RequestExecution _handle_flush();
+
+  // Send the rows of an executed portal, at most @param row_limit (0 for all).
+  void _send_portal_rows(const std::string& portal_name, const uint32_t row_limit);
+
+  // Append the row of an INSERT INTO ... VALUES portal to the pending rows and close the portal. The row is
+  // acknowledged once it was inserted.
+  void _collect_insert_row(const std::string& portal_name);
+
+  // Insert the rows collected from executions of INSERT INTO ... VALUES statements with a single Insert operator. On
+  // success, the responses deferred until then are released. On failure, they are dropped, the transaction is rolled
+  // back, and the error is thrown.
+  void _insert_pending_rows();
+
+  // Send @param send_response right away or, while rows are pending, once they were inserted.
+  void _send_or_defer(std::function<void()> send_response);
 
   // Commit current transaction.
-  void _sync();
+  RequestExecution _sync();
 
   const std::shared_ptr<Socket> _socket;
-  const std::shared_ptr<PostgresProtocolHandler<Socket>> _postgres_protocol_handler;
+  const std::shared_ptr<MessageStream> _message_stream;
+  const std::shared_ptr<PostgresProtocolHandler<MessageStream>> _postgres_protocol_handler;
+  std::array<char, SERVER_BUFFER_SIZE> _receive_buffer;
   const SendExecutionInfo _send_execution_info;
+  // Attached to the tasks of all queries issued by this session (see TaskContext).
+  const uint64_t _session_id;
+  std::function<void()> _on_close;
+  bool _connection_established = false;
   bool _terminate_session = false;
   bool _sync_send_after_error = false;
   std::shared_ptr<TransactionContext> _transaction_context;
-  std::unordered_map<std::string, std::shared_ptr<AbstractOperator>> _portals;
+  std::unordered_map<std::string, Portal> _portals;
+
+  // JDBC clients send batches of inserts as a sequence of Bind and Execute messages for the same statement. Instead of
+  // optimizing and executing a plan for each of them, their rows are collected and inserted at once before the next
+  // other statement is executed or the transaction is committed.
+  std::string _pending_insert_table_name;
+  std::shared_ptr<Table> _pending_insert_rows;
+
+  // Responses must be sent in the order of the messages. Thus, the responses to the collected rows and to all messages
+  // after them are deferred until the rows were inserted, so that the client is never told about an insert that has
+  // not happened yet. Released responses are sent before the response to the message that triggered the insert.
+  std::vector<std::function<void()>> _deferred_responses;
+  std::vector<std::function<void()>> _released_responses;
 };
 }  // namespace hyrise
@@ -1,6 +1,7 @@
 #include "write_buffer.hpp"
 
 #include "client_disconnect_exception.hpp"
+#include "message_stream.hpp"
 
 namespace hyrise {
 
@@ -48,9 +49,37 @@ void WriteBuffer<SocketType>::put_string(const std::string& value, const HasNull
   }
 }
 
+template <typename SocketType>
+void WriteBuffer<SocketType>::put_bytes(const char* data, const size_t byte_count) {
+  if (byte_count < maximum_capacity() - size()) {
+    std::copy_n(data, byte_count, _current_position);
+    std::advance(_current_position, byte_count);
+    return;
+  }
+
+  // Preserve the order of the messages by sending the buffered data first.
+  if (size() > 0) {
+    flush();
+  }
+
+  if (byte_count < maximum_capacity()) {
+    std::copy_n(data, byte_count, _current_position);
+    std::advance(_current_position, byte_count);
+    return;
+  }
+
+  auto error_code = boost::system::error_code{};
+  const auto bytes_sent = boost::asio::write(*_socket, boost::asio::buffer(data, byte_count), error_code);
+  _check_write_result(error_code, bytes_sent);
+}
+
 template <typename SocketType>
 void WriteBuffer<SocketType>::flush(const size_t bytes_required) {
   Assert(bytes_required <= size(), "Cannot flush more byte than available");
+  if (size() == 0) {
+    return;
+  }
+
   const auto bytes_to_send = bytes_required ? bytes_required : size();
   size_t bytes_sent;
 
@@ -68,14 +97,20 @@ void WriteBuffer<SocketType>::flush(const size_t bytes_required) {
                                     boost::asio::transfer_at_least(bytes_to_send), error_code);
   }
 
+  _check_write_result(error_code, bytes_sent);
+
+  std::advance(_start_position, bytes_sent);
+}
+
+template <typename SocketType>
+void WriteBuffer<SocketType>::_check_write_result(const boost::system::error_code& error_code,
+                                                  const size_t bytes_sent) {
   // Socket was closed by client during execution
   if (error_code == boost::asio::error::broken_pipe || error_code == boost::asio::error::connection_reset ||
       bytes_sent == 0) {
     throw ClientDisconnectException("Write operation failed. Client closed connection.");
   }
   Assert(!error_code, error_code.message());
-
-  std::advance(_start_position, bytes_sent);
 }
 
 template <typename SocketType>
@@ -85,7 +120,7 @@ void WriteBuffer<SocketType>::_flush_if_necessary(const size_t bytes_required) {
   }
 }
 
-template class WriteBuffer<Socket>;
+template class WriteBuffer<MessageStream>;
 template class WriteBuffer<boost::asio::posix::stream_descriptor>;
 
 }  // namespace hyrise
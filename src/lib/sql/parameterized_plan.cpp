@@ -0,0 +1,417 @@
+#include "parameterized_plan.hpp"
+
+#include <algorithm>
+#include <cctype>
+#include <charconv>
+#include <cstdlib>
+#include <limits>
+#include <unordered_map>
+#include <unordered_set>
+#include <utility>
+
+#include <boost/algorithm/string.hpp>
+
+#include "SQLParser.h"
+#include "constant_mappings.hpp"
+#include "cost_estimation/cost_estimator_calibrated.hpp"
+#include "expression/correlated_parameter_expression.hpp"
+#include "expression/expression_functional.hpp"
+#include "expression/expression_utils.hpp"
+#include "expression/lqp_subquery_expression.hpp"
+#include "expression/placeholder_expression.hpp"
+#include "hyrise.hpp"
+#include "logical_query_plan/abstract_lqp_node.hpp"
+#include "logical_query_plan/lqp_translator.hpp"
+#include "logical_query_plan/lqp_utils.hpp"
+#include "logical_query_plan/predicate_node.hpp"
+#include "logical_query_plan/stored_table_node.hpp"
+#include "operators/abstract_operator.hpp"
+#include "optimizer/optimizer.hpp"
+#include "optimizer/strategy/chunk_pruning_rule.hpp"
+#include "optimizer/strategy/index_scan_rule.hpp"
+#include "sql/sql_translator.hpp"
+#include "statistics/cardinality_estimator.hpp"
+#include "statistics/table_statistics.hpp"
+#include "storage/prepared_plan.hpp"
+#include "utils/assert.hpp"
+
+namespace {
+
+using namespace hyrise;                         // NOLINT
+using namespace hyrise::expression_functional;  // NOLINT
+
+bool is_identifier_character(const char character) {
+  return std::isalnum(static_cast<unsigned char>(character)) || character == '_';
+}
+
+// Parses the numeric literal at the beginning of @param sql. Integers are stored as int32_t if possible, just as the
+// SQLTranslator does.
+std::optional<AllTypeVariant> parse_number(const std::string_view sql, size_t& length) {
+  length = 0;
+  auto is_floating_point = false;
+  while (length < sql.size() && (std::isdigit(static_cast<unsigned char>(sql[length])) || sql[length] == '.')) {
+    is_floating_point |= sql[length] == '.';
+    ++length;
+  }
+
+  // Literals directly followed by identifiers (e.g., `1e5` or `1a`) are not parameterized.
+  if (length < sql.size() && is_identifier_character(sql[length])) {
+    return std::nullopt;
+  }
+
+  const auto literal = std::string{sql.substr(0, length)};
+  if (is_floating_point) {
+    auto* end = static_cast<char*>(nullptr);
+    const auto value = std::strtod(literal.c_str(), &end);
+    if (end != literal.c_str() + literal.size()) {
+      return std::nullopt;
+    }
+    return AllTypeVariant{value};
+  }
+
+  auto value = int64_t{0};
+  const auto [end, error] = std::from_chars(literal.data(), literal.data() + literal.size(), value);
+  if (error != std::errc{} || end != literal.data() + literal.size()) {
+    return std::nullopt;
+  }
+  if (value <= std::numeric_limits<int32_t>::max()) {
+    return AllTypeVariant{static_cast<int32_t>(value)};
+  }
+  return AllTypeVariant{value};
+}
+
+std::unordered_map<ParameterID, AllTypeVariant> parameters_for(const PreparedPlan& prepared_plan,
+                                                               const std::vector<AllTypeVariant>& literals) {
+  Assert(literals.size() == prepared_plan.parameter_ids.size(), "Expected one literal per placeholder.");
+
+  auto parameters = std::unordered_map<ParameterID, AllTypeVariant>{};
+  for (auto literal_idx = size_t{0}; literal_idx < literals.size(); ++literal_idx) {
+    parameters.emplace(prepared_plan.parameter_ids[literal_idx], literals[literal_idx]);
+  }
+  return parameters;
+}
+
+std::vector<std::shared_ptr<AbstractExpression>> value_expressions(const std::vector<AllTypeVariant>& literals) {
+  auto expressions = std::vector<std::shared_ptr<AbstractExpression>>{};
+  expressions.reserve(literals.size());
+  for (const auto& literal : literals) {
+    expressions.emplace_back(value_(literal));
+  }
+  return expressions;
+}
+
+// Returns true if a value of the predicate is one of the parameters. If so, the parameters are replaced by their
+// values.
+bool bind_parameters(OperatorScanPredicate& predicate,
+                     const std::unordered_map<ParameterID, AllTypeVariant>& parameters) {
+  auto found_parameter = false;
+  const auto bind_parameter = [&](AllParameterVariant& value) {
+    if (!is_parameter_id(value)) {
+      return;
+    }
+
+    const auto parameter_iter = parameters.find(boost::get<ParameterID>(value));
+    if (parameter_iter != parameters.end()) {
+      value = parameter_iter->second;
+      found_parameter = true;
+    }
+  };
+
+  bind_parameter(predicate.value);
+  if (predicate.value2) {
+    bind_parameter(*predicate.value2);
+  }
+  return found_parameter;
+}
+
+// Replaces the CorrelatedParameterExpressions of the placeholders with PlaceholderExpressions again so that the
+// optimized plan can be instantiated for other literals (see PreparedPlan::instantiate()). Also drops the pruned
+// chunks of StoredTableNodes, which bind() determines for the literals at hand.
+void lqp_unbind_parameters(const std::shared_ptr<AbstractLQPNode>& lqp, const std::vector<ParameterID>& parameter_ids,
+                           std::unordered_set<std::shared_ptr<AbstractLQPNode>>& visited_nodes) {
+  visit_lqp(lqp, [&](const auto& node) {
+    if (!visited_nodes.emplace(node).second) {
+      return LQPVisitation::DoNotVisitInputs;
+    }
+
+    if (node->type == LQPNodeType::StoredTable) {
+      auto& stored_table_node = static_cast<StoredTableNode&>(*node);
+      stored_table_node.set_pruned_chunk_ids({});
+      stored_table_node.table_statistics = nullptr;
+    }
+
+    for (auto& expression : node->node_expressions) {
+      visit_expression(expression, [&](auto& sub_expression) {
+        if (sub_expression->type == ExpressionType::CorrelatedParameter) {
+          const auto parameter_id = static_cast<const CorrelatedParameterExpression&>(*sub_expression).parameter_id;
+          if (std::find(parameter_ids.cbegin(), parameter_ids.cend(), parameter_id) != parameter_ids.cend()) {
+            sub_expression = std::make_shared<PlaceholderExpression>(parameter_id);
+          }
+          return ExpressionVisitation::DoNotVisitArguments;
+        }
+
+        if (sub_expression->type == ExpressionType::LQPSubquery) {
+          lqp_unbind_parameters(static_cast<const LQPSubqueryExpression&>(*sub_expression).lqp, parameter_ids,
+                                visited_nodes);
+        }
+        return ExpressionVisitation::VisitArguments;
+      });
+    }
+
+    return LQPVisitation::VisitInputs;
+  });
+}
+
+// The rules of the default optimizer (see Optimizer::create_default_optimizer()) that only consider ValueExpressions.
+std::shared_ptr<Optimizer> create_value_dependent_optimizer() {
+  const auto& cost_model_coefficients = Hyrise::get().cost_model_coefficients;
+  auto optimizer = cost_model_coefficients
+                       ? std::make_shared<Optimizer>(std::make_shared<CostEstimatorCalibrated>(
+                             std::make_shared<CardinalityEstimator>(), cost_model_coefficients))
+                       : std::make_shared<Optimizer>();
+
+  optimizer->add_rule(std::make_unique<ChunkPruningRule>());
+  optimizer->add_rule(std::make_unique<IndexScanRule>());
+  return optimizer;
+}
+
+Cardinality estimate_row_count(const std::shared_ptr<TableStatistics>& input_table_statistics,
+                               const OperatorScanPredicate& predicate) {
+  // Do not let very small estimates (e.g., for a single matching row) shrink the validity range to nothing.
+  const auto output_table_statistics =
+      CardinalityEstimator::estimate_operator_scan_predicate(input_table_statistics, predicate);
+  return std::max(Cardinality{1}, output_table_statistics->row_count);
+}
+
+}  // namespace
+
+namespace hyrise {
+
+std::optional<ParameterizedPlan::ExtractedLiterals> ParameterizedPlan::extract_literals(const std::string& sql) {
+  const auto trimmed_sql = boost::trim_copy(sql);
+  if (!boost::istarts_with(trimmed_sql, "SELECT")) {
+    return std::nullopt;
+  }
+
+  auto extracted_literals = ExtractedLiterals{};
+  auto& normalized_sql = extracted_literals.normalized_sql;
+  normalized_sql.reserve(trimmed_sql.size());
+
+  const auto sql_view = std::string_view{trimmed_sql};
+  const auto length = sql_view.size();
+  auto pending_whitespace = false;
+  auto position = size_t{0};
+  while (position < length) {
+    const auto character = sql_view[position];
+    if (std::isspace(static_cast<unsigned char>(character))) {
+      pending_whitespace = true;
+      ++position;
+      continue;
+    }
+
+    if (pending_whitespace) {
+      normalized_sql += ' ';
+      pending_whitespace = false;
+    }
+
+    // Statements with explicit placeholders are prepared statements. We also do not bother to skip comments.
+    const auto next_character = position + 1 < length ? sql_view[position + 1] : char{0};
+    if (character == '?' || (character == '-' && next_character == '-') ||
+        (character == '/' && next_character == '*')) {
+      return std::nullopt;
+    }
+
+    if (character == '"') {
+      // Quoted identifiers are copied as they are.
+      const auto end = sql_view.find('"', position + 1);
+      if (end == std::string_view::npos) {
+        return std::nullopt;
+      }
+      normalized_sql += sql_view.substr(position, end - position + 1);
+      position = end + 1;
+    } else if (character == '\'') {
+      // String literal, two consecutive quotes represent a single quote.
+      auto value = pmr_string{};
+      ++position;
+      while (true) {
+        if (position >= length) {
+          return std::nullopt;
+        }
+        if (sql_view[position] == '\'') {
+          if (position + 1 < length && sql_view[position + 1] == '\'') {
+            value += '\'';
+            position += 2;
+            continue;
+          }
+          ++position;
+          break;
+        }
+        value += sql_view[position];
+        ++position;
+      }
+      normalized_sql += '?';
+      extracted_literals.literals.emplace_back(std::move(value));
+    } else if (is_identifier_character(character) && !std::isdigit(static_cast<unsigned char>(character))) {
+      // Keywords and identifiers, which can contain digits (e.g., `table_1`).
+      const auto begin = position;
+      while (position < length && is_identifier_character(sql_view[position])) {
+        ++position;
+      }
+      normalized_sql += sql_view.substr(begin, position - begin);
+    } else if (std::isdigit(static_cast<unsigned char>(character)) ||
+               (character == '.' && std::isdigit(static_cast<unsigned char>(next_character)))) {
+      auto literal_length = size_t{0};
+      auto value = parse_number(sql_view.substr(position), literal_length);
+      if (!value) {
+        return std::nullopt;
+      }
+      normalized_sql += '?';
+      extracted_literals.literals.emplace_back(std::move(*value));
+      position += literal_length;
+    } else {
+      normalized_sql += character;
+      ++position;
+    }
+  }
+
+  while (!normalized_sql.empty() && (normalized_sql.back() == ';' || normalized_sql.back() == ' ')) {
+    normalized_sql.pop_back();
+  }
+
+  if (extracted_literals.literals.empty()) {
+    return std::nullopt;
+  }
+
+  return extracted_literals;
+}
+
+std::string ParameterizedPlan::cache_key(const ExtractedLiterals& extracted_literals, const UseMvcc use_mvcc) {
+  auto key = extracted_literals.normalized_sql;
+  key += use_mvcc == UseMvcc::Yes ? "\n(validated)" : "\n(not validated)";
+  for (const auto& literal : extracted_literals.literals) {
+    key += ' ';
+    key += data_type_to_string.left.at(data_type_from_all_type_variant(literal));
+  }
+  return key;
+}
+
+std::shared_ptr<PreparedPlan> ParameterizedPlan::prepare(const ExtractedLiterals& extracted_literals,
+                                                         const std::shared_ptr<AbstractLQPNode>& lqp,
+                                                         const UseMvcc use_mvcc) {
+  auto parse_result = hsql::SQLParserResult{};
+  hsql::SQLParser::parse(extracted_literals.normalized_sql, &parse_result);
+  if (!parse_result.isValid() || parse_result.size() != 1) {
+    return nullptr;
+  }
+
+  auto translation_result = SQLTranslationResult{};
+  try {
+    translation_result = SQLTranslator{use_mvcc}.translate_parser_result(parse_result);
+  } catch (const std::exception& /* exception */) {
+    // Some literals are part of the syntax and cannot be replaced by placeholders (e.g., `INTERVAL '3' DAY`).
+    return nullptr;
+  }
+
+  const auto& translation_info = translation_result.translation_info;
+  const auto& literals = extracted_literals.literals;
+  if (!translation_info.cacheable || translation_info.parameter_ids_of_value_placeholders.size() != literals.size()) {
+    return nullptr;
+  }
+
+  const auto prepared_plan = std::make_shared<PreparedPlan>(translation_result.lqp_nodes.at(0),
+                                                            translation_info.parameter_ids_of_value_placeholders);
+
+  // The SQLTranslator might treat literals differently than placeholders, e.g., `ORDER BY 1`. Only if the plan with
+  // the bound literals is the plan of the original statement, the parameterized plan is equivalent.
+  if (*prepared_plan->instantiate(value_expressions(literals)) != *lqp) {
+    return nullptr;
+  }
+
+  return prepared_plan;
+}
+
+std::shared_ptr<ParameterizedPlan> ParameterizedPlan::create(const std::shared_ptr<PreparedPlan>& prepared_plan,
+                                                             const std::vector<AllTypeVariant>& literals,
+                                                             const std::shared_ptr<Optimizer>& optimizer) {
+  const auto parameters = parameters_for(*prepared_plan, literals);
+
+  auto parameter_expressions = std::vector<std::shared_ptr<AbstractExpression>>{};
+  parameter_expressions.reserve(literals.size());
+  for (auto literal_idx = size_t{0}; literal_idx < literals.size(); ++literal_idx) {
+    const auto& literal = literals[literal_idx];
+    const auto parameter_expression = std::make_shared<CorrelatedParameterExpression>(
+        prepared_plan->parameter_ids[literal_idx],
+        CorrelatedParameterExpression::ReferencedExpressionInfo{data_type_from_all_type_variant(literal), "?"});
+    parameter_expression->set_value(literal);
+    parameter_expressions.emplace_back(parameter_expression);
+  }
+
+  const auto optimized_lqp = optimizer->optimize(prepared_plan->instantiate(parameter_expressions));
+
+  auto validity_ranges = std::vector<ValidityRange>{};
+  const auto cardinality_estimator = CardinalityEstimator{};
+  visit_lqp(optimized_lqp, [&](const auto& node) {
+    if (node->type != LQPNodeType::Predicate) {
+      return LQPVisitation::VisitInputs;
+    }
+
+    const auto& predicate_node = static_cast<const PredicateNode&>(*node);
+    const auto operator_scan_predicates =
+        OperatorScanPredicate::from_expression(*predicate_node.predicate(), predicate_node);
+    if (!operator_scan_predicates) {
+      return LQPVisitation::VisitInputs;
+    }
+
+    auto input_table_statistics = std::shared_ptr<TableStatistics>{};
+    for (const auto& predicate : *operator_scan_predicates) {
+      auto bound_predicate = predicate;
+      if (!bind_parameters(bound_predicate, parameters)) {
+        continue;
+      }
+
+      if (!input_table_statistics) {
+        input_table_statistics = cardinality_estimator.estimate_statistics(node->left_input());
+      }
+      const auto cardinality = estimate_row_count(input_table_statistics, bound_predicate);
+      validity_ranges.emplace_back(ValidityRange{predicate, input_table_statistics,
+                                                 cardinality / CARDINALITY_VALIDITY_FACTOR,
+                                                 cardinality * CARDINALITY_VALIDITY_FACTOR});
+    }
+
+    return LQPVisitation::VisitInputs;
+  });
+
+  auto visited_nodes = std::unordered_set<std::shared_ptr<AbstractLQPNode>>{};
+  lqp_unbind_parameters(optimized_lqp, prepared_plan->parameter_ids, visited_nodes);
+  const auto optimized_plan = std::make_shared<PreparedPlan>(optimized_lqp, prepared_plan->parameter_ids);
+  return std::make_shared<ParameterizedPlan>(prepared_plan, optimized_plan, validity_ranges);
+}
+
+ParameterizedPlan::ParameterizedPlan(const std::shared_ptr<PreparedPlan>& init_prepared_plan,
+                                     const std::shared_ptr<PreparedPlan>& init_optimized_plan,
+                                     const std::vector<ValidityRange>& init_validity_ranges)
+    : prepared_plan(init_prepared_plan),
+      optimized_plan(init_optimized_plan),
+      _validity_ranges(init_validity_ranges) {}
+
+bool ParameterizedPlan::is_valid_for(const std::vector<AllTypeVariant>& literals) const {
+  const auto parameters = parameters_for(*prepared_plan, literals);
+  return std::all_of(_validity_ranges.cbegin(), _validity_ranges.cend(), [&](const auto& validity_range) {
+    auto bound_predicate = validity_range.predicate;
+    bind_parameters(bound_predicate, parameters);
+    const auto cardinality = estimate_row_count(validity_range.input_table_statistics, bound_predicate);
+    return cardinality >= validity_range.min_cardinality && cardinality <= validity_range.max_cardinality;
+  });
+}
+
+std::shared_ptr<AbstractOperator> ParameterizedPlan::bind(const std::vector<AllTypeVariant>& literals) const {
+  auto bound_lqp = optimized_plan->instantiate(value_expressions(literals));
+  bound_lqp = create_value_dependent_optimizer()->optimize(std::move(bound_lqp));
+  return LQPTranslator{}.translate_node(bound_lqp);
+}
+
+const std::vector<ParameterizedPlan::ValidityRange>& ParameterizedPlan::validity_ranges() const {
+  return _validity_ranges;
+}
+
+}  // namespace hyrise
@@ -0,0 +1,99 @@
+#pragma once
+
+#include <memory>
+#include <optional>
+#include <string>
+#include <vector>
+
+#include "all_type_variant.hpp"
+#include "operators/operator_scan_predicate.hpp"
+#include "types.hpp"
+
+namespace hyrise {
+
+class AbstractLQPNode;
+class AbstractOperator;
+class Optimizer;
+class PreparedPlan;
+class TableStatistics;
+
+/**
+ * Optimized plan of an automatically parameterized statement. Statements that only differ in their literals, such as
+ * `SELECT * FROM t WHERE id = 17` and `SELECT * FROM t WHERE id = 18`, share their ParameterizedPlans (see
+ * SQLPipelineStatement::get_physical_plan()). Thus, only the first of them pays for SQL translation and the full
+ * optimization.
+ *
+ * extract_literals() replaces the literals of a SELECT statement with placeholders. The normalized statement is
+ * translated into a PreparedPlan once. For the optimization, its placeholders are bound to
+ * CorrelatedParameterExpressions that carry the literals of the first statement. The CardinalityEstimator uses these
+ * values, but rules that specialize the plan for a value (i.e., the ChunkPruningRule and the IndexScanRule) only
+ * consider ValueExpressions. The optimized plan is kept with placeholders. bind() instantiates it with the literals
+ * of a statement and applies these value-dependent rules before translating it. Hence, every statement still prunes
+ * chunks and uses indexes for its own literals.
+ *
+ * A plan that is good for one value can be bad for another one, e.g., if the join order was chosen for a selective
+ * predicate. For every scan predicate on a parameter, we remember the estimated cardinality that the plan was optimized
+ * for. Statements whose estimates differ by more than CARDINALITY_VALIDITY_FACTOR are outside of the plan's validity
+ * range (see is_valid_for()). For them, the statement is optimized again. Up to MAX_PLAN_COUNT plans with different
+ * validity ranges are cached per statement (see SQLParameterizedPlanCache).
+ */
+class ParameterizedPlan final {
+ public:
+  static constexpr auto CARDINALITY_VALIDITY_FACTOR = 2.0f;
+  static constexpr auto MAX_PLAN_COUNT = size_t{4};
+
+  struct ExtractedLiterals {
+    // The SQL string with the literals replaced by placeholders (`?`) and normalized whitespace.
+    std::string normalized_sql;
+
+    // The literals in the order of the placeholders.
+    std::vector<AllTypeVariant> literals;
+  };
+
+  // Returns std::nullopt if the statement is not a SELECT statement, has no literals, or already contains placeholders.
+  static std::optional<ExtractedLiterals> extract_literals(const std::string& sql);
+
+  // Literals of different data types can lead to different plans. Thus, the data types are part of the cache key.
+  static std::string cache_key(const ExtractedLiterals& extracted_literals, const UseMvcc use_mvcc);
+
+  // Translates the normalized statement. Returns nullptr if it cannot be parameterized, i.e., if the translation
+  // fails or if binding the literals does not result in the unoptimized @param lqp of the original statement.
+  static std::shared_ptr<PreparedPlan> prepare(const ExtractedLiterals& extracted_literals,
+                                               const std::shared_ptr<AbstractLQPNode>& lqp, const UseMvcc use_mvcc);
+
+  // Optimizes the prepared plan for the given literals.
+  static std::shared_ptr<ParameterizedPlan> create(const std::shared_ptr<PreparedPlan>& prepared_plan,
+                                                   const std::vector<AllTypeVariant>& literals,
+                                                   const std::shared_ptr<Optimizer>& optimizer);
+
+  // Scan predicate on at least one parameter and the cardinality that the plan was optimized for.
+  struct ValidityRange {
+    OperatorScanPredicate predicate;
+    std::shared_ptr<TableStatistics> input_table_statistics;
+    Cardinality min_cardinality;
+    Cardinality max_cardinality;
+  };
+
+  ParameterizedPlan(const std::shared_ptr<PreparedPlan>& init_prepared_plan,
+                    const std::shared_ptr<PreparedPlan>& init_optimized_plan,
+                    const std::vector<ValidityRange>& init_validity_ranges);
+
+  // Returns false if the estimated cardinality of a scan predicate for the literals falls outside its validity range.
+  bool is_valid_for(const std::vector<AllTypeVariant>& literals) const;
+
+  // Instantiates the optimized plan with the literals, prunes chunks and chooses indexes for them, and translates it.
+  std::shared_ptr<AbstractOperator> bind(const std::vector<AllTypeVariant>& literals) const;
+
+  const std::vector<ValidityRange>& validity_ranges() const;
+
+  // Unoptimized plan with placeholders. Used to optimize the statement again for literals outside the validity range.
+  const std::shared_ptr<PreparedPlan> prepared_plan;
+
+  // Optimized plan with placeholders, but without the value-dependent optimizations.
+  const std::shared_ptr<PreparedPlan> optimized_plan;
+
+ private:
+  const std::vector<ValidityRange> _validity_ranges;
+};
+
+}  // namespace hyrise
@@ -1,6 +1,7 @@
 #include "sql_pipeline.hpp"
 
 #include <algorithm>
+#include <map>
 #include <utility>
 
 #include <boost/algorithm/string.hpp>
@@ -8,6 +9,8 @@
 #include "SQLParser.h"
 #include "create_sql_parser_error_message.hpp"
 #include "hyrise.hpp"
+#include "scheduler/resource_group.hpp"
+#include "scheduler/task_context.hpp"
 #include "sql_plan_cache.hpp"
 #include "utils/assert.hpp"
 #include "utils/format_duration.hpp"
@@ -17,9 +20,15 @@ namespace hyrise {
 SQLPipeline::SQLPipeline(const std::string& sql, const std::shared_ptr<TransactionContext>& transaction_context,
                          const UseMvcc use_mvcc, const std::shared_ptr<Optimizer>& optimizer,
                          const std::shared_ptr<SQLPhysicalPlanCache>& init_pqp_cache,
-                         const std::shared_ptr<SQLLogicalPlanCache>& init_lqp_cache)
+                         const std::shared_ptr<SQLLogicalPlanCache>& init_lqp_cache,
+                         const std::shared_ptr<SQLParameterizedPlanCache>& init_parameterized_plan_cache,
+                         const std::shared_ptr<SQLResultCache>& init_result_cache,
+                         const std::shared_ptr<ResourceGroup>& resource_group,
+                         const std::optional<uint64_t>& session_id)
     : pqp_cache(init_pqp_cache),
       lqp_cache(init_lqp_cache),
+      parameterized_plan_cache(init_parameterized_plan_cache),
+      result_cache(init_result_cache),
       _sql(sql),
       _transaction_context(transaction_context),
       _optimizer(optimizer) {
@@ -80,8 +89,15 @@ SQLPipeline::SQLPipeline(const std::string& sql, const std::shared_ptr<Transacti
     const auto statement_string = boost::trim_copy(sql.substr(sql_string_offset, statement_string_length));
     sql_string_offset += statement_string_length;
 
-    auto pipeline_statement = std::make_shared<SQLPipelineStatement>(statement_string, std::move(parsed_statement),
-                                                                     use_mvcc, optimizer, pqp_cache, lqp_cache);
+    // Each statement is a query of its own. Unless a resource group was passed, each statement gets a separate group so
+    // that concurrent queries share the workers equally.
+    const auto statement_resource_group =
+        resource_group ? resource_group : std::make_shared<ResourceGroup>("statement");
+    const auto task_context = std::make_shared<TaskContext>(statement_resource_group, session_id);
+
+    auto pipeline_statement = std::make_shared<SQLPipelineStatement>(
+        statement_string, std::move(parsed_statement), use_mvcc, optimizer, pqp_cache, lqp_cache,
+        parameterized_plan_cache, result_cache, task_context);
     _sql_pipeline_statements.emplace_back(std::move(pipeline_statement));
   }
 
@@ -327,6 +343,17 @@ const std::vector<std::shared_ptr<SQLPipelineStatement>>& SQLPipeline::_get_sql_
   return _sql_pipeline_statements;
 }
 
+std::map<std::string, std::chrono::nanoseconds> SQLPipelineMetrics::optimizer_rule_durations() const {
+  auto rule_durations = std::map<std::string, std::chrono::nanoseconds>{};
+  for (const auto& statement_metric : statement_metrics) {
+    for (const auto& rule_metrics : statement_metric->optimizer_rule_durations) {
+      rule_durations[rule_metrics.rule_name] += rule_metrics.duration;
+    }
+  }
+
+  return rule_durations;
+}
+
 std::ostream& operator<<(std::ostream& stream, const SQLPipelineMetrics& metrics) {
   auto total_sql_translate_nanos = std::chrono::nanoseconds::zero();
   auto total_optimize_nanos = std::chrono::nanoseconds::zero();
@@ -348,7 +375,15 @@ std::ostream& operator<<(std::ostream& stream, const SQLPipelineMetrics& metrics
   stream << "Execution info: [";
   stream << "PARSE: " << format_duration(metrics.parse_time_nanos) << ", ";
   stream << "SQL TRANSLATE: " << format_duration(total_sql_translate_nanos) << ", ";
-  stream << "OPTIMIZE: " << format_duration(total_optimize_nanos) << ", ";
+  stream << "OPTIMIZE: " << format_duration(total_optimize_nanos);
+  // Name the slowest rule so that optimizer regressions become visible. There is none for cached plans.
+  const auto rule_durations = metrics.optimizer_rule_durations();
+  const auto slowest_rule = std::max_element(rule_durations.cbegin(), rule_durations.cend(),
+                                             [](const auto& lhs, const auto& rhs) { return lhs.second < rhs.second; });
+  if (slowest_rule != rule_durations.cend()) {
+    stream << " (slowest rule: " << slowest_rule->first << " " << format_duration(slowest_rule->second) << ")";
+  }
+  stream << ", ";
   stream << "LQP TRANSLATE: " << format_duration(total_lqp_translate_nanos) << ", ";
   stream << "EXECUTE: " << format_duration(total_execute_nanos) << " (wall time) | ";
   stream << "QUERY PLAN CACHE HITS: " << num_cache_hits << "/" << query_plan_cache_hits.size() << " statement(s)";
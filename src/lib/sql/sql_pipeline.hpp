@@ -1,6 +1,9 @@
 #pragma once
 
+#include <map>
 #include <memory>
+#include <optional>
+#include <string>
 
 #include "SQLParserResult.h"
 #include "concurrency/transaction_context.hpp"
@@ -12,12 +15,19 @@
 
 namespace hyrise {
 
+class ResourceGroup;
+class SQLResultCache;
+
 // Holds relevant information about the execution of an SQLPipeline.
 struct SQLPipelineMetrics {
   std::vector<std::shared_ptr<const SQLPipelineStatementMetrics>> statement_metrics;
 
   // This is different from the other measured times as we only get this for all statements at once
   std::chrono::nanoseconds parse_time_nanos{0};
+
+  // Sums up the durations of each optimizer rule (by name) over all statements. Rules that are part of the optimizer
+  // multiple times are summed up, too.
+  std::map<std::string, std::chrono::nanoseconds> optimizer_rule_durations() const;
 };
 
 std::ostream& operator<<(std::ostream& stream, const SQLPipelineMetrics& metrics);
@@ -35,7 +45,10 @@ class SQLPipeline : public Noncopyable {
   SQLPipeline(const std::string& sql, const std::shared_ptr<TransactionContext>& transaction_context,
               const UseMvcc use_mvcc, const std::shared_ptr<Optimizer>& optimizer,
               const std::shared_ptr<SQLPhysicalPlanCache>& init_pqp_cache,
-              const std::shared_ptr<SQLLogicalPlanCache>& init_lqp_cache);
+              const std::shared_ptr<SQLLogicalPlanCache>& init_lqp_cache,
+              const std::shared_ptr<SQLParameterizedPlanCache>& init_parameterized_plan_cache,
+              const std::shared_ptr<SQLResultCache>& init_result_cache,
+              const std::shared_ptr<ResourceGroup>& resource_group, const std::optional<uint64_t>& session_id);
 
   // Returns the original SQL string
   const std::string& get_sql() const;
@@ -95,6 +108,8 @@ class SQLPipeline : public Noncopyable {
 
   const std::shared_ptr<SQLPhysicalPlanCache> pqp_cache;
   const std::shared_ptr<SQLLogicalPlanCache> lqp_cache;
+  const std::shared_ptr<SQLParameterizedPlanCache> parameterized_plan_cache;
+  const std::shared_ptr<SQLResultCache> result_cache;
 
  private:
   friend class SQLPipelineStatementTest;
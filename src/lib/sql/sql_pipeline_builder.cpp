@@ -4,7 +4,11 @@
 namespace hyrise {
 
 SQLPipelineBuilder::SQLPipelineBuilder(const std::string& sql)
-    : _sql(sql), _pqp_cache(Hyrise::get().default_pqp_cache), _lqp_cache(Hyrise::get().default_lqp_cache) {}
+    : _sql(sql),
+      _pqp_cache(Hyrise::get().default_pqp_cache),
+      _lqp_cache(Hyrise::get().default_lqp_cache),
+      _parameterized_plan_cache(Hyrise::get().default_parameterized_plan_cache),
+      _result_cache(Hyrise::get().default_result_cache) {}
 
 SQLPipelineBuilder& SQLPipelineBuilder::with_mvcc(const UseMvcc use_mvcc) {
   _use_mvcc = use_mvcc;
@@ -34,13 +38,35 @@ SQLPipelineBuilder& SQLPipelineBuilder::with_lqp_cache(const std::shared_ptr<SQL
   return *this;
 }
 
+SQLPipelineBuilder& SQLPipelineBuilder::with_parameterized_plan_cache(
+    const std::shared_ptr<SQLParameterizedPlanCache>& parameterized_plan_cache) {
+  _parameterized_plan_cache = parameterized_plan_cache;
+  return *this;
+}
+
+SQLPipelineBuilder& SQLPipelineBuilder::with_result_cache(const std::shared_ptr<SQLResultCache>& result_cache) {
+  _result_cache = result_cache;
+  return *this;
+}
+
+SQLPipelineBuilder& SQLPipelineBuilder::with_resource_group(const std::shared_ptr<ResourceGroup>& resource_group) {
+  _resource_group = resource_group;
+  return *this;
+}
+
+SQLPipelineBuilder& SQLPipelineBuilder::with_session_id(const uint64_t session_id) {
+  _session_id = session_id;
+  return *this;
+}
+
 SQLPipelineBuilder& SQLPipelineBuilder::disable_mvcc() {
   return with_mvcc(UseMvcc::No);
 }
 
 SQLPipeline SQLPipelineBuilder::create_pipeline() const {
   auto optimizer = _optimizer ? _optimizer : Optimizer::create_default_optimizer();
-  auto pipeline = SQLPipeline(_sql, _transaction_context, _use_mvcc, optimizer, _pqp_cache, _lqp_cache);
+  auto pipeline = SQLPipeline(_sql, _transaction_context, _use_mvcc, optimizer, _pqp_cache, _lqp_cache,
+                              _parameterized_plan_cache, _result_cache, _resource_group, _session_id);
   return pipeline;
 }
 
@@ -1,6 +1,7 @@
 #pragma once
 
 #include <memory>
+#include <optional>
 #include <string>
 
 #include "types.hpp"
@@ -12,6 +13,8 @@
 namespace hyrise {
 
 class Optimizer;
+class ResourceGroup;
+class SQLResultCache;
 
 /**
  * Interface for the configured execution of SQL.
@@ -42,6 +45,20 @@ class SQLPipelineBuilder final {
   SQLPipelineBuilder& with_transaction_context(const std::shared_ptr<TransactionContext>& transaction_context);
   SQLPipelineBuilder& with_pqp_cache(const std::shared_ptr<SQLPhysicalPlanCache>& pqp_cache);
   SQLPipelineBuilder& with_lqp_cache(const std::shared_ptr<SQLLogicalPlanCache>& lqp_cache);
+  SQLPipelineBuilder& with_parameterized_plan_cache(
+      const std::shared_ptr<SQLParameterizedPlanCache>& parameterized_plan_cache);
+  SQLPipelineBuilder& with_result_cache(const std::shared_ptr<SQLResultCache>& result_cache);
+
+  /**
+   * Executes all statements in the given resource group (see ResourceGroup). By default, each statement gets a group
+   * of its own.
+   */
+  SQLPipelineBuilder& with_resource_group(const std::shared_ptr<ResourceGroup>& resource_group);
+
+  /**
+   * Attaches the id of the (server) session that issued the query to the tasks of the pipeline.
+   */
+  SQLPipelineBuilder& with_session_id(const uint64_t session_id);
 
   /**
    * Short for with_mvcc(UseMvcc::No)
@@ -58,6 +75,10 @@ class SQLPipelineBuilder final {
   std::shared_ptr<Optimizer> _optimizer;
   std::shared_ptr<SQLPhysicalPlanCache> _pqp_cache;
   std::shared_ptr<SQLLogicalPlanCache> _lqp_cache;
+  std::shared_ptr<SQLParameterizedPlanCache> _parameterized_plan_cache;
+  std::shared_ptr<SQLResultCache> _result_cache;
+  std::shared_ptr<ResourceGroup> _resource_group;
+  std::optional<uint64_t> _session_id;
 };
 
 }  // namespace hyrise
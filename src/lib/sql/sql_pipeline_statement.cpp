@@ -1,9 +1,13 @@
 #include "sql_pipeline_statement.hpp"
 
+#include <algorithm>
 #include <fstream>
 #include <iomanip>
 #include <memory>
+#include <unordered_map>
+#include <unordered_set>
 #include <utility>
+#include <vector>
 
 #include <boost/algorithm/string.hpp>
 
@@ -12,31 +16,106 @@
 #include "expression/value_expression.hpp"
 #include "hyrise.hpp"
 #include "logical_query_plan/lqp_utils.hpp"
+#include "operators/abstract_join_operator.hpp"
 #include "operators/export.hpp"
+#include "operators/get_table.hpp"
 #include "operators/import.hpp"
 #include "operators/maintenance/create_prepared_plan.hpp"
 #include "operators/maintenance/create_table.hpp"
 #include "operators/maintenance/create_view.hpp"
 #include "operators/maintenance/drop_table.hpp"
 #include "operators/maintenance/drop_view.hpp"
+#include "operators/pqp_utils.hpp"
+#include "operators/table_wrapper.hpp"
 #include "optimizer/optimizer.hpp"
 #include "scheduler/job_task.hpp"
+#include "sql/parameterized_plan.hpp"
 #include "sql/sql_pipeline_builder.hpp"
 #include "sql/sql_plan_cache.hpp"
+#include "sql/sql_result_cache.hpp"
 #include "sql/sql_translator.hpp"
+#include "statistics/cardinality_estimator.hpp"
+#include "statistics/cardinality_feedback.hpp"
 #include "utils/assert.hpp"
 
+namespace {
+
+using namespace hyrise;  // NOLINT
+
+bool contains_join(const std::shared_ptr<AbstractLQPNode>& lqp) {
+  auto join_found = false;
+  visit_lqp(lqp, [&](const auto& node) {
+    join_found |= node->type == LQPNodeType::Join;
+    return join_found ? LQPVisitation::DoNotVisitInputs : LQPVisitation::VisitInputs;
+  });
+  return join_found;
+}
+
+// Returns the inputs of joins that do not contain joins themselves, i.e., the (filtered) tables of the join graph.
+// Since operators materialize their outputs, the remaining plan can be replaced once they are executed. Returns no
+// inputs for plans that modify data.
+std::vector<std::shared_ptr<AbstractLQPNode>> join_inputs(const std::shared_ptr<AbstractLQPNode>& lqp) {
+  auto inputs = std::vector<std::shared_ptr<AbstractLQPNode>>{};
+  auto read_only = true;
+  visit_lqp(lqp, [&](const auto& node) {
+    switch (node->type) {
+      case LQPNodeType::Delete:
+      case LQPNodeType::Insert:
+      case LQPNodeType::Update:
+        read_only = false;
+        return LQPVisitation::DoNotVisitInputs;
+      case LQPNodeType::Join:
+        for (const auto& input : {node->left_input(), node->right_input()}) {
+          if (!contains_join(input) && std::find(inputs.cbegin(), inputs.cend(), input) == inputs.cend()) {
+            inputs.emplace_back(input);
+          }
+        }
+        return LQPVisitation::VisitInputs;
+      default:
+        return LQPVisitation::VisitInputs;
+    }
+  });
+
+  if (!read_only) {
+    return {};
+  }
+  return inputs;
+}
+
+// Dynamic pruning (see GetTable::set_dynamic_pruning_input()) removes chunks depending on the other join input. Thus,
+// the cardinalities below the join do not depend on the subplan alone and must not be recorded for it.
+bool is_dynamically_pruned(const std::shared_ptr<AbstractOperator>& op) {
+  auto dynamically_pruned = false;
+  visit_pqp(op, [&](const auto& input) {
+    if (std::dynamic_pointer_cast<const AbstractJoinOperator>(input)) {
+      return PQPVisitation::DoNotVisitInputs;
+    }
+
+    const auto get_table = std::dynamic_pointer_cast<const GetTable>(input);
+    dynamically_pruned |= get_table && get_table->dynamic_pruning_input();
+    return dynamically_pruned ? PQPVisitation::DoNotVisitInputs : PQPVisitation::VisitInputs;
+  });
+  return dynamically_pruned;
+}
+
+}  // namespace
+
 namespace hyrise {
 
-SQLPipelineStatement::SQLPipelineStatement(const std::string& sql, std::shared_ptr<hsql::SQLParserResult> parsed_sql,
-                                           const UseMvcc use_mvcc, const std::shared_ptr<Optimizer>& optimizer,
-                                           const std::shared_ptr<SQLPhysicalPlanCache>& init_pqp_cache,
-                                           const std::shared_ptr<SQLLogicalPlanCache>& init_lqp_cache)
+SQLPipelineStatement::SQLPipelineStatement(
+    const std::string& sql, std::shared_ptr<hsql::SQLParserResult> parsed_sql, const UseMvcc use_mvcc,
+    const std::shared_ptr<Optimizer>& optimizer, const std::shared_ptr<SQLPhysicalPlanCache>& init_pqp_cache,
+    const std::shared_ptr<SQLLogicalPlanCache>& init_lqp_cache,
+    const std::shared_ptr<SQLParameterizedPlanCache>& init_parameterized_plan_cache,
+    const std::shared_ptr<SQLResultCache>& init_result_cache, const std::shared_ptr<TaskContext>& task_context)
     : pqp_cache(init_pqp_cache),
       lqp_cache(init_lqp_cache),
+      parameterized_plan_cache(init_parameterized_plan_cache),
+      result_cache(init_result_cache),
       _sql_string(sql),
       _use_mvcc(use_mvcc),
       _optimizer(optimizer),
+      _task_context(task_context),
       _parsed_sql_statement(std::move(parsed_sql)),
       _metrics(std::make_shared<SQLPipelineStatementMetrics>()) {
   Assert(!_parsed_sql_statement || _parsed_sql_statement->size() == 1,
@@ -168,8 +247,15 @@ const std::shared_ptr<AbstractOperator>& SQLPipelineStatement::get_physical_plan
   auto started = std::chrono::steady_clock::now();
   auto done = started;  // dummy value needed for initialization
 
+  // Statements that only differ in their literals share a plan.
+  auto is_parameterized = false;
+  if (parameterized_plan_cache) {
+    _physical_plan = _get_parameterized_physical_plan();
+    is_parameterized = _physical_plan != nullptr;
+  }
+
   // Try to retrieve the PQP from cache
-  if (pqp_cache) {
+  if (pqp_cache && !_physical_plan) {
     if (const auto cached_physical_plan = pqp_cache->try_get(_sql_string)) {
       if ((*cached_physical_plan)->transaction_context_is_set()) {
         Assert(_use_mvcc == UseMvcc::Yes, "Trying to use MVCC cached query without a transaction context.");
@@ -189,6 +275,7 @@ const std::shared_ptr<AbstractOperator>& SQLPipelineStatement::get_physical_plan
     // Reset time to exclude previous pipeline steps
     started = std::chrono::steady_clock::now();
     _physical_plan = LQPTranslator{}.translate_node(lqp);
+    _physical_plan_is_translated = true;
   }
 
   done = std::chrono::steady_clock::now();
@@ -198,7 +285,7 @@ const std::shared_ptr<AbstractOperator>& SQLPipelineStatement::get_physical_plan
   }
 
   // Cache newly created plan for the according sql statement (only if not already cached)
-  if (pqp_cache && !_metrics->query_plan_cache_hit && _translation_info.cacheable) {
+  if (pqp_cache && !_metrics->query_plan_cache_hit && !is_parameterized && _translation_info.cacheable) {
     pqp_cache->set(_sql_string, _physical_plan);
   }
 
@@ -207,20 +294,260 @@ const std::shared_ptr<AbstractOperator>& SQLPipelineStatement::get_physical_plan
   return _physical_plan;
 }
 
+std::shared_ptr<AbstractOperator> SQLPipelineStatement::_get_parameterized_physical_plan() {
+  const auto extracted_literals = ParameterizedPlan::extract_literals(_sql_string);
+  if (!extracted_literals) {
+    return nullptr;
+  }
+
+  const auto& literals = extracted_literals->literals;
+  const auto cache_key = ParameterizedPlan::cache_key(*extracted_literals, _use_mvcc);
+  if (const auto cached_plans = parameterized_plan_cache->try_get(cache_key)) {
+    // The statement has been seen before and cannot be parameterized.
+    if (cached_plans->empty()) {
+      return nullptr;
+    }
+
+    for (const auto& cached_plan : *cached_plans) {
+      if (cached_plan->is_valid_for(literals)) {
+        _metrics->query_plan_cache_hit = true;
+        return cached_plan->bind(literals);
+      }
+    }
+
+    // The literals are outside of the validity ranges of all cached plans. Optimize the statement again and add the new
+    // plan, replacing the oldest one if there are too many.
+    const auto parameterized_plan =
+        ParameterizedPlan::create(cached_plans->front()->prepared_plan, literals, _optimizer);
+    auto parameterized_plans = *cached_plans;
+    if (parameterized_plans.size() >= ParameterizedPlan::MAX_PLAN_COUNT) {
+      parameterized_plans.erase(parameterized_plans.begin());
+    }
+    parameterized_plans.emplace_back(parameterized_plan);
+    parameterized_plan_cache->set(cache_key, parameterized_plans);
+    return parameterized_plan->bind(literals);
+  }
+
+  const auto prepared_plan = ParameterizedPlan::prepare(*extracted_literals, get_unoptimized_logical_plan(), _use_mvcc);
+  if (!prepared_plan || !_translation_info.cacheable) {
+    parameterized_plan_cache->set(cache_key, {});
+    return nullptr;
+  }
+
+  const auto parameterized_plan = ParameterizedPlan::create(prepared_plan, literals, _optimizer);
+  parameterized_plan_cache->set(cache_key, {parameterized_plan});
+  return parameterized_plan->bind(literals);
+}
+
 const std::vector<std::shared_ptr<AbstractTask>>& SQLPipelineStatement::get_tasks() {
   if (!_tasks.empty()) {
     return _tasks;
   }
 
+  // All tasks created here (and all tasks that they spawn during their execution) belong to this statement.
+  const auto scoped_task_context = ScopedTaskContext{_task_context};
+
   if (_is_transaction_statement()) {
     _tasks = _get_transaction_tasks();
   } else {
     _precheck_ddl_operators(get_physical_plan());
+    if (result_cache) {
+      _apply_result_cache();
+    }
     std::tie(_tasks, _root_operator_task) = OperatorTask::make_tasks_from_operator(get_physical_plan());
   }
   return _tasks;
 }
 
+void SQLPipelineStatement::_apply_result_cache() {
+  // Without MVCC, we cannot tell whether results are outdated. Transactions that modified data see their own
+  // uncommitted changes, so their results differ from those of other transactions.
+  if (!_transaction_context || !_transaction_context->read_write_operators().empty()) {
+    return;
+  }
+
+  auto copied_ops = std::unordered_map<const AbstractOperator*, std::shared_ptr<AbstractOperator>>{};
+  auto candidates = std::vector<std::shared_ptr<AbstractOperator>>{};
+  visit_pqp(_physical_plan, [&](const auto& op) {
+    if (!SQLResultCache::is_cacheable(op->lqp_node)) {
+      return PQPVisitation::VisitInputs;
+    }
+
+    if (const auto result = result_cache->try_get(op->lqp_node, *_transaction_context)) {
+      // deep_copy() uses the TableWrapper instead of copying the operator and its inputs.
+      const auto table_wrapper = std::make_shared<TableWrapper>(result);
+      table_wrapper->lqp_node = op->lqp_node;
+      copied_ops.emplace(op.get(), table_wrapper);
+      ++_metrics->result_cache_hit_count;
+    } else {
+      candidates.emplace_back(op);
+    }
+    return PQPVisitation::DoNotVisitInputs;
+  });
+
+  if (_metrics->result_cache_hit_count > 0) {
+    _physical_plan = _physical_plan->deep_copy(copied_ops);
+    _physical_plan->set_transaction_context_recursively(_transaction_context);
+    for (auto& candidate : candidates) {
+      candidate = copied_ops.at(candidate.get());
+    }
+  }
+
+  _result_cache_candidates = std::move(candidates);
+}
+
+void SQLPipelineStatement::_cache_results(const bool execution_failed) {
+  for (const auto& candidate : _result_cache_candidates) {
+    if (!execution_failed && candidate->state() == OperatorState::ExecutedAndAvailable) {
+      auto execution_duration = std::chrono::nanoseconds{0};
+      visit_pqp(candidate, [&](const auto& op) {
+        execution_duration += op->performance_data->walltime;
+        return PQPVisitation::VisitInputs;
+      });
+      result_cache->set(candidate->lqp_node, candidate->get_output(), *_transaction_context, execution_duration);
+    }
+
+    if (candidate != _physical_plan) {
+      candidate->deregister_consumer();
+    }
+  }
+  _result_cache_candidates.clear();
+}
+
+void SQLPipelineStatement::_reoptimize_after_join_inputs(CardinalityFeedback& cardinality_feedback) {
+  // Plans from the caches have been executed before, so their cardinalities have been recorded already.
+  get_physical_plan();
+  if (!_physical_plan_is_translated) {
+    return;
+  }
+
+  // The order of fewer than three inputs hardly affects the runtime.
+  const auto input_nodes = join_inputs(_optimized_logical_plan);
+  if (input_nodes.size() < 3) {
+    return;
+  }
+
+  // If an LQP node is translated into multiple operators (e.g., an IndexScan and a TableScan that are united), the
+  // topmost one produces its output.
+  auto input_operators = std::vector<std::shared_ptr<AbstractOperator>>{};
+  visit_pqp(_physical_plan, [&](const auto& op) {
+    if (!op->lqp_node || std::find(input_nodes.cbegin(), input_nodes.cend(), op->lqp_node) == input_nodes.cend()) {
+      return PQPVisitation::VisitInputs;
+    }
+
+    input_operators.emplace_back(op);
+    return PQPVisitation::DoNotVisitInputs;
+  });
+
+  const auto started = std::chrono::steady_clock::now();
+
+  {
+    const auto scoped_task_context = ScopedTaskContext{_task_context};
+    auto task_set = std::unordered_set<std::shared_ptr<AbstractTask>>{};
+    for (const auto& op : input_operators) {
+      const auto operator_tasks = OperatorTask::make_tasks_from_operator(op).first;
+      task_set.insert(operator_tasks.cbegin(), operator_tasks.cend());
+    }
+    Hyrise::get().scheduler()->schedule_and_wait_for_tasks(
+        std::vector<std::shared_ptr<AbstractTask>>(task_set.cbegin(), task_set.cend()));
+  }
+
+  _metrics->plan_execution_duration += std::chrono::steady_clock::now() - started;
+
+  if (_transaction_context && _transaction_context->phase() != TransactionPhase::Active) {
+    return;
+  }
+
+  // The estimations include the cardinalities observed in previous executions.
+  auto reoptimize = false;
+  auto subplan_hashes = CardinalityFeedback::SubplanHashes{};
+  for (const auto& op : input_operators) {
+    if (is_dynamically_pruned(op)) {
+      continue;
+    }
+
+    const auto estimated_cardinality = CardinalityEstimator{}.estimate_cardinality(op->lqp_node);
+    const auto observed_cardinality = static_cast<Cardinality>(op->get_output()->row_count());
+    reoptimize |= cardinality_feedback.requires_reoptimization(estimated_cardinality, observed_cardinality);
+    cardinality_feedback.record(*op->lqp_node, observed_cardinality, &subplan_hashes);
+  }
+
+  if (!reoptimize) {
+    return;
+  }
+
+  // The optimizer modifies the LQP that it optimizes. Thus, we translate the statement again.
+  const auto optimization_started = std::chrono::steady_clock::now();
+  _unoptimized_logical_plan = nullptr;
+  auto unoptimized_lqp = get_unoptimized_logical_plan();
+  _unoptimized_logical_plan = nullptr;
+  _optimized_logical_plan = _optimizer->optimize(std::move(unoptimized_lqp));
+
+  const auto translation_started = std::chrono::steady_clock::now();
+  _metrics->optimization_duration += translation_started - optimization_started;
+
+  const auto reoptimized_plan = LQPTranslator{}.translate_node(_optimized_logical_plan);
+  if (_use_mvcc == UseMvcc::Yes) {
+    reoptimized_plan->set_transaction_context_recursively(_transaction_context);
+  }
+
+  // Following executions of the statement start with the new plan.
+  if (_translation_info.cacheable) {
+    if (lqp_cache) {
+      lqp_cache->set(_sql_string, _optimized_logical_plan);
+    }
+    if (pqp_cache) {
+      pqp_cache->set(_sql_string, reoptimized_plan);
+    }
+  }
+
+  // Join inputs that did not change are not executed again. deep_copy() uses their results instead of copying them.
+  auto copied_ops = std::unordered_map<const AbstractOperator*, std::shared_ptr<AbstractOperator>>{};
+  visit_pqp(reoptimized_plan, [&](const auto& op) {
+    if (!op->lqp_node) {
+      return PQPVisitation::VisitInputs;
+    }
+
+    const auto input_operator_iter =
+        std::find_if(input_operators.cbegin(), input_operators.cend(),
+                     [&](const auto& input_operator) { return *input_operator->lqp_node == *op->lqp_node; });
+    if (input_operator_iter == input_operators.cend()) {
+      return PQPVisitation::VisitInputs;
+    }
+
+    const auto table_wrapper = std::make_shared<TableWrapper>((*input_operator_iter)->get_output());
+    table_wrapper->lqp_node = op->lqp_node;
+    copied_ops.emplace(op.get(), table_wrapper);
+    return PQPVisitation::DoNotVisitInputs;
+  });
+
+  _physical_plan = reoptimized_plan->deep_copy(copied_ops);
+  if (_use_mvcc == UseMvcc::Yes) {
+    _physical_plan->set_transaction_context_recursively(_transaction_context);
+  }
+
+  _metrics->lqp_translation_duration += std::chrono::steady_clock::now() - translation_started;
+  _metrics->reoptimized = true;
+}
+
+void SQLPipelineStatement::_record_cardinalities(CardinalityFeedback& cardinality_feedback) const {
+  // Only the topmost operator of an LQP node produces its output (see _reoptimize_after_join_inputs()).
+  auto recorded_nodes = std::unordered_set<std::shared_ptr<const AbstractLQPNode>>{};
+  auto subplan_hashes = CardinalityFeedback::SubplanHashes{};
+  visit_pqp(_physical_plan, [&](const auto& op) {
+    const auto& performance_data = *op->performance_data;
+    if (!op->lqp_node || !performance_data.has_output || !recorded_nodes.emplace(op->lqp_node).second) {
+      return PQPVisitation::VisitInputs;
+    }
+
+    if (!is_dynamically_pruned(op)) {
+      cardinality_feedback.record(*op->lqp_node, static_cast<Cardinality>(performance_data.output_row_count),
+                                  &subplan_hashes);
+    }
+    return PQPVisitation::VisitInputs;
+  });
+}
+
 std::vector<std::shared_ptr<AbstractTask>> SQLPipelineStatement::_get_transaction_tasks() {
   const auto& sql_statement = get_parsed_sql_statement();
   const std::vector<hsql::SQLStatement*>& statements = sql_statement->getStatements();
@@ -268,16 +595,36 @@ std::pair<SQLPipelineStatus, const std::shared_ptr<const Table>&> SQLPipelineSta
     return {SQLPipelineStatus::Success, _result_table};
   }
 
+  const auto& cardinality_feedback = Hyrise::get().cardinality_feedback;
+  if (cardinality_feedback && cardinality_feedback->reoptimization_threshold && _tasks.empty() &&
+      !_is_transaction_statement()) {
+    _reoptimize_after_join_inputs(*cardinality_feedback);
+  }
+
   const auto& tasks = get_tasks();
 
+  // Keep the results of the result cache candidates after their consumers executed, until _cache_results() releases
+  // them. We only register here, so that statements whose tasks are never executed do not leak the results. The root
+  // operator is not cleared automatically anyway.
+  for (const auto& candidate : _result_cache_candidates) {
+    if (candidate != _physical_plan) {
+      candidate->register_consumer();
+    }
+  }
+
   const auto started = std::chrono::steady_clock::now();
 
   Hyrise::get().scheduler()->schedule_and_wait_for_tasks(tasks);
+  _cache_results(has_failed());
 
   if (has_failed()) {
     return {SQLPipelineStatus::Failure, _result_table};
   }
 
+  if (cardinality_feedback && !_is_transaction_statement()) {
+    _record_cardinalities(*cardinality_feedback);
+  }
+
   if (_use_mvcc == UseMvcc::Yes && _transaction_context->is_auto_commit()) {
     _transaction_context->commit();
   }
@@ -290,7 +637,7 @@ std::pair<SQLPipelineStatus, const std::shared_ptr<const Table>&> SQLPipelineSta
   }
 
   const auto done = std::chrono::steady_clock::now();
-  _metrics->plan_execution_duration = done - started;
+  _metrics->plan_execution_duration += done - started;
 
   // Get result table, if it was not a transaction statement
   if (!_is_transaction_statement()) {
@@ -327,6 +674,10 @@ const std::shared_ptr<SQLPipelineStatementMetrics>& SQLPipelineStatement::metric
   return _metrics;
 }
 
+const std::shared_ptr<TaskContext>& SQLPipelineStatement::task_context() const {
+  return _task_context;
+}
+
 void SQLPipelineStatement::_precheck_ddl_operators(const std::shared_ptr<AbstractOperator>& pqp) {
   const auto& storage_manager = Hyrise::get().storage_manager;
 
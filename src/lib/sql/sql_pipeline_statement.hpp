@@ -11,12 +11,16 @@
 #include "scheduler/abstract_task.hpp"
 #include "scheduler/job_task.hpp"
 #include "scheduler/operator_task.hpp"
+#include "scheduler/task_context.hpp"
 #include "sql/sql_translator.hpp"
 #include "sql_plan_cache.hpp"
+#include "sql_result_cache.hpp"
 #include "storage/table.hpp"
 
 namespace hyrise {
 
+class CardinalityFeedback;
+
 // Holds relevant information about the execution of an SQLPipelineStatement.
 struct SQLPipelineStatementMetrics {
   std::chrono::nanoseconds sql_translation_duration{};
@@ -26,6 +30,12 @@ struct SQLPipelineStatementMetrics {
   std::chrono::nanoseconds plan_execution_duration{};
 
   bool query_plan_cache_hit = false;
+
+  // Number of operators that were replaced by results from the SQLResultCache.
+  size_t result_cache_hit_count = 0;
+
+  // Whether the plan was optimized again after executing the inputs of its joins (see CardinalityFeedback).
+  bool reoptimized = false;
 };
 
 enum class SQLPipelineStatus {
@@ -47,9 +57,19 @@ enum class SQLPipelineStatus {
  *  get_unoptimized_logical_plan() -> get_parsed_sql()
  *
  * NOTE:
- *  If a physical plan for an SQL statement is in the SQLPhysicalPlanCache, it will be used instead of translating the
- *  optimized LQP (get_optimized_logical_plans()) into a PQP. Thus, in this case, the optimized LQP and PQP could be
- *  different.
+ *  If a physical plan for an SQL statement is in the SQLParameterizedPlanCache or the SQLPhysicalPlanCache, it will be
+ *  used instead of translating the optimized LQP (get_optimized_logical_plans()) into a PQP. Thus, in this case, the
+ *  optimized LQP and PQP could be different.
+ *
+ * NOTE:
+ *  If an SQLResultCache is used, get_tasks() replaces the operators of joins and aggregates with their cached results.
+ *  The results of the remaining joins and aggregates are cached after the execution.
+ *
+ * NOTE:
+ *  If Hyrise::get().cardinality_feedback is set, the output cardinalities of all operators are recorded after the
+ *  execution. If it has a reoptimization_threshold, get_result_table() first executes the inputs of the joins of a
+ *  newly optimized plan. If their cardinalities were misestimated, the statement is optimized again and the new plan
+ *  reuses their results.
  */
 class SQLPipelineStatement : public Noncopyable {
  public:
@@ -57,7 +77,10 @@ class SQLPipelineStatement : public Noncopyable {
   SQLPipelineStatement(const std::string& sql, std::shared_ptr<hsql::SQLParserResult> parsed_sql,
                        const UseMvcc use_mvcc, const std::shared_ptr<Optimizer>& optimizer,
                        const std::shared_ptr<SQLPhysicalPlanCache>& init_pqp_cache,
-                       const std::shared_ptr<SQLLogicalPlanCache>& init_lqp_cache);
+                       const std::shared_ptr<SQLLogicalPlanCache>& init_lqp_cache,
+                       const std::shared_ptr<SQLParameterizedPlanCache>& init_parameterized_plan_cache,
+                       const std::shared_ptr<SQLResultCache>& init_result_cache,
+                       const std::shared_ptr<TaskContext>& task_context);
 
   // Set the transaction context if this SQLPipelineStatement should not auto-commit.
   void set_transaction_context(const std::shared_ptr<TransactionContext>& transaction_context);
@@ -78,8 +101,8 @@ class SQLPipelineStatement : public Noncopyable {
   const std::shared_ptr<AbstractLQPNode>& get_optimized_logical_plan();
 
   // Returns the PQP for this statement.
-  // The physical plan is either retrieved from the SQLPhysicalPlanCache or, if unavailable, translated from the
-  // optimized LQP.
+  // The physical plan is either retrieved from the SQLParameterizedPlanCache, from the SQLPhysicalPlanCache or, if
+  // unavailable, translated from the optimized LQP.
   const std::shared_ptr<AbstractOperator>& get_physical_plan();
 
   // Returns all tasks that need to be executed for this query.
@@ -100,12 +123,35 @@ class SQLPipelineStatement : public Noncopyable {
 
   const std::shared_ptr<SQLPipelineStatementMetrics>& metrics() const;
 
+  // Identity and resource group of this statement, attached to all tasks that are spawned for it. Might be nullptr.
+  const std::shared_ptr<TaskContext>& task_context() const;
+
   const std::shared_ptr<SQLPhysicalPlanCache> pqp_cache;
   const std::shared_ptr<SQLLogicalPlanCache> lqp_cache;
+  const std::shared_ptr<SQLParameterizedPlanCache> parameterized_plan_cache;
+  const std::shared_ptr<SQLResultCache> result_cache;
 
  private:
   bool _is_transaction_statement();
 
+  // Returns the PQP of a statement that only differs from a previous statement in its literals (see
+  // ParameterizedPlan), or nullptr if the statement is not parameterized.
+  std::shared_ptr<AbstractOperator> _get_parameterized_physical_plan();
+
+  // Replaces the topmost cacheable operators of the PQP with their results from the result cache. Operators without a
+  // valid cached result are kept as _result_cache_candidates. get_result_table() registers as their consumer.
+  void _apply_result_cache();
+
+  // Caches the results of the _result_cache_candidates and releases them.
+  void _cache_results(const bool execution_failed);
+
+  // Executes the operators of the join inputs (e.g., the filtered tables) and replaces the physical plan with a
+  // re-optimized one if their cardinalities differ from the estimations by more than the reoptimization_threshold.
+  void _reoptimize_after_join_inputs(CardinalityFeedback& cardinality_feedback);
+
+  // Records the output cardinalities of the executed operators.
+  void _record_cardinalities(CardinalityFeedback& cardinality_feedback) const;
+
   // Returns the tasks that execute transaction statements
   std::vector<std::shared_ptr<AbstractTask>> _get_transaction_tasks();
 
@@ -119,13 +165,18 @@ class SQLPipelineStatement : public Noncopyable {
 
   const std::shared_ptr<Optimizer> _optimizer;
 
+  const std::shared_ptr<TaskContext> _task_context;
+
   // Execution results
   std::shared_ptr<hsql::SQLParserResult> _parsed_sql_statement;
   std::shared_ptr<AbstractLQPNode> _unoptimized_logical_plan;
   std::shared_ptr<AbstractLQPNode> _optimized_logical_plan;
   std::shared_ptr<AbstractOperator> _physical_plan;
+  // False if the physical plan was retrieved from a cache.
+  bool _physical_plan_is_translated{false};
 
   std::shared_ptr<OperatorTask> _root_operator_task;
+  std::vector<std::shared_ptr<AbstractOperator>> _result_cache_candidates;
   std::vector<std::shared_ptr<AbstractTask>> _tasks;
 
   std::shared_ptr<const Table> _result_table;
@@ -2,15 +2,24 @@
 
 #include <memory>
 #include <string>
+#include <vector>
 
-#include "cache/gdfs_cache.hpp"
+#include "cache/sharded_gdfs_cache.hpp"
 
 namespace hyrise {
 
 class AbstractOperator;
 class AbstractLQPNode;
+class ParameterizedPlan;
+class PreparedPlan;
 
-using SQLPhysicalPlanCache = GDFSCache<std::string, std::shared_ptr<AbstractOperator>>;
-using SQLLogicalPlanCache = GDFSCache<std::string, std::shared_ptr<AbstractLQPNode>>;
+using SQLPhysicalPlanCache = ShardedGDFSCache<std::string, std::shared_ptr<AbstractOperator>>;
+using SQLLogicalPlanCache = ShardedGDFSCache<std::string, std::shared_ptr<AbstractLQPNode>>;
+// Unoptimized, parameterized plans of prepared statements, keyed by normalized SQL (see QueryHandler::normalize_sql)
+using SQLPreparedPlanCache = ShardedGDFSCache<std::string, std::shared_ptr<PreparedPlan>>;
+// Plans of statements whose literals were replaced by parameters, keyed by ParameterizedPlan::cache_key(). Each plan
+// covers a different validity range, the oldest plan comes first. Statements that cannot be parameterized are cached
+// without plans.
+using SQLParameterizedPlanCache = ShardedGDFSCache<std::string, std::vector<std::shared_ptr<ParameterizedPlan>>>;
 
 }  // namespace hyrise
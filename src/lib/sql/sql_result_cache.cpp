@@ -0,0 +1,202 @@
+#include "sql_result_cache.hpp"
+
+#include <algorithm>
+#include <iterator>
+
+#include "concurrency/transaction_context.hpp"
+#include "expression/expression_utils.hpp"
+#include "hyrise.hpp"
+#include "logical_query_plan/lqp_utils.hpp"
+#include "logical_query_plan/stored_table_node.hpp"
+#include "storage/table.hpp"
+
+namespace {
+
+using namespace hyrise;  // NOLINT
+
+bool has_uncacheable_expression(const AbstractLQPNode& node) {
+  auto uncacheable = false;
+  for (const auto& node_expression : node.node_expressions) {
+    visit_expression(node_expression, [&](const auto& expression) {
+      switch (expression->type) {
+        // Placeholders and parameters have different values in each execution.
+        case ExpressionType::Placeholder:
+        case ExpressionType::CorrelatedParameter:
+        // The tables of subqueries are not tracked as dependencies.
+        case ExpressionType::LQPSubquery:
+        case ExpressionType::PQPSubquery:
+          uncacheable = true;
+          return ExpressionVisitation::DoNotVisitArguments;
+        default:
+          return ExpressionVisitation::VisitArguments;
+      }
+    });
+  }
+  return uncacheable;
+}
+
+}  // namespace
+
+namespace hyrise {
+
+SQLResultCache::SQLResultCache(const size_t capacity) : _cache(capacity) {}
+
+bool SQLResultCache::is_cacheable(const std::shared_ptr<const AbstractLQPNode>& lqp) {
+  // Caching the results of scans or projections saves little work, but costs memory.
+  if (!lqp || (lqp->type != LQPNodeType::Join && lqp->type != LQPNodeType::Aggregate)) {
+    return false;
+  }
+
+  auto cacheable = true;
+  visit_lqp(lqp, [&](const auto& node) {
+    switch (node->type) {
+      case LQPNodeType::Aggregate:
+      case LQPNodeType::Alias:
+      case LQPNodeType::DummyTable:
+      case LQPNodeType::Except:
+      case LQPNodeType::Intersect:
+      case LQPNodeType::Join:
+      case LQPNodeType::Limit:
+      case LQPNodeType::Predicate:
+      case LQPNodeType::Projection:
+      case LQPNodeType::Sort:
+      case LQPNodeType::StoredTable:
+      case LQPNodeType::Union:
+      case LQPNodeType::Validate:
+        break;
+      default:
+        // Data modifications, meta tables, static tables, and mocks.
+        cacheable = false;
+    }
+
+    cacheable &= !has_uncacheable_expression(*node);
+    return cacheable ? LQPVisitation::VisitInputs : LQPVisitation::DoNotVisitInputs;
+  });
+
+  return cacheable;
+}
+
+std::shared_ptr<const Table> SQLResultCache::try_get(const std::shared_ptr<const AbstractLQPNode>& lqp,
+                                                     const TransactionContext& transaction_context) {
+  const auto entry = _cache.try_get(lqp);
+  if (!entry || !_is_valid(**entry, transaction_context.snapshot_commit_id())) {
+    return nullptr;
+  }
+
+  return (*entry)->result;
+}
+
+void SQLResultCache::set(const std::shared_ptr<const AbstractLQPNode>& lqp, const std::shared_ptr<const Table>& result,
+                         const TransactionContext& transaction_context,
+                         const std::chrono::nanoseconds execution_duration) {
+  DebugAssert(is_cacheable(lqp), "Result of LQP cannot be cached.");
+  auto entry = std::make_shared<Entry>();
+  entry->result = result;
+  entry->snapshot_commit_id = transaction_context.snapshot_commit_id();
+
+  auto& storage_manager = Hyrise::get().storage_manager;
+  auto table_dropped = false;
+  visit_lqp(lqp, [&](const auto& node) {
+    if (node->type != LQPNodeType::StoredTable) {
+      return LQPVisitation::VisitInputs;
+    }
+
+    const auto& stored_table_node = static_cast<const StoredTableNode&>(*node);
+    auto pruned_chunk_ids = stored_table_node.pruned_chunk_ids();
+    std::sort(pruned_chunk_ids.begin(), pruned_chunk_ids.end());
+
+    auto& dependencies = entry->dependencies;
+    const auto dependency_iter = std::find_if(dependencies.begin(), dependencies.end(), [&](const auto& dependency) {
+      return dependency.table_name == stored_table_node.table_name;
+    });
+
+    // Multiple StoredTableNodes of the same table might prune different chunks. Only the chunks that all of them prune
+    // are irrelevant for the result.
+    if (dependency_iter != dependencies.end()) {
+      auto common_pruned_chunk_ids = std::vector<ChunkID>{};
+      std::set_intersection(dependency_iter->pruned_chunk_ids.cbegin(), dependency_iter->pruned_chunk_ids.cend(),
+                            pruned_chunk_ids.cbegin(), pruned_chunk_ids.cend(),
+                            std::back_inserter(common_pruned_chunk_ids));
+      dependency_iter->pruned_chunk_ids = std::move(common_pruned_chunk_ids);
+      return LQPVisitation::VisitInputs;
+    }
+
+    if (!storage_manager.has_table(stored_table_node.table_name)) {
+      table_dropped = true;
+      return LQPVisitation::DoNotVisitInputs;
+    }
+
+    dependencies.emplace_back(Dependency{stored_table_node.table_name,
+                                         storage_manager.get_table(stored_table_node.table_name),
+                                         std::move(pruned_chunk_ids)});
+    return LQPVisitation::VisitInputs;
+  });
+
+  if (table_dropped) {
+    return;
+  }
+
+  // The key is a copy of the subplan. Otherwise, the cache would keep the statement's LQP alive, which might still be
+  // modified.
+  const auto cache_key = std::shared_ptr<const AbstractLQPNode>{lqp->deep_copy()};
+
+  // Sizes are given in KiB and costs in microseconds. Both are at least one to avoid dividing by zero.
+  const auto size = std::max(static_cast<double>(result->memory_usage(MemoryUsageCalculationMode::Sampled)) / 1024.0,
+                             1.0);
+  const auto cost =
+      std::max(static_cast<double>(std::chrono::duration_cast<std::chrono::microseconds>(execution_duration).count()),
+               1.0);
+  _cache.set(cache_key, entry, cost, size);
+}
+
+size_t SQLResultCache::size() const {
+  return _cache.size();
+}
+
+void SQLResultCache::clear() {
+  _cache.clear();
+}
+
+size_t SQLResultCache::LQPHash::operator()(const std::shared_ptr<const AbstractLQPNode>& lqp) const {
+  return lqp->hash();
+}
+
+bool SQLResultCache::LQPEqual::operator()(const std::shared_ptr<const AbstractLQPNode>& lhs,
+                                          const std::shared_ptr<const AbstractLQPNode>& rhs) const {
+  return lhs == rhs || *lhs == *rhs;
+}
+
+bool SQLResultCache::_is_valid(const Entry& entry, const CommitID snapshot_commit_id) {
+  // Changes committed up to this commit id are visible both in the cached result and for the transaction.
+  const auto commit_id = std::min(entry.snapshot_commit_id, snapshot_commit_id);
+
+  auto& storage_manager = Hyrise::get().storage_manager;
+  for (const auto& dependency : entry.dependencies) {
+    // The table might have been dropped or replaced by a table with the same name.
+    if (!storage_manager.has_table(dependency.table_name)) {
+      return false;
+    }
+
+    const auto table = storage_manager.get_table(dependency.table_name);
+    if (table != dependency.table.lock()) {
+      return false;
+    }
+
+    const auto chunk_count = table->chunk_count();
+    for (auto chunk_id = ChunkID{0}; chunk_id < chunk_count; ++chunk_id) {
+      const auto chunk = table->get_chunk(chunk_id);
+      if (!chunk || std::binary_search(dependency.pruned_chunk_ids.cbegin(), dependency.pruned_chunk_ids.cend(),
+                                       chunk_id)) {
+        continue;
+      }
+
+      if (chunk->last_modification_commit_id() > commit_id) {
+        return false;
+      }
+    }
+  }
+
+  return true;
+}
+
+}  // namespace hyrise
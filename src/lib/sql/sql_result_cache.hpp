@@ -0,0 +1,78 @@
+#pragma once
+
+#include <chrono>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "cache/sharded_gdfs_cache.hpp"
+#include "logical_query_plan/abstract_lqp_node.hpp"
+#include "types.hpp"
+
+namespace hyrise {
+
+class Table;
+class TransactionContext;
+
+/**
+ * Cache for the results of LQP subplans, such as the filtered joins and aggregates that dashboards execute over and
+ * over again. SQLPipelineStatement::get_tasks() replaces the operators of cached subplans with their results. Subplans
+ * are compared using AbstractLQPNode::hash() and AbstractLQPNode::operator==.
+ *
+ * A result that was computed with the snapshot commit id S is valid for a transaction with the snapshot commit id T if
+ * no transaction modified the chunks that the result depends on after min(S, T) (see
+ * Chunk::last_modification_commit_id()). These are all chunks of the subplan's stored tables, except for pruned
+ * chunks. Outdated results are not returned and are replaced once the subplan is executed again.
+ *
+ * The results are weighted by the runtime of their operators (cost) and by their memory usage (size). Thus, the GDFS
+ * policy first evicts large results that are cheap to compute.
+ */
+class SQLResultCache : public Noncopyable {
+ public:
+  explicit SQLResultCache(const size_t capacity = DEFAULT_CACHE_CAPACITY);
+
+  // Returns true if the result of @param lqp is worth caching and only depends on the data of stored tables, i.e., if
+  // @param lqp is a join or an aggregate, does not modify data, and has no placeholders, parameters, or subqueries.
+  static bool is_cacheable(const std::shared_ptr<const AbstractLQPNode>& lqp);
+
+  // Returns the cached result of @param lqp if it is valid for the transaction, nullptr otherwise.
+  std::shared_ptr<const Table> try_get(const std::shared_ptr<const AbstractLQPNode>& lqp,
+                                       const TransactionContext& transaction_context);
+
+  // Caches the @param result of @param lqp. The result must not include uncommitted changes of the transaction.
+  void set(const std::shared_ptr<const AbstractLQPNode>& lqp, const std::shared_ptr<const Table>& result,
+           const TransactionContext& transaction_context, const std::chrono::nanoseconds execution_duration);
+
+  size_t size() const;
+
+  void clear();
+
+ private:
+  // Stored table that a result depends on. The chunks pruned in all of its StoredTableNodes are not considered.
+  struct Dependency {
+    std::string table_name;
+    std::weak_ptr<const Table> table;
+    std::vector<ChunkID> pruned_chunk_ids;
+  };
+
+  struct Entry {
+    std::shared_ptr<const Table> result;
+    CommitID snapshot_commit_id;
+    std::vector<Dependency> dependencies;
+  };
+
+  struct LQPHash final {
+    size_t operator()(const std::shared_ptr<const AbstractLQPNode>& lqp) const;
+  };
+
+  struct LQPEqual final {
+    bool operator()(const std::shared_ptr<const AbstractLQPNode>& lhs,
+                    const std::shared_ptr<const AbstractLQPNode>& rhs) const;
+  };
+
+  static bool _is_valid(const Entry& entry, const CommitID snapshot_commit_id);
+
+  ShardedGDFSCache<std::shared_ptr<const AbstractLQPNode>, std::shared_ptr<const Entry>, LQPHash, LQPEqual> _cache;
+};
+
+}  // namespace hyrise
@@ -9,6 +9,7 @@ void AbstractCardinalityEstimator::guarantee_join_graph(const JoinGraph& join_gr
 
 void AbstractCardinalityEstimator::guarantee_bottom_up_construction() {
   cardinality_estimation_cache.statistics_by_lqp.emplace();
+  cardinality_estimation_cache.subplan_hashes.emplace();
 }
 
 }  // namespace hyrise
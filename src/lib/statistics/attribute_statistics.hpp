@@ -20,6 +20,8 @@ template <typename T>
 class RangeFilter;
 template <typename T>
 class CountingQuotientFilter;
+template <typename T>
+class BloomFilter;
 
 /**
  * For docs, see BaseAttributeStatistics
@@ -41,9 +43,13 @@ class AttributeStatistics : public BaseAttributeStatistics {
       const size_t num_values_pruned, const PredicateCondition predicate_condition, const AllTypeVariant& variant_value,
       const std::optional<AllTypeVariant>& variant_value2 = std::nullopt) const override;
 
+  bool does_not_contain(const PredicateCondition predicate_condition, const AllTypeVariant& variant_value,
+                        const std::optional<AllTypeVariant>& variant_value2 = std::nullopt) const override;
+
   std::shared_ptr<AbstractHistogram<T>> histogram;
   std::shared_ptr<MinMaxFilter<T>> min_max_filter;
   std::shared_ptr<RangeFilter<T>> range_filter;
+  std::shared_ptr<BloomFilter<T>> bloom_filter;
   std::shared_ptr<NullValueRatioStatistics> null_value_ratio;
 };
 
@@ -65,6 +71,10 @@ std::ostream& operator<<(std::ostream& stream, const AttributeStatistics<T>& att
     stream << "Has RangeFilter" << std::endl;
   }
 
+  if (attribute_statistics.bloom_filter) {
+    stream << "Has BloomFilter" << std::endl;
+  }
+
   if (attribute_statistics.null_value_ratio) {
     stream << "NullValueRatio: " << attribute_statistics.null_value_ratio->ratio << std::endl;
   }
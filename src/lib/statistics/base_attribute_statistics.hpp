@@ -52,6 +52,13 @@ class BaseAttributeStatistics {
       const size_t num_values_pruned, const PredicateCondition predicate_condition, const AllTypeVariant& variant_value,
       const std::optional<AllTypeVariant>& variant_value2 = std::nullopt) const;
 
+  /**
+   * Returns true if any of the filters (e.g., a MinMaxFilter or a BloomFilter) guarantees that no value satisfies the
+   * predicate. Histograms are not considered. Used to prune chunks, both by the optimizer and during execution.
+   */
+  virtual bool does_not_contain(const PredicateCondition predicate_condition, const AllTypeVariant& variant_value,
+                                const std::optional<AllTypeVariant>& variant_value2 = std::nullopt) const = 0;
+
   const DataType data_type;
 };
 
@@ -1,5 +1,6 @@
 #pragma once
 
+#include "cardinality_feedback.hpp"
 #include "join_graph_statistics_cache.hpp"
 
 namespace hyrise {
@@ -11,6 +12,9 @@ class CardinalityEstimationCache {
 
   using StatisticsByLQP = std::unordered_map<std::shared_ptr<const AbstractLQPNode>, std::shared_ptr<TableStatistics>>;
   std::optional<StatisticsByLQP> statistics_by_lqp;
+
+  // Hashes of the LQPs for looking up their cardinalities in the CardinalityFeedback. Set with statistics_by_lqp.
+  std::optional<CardinalityFeedback::SubplanHashes> subplan_hashes;
 };
 
 }  // namespace hyrise
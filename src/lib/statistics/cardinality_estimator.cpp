@@ -1,13 +1,18 @@
 #include "cardinality_estimator.hpp"
 
+#include <algorithm>
+#include <cmath>
 #include <iostream>
 #include <memory>
 
 #include "attribute_statistics.hpp"
+#include "column_group_statistics.hpp"
 #include "expression/abstract_expression.hpp"
+#include "expression/correlated_parameter_expression.hpp"
 #include "expression/expression_functional.hpp"
 #include "expression/expression_utils.hpp"
 #include "expression/logical_expression.hpp"
+#include "expression/lqp_column_expression.hpp"
 #include "expression/lqp_subquery_expression.hpp"
 #include "expression/value_expression.hpp"
 #include "hyrise.hpp"
@@ -30,6 +35,7 @@
 #include "resolve_type.hpp"
 #include "statistics/attribute_statistics.hpp"
 #include "statistics/cardinality_estimation_cache.hpp"
+#include "statistics/cardinality_feedback.hpp"
 #include "statistics/statistics_objects/equal_distinct_count_histogram.hpp"
 #include "statistics/statistics_objects/generic_histogram.hpp"
 #include "statistics/statistics_objects/generic_histogram_builder.hpp"
@@ -65,6 +71,225 @@ std::optional<float> estimate_null_value_ratio_of_column(const TableStatistics&
   return std::nullopt;
 }
 
+// Returns a copy of the predicate in which all CorrelatedParameterExpressions are replaced by their values. Returns
+// nullptr if the predicate has no parameters or if a value is not set, which is the case for correlated subqueries.
+std::shared_ptr<AbstractExpression> bind_correlated_parameter_values(
+    const std::shared_ptr<AbstractExpression>& predicate) {
+  if (!expression_contains_correlated_parameter(predicate)) {
+    return nullptr;
+  }
+
+  auto bound_predicate = predicate->deep_copy();
+  auto all_values_set = true;
+  visit_expression(bound_predicate, [&](auto& sub_expression) {
+    if (sub_expression->type != ExpressionType::CorrelatedParameter) {
+      return ExpressionVisitation::VisitArguments;
+    }
+
+    const auto& value = static_cast<const CorrelatedParameterExpression&>(*sub_expression).value();
+    if (value) {
+      sub_expression = std::make_shared<ValueExpression>(*value);
+    } else {
+      all_values_set = false;
+    }
+    return ExpressionVisitation::DoNotVisitArguments;
+  });
+
+  return all_values_set ? bound_predicate : nullptr;
+}
+
+// Scales the column statistics of the estimation to a cardinality that is known (or estimated) more accurately.
+std::shared_ptr<TableStatistics> scale_to_cardinality(const TableStatistics& estimated_statistics,
+                                                      const Cardinality cardinality) {
+  const auto selectivity = estimated_statistics.row_count > 0 ? cardinality / estimated_statistics.row_count
+                                                              : Selectivity{1};
+  const auto column_count = estimated_statistics.column_statistics.size();
+  auto column_statistics = std::vector<std::shared_ptr<BaseAttributeStatistics>>(column_count);
+  for (auto column_id = ColumnID{0}; column_id < column_count; ++column_id) {
+    column_statistics[column_id] = estimated_statistics.column_statistics[column_id]->scaled(selectivity);
+  }
+
+  return std::make_shared<TableStatistics>(std::move(column_statistics), cardinality);
+}
+
+// Returns the statistics of the stored table that @param node reads. They hold the ColumnGroupStatistics, which the
+// TableStatistics of a StoredTableNode (e.g., after chunk pruning) do not.
+std::shared_ptr<TableStatistics> stored_table_statistics(const StoredTableNode& stored_table_node) {
+  return Hyrise::get().storage_manager.get_table(stored_table_node.table_name)->table_statistics();
+}
+
+// Translates a predicate on a StoredTableNode into OperatorScanPredicates whose column ids refer to the stored table,
+// i.e., to the ColumnGroupStatistics.
+std::optional<std::vector<OperatorScanPredicate>> stored_table_scan_predicates(
+    const AbstractExpression& predicate, const StoredTableNode& stored_table_node) {
+  auto scan_predicates = OperatorScanPredicate::from_expression(predicate, stored_table_node);
+  if (!scan_predicates) {
+    return std::nullopt;
+  }
+
+  const auto& output_expressions = stored_table_node.output_expressions();
+  for (auto& scan_predicate : *scan_predicates) {
+    const auto& column_expression = *output_expressions[scan_predicate.column_id];
+    scan_predicate.column_id = static_cast<const LQPColumnExpression&>(column_expression).original_column_id;
+  }
+  return scan_predicates;
+}
+
+/**
+ * Estimates the cardinality of a PredicateNode in a chain of PredicateNodes (and ValidateNodes) on a stored table from
+ * the joint distribution of the scanned columns (see ColumnGroupStatistics). The input cardinality already reflects
+ * the predicates below. Hence, we only apply the conditional selectivity of the node's predicate given the predicates
+ * below: selectivity(all predicates) / selectivity(predicates below). Returns std::nullopt if no column group covers
+ * the node's predicate and at least one of the predicates below.
+ */
+std::optional<Cardinality> estimate_predicate_chain_with_column_group_statistics(const PredicateNode& predicate_node,
+                                                                                 const Cardinality input_row_count) {
+  auto lower_predicate_nodes = std::vector<std::shared_ptr<const AbstractLQPNode>>{};
+  auto node = std::shared_ptr<const AbstractLQPNode>{predicate_node.left_input()};
+  while (node->type == LQPNodeType::Predicate || node->type == LQPNodeType::Validate) {
+    if (node->type == LQPNodeType::Predicate) {
+      lower_predicate_nodes.emplace_back(node);
+    }
+    node = node->left_input();
+  }
+
+  if (lower_predicate_nodes.empty() || node->type != LQPNodeType::StoredTable) {
+    return std::nullopt;
+  }
+
+  const auto& stored_table_node = static_cast<const StoredTableNode&>(*node);
+  const auto table_statistics = stored_table_statistics(stored_table_node);
+  if (!table_statistics) {
+    return std::nullopt;
+  }
+
+  const auto predicates = stored_table_scan_predicates(*predicate_node.predicate(), stored_table_node);
+  if (!predicates) {
+    return std::nullopt;
+  }
+
+  auto lower_predicates = std::vector<OperatorScanPredicate>{};
+  for (const auto& lower_predicate_node : lower_predicate_nodes) {
+    const auto& predicate = *static_cast<const PredicateNode&>(*lower_predicate_node).predicate();
+    if (const auto scan_predicates = stored_table_scan_predicates(predicate, stored_table_node)) {
+      lower_predicates.insert(lower_predicates.end(), scan_predicates->begin(), scan_predicates->end());
+    }
+  }
+
+  // Pick the column group that covers the most predicates below.
+  auto best_column_group_statistics = std::shared_ptr<const ColumnGroupStatistics>{};
+  auto best_lower_predicates = std::vector<OperatorScanPredicate>{};
+  for (const auto& column_group_statistics : table_statistics->column_group_statistics) {
+    if (!std::all_of(predicates->cbegin(), predicates->cend(), [&](const auto& predicate) {
+          return column_group_statistics->can_estimate(predicate);
+        })) {
+      continue;
+    }
+
+    auto covered_lower_predicates = std::vector<OperatorScanPredicate>{};
+    for (const auto& lower_predicate : lower_predicates) {
+      if (column_group_statistics->can_estimate(lower_predicate)) {
+        covered_lower_predicates.emplace_back(lower_predicate);
+      }
+    }
+
+    if (covered_lower_predicates.size() > best_lower_predicates.size()) {
+      best_column_group_statistics = column_group_statistics;
+      best_lower_predicates = std::move(covered_lower_predicates);
+    }
+  }
+
+  if (!best_column_group_statistics) {
+    return std::nullopt;
+  }
+
+  const auto lower_selectivity = best_column_group_statistics->estimate_selectivity(best_lower_predicates);
+  auto all_predicates = best_lower_predicates;
+  all_predicates.insert(all_predicates.end(), predicates->cbegin(), predicates->cend());
+  const auto selectivity = best_column_group_statistics->estimate_selectivity(all_predicates);
+  if (!lower_selectivity || !selectivity || *lower_selectivity == 0.0f) {
+    return std::nullopt;
+  }
+
+  return input_row_count * std::min(*selectivity / *lower_selectivity, Selectivity{1});
+}
+
+// Returns the statistics of the column group that consists of exactly the sorted @param column_ids. A larger group
+// also counts the combinations with the values of its other columns and would overestimate the number of groups.
+std::shared_ptr<const ColumnGroupStatistics> find_exact_column_group_statistics(
+    const TableStatistics& table_statistics, const std::vector<ColumnID>& column_ids) {
+  for (const auto& column_group_statistics : table_statistics.column_group_statistics) {
+    if (column_group_statistics && column_group_statistics->column_ids == column_ids) {
+      return column_group_statistics;
+    }
+  }
+  return nullptr;
+}
+
+/**
+ * Estimates the number of groups of an AggregateNode that groups by columns of a single stored table from the distinct
+ * count sketches of the columns (see ColumnGroupStatistics). If there is no column group of exactly the group-by
+ * columns, we assume independence and multiply the distinct counts of the single columns, capped at the row count.
+ */
+std::optional<Cardinality> estimate_group_count_with_column_group_statistics(const AggregateNode& aggregate_node,
+                                                                             const Cardinality input_row_count) {
+  if (aggregate_node.aggregate_expressions_begin_idx == 0) {
+    return std::nullopt;
+  }
+
+  auto stored_table_node = std::shared_ptr<const AbstractLQPNode>{};
+  auto column_ids = std::vector<ColumnID>{};
+  for (auto expression_idx = size_t{0}; expression_idx < aggregate_node.aggregate_expressions_begin_idx;
+       ++expression_idx) {
+    const auto& group_by_expression = aggregate_node.node_expressions[expression_idx];
+    if (group_by_expression->type != ExpressionType::LQPColumn) {
+      return std::nullopt;
+    }
+
+    const auto& column_expression = static_cast<const LQPColumnExpression&>(*group_by_expression);
+    const auto original_node = column_expression.original_node.lock();
+    if (!original_node || original_node->type != LQPNodeType::StoredTable ||
+        (stored_table_node && original_node != stored_table_node)) {
+      return std::nullopt;
+    }
+
+    stored_table_node = original_node;
+    column_ids.emplace_back(column_expression.original_column_id);
+  }
+
+  const auto table_statistics = stored_table_statistics(static_cast<const StoredTableNode&>(*stored_table_node));
+  if (!table_statistics) {
+    return std::nullopt;
+  }
+
+  std::sort(column_ids.begin(), column_ids.end());
+  column_ids.erase(std::unique(column_ids.begin(), column_ids.end()), column_ids.end());
+
+  auto distinct_count = Cardinality{1};
+  if (const auto column_group_statistics = find_exact_column_group_statistics(*table_statistics, column_ids)) {
+    distinct_count = column_group_statistics->distinct_count();
+  } else {
+    for (const auto column_id : column_ids) {
+      const auto single_column_statistics = find_exact_column_group_statistics(*table_statistics, {column_id});
+      if (!single_column_statistics) {
+        return std::nullopt;
+      }
+      distinct_count *= single_column_statistics->distinct_count();
+    }
+  }
+
+  // If the input contains only a fraction of the table's rows, it also contains fewer groups. Assuming that all groups
+  // are equally large, the expected number of groups with at least one row in a sample of n of N rows is
+  // d * (1 - (1 - n / N) ^ (N / d)).
+  const auto table_row_count = table_statistics->row_count;
+  distinct_count = std::min(distinct_count, table_row_count);
+  if (input_row_count < table_row_count && distinct_count > 0) {
+    distinct_count *= 1.0f - std::pow(1.0f - input_row_count / table_row_count, table_row_count / distinct_count);
+  }
+
+  return std::min(distinct_count, input_row_count);
+}
+
 }  // namespace
 
 namespace hyrise {
@@ -228,7 +453,19 @@ std::shared_ptr<TableStatistics> CardinalityEstimator::estimate_statistics(
   }
 
   /**
-   * 3. Store output_table_statistics in cache
+   * 3. Replace the estimated cardinality with the cardinality observed when a plan with the same result was executed
+   */
+  if (const auto& cardinality_feedback = Hyrise::get().cardinality_feedback) {
+    auto& subplan_hashes = cardinality_estimation_cache.subplan_hashes;
+    const auto observed_cardinality =
+        cardinality_feedback->try_get(*lqp, subplan_hashes ? &*subplan_hashes : nullptr);
+    if (observed_cardinality && *observed_cardinality != output_table_statistics->row_count) {
+      output_table_statistics = scale_to_cardinality(*output_table_statistics, *observed_cardinality);
+    }
+  }
+
+  /**
+   * 4. Store output_table_statistics in cache
    */
   if (join_graph_bitmask) {
     cardinality_estimation_cache.join_graph_statistics_cache->set(*join_graph_bitmask, lqp->output_expressions(),
@@ -292,7 +529,8 @@ std::shared_ptr<TableStatistics> CardinalityEstimator::estimate_projection_node(
 std::shared_ptr<TableStatistics> CardinalityEstimator::estimate_aggregate_node(
     const AggregateNode& aggregate_node, const std::shared_ptr<TableStatistics>& input_table_statistics) {
   // For AggregateNodes, statistics from group-by columns are forwarded and for the aggregate columns
-  // dummy statistics are created for now.
+  // dummy statistics are created for now. The number of groups is estimated from distinct count sketches if all
+  // group-by columns stem from the same stored table. Otherwise, we estimate that each input row forms a group.
 
   const auto& output_expressions = aggregate_node.output_expressions();
   const auto output_expression_count = output_expressions.size();
@@ -312,7 +550,10 @@ std::shared_ptr<TableStatistics> CardinalityEstimator::estimate_aggregate_node(
     }
   }
 
-  return std::make_shared<TableStatistics>(std::move(column_statistics), input_table_statistics->row_count);
+  const auto row_count =
+      estimate_group_count_with_column_group_statistics(aggregate_node, input_table_statistics->row_count)
+          .value_or(input_table_statistics->row_count);
+  return std::make_shared<TableStatistics>(std::move(column_statistics), row_count);
 }
 
 std::shared_ptr<TableStatistics> CardinalityEstimator::estimate_validate_node(
@@ -374,6 +615,13 @@ std::shared_ptr<TableStatistics> CardinalityEstimator::estimate_predicate_node(
     }
   }
 
+  // The parameters of automatically parameterized statements carry the literals that the plan is optimized for (see
+  // ParameterizedPlan). Estimate them like these literals.
+  if (const auto bound_predicate = bind_correlated_parameter_values(predicate)) {
+    const auto bound_predicate_node = PredicateNode::make(bound_predicate, predicate_node.left_input());
+    return estimate_predicate_node(*bound_predicate_node, input_table_statistics);
+  }
+
   // Estimating correlated parameters is tricky. Example:
   //   SELECT c_custkey, (SELECT AVG(o_totalprice) FROM orders WHERE o_custkey = c_custkey) FROM customer
   // If the subquery was executed for each customer row, assuming that the predicate has a selectivity matching that
@@ -428,6 +676,14 @@ std::shared_ptr<TableStatistics> CardinalityEstimator::estimate_predicate_node(
     output_table_statistics = estimate_operator_scan_predicate(output_table_statistics, operator_scan_predicate);
   }
 
+  // The estimation above assumes that the scanned column is independent of the columns scanned below. If there are
+  // statistics on the joint distribution of these columns, use them instead.
+  const auto correlated_row_count =
+      estimate_predicate_chain_with_column_group_statistics(predicate_node, input_table_statistics->row_count);
+  if (correlated_row_count && *correlated_row_count != output_table_statistics->row_count) {
+    output_table_statistics = scale_to_cardinality(*output_table_statistics, *correlated_row_count);
+  }
+
   return output_table_statistics;
 }
 
@@ -0,0 +1,332 @@
+#include "cardinality_feedback.hpp"
+
+#include <algorithm>
+#include <iterator>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include <boost/container_hash/hash.hpp>
+
+#include "expression/binary_predicate_expression.hpp"
+#include "expression/expression_utils.hpp"
+#include "expression/lqp_column_expression.hpp"
+#include "logical_query_plan/abstract_lqp_node.hpp"
+#include "logical_query_plan/join_node.hpp"
+#include "logical_query_plan/stored_table_node.hpp"
+#include "logical_query_plan/union_node.hpp"
+#include "utils/assert.hpp"
+
+namespace {
+
+using namespace hyrise;  // NOLINT
+
+// The hashes of inner joins and of the predicates above them are sums of the hashes of their parts, which makes them
+// independent of the join order. Mixing the parts first (finalizer of SplitMix64) avoids that different parts sum up
+// to the same hash.
+size_t mix(size_t hash) {
+  hash ^= hash >> 30u;
+  hash *= 0xbf58476d1ce4e5b9u;
+  hash ^= hash >> 27u;
+  hash *= 0x94d049bb133111ebu;
+  hash ^= hash >> 31u;
+  return hash;
+}
+
+std::optional<size_t> expression_hash(const std::shared_ptr<AbstractExpression>& expression) {
+  auto hash = std::hash<std::string>{}(expression->description(AbstractExpression::DescriptionMode::ColumnName));
+  auto supported = true;
+  visit_expression(expression, [&](const auto& sub_expression) {
+    switch (sub_expression->type) {
+      // The values of placeholders and parameters differ between executions. The description of subqueries includes
+      // the address of their plan.
+      case ExpressionType::Placeholder:
+      case ExpressionType::CorrelatedParameter:
+      case ExpressionType::LQPSubquery:
+      case ExpressionType::PQPSubquery:
+        supported = false;
+        return ExpressionVisitation::DoNotVisitArguments;
+      case ExpressionType::LQPColumn: {
+        // Column names are ambiguous (e.g., most tables have an `id` column). Thus, we add the table name.
+        const auto& column_expression = static_cast<const LQPColumnExpression&>(*sub_expression);
+        const auto original_node = column_expression.original_node.lock();
+        Assert(original_node, "LQPColumnExpression is expired.");
+        if (original_node->type == LQPNodeType::StoredTable) {
+          boost::hash_combine(hash, static_cast<const StoredTableNode&>(*original_node).table_name);
+        }
+        boost::hash_combine(hash, column_expression.original_column_id);
+        return ExpressionVisitation::DoNotVisitArguments;
+      }
+      default:
+        return ExpressionVisitation::VisitArguments;
+    }
+  });
+
+  if (!supported) {
+    return std::nullopt;
+  }
+  return hash;
+}
+
+// Join predicates are hashed independently of the order of their operands, i.e., `a = b` and `b = a` are equal.
+std::optional<size_t> predicate_hash(const std::shared_ptr<AbstractExpression>& predicate) {
+  const auto binary_predicate = std::dynamic_pointer_cast<BinaryPredicateExpression>(predicate);
+  if (!binary_predicate || !is_binary_numeric_predicate_condition(binary_predicate->predicate_condition)) {
+    return expression_hash(predicate);
+  }
+
+  const auto left_hash = expression_hash(binary_predicate->left_operand());
+  const auto right_hash = expression_hash(binary_predicate->right_operand());
+  if (!left_hash || !right_hash) {
+    return std::nullopt;
+  }
+
+  auto predicate_condition = binary_predicate->predicate_condition;
+  auto hash = size_t{0};
+  if (*left_hash <= *right_hash) {
+    boost::hash_combine(hash, *left_hash);
+    boost::hash_combine(hash, *right_hash);
+  } else {
+    predicate_condition = flip_predicate_condition(predicate_condition);
+    boost::hash_combine(hash, *right_hash);
+    boost::hash_combine(hash, *left_hash);
+  }
+  boost::hash_combine(hash, predicate_condition);
+  return mix(hash);
+}
+
+using SubplanHash = CardinalityFeedback::SubplanHash;
+using SubplanHashes = CardinalityFeedback::SubplanHashes;
+
+std::optional<SubplanHash> memoized_node_hash(const AbstractLQPNode& node, SubplanHashes* memo);
+
+// Semi-join reductions only reduce the input of another node and do not change its result.
+std::optional<SubplanHash> input_hash(const std::shared_ptr<AbstractLQPNode>& input, SubplanHashes* memo) {
+  auto reduced_input = input;
+  while (reduced_input->type == LQPNodeType::Join &&
+         static_cast<const JoinNode&>(*reduced_input).is_semi_reduction()) {
+    reduced_input = reduced_input->left_input();
+  }
+  return memoized_node_hash(*reduced_input, memo);
+}
+
+// Columns are identified by their table name (see expression_hash()). Thus, a subplan that scans a table more than
+// once (e.g., for a self-join) cannot be hashed: filtering one or the other instance of the table would result in the
+// same hash. The inputs of unions scan the same instances of the tables, so they may share table names.
+std::optional<std::vector<std::string>> merge_table_names(const SubplanHash& left_input,
+                                                          const SubplanHash& right_input, const bool allow_duplicates) {
+  auto table_names = std::vector<std::string>{};
+  table_names.reserve(left_input.table_names.size() + right_input.table_names.size());
+  std::set_union(left_input.table_names.cbegin(), left_input.table_names.cend(), right_input.table_names.cbegin(),
+                 right_input.table_names.cend(), std::back_inserter(table_names));
+  if (!allow_duplicates && table_names.size() < left_input.table_names.size() + right_input.table_names.size()) {
+    return std::nullopt;
+  }
+  return table_names;
+}
+
+// Returns the hash of @param node and sets @param table_names to the sorted names of the tables it scans.
+std::optional<size_t> node_hash(const AbstractLQPNode& node, SubplanHashes* memo,
+                                std::vector<std::string>& table_names) {
+  const auto type_hash = mix(static_cast<size_t>(node.type) + 1);
+
+  const auto single_input_hash = [&](const std::shared_ptr<AbstractLQPNode>& input) -> std::optional<size_t> {
+    auto hash = input_hash(input, memo);
+    if (!hash) {
+      return std::nullopt;
+    }
+    table_names = std::move(hash->table_names);
+    return hash->hash;
+  };
+
+  const auto input_hashes = [&](const bool allow_duplicate_tables) -> std::optional<std::pair<size_t, size_t>> {
+    const auto left_input = input_hash(node.left_input(), memo);
+    const auto right_input = input_hash(node.right_input(), memo);
+    if (!left_input || !right_input) {
+      return std::nullopt;
+    }
+
+    auto merged_table_names = merge_table_names(*left_input, *right_input, allow_duplicate_tables);
+    if (!merged_table_names) {
+      return std::nullopt;
+    }
+    table_names = std::move(*merged_table_names);
+    return std::pair{left_input->hash, right_input->hash};
+  };
+
+  switch (node.type) {
+    case LQPNodeType::StoredTable: {
+      const auto& table_name = static_cast<const StoredTableNode&>(node).table_name;
+      table_names = {table_name};
+      return mix(type_hash ^ std::hash<std::string>{}(table_name));
+    }
+
+    case LQPNodeType::Alias:
+    case LQPNodeType::Projection:
+    case LQPNodeType::Sort:
+      return single_input_hash(node.left_input());
+
+    case LQPNodeType::Validate: {
+      const auto input = single_input_hash(node.left_input());
+      if (!input) {
+        return std::nullopt;
+      }
+      return *input + type_hash;
+    }
+
+    case LQPNodeType::Predicate: {
+      const auto input = single_input_hash(node.left_input());
+      const auto predicate = predicate_hash(node.node_expressions.front());
+      if (!input || !predicate) {
+        return std::nullopt;
+      }
+      return *input + *predicate;
+    }
+
+    case LQPNodeType::Join: {
+      const auto& join_node = static_cast<const JoinNode&>(node);
+      const auto inputs = input_hashes(false);
+      if (!inputs) {
+        return std::nullopt;
+      }
+      const auto [left_input, right_input] = *inputs;
+
+      // Inner joins equal cross joins with predicates on top.
+      if (join_node.join_mode == JoinMode::Inner || join_node.join_mode == JoinMode::Cross) {
+        auto hash = left_input + right_input + mix(static_cast<size_t>(JoinMode::Cross) + 1);
+        for (const auto& join_predicate : join_node.join_predicates()) {
+          const auto predicate = predicate_hash(join_predicate);
+          if (!predicate) {
+            return std::nullopt;
+          }
+          hash += *predicate;
+        }
+        return hash;
+      }
+
+      // Other joins are not commutative. Their predicates cannot be moved either.
+      auto hash = size_t{0};
+      boost::hash_combine(hash, join_node.join_mode);
+      boost::hash_combine(hash, right_input);
+      for (const auto& join_predicate : join_node.join_predicates()) {
+        const auto predicate = expression_hash(join_predicate);
+        if (!predicate) {
+          return std::nullopt;
+        }
+        boost::hash_combine(hash, *predicate);
+      }
+      return left_input + mix(hash ^ type_hash);
+    }
+
+    case LQPNodeType::Union: {
+      const auto inputs = input_hashes(true);
+      if (!inputs) {
+        return std::nullopt;
+      }
+      const auto [left_input, right_input] = *inputs;
+
+      auto hash = type_hash;
+      boost::hash_combine(hash, static_cast<const UnionNode&>(node).set_operation_mode);
+      boost::hash_combine(hash, std::min(left_input, right_input));
+      boost::hash_combine(hash, std::max(left_input, right_input));
+      return mix(hash);
+    }
+
+    case LQPNodeType::Aggregate:
+    case LQPNodeType::Limit: {
+      const auto input = single_input_hash(node.left_input());
+      if (!input) {
+        return std::nullopt;
+      }
+
+      auto hash = type_hash;
+      boost::hash_combine(hash, *input);
+      for (const auto& node_expression : node.node_expressions) {
+        const auto expression = expression_hash(node_expression);
+        if (!expression) {
+          return std::nullopt;
+        }
+        boost::hash_combine(hash, *expression);
+      }
+      return mix(hash);
+    }
+
+    default:
+      // The data of MockNodes and StaticTableNodes is unknown. Other nodes are rare enough not to be tracked.
+      return std::nullopt;
+  }
+}
+
+std::optional<SubplanHash> memoized_node_hash(const AbstractLQPNode& node, SubplanHashes* memo) {
+  if (memo) {
+    const auto memo_iter = memo->find(node.shared_from_this());
+    if (memo_iter != memo->end()) {
+      return memo_iter->second;
+    }
+  }
+
+  auto subplan_hash = std::optional<SubplanHash>{};
+  auto table_names = std::vector<std::string>{};
+  if (const auto hash = node_hash(node, memo, table_names)) {
+    subplan_hash = SubplanHash{*hash, std::move(table_names)};
+  }
+
+  if (memo) {
+    memo->emplace(node.shared_from_this(), subplan_hash);
+  }
+  return subplan_hash;
+}
+
+}  // namespace
+
+namespace hyrise {
+
+CardinalityFeedback::CardinalityFeedback(const std::optional<float> init_reoptimization_threshold,
+                                         const size_t capacity)
+    : reoptimization_threshold(init_reoptimization_threshold), _cardinalities(capacity) {
+  Assert(!reoptimization_threshold || *reoptimization_threshold > 1.0f, "Threshold must be a factor greater than 1.");
+}
+
+std::optional<size_t> CardinalityFeedback::subplan_hash(const AbstractLQPNode& lqp, SubplanHashes* memo) {
+  const auto hash = memoized_node_hash(lqp, memo);
+  if (!hash) {
+    return std::nullopt;
+  }
+  return hash->hash;
+}
+
+void CardinalityFeedback::record(const AbstractLQPNode& lqp, const Cardinality cardinality, SubplanHashes* memo) {
+  if (const auto hash = subplan_hash(lqp, memo)) {
+    _cardinalities.set(*hash, cardinality);
+  }
+}
+
+std::optional<Cardinality> CardinalityFeedback::try_get(const AbstractLQPNode& lqp, SubplanHashes* memo) {
+  const auto hash = subplan_hash(lqp, memo);
+  if (!hash) {
+    return std::nullopt;
+  }
+  return _cardinalities.try_get(*hash);
+}
+
+bool CardinalityFeedback::requires_reoptimization(const Cardinality estimated_cardinality,
+                                                  const Cardinality observed_cardinality) const {
+  if (!reoptimization_threshold) {
+    return false;
+  }
+
+  // Cardinalities below one are treated as one to avoid dividing by zero.
+  const auto lower = std::max(std::min(estimated_cardinality, observed_cardinality), Cardinality{1});
+  const auto upper = std::max(std::max(estimated_cardinality, observed_cardinality), Cardinality{1});
+  return upper / lower > *reoptimization_threshold;
+}
+
+size_t CardinalityFeedback::size() const {
+  return _cardinalities.size();
+}
+
+void CardinalityFeedback::clear() {
+  _cardinalities.clear();
+}
+
+}  // namespace hyrise
@@ -0,0 +1,76 @@
+#pragma once
+
+#include <memory>
+#include <optional>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "cache/sharded_gdfs_cache.hpp"
+#include "types.hpp"
+
+namespace hyrise {
+
+class AbstractLQPNode;
+
+/**
+ * Store for the output cardinalities that operators observed during execution (see OperatorPerformanceData). The
+ * CardinalityEstimator prefers these over the estimations based on histograms, which suffer from compounding errors
+ * due to the independence assumption. Thus, the JoinOrderingRule picks better join orders for queries that ran
+ * before.
+ *
+ * Cardinalities are stored for the subplan_hash() of an LQP. During join ordering, the candidate plans differ from the
+ * executed plan in the order of their joins, in the placement of their predicates, and in the pruning of chunks and
+ * columns. Hence, the hash of a subplan must not depend on these properties (see subplan_hash()).
+ *
+ * If reoptimization_threshold is set, SQLPipelineStatement::get_result_table() executes the inputs of the joins first
+ * and re-optimizes the remaining plan if their cardinalities differ from the estimations by more than this factor.
+ */
+class CardinalityFeedback : public Noncopyable {
+ public:
+  explicit CardinalityFeedback(const std::optional<float> init_reoptimization_threshold = std::nullopt,
+                               const size_t capacity = DEFAULT_CACHE_CAPACITY * 64);
+
+  // Hashes of subplans and the tables they scan, memoized per node (see subplan_hash()).
+  struct SubplanHash {
+    size_t hash;
+    // Sorted names of the scanned tables.
+    std::vector<std::string> table_names;
+  };
+  using SubplanHashes = std::unordered_map<std::shared_ptr<const AbstractLQPNode>, std::optional<SubplanHash>>;
+
+  /**
+   * Returns a hash of @param lqp that is equal for plans that produce the same rows, or std::nullopt if @param lqp
+   * contains nodes or expressions that we do not track (e.g., MockNodes, placeholders, or subqueries). The hash
+   * - ignores pruned chunks and columns of StoredTableNodes,
+   * - ignores Sort, Projection, and Alias nodes as they do not change the cardinality,
+   * - is independent of the order of inner and cross joins and of the placement of predicates below them, and
+   * - does not include semi-join reductions (see JoinNode::is_semi_reduction()) below other nodes. They do not change
+   *   the result of the node that they reduce the input of.
+   * Columns are identified by their table and column id. Thus, plans that scan a table more than once (e.g., for
+   * self-joins) are not hashed, as filtering one or the other scan would result in the same hash.
+   *
+   * If @param memo is given, the hashes of all nodes of @param lqp are memoized there. This is only valid as long as
+   * the memoized LQPs are not modified (e.g., during join ordering, see guarantee_bottom_up_construction()).
+   */
+  static std::optional<size_t> subplan_hash(const AbstractLQPNode& lqp, SubplanHashes* memo = nullptr);
+
+  void record(const AbstractLQPNode& lqp, const Cardinality cardinality, SubplanHashes* memo = nullptr);
+
+  std::optional<Cardinality> try_get(const AbstractLQPNode& lqp, SubplanHashes* memo = nullptr);
+
+  // Returns true if @param observed_cardinality differs from @param estimated_cardinality by more than the
+  // reoptimization_threshold.
+  bool requires_reoptimization(const Cardinality estimated_cardinality, const Cardinality observed_cardinality) const;
+
+  size_t size() const;
+
+  void clear();
+
+  const std::optional<float> reoptimization_threshold;
+
+ private:
+  ShardedGDFSCache<size_t, Cardinality> _cardinalities;
+};
+
+}  // namespace hyrise
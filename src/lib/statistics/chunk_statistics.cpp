@@ -0,0 +1,51 @@
+#include "chunk_statistics.hpp"
+
+#include "column_group_statistics.hpp"
+#include "resolve_type.hpp"
+#include "statistics/statistics_objects/equal_distinct_count_histogram.hpp"
+#include "statistics/table_statistics.hpp"
+#include "storage/chunk.hpp"
+#include "storage/segment_iterate.hpp"
+#include "utils/assert.hpp"
+
+namespace hyrise {
+
+std::shared_ptr<ChunkStatistics> ChunkStatistics::from_chunk(const Chunk& chunk,
+                                                             const std::vector<DataType>& column_data_types) {
+  const auto column_count = chunk.column_count();
+  Assert(column_data_types.size() == static_cast<size_t>(column_count),
+         "Number of column types must match the chunk’s column count.");
+
+  const auto row_count = chunk.size();
+  const auto histogram_bin_count = TableStatistics::histogram_bin_count(row_count);
+
+  auto histograms = std::vector<std::shared_ptr<const AbstractStatisticsObject>>(column_count);
+  auto distinct_count_sketches = std::vector<HyperLogLog>(column_count, HyperLogLog{SKETCH_PRECISION});
+  for (auto column_id = ColumnID{0}; column_id < column_count; ++column_id) {
+    const auto& segment = *chunk.get_segment(column_id);
+    resolve_data_type(column_data_types[column_id], [&](const auto data_type_t) {
+      using ColumnDataType = typename decltype(data_type_t)::type;
+
+      histograms[column_id] = EqualDistinctCountHistogram<ColumnDataType>::from_segment(segment, histogram_bin_count);
+
+      auto& sketch = distinct_count_sketches[column_id];
+      segment_iterate<ColumnDataType>(segment, [&](const auto& position) {
+        sketch.add(position.is_null() ? ColumnGroupStatistics::NULL_VALUE_HASH
+                                      : std::hash<ColumnDataType>{}(position.value()));
+      });
+    });
+  }
+
+  return std::make_shared<ChunkStatistics>(row_count, std::move(histograms), std::move(distinct_count_sketches));
+}
+
+ChunkStatistics::ChunkStatistics(const ChunkOffset init_row_count,
+                                 std::vector<std::shared_ptr<const AbstractStatisticsObject>>&& init_histograms,
+                                 std::vector<HyperLogLog>&& init_distinct_count_sketches)
+    : row_count(init_row_count),
+      histograms(std::move(init_histograms)),
+      distinct_count_sketches(std::move(init_distinct_count_sketches)) {
+  Assert(histograms.size() == distinct_count_sketches.size(), "Expected one histogram and one sketch per column.");
+}
+
+}  // namespace hyrise
@@ -0,0 +1,45 @@
+#pragma once
+
+#include <memory>
+#include <vector>
+
+#include "all_type_variant.hpp"
+#include "statistics/statistics_objects/hyper_log_log.hpp"
+#include "types.hpp"
+
+namespace hyrise {
+
+class AbstractStatisticsObject;
+class Chunk;
+
+/**
+ * Statistics on the values of a single chunk that can be merged into the statistics of its table (see
+ * TableStatistics::from_chunk_statistics()). Unlike the statistics of a table, they do not become stale when rows are
+ * inserted, as only immutable chunks keep them. Thus, the statistics of a table can be refreshed by merging the
+ * statistics of its chunks instead of scanning the whole table again.
+ *
+ * ChunkEncoder::encode_chunk() creates them together with the pruning statistics.
+ */
+class ChunkStatistics {
+ public:
+  // The sketches of all chunks are merged. Thus, a lower precision than for single sketches keeps the memory footprint
+  // of chunks with many columns small (1 KiB per segment) without sacrificing much accuracy.
+  static constexpr auto SKETCH_PRECISION = uint8_t{10};
+
+  static std::shared_ptr<ChunkStatistics> from_chunk(const Chunk& chunk,
+                                                     const std::vector<DataType>& column_data_types);
+
+  ChunkStatistics(const ChunkOffset init_row_count,
+                  std::vector<std::shared_ptr<const AbstractStatisticsObject>>&& init_histograms,
+                  std::vector<HyperLogLog>&& init_distinct_count_sketches);
+
+  const ChunkOffset row_count;
+
+  // One EqualDistinctCountHistogram of the non-NULL values per column. nullptr if a segment only contains NULLs.
+  const std::vector<std::shared_ptr<const AbstractStatisticsObject>> histograms;
+
+  // One HyperLogLog sketch per column. Like the sketches of ColumnGroupStatistics, they count NULL as a value.
+  const std::vector<HyperLogLog> distinct_count_sketches;
+};
+
+}  // namespace hyrise
@@ -0,0 +1,302 @@
+#include "column_group_statistics.hpp"
+
+#include <algorithm>
+#include <functional>
+#include <map>
+
+#include <boost/container_hash/hash.hpp>
+
+#include "all_parameter_variant.hpp"
+#include "lossy_cast.hpp"
+#include "operators/operator_scan_predicate.hpp"
+#include "resolve_type.hpp"
+#include "storage/segment_iterate.hpp"
+#include "storage/table.hpp"
+#include "utils/assert.hpp"
+
+namespace {
+
+using namespace hyrise;  // NOLINT
+
+bool is_supported_predicate(const OperatorScanPredicate& predicate) {
+  switch (predicate.predicate_condition) {
+    case PredicateCondition::IsNull:
+    case PredicateCondition::IsNotNull:
+      return true;
+
+    case PredicateCondition::Equals:
+    case PredicateCondition::NotEquals:
+    case PredicateCondition::LessThan:
+    case PredicateCondition::LessThanEquals:
+    case PredicateCondition::GreaterThan:
+    case PredicateCondition::GreaterThanEquals:
+      return is_variant(predicate.value);
+
+    case PredicateCondition::BetweenInclusive:
+    case PredicateCondition::BetweenLowerExclusive:
+    case PredicateCondition::BetweenUpperExclusive:
+    case PredicateCondition::BetweenExclusive:
+      return is_variant(predicate.value) && predicate.value2 && is_variant(*predicate.value2);
+
+    default:
+      return false;
+  }
+}
+
+// A predicate on the values of one column of the sampled bins. The search values are cast to the data type of the
+// column once rather than for every bin.
+struct BinPredicate {
+  // Index of the values in the bins.
+  size_t value_idx;
+
+  std::function<bool(const AllTypeVariant&)> matches;
+
+  // Set for predicates that select a range of values (=, <, <=, >, >=, and BETWEEN). They return whether a non-NULL
+  // value is below or above the range. As the bins are sorted by their values, they allow to binary search the range
+  // of bins that match a predicate on the first column.
+  std::function<bool(const AllTypeVariant&)> is_below_range;
+  std::function<bool(const AllTypeVariant&)> is_above_range;
+};
+
+BinPredicate make_bin_predicate(const OperatorScanPredicate& predicate, const size_t value_idx,
+                                const std::optional<DataType> column_data_type) {
+  const auto predicate_condition = predicate.predicate_condition;
+  if (predicate_condition == PredicateCondition::IsNull || predicate_condition == PredicateCondition::IsNotNull) {
+    const auto is_null = predicate_condition == PredicateCondition::IsNull;
+    return {value_idx, [is_null](const AllTypeVariant& value) { return variant_is_null(value) == is_null; }, {}, {}};
+  }
+
+  // Comparisons with NULL are never true. If all sampled values of the column are NULL, the column has no data type.
+  auto bin_predicate = BinPredicate{value_idx, [](const AllTypeVariant& /*value*/) { return false; }, {}, {}};
+  if (!column_data_type) {
+    return bin_predicate;
+  }
+
+  resolve_data_type(*column_data_type, [&](const auto data_type_t) {
+    using ColumnDataType = typename decltype(data_type_t)::type;
+
+    const auto search_value = lossy_variant_cast<ColumnDataType>(boost::get<AllTypeVariant>(predicate.value));
+    if (!search_value) {
+      return;
+    }
+
+    if (predicate_condition == PredicateCondition::NotEquals) {
+      bin_predicate.matches = [not_equals_value = *search_value](const AllTypeVariant& value) {
+        return !variant_is_null(value) && boost::get<ColumnDataType>(value) != not_equals_value;
+      };
+      return;
+    }
+
+    auto lower_bound = std::optional<ColumnDataType>{};
+    auto upper_bound = std::optional<ColumnDataType>{};
+    auto lower_bound_inclusive = true;
+    auto upper_bound_inclusive = true;
+    switch (predicate_condition) {
+      case PredicateCondition::Equals:
+        lower_bound = search_value;
+        upper_bound = search_value;
+        break;
+      case PredicateCondition::LessThan:
+      case PredicateCondition::LessThanEquals:
+        upper_bound = search_value;
+        upper_bound_inclusive = predicate_condition == PredicateCondition::LessThanEquals;
+        break;
+      case PredicateCondition::GreaterThan:
+      case PredicateCondition::GreaterThanEquals:
+        lower_bound = search_value;
+        lower_bound_inclusive = predicate_condition == PredicateCondition::GreaterThanEquals;
+        break;
+      default:
+        upper_bound = lossy_variant_cast<ColumnDataType>(boost::get<AllTypeVariant>(*predicate.value2));
+        if (!upper_bound) {
+          return;
+        }
+        lower_bound = search_value;
+        lower_bound_inclusive = is_lower_inclusive_between(predicate_condition);
+        upper_bound_inclusive = is_upper_inclusive_between(predicate_condition);
+    }
+
+    bin_predicate.is_below_range = [lower_bound, lower_bound_inclusive](const AllTypeVariant& value) {
+      if (!lower_bound) {
+        return false;
+      }
+      const auto& typed_value = boost::get<ColumnDataType>(value);
+      return lower_bound_inclusive ? typed_value < *lower_bound : typed_value <= *lower_bound;
+    };
+    bin_predicate.is_above_range = [upper_bound, upper_bound_inclusive](const AllTypeVariant& value) {
+      if (!upper_bound) {
+        return false;
+      }
+      const auto& typed_value = boost::get<ColumnDataType>(value);
+      return upper_bound_inclusive ? typed_value > *upper_bound : typed_value >= *upper_bound;
+    };
+    bin_predicate.matches = [is_below_range = bin_predicate.is_below_range,
+                             is_above_range = bin_predicate.is_above_range](const AllTypeVariant& value) {
+      return !variant_is_null(value) && !is_below_range(value) && !is_above_range(value);
+    };
+  });
+
+  return bin_predicate;
+}
+
+}  // namespace
+
+namespace hyrise {
+
+std::shared_ptr<ColumnGroupStatistics> ColumnGroupStatistics::from_table(const Table& table,
+                                                                         std::vector<ColumnID> column_ids,
+                                                                         const size_t sample_size) {
+  std::sort(column_ids.begin(), column_ids.end());
+
+  auto distinct_count_sketch = HyperLogLog{};
+  auto sample_frequencies = std::map<std::vector<AllTypeVariant>, Cardinality>{};
+
+  // Systematic sample: every sample_step-th row is part of the sample.
+  const auto sample_step = sample_size == 0 ? uint64_t{0} : std::max(uint64_t{1}, table.row_count() / sample_size);
+  auto next_sample_row = uint64_t{0};
+  auto chunk_begin_row = uint64_t{0};
+
+  auto row_hashes = std::vector<size_t>{};
+  const auto chunk_count = table.chunk_count();
+  for (auto chunk_id = ChunkID{0}; chunk_id < chunk_count; ++chunk_id) {
+    const auto chunk = table.get_chunk(chunk_id);
+    if (!chunk) {
+      continue;
+    }
+
+    // Hash the value combination of each row by combining the hashes of its values column by column.
+    const auto chunk_size = static_cast<uint64_t>(chunk->size());
+    row_hashes.assign(chunk_size, size_t{0});
+    for (const auto column_id : column_ids) {
+      resolve_data_type(table.column_data_type(column_id), [&](const auto data_type_t) {
+        using ColumnDataType = typename decltype(data_type_t)::type;
+
+        segment_iterate<ColumnDataType>(*chunk->get_segment(column_id), [&](const auto& position) {
+          const auto value_hash = position.is_null() ? NULL_VALUE_HASH : std::hash<ColumnDataType>{}(position.value());
+          boost::hash_combine(row_hashes[position.chunk_offset()], value_hash);
+        });
+      });
+    }
+
+    for (const auto row_hash : row_hashes) {
+      distinct_count_sketch.add(row_hash);
+    }
+
+    if (sample_step > 0) {
+      while (next_sample_row < chunk_begin_row + chunk_size) {
+        const auto chunk_offset = ChunkOffset{static_cast<ChunkOffset::base_type>(next_sample_row - chunk_begin_row)};
+        auto values = std::vector<AllTypeVariant>{};
+        values.reserve(column_ids.size());
+        for (const auto column_id : column_ids) {
+          values.emplace_back((*chunk->get_segment(column_id))[chunk_offset]);
+        }
+        ++sample_frequencies[values];
+        next_sample_row += sample_step;
+      }
+    }
+
+    chunk_begin_row += chunk_size;
+  }
+
+  auto sampled_histogram = std::vector<SampledBin>{};
+  sampled_histogram.reserve(sample_frequencies.size());
+  for (const auto& [values, height] : sample_frequencies) {
+    sampled_histogram.emplace_back(SampledBin{values, height});
+  }
+
+  return std::make_shared<ColumnGroupStatistics>(std::move(column_ids), std::move(distinct_count_sketch),
+                                                 std::move(sampled_histogram));
+}
+
+ColumnGroupStatistics::ColumnGroupStatistics(std::vector<ColumnID>&& init_column_ids,
+                                             HyperLogLog&& init_distinct_count_sketch,
+                                             std::vector<SampledBin>&& init_sampled_histogram)
+    : column_ids(std::move(init_column_ids)),
+      distinct_count_sketch(std::move(init_distinct_count_sketch)),
+      sampled_histogram(std::move(init_sampled_histogram)) {
+  Assert(!column_ids.empty(), "Column group must not be empty.");
+  Assert(std::is_sorted(column_ids.cbegin(), column_ids.cend()) &&
+             std::adjacent_find(column_ids.cbegin(), column_ids.cend()) == column_ids.cend(),
+         "Column ids of a column group must be sorted and unique.");
+
+  DebugAssert(std::is_sorted(sampled_histogram.cbegin(), sampled_histogram.cend(),
+                             [](const auto& lhs, const auto& rhs) { return lhs.values < rhs.values; }),
+              "Sampled bins must be sorted by their values.");
+
+  _column_data_types.resize(column_ids.size());
+  for (const auto& bin : sampled_histogram) {
+    DebugAssert(bin.values.size() == column_ids.size(), "Expected one value per column in each bin.");
+    _sampled_row_count += bin.height;
+
+    const auto value_count = bin.values.size();
+    for (auto value_idx = size_t{0}; value_idx < value_count; ++value_idx) {
+      if (!_column_data_types[value_idx] && !variant_is_null(bin.values[value_idx])) {
+        _column_data_types[value_idx] = data_type_from_all_type_variant(bin.values[value_idx]);
+      }
+    }
+  }
+}
+
+bool ColumnGroupStatistics::covers(const std::vector<ColumnID>& other_column_ids) const {
+  return std::all_of(other_column_ids.cbegin(), other_column_ids.cend(), [&](const auto column_id) {
+    return std::binary_search(column_ids.cbegin(), column_ids.cend(), column_id);
+  });
+}
+
+bool ColumnGroupStatistics::can_estimate(const OperatorScanPredicate& predicate) const {
+  return !sampled_histogram.empty() && is_supported_predicate(predicate) &&
+         std::binary_search(column_ids.cbegin(), column_ids.cend(), predicate.column_id);
+}
+
+Cardinality ColumnGroupStatistics::distinct_count() const {
+  return distinct_count_sketch.estimate_distinct_count();
+}
+
+std::optional<Selectivity> ColumnGroupStatistics::estimate_selectivity(
+    const std::vector<OperatorScanPredicate>& predicates) const {
+  auto bin_predicates = std::vector<BinPredicate>{};
+  bin_predicates.reserve(predicates.size());
+  for (const auto& predicate : predicates) {
+    if (!can_estimate(predicate)) {
+      return std::nullopt;
+    }
+
+    // Resolve the column of the predicate to the index of the values in the bins.
+    const auto column_iter = std::lower_bound(column_ids.cbegin(), column_ids.cend(), predicate.column_id);
+    const auto value_idx = static_cast<size_t>(std::distance(column_ids.cbegin(), column_iter));
+    bin_predicates.emplace_back(make_bin_predicate(predicate, value_idx, _column_data_types[value_idx]));
+  }
+
+  // The bins are sorted by their values, NULLs first. Thus, the bins whose first value is in the range of a predicate
+  // are adjacent, and we only evaluate the other predicates for them.
+  auto bins_begin = sampled_histogram.cbegin();
+  auto bins_end = sampled_histogram.cend();
+  for (const auto& bin_predicate : bin_predicates) {
+    if (bin_predicate.value_idx != 0 || !bin_predicate.is_below_range) {
+      continue;
+    }
+
+    bins_begin = std::partition_point(bins_begin, bins_end, [&](const auto& bin) {
+      return variant_is_null(bin.values[0]) || bin_predicate.is_below_range(bin.values[0]);
+    });
+    bins_end = std::partition_point(bins_begin, bins_end, [&](const auto& bin) {
+      return !bin_predicate.is_above_range(bin.values[0]);
+    });
+  }
+
+  auto matching_height = Cardinality{0};
+  for (auto bin_iter = bins_begin; bin_iter != bins_end; ++bin_iter) {
+    const auto& values = bin_iter->values;
+    const auto matches = std::all_of(bin_predicates.cbegin(), bin_predicates.cend(), [&](const auto& bin_predicate) {
+      return bin_predicate.matches(values[bin_predicate.value_idx]);
+    });
+
+    if (matches) {
+      matching_height += bin_iter->height;
+    }
+  }
+
+  return Selectivity{matching_height / _sampled_row_count};
+}
+
+}  // namespace hyrise
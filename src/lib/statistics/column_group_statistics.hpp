@@ -0,0 +1,81 @@
+#pragma once
+
+#include <memory>
+#include <optional>
+#include <vector>
+
+#include "all_type_variant.hpp"
+#include "statistics/statistics_objects/hyper_log_log.hpp"
+#include "types.hpp"
+
+namespace hyrise {
+
+class Table;
+struct OperatorScanPredicate;
+
+/**
+ * Statistics on the joint distribution of a group of columns of a stored table, e.g., of `city` and `zip`. Without
+ * them, the CardinalityEstimator assumes that the values of different columns are independent, which underestimates
+ * conjunctive predicates and overestimates the number of groups of an aggregate on correlated columns.
+ *
+ * - distinct_count_sketch: HyperLogLog sketch of the value combinations of all rows. Used to estimate the output
+ *   cardinality of AggregateNodes that group by these columns. TableStatistics::from_table() creates one for each
+ *   single column.
+ * - sampled_histogram: frequencies of the value combinations in a systematic sample of the rows. Each bin is one
+ *   distinct combination. Used to estimate the selectivity of conjunctive predicates on the columns, including
+ *   combinations of values that never occur together. Empty if the statistics were created with a sample_size of 0.
+ *
+ * Groups of more than one column are not created automatically. Add them to TableStatistics::column_group_statistics
+ * of the stored table for columns that are known to be correlated. This is not thread-safe and should happen before
+ * queries are optimized.
+ */
+class ColumnGroupStatistics {
+ public:
+  static constexpr auto DEFAULT_SAMPLE_SIZE = size_t{10'000};
+
+  // Hash that the distinct count sketches use for NULLs. NULLs form a group of their own, as in the Aggregate
+  // operators.
+  static constexpr auto NULL_VALUE_HASH = size_t{0x9e3779b97f4a7c15};
+
+  struct SampledBin {
+    std::vector<AllTypeVariant> values;
+    Cardinality height;
+  };
+
+  static std::shared_ptr<ColumnGroupStatistics> from_table(const Table& table, std::vector<ColumnID> column_ids,
+                                                           const size_t sample_size = DEFAULT_SAMPLE_SIZE);
+
+  ColumnGroupStatistics(std::vector<ColumnID>&& init_column_ids, HyperLogLog&& init_distinct_count_sketch,
+                        std::vector<SampledBin>&& init_sampled_histogram);
+
+  bool covers(const std::vector<ColumnID>& other_column_ids) const;
+
+  // Returns true if the sampled histogram exists and @param predicate can be evaluated on it (see
+  // estimate_selectivity()).
+  bool can_estimate(const OperatorScanPredicate& predicate) const;
+
+  Cardinality distinct_count() const;
+
+  /**
+   * Estimates the fraction of rows that satisfy all @param predicates from the sampled histogram. The column ids of the
+   * predicates refer to the stored table. Returns std::nullopt if can_estimate() is false for any of the predicates,
+   * e.g., for LIKE, comparisons of two columns, or columns that are not part of the group.
+   */
+  std::optional<Selectivity> estimate_selectivity(const std::vector<OperatorScanPredicate>& predicates) const;
+
+  // Sorted ascendingly.
+  const std::vector<ColumnID> column_ids;
+
+  HyperLogLog distinct_count_sketch;
+
+  // The values of each bin are ordered like column_ids. The bins are sorted by their values.
+  const std::vector<SampledBin> sampled_histogram;
+
+ private:
+  // Data types of the columns, taken from the sampled values. std::nullopt if all sampled values of a column are NULL.
+  std::vector<std::optional<DataType>> _column_data_types;
+
+  Cardinality _sampled_row_count{0};
+};
+
+}  // namespace hyrise
@@ -8,6 +8,7 @@
 #include "operators/table_wrapper.hpp"
 #include "resolve_type.hpp"
 #include "statistics/attribute_statistics.hpp"
+#include "statistics/statistics_objects/bloom_filter.hpp"
 #include "statistics/statistics_objects/equal_distinct_count_histogram.hpp"
 #include "statistics/statistics_objects/generic_histogram_builder.hpp"
 #include "statistics/statistics_objects/min_max_filter.hpp"
@@ -36,6 +37,21 @@ void create_pruning_statistics_for_segment(AttributeStatistics<T>& segment_stati
   if (pruning_statistics) {
     segment_statistics.set_statistics_object(pruning_statistics);
   }
+
+  // Min/max and range filters cannot prune equality predicates on unclustered, high-cardinality segments. Bloom filters
+  // can, but they are only worth their memory if the other filter is not exact: a RangeFilter with at most
+  // DEFAULT_MAX_RANGES_COUNT values stores each value as a range of its own, and a MinMaxFilter is exact for a single
+  // value.
+  auto other_filter_is_exact = false;
+  if constexpr (std::is_arithmetic_v<T>) {
+    other_filter_is_exact = dictionary.size() <= DEFAULT_MAX_RANGES_COUNT;
+  } else {
+    other_filter_is_exact = dictionary.size() <= 1;
+  }
+
+  if (!other_filter_is_exact) {
+    segment_statistics.set_statistics_object(BloomFilter<T>::build_filter(dictionary));
+  }
 }
 
 }  // namespace
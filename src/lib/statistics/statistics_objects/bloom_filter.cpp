@@ -0,0 +1,133 @@
+#include "bloom_filter.hpp"
+
+#include <algorithm>
+#include <array>
+#include <functional>
+#include <memory>
+#include <optional>
+#include <vector>
+
+#include "resolve_type.hpp"
+#include "utils/assert.hpp"
+
+namespace {
+
+using namespace hyrise;  // NOLINT
+
+// Multipliers that derive the bit positions within a block from a single hash value (taken from the Parquet
+// specification of split block Bloom filters).
+constexpr auto SALTS = std::array<uint32_t, 8>{0x47b6137bU, 0x44974d91U, 0x8824ad5bU, 0xa2b7289dU,
+                                               0x705495c7U, 0x2df1424bU, 0x9efc4947U, 0x5c6bfb31U};
+
+// Block with exactly one bit set per word.
+template <typename Block>
+Block block_mask(const uint32_t hash) {
+  auto mask = Block{};
+  for (auto word_idx = size_t{0}; word_idx < mask.size(); ++word_idx) {
+    mask[word_idx] = uint32_t{1} << ((hash * SALTS[word_idx]) >> 27);
+  }
+  return mask;
+}
+
+// Maps the upper half of the hash to [0, block_count) without a modulo.
+size_t block_index(const uint64_t hash, const size_t block_count) {
+  return static_cast<size_t>(((hash >> 32) * block_count) >> 32);
+}
+
+}  // namespace
+
+namespace hyrise {
+
+template <typename T>
+BloomFilter<T>::BloomFilter(const std::shared_ptr<const std::vector<Block>>& init_blocks)
+    : AbstractStatisticsObject(data_type_from_type<T>()), _blocks(init_blocks) {
+  Assert(_blocks && !_blocks->empty(), "BloomFilter requires at least one block.");
+}
+
+template <typename T>
+std::shared_ptr<BloomFilter<T>> BloomFilter<T>::build_filter(const pmr_vector<T>& distinct_values,
+                                                             const size_t bits_per_value) {
+  Assert(bits_per_value > 0, "BloomFilter requires at least one bit per value.");
+  constexpr auto BLOCK_BIT_COUNT = BLOCK_WORD_COUNT * 32;
+  const auto block_count = std::max(size_t{1}, (distinct_values.size() * bits_per_value + BLOCK_BIT_COUNT - 1) /
+                                                   BLOCK_BIT_COUNT);
+
+  auto blocks = std::make_shared<std::vector<Block>>(block_count);
+  for (const auto& value : distinct_values) {
+    const auto hash = _hash(value);
+    auto& block = (*blocks)[block_index(hash, block_count)];
+    const auto mask = block_mask<Block>(static_cast<uint32_t>(hash));
+    for (auto word_idx = size_t{0}; word_idx < BLOCK_WORD_COUNT; ++word_idx) {
+      block[word_idx] |= mask[word_idx];
+    }
+  }
+
+  return std::make_shared<BloomFilter<T>>(blocks);
+}
+
+template <typename T>
+bool BloomFilter<T>::may_contain(const T& value) const {
+  const auto hash = _hash(value);
+  const auto& block = (*_blocks)[block_index(hash, _blocks->size())];
+  const auto mask = block_mask<Block>(static_cast<uint32_t>(hash));
+
+  // Combine the word tests without branches so that the loop is vectorized.
+  auto missing_bits = uint32_t{0};
+  for (auto word_idx = size_t{0}; word_idx < BLOCK_WORD_COUNT; ++word_idx) {
+    missing_bits |= mask[word_idx] & ~block[word_idx];
+  }
+  return missing_bits == 0;
+}
+
+template <typename T>
+std::shared_ptr<AbstractStatisticsObject> BloomFilter<T>::sliced(
+    const PredicateCondition predicate_condition, const AllTypeVariant& variant_value,
+    const std::optional<AllTypeVariant>& variant_value2) const {
+  if (does_not_contain(predicate_condition, variant_value, variant_value2)) {
+    return nullptr;
+  }
+
+  // The remaining values are a subset of the filtered values, so the filter still has no false negatives.
+  return std::make_shared<BloomFilter<T>>(_blocks);
+}
+
+template <typename T>
+std::shared_ptr<AbstractStatisticsObject> BloomFilter<T>::scaled(const Selectivity /*selectivity*/) const {
+  return std::make_shared<BloomFilter<T>>(_blocks);
+}
+
+template <typename T>
+bool BloomFilter<T>::does_not_contain(const PredicateCondition predicate_condition,
+                                      const AllTypeVariant& variant_value,
+                                      const std::optional<AllTypeVariant>& /*variant_value2*/) const {
+  // Only equality predicates can be pruned. Early exit for NULL variants.
+  if (predicate_condition != PredicateCondition::Equals || variant_is_null(variant_value)) {
+    return false;
+  }
+
+  // We expect the caller (e.g., the ChunkPruningRule) to handle type-safe conversions. Boost will throw an exception
+  // if this was not done.
+  return !may_contain(boost::get<T>(variant_value));
+}
+
+template <typename T>
+size_t BloomFilter<T>::block_count() const {
+  return _blocks->size();
+}
+
+template <typename T>
+uint64_t BloomFilter<T>::_hash(const T& value) {
+  // std::hash is the identity for integers. Hence, we mix the bits using the finalizer of MurmurHash3 so that both
+  // halves of the hash are well distributed.
+  auto hash = static_cast<uint64_t>(std::hash<T>{}(value));
+  hash ^= hash >> 33;
+  hash *= 0xff51afd7ed558ccdULL;
+  hash ^= hash >> 33;
+  hash *= 0xc4ceb9fe1a85ec53ULL;
+  hash ^= hash >> 33;
+  return hash;
+}
+
+EXPLICITLY_INSTANTIATE_DATA_TYPES(BloomFilter);
+
+}  // namespace hyrise
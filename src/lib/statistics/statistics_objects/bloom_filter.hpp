@@ -0,0 +1,71 @@
+#pragma once
+
+#include <array>
+#include <memory>
+#include <optional>
+#include <vector>
+
+#include "abstract_statistics_object.hpp"
+#include "all_type_variant.hpp"
+#include "types.hpp"
+
+namespace hyrise {
+
+/**
+ * Filters are data structures that are primarily used for probabilistic membership queries. In Hyrise, they are
+ * typically created on a single segment. They can then be used to check whether a certain value exists in the segment.
+ *
+ * The BloomFilter answers equality queries for segments whose values are not clustered. For those, MinMaxFilters and
+ * RangeFilters cover almost the whole domain and rarely prune a chunk (e.g., for UUIDs or order keys). A Bloom filter
+ * has no false negatives: if does_not_contain(Equals, x) returns true, x is not part of the segment. False positives
+ * occur with a probability that depends on the number of bits per value (about 2 % for the default of eight bits).
+ *
+ * We use a split block Bloom filter (as, e.g., Apache Parquet and Impala do). The filter consists of 256-bit blocks,
+ * each made of eight 32-bit words. A value is hashed once. The upper half of the hash selects a block, the lower half
+ * is multiplied with eight salts to set one bit in each word of that block. As the blocks are aligned to 32 bytes, a
+ * lookup touches a single cache line. The eight word tests can be vectorized by the compiler.
+ *
+ * The filter is immutable. Sliced and scaled copies share its blocks.
+ */
+template <typename T>
+class BloomFilter : public AbstractStatisticsObject {
+ public:
+  static constexpr auto BLOCK_WORD_COUNT = size_t{8};
+
+  // Blocks are aligned to their size, so that no block spans two cache lines. Since C++17, std::allocator (and thus
+  // std::vector) respects this alignment.
+  struct alignas(BLOCK_WORD_COUNT * sizeof(uint32_t)) Block : std::array<uint32_t, BLOCK_WORD_COUNT> {};
+  static_assert(sizeof(Block) == BLOCK_WORD_COUNT * sizeof(uint32_t), "Blocks must not be padded.");
+
+  static constexpr auto DEFAULT_BITS_PER_VALUE = size_t{8};
+
+  explicit BloomFilter(const std::shared_ptr<const std::vector<Block>>& init_blocks);
+
+  // Builds a filter for the distinct values of a segment, e.g., for its dictionary.
+  static std::shared_ptr<BloomFilter<T>> build_filter(const pmr_vector<T>& distinct_values,
+                                                      const size_t bits_per_value = DEFAULT_BITS_PER_VALUE);
+
+  // Returns false if the value is definitely not part of the filtered values.
+  bool may_contain(const T& value) const;
+
+  std::shared_ptr<AbstractStatisticsObject> sliced(
+      const PredicateCondition predicate_condition, const AllTypeVariant& variant_value,
+      const std::optional<AllTypeVariant>& variant_value2 = std::nullopt) const override;
+
+  std::shared_ptr<AbstractStatisticsObject> scaled(const Selectivity selectivity) const override;
+
+  // Only equality predicates can be pruned. For all other predicates, false is returned.
+  bool does_not_contain(const PredicateCondition predicate_condition, const AllTypeVariant& variant_value,
+                        const std::optional<AllTypeVariant>& variant_value2 = std::nullopt) const;
+
+  size_t block_count() const;
+
+ protected:
+  static uint64_t _hash(const T& value);
+
+  const std::shared_ptr<const std::vector<Block>> _blocks;
+};
+
+EXPLICITLY_DECLARE_DATA_TYPES(BloomFilter);
+
+}  // namespace hyrise
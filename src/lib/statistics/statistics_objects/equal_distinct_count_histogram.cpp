@@ -48,6 +48,18 @@ void add_segment_to_value_distribution(const AbstractSegment& segment, ValueDist
   });
 }
 
+template <typename T>
+std::vector<std::pair<T, HistogramCountType>> sorted_value_distribution(
+    ValueDistributionMap<T>&& value_distribution_map) {
+  auto value_distribution =
+      std::vector<std::pair<T, HistogramCountType>>{value_distribution_map.begin(), value_distribution_map.end()};
+  value_distribution_map.clear();  // Maps can be large and sorting slow. Free space early.
+  boost::sort::pdqsort(value_distribution.begin(), value_distribution.end(),
+                       [&](const auto& lhs, const auto& rhs) { return lhs.first < rhs.first; });
+
+  return value_distribution;
+}
+
 template <typename T>
 std::vector<std::pair<T, HistogramCountType>> value_distribution_from_column(const Table& table,
                                                                              const ColumnID column_id,
@@ -63,14 +75,9 @@ std::vector<std::pair<T, HistogramCountType>> value_distribution_from_column(con
     add_segment_to_value_distribution<T>(*chunk->get_segment(column_id), value_distribution_map, domain);
   }
 
-  auto value_distribution =
-      std::vector<std::pair<T, HistogramCountType>>{value_distribution_map.begin(), value_distribution_map.end()};
-  value_distribution_map.clear();  // Maps can be large and sorting slow. Free space early.
-  boost::sort::pdqsort(value_distribution.begin(), value_distribution.end(),
-                       [&](const auto& lhs, const auto& rhs) { return lhs.first < rhs.first; });
-
-  return value_distribution;
+  return sorted_value_distribution(std::move(value_distribution_map));
 }
+
 }  // namespace
 
 namespace hyrise {
@@ -104,8 +111,23 @@ std::shared_ptr<EqualDistinctCountHistogram<T>> EqualDistinctCountHistogram<T>::
     const Table& table, const ColumnID column_id, const BinID max_bin_count, const HistogramDomain<T>& domain) {
   Assert(max_bin_count > 0, "max_bin_count must be greater than zero ");
 
-  const auto value_distribution = value_distribution_from_column(table, column_id, domain);
+  return _from_value_distribution(value_distribution_from_column(table, column_id, domain), max_bin_count);
+}
 
+template <typename T>
+std::shared_ptr<EqualDistinctCountHistogram<T>> EqualDistinctCountHistogram<T>::from_segment(
+    const AbstractSegment& segment, const BinID max_bin_count, const HistogramDomain<T>& domain) {
+  Assert(max_bin_count > 0, "max_bin_count must be greater than zero ");
+
+  auto value_distribution_map = ValueDistributionMap<T>{};
+  add_segment_to_value_distribution<T>(segment, value_distribution_map, domain);
+
+  return _from_value_distribution(sorted_value_distribution(std::move(value_distribution_map)), max_bin_count);
+}
+
+template <typename T>
+std::shared_ptr<EqualDistinctCountHistogram<T>> EqualDistinctCountHistogram<T>::_from_value_distribution(
+    std::vector<std::pair<T, HistogramCountType>>&& value_distribution, const BinID max_bin_count) {
   if (value_distribution.empty()) {
     return nullptr;
   }
@@ -36,6 +36,14 @@ class EqualDistinctCountHistogram : public AbstractHistogram<T> {
                                                                      const BinID max_bin_count,
                                                                      const HistogramDomain<T>& domain = {});
 
+  /**
+   * Create an EqualDistinctCountHistogram for a single segment, e.g., for the statistics of a chunk
+   * @param max_bin_count   Desired number of bins. Less might be created, but never more. Must not be zero.
+   */
+  static std::shared_ptr<EqualDistinctCountHistogram<T>> from_segment(const AbstractSegment& segment,
+                                                                      const BinID max_bin_count,
+                                                                      const HistogramDomain<T>& domain = {});
+
   std::string name() const override;
   std::shared_ptr<AbstractHistogram<T>> clone() const override;
   HistogramCountType total_distinct_count() const override;
@@ -59,6 +67,11 @@ class EqualDistinctCountHistogram : public AbstractHistogram<T> {
   BinID _next_bin_for_value(const T& value) const override;
 
  private:
+  // Creates the histogram from the sorted (value, count) pairs of a column or segment. Returns nullptr if there are
+  // none.
+  static std::shared_ptr<EqualDistinctCountHistogram<T>> _from_value_distribution(
+      std::vector<std::pair<T, HistogramCountType>>&& value_distribution, const BinID max_bin_count);
+
   /**
    * We use multiple vectors rather than a vector of structs for ease-of-use with STL library functions.
    */
@@ -1,11 +1,22 @@
 #include "generic_histogram.hpp"
 
+#include <algorithm>
 #include <memory>
 #include <numeric>
 #include <string>
 #include <utility>
 #include <vector>
 
+#include "generic_histogram_builder.hpp"
+
+namespace {
+
+// When merging histograms, the bins of the merged histogram are assembled from up to this many intervals per bin. More
+// intervals allow for more evenly sized bins but require more estimations on the input histograms.
+constexpr auto MERGE_INTERVALS_PER_BIN = size_t{8};
+
+}  // namespace
+
 namespace hyrise {
 
 template <typename T>
@@ -38,6 +49,136 @@ std::shared_ptr<GenericHistogram<T>> GenericHistogram<T>::with_single_bin(const
                                             std::vector{distinct_count}, domain);
 }
 
+template <typename T>
+std::shared_ptr<GenericHistogram<T>> GenericHistogram<T>::from_histograms(
+    const std::vector<std::shared_ptr<const AbstractHistogram<T>>>& histograms, const BinID max_bin_count,
+    const std::optional<HistogramCountType>& total_distinct_count) {
+  Assert(max_bin_count > 0, "max_bin_count must be greater than zero.");
+
+  // The bin bounds of all input histograms are the candidates for the bounds of the merged histogram.
+  auto bounds = std::vector<T>{};
+  for (const auto& histogram : histograms) {
+    const auto bin_count = histogram->bin_count();
+    for (auto bin_id = BinID{0}; bin_id < bin_count; ++bin_id) {
+      bounds.emplace_back(histogram->bin_minimum(bin_id));
+      bounds.emplace_back(histogram->bin_maximum(bin_id));
+    }
+  }
+
+  if (bounds.empty()) {
+    return nullptr;
+  }
+
+  std::sort(bounds.begin(), bounds.end());
+  bounds.erase(std::unique(bounds.begin(), bounds.end()), bounds.end());
+
+  // Keep evenly spaced candidates (including the smallest and the largest one) if there are too many.
+  const auto max_interval_count = max_bin_count * MERGE_INTERVALS_PER_BIN;
+  if (bounds.size() > max_interval_count + 1) {
+    auto thinned_bounds = std::vector<T>(max_interval_count + 1);
+    for (auto bound_idx = size_t{0}; bound_idx <= max_interval_count; ++bound_idx) {
+      thinned_bounds[bound_idx] = bounds[bound_idx * (bounds.size() - 1) / max_interval_count];
+    }
+    bounds = std::move(thinned_bounds);
+  }
+
+  // Estimate the height and distinct count of the intervals [bounds[0], bounds[1]], (bounds[1], bounds[2]], ... by
+  // summing up the estimations of all input histograms that overlap with the interval.
+  const auto& domain = histograms.front()->domain();
+  struct Interval {
+    T min;
+    T max;
+    HistogramCountType height;
+    HistogramCountType distinct_count;
+  };
+  auto intervals = std::vector<Interval>{};
+  intervals.reserve(bounds.size());
+
+  const auto interval_count = std::max(bounds.size() - 1, size_t{1});
+  for (auto interval_idx = size_t{0}; interval_idx < interval_count; ++interval_idx) {
+    const auto is_first_interval = interval_idx == 0;
+    const auto& lower_bound = bounds[interval_idx];
+    const auto& upper_bound = bounds.size() == 1 ? bounds.front() : bounds[interval_idx + 1];
+    const auto predicate_condition =
+        is_first_interval ? PredicateCondition::BetweenInclusive : PredicateCondition::BetweenLowerExclusive;
+
+    auto height = HistogramCountType{0};
+    auto distinct_count = HistogramCountType{0};
+    for (const auto& histogram : histograms) {
+      const auto bin_count = histogram->bin_count();
+      if (bin_count == 0 || upper_bound < histogram->bin_minimum(BinID{0}) ||
+          lower_bound > histogram->bin_maximum(bin_count - 1)) {
+        continue;
+      }
+
+      const auto [interval_height, interval_distinct_count] = histogram->estimate_cardinality_and_distinct_count(
+          predicate_condition, AllTypeVariant{lower_bound}, AllTypeVariant{upper_bound});
+      height += interval_height;
+      distinct_count += interval_distinct_count;
+    }
+
+    if (height == 0) {
+      continue;
+    }
+
+    // For strings, the next value of the lower bound might be greater than the upper bound if the lower bound is longer
+    // than the prefix length of the domain.
+    const auto interval_min =
+        is_first_interval ? lower_bound : std::min(domain.next_value_clamped(lower_bound), upper_bound);
+    intervals.emplace_back(Interval{interval_min, upper_bound, height, distinct_count});
+  }
+
+  if (intervals.empty()) {
+    return nullptr;
+  }
+
+  // Scale the distinct counts to the known total. The distinct count of an interval cannot exceed its height.
+  const auto summed_distinct_count =
+      std::accumulate(intervals.cbegin(), intervals.cend(), HistogramCountType{0},
+                      [](const auto sum, const auto& interval) { return sum + interval.distinct_count; });
+  if (total_distinct_count && summed_distinct_count > 0) {
+    const auto distinct_count_factor = *total_distinct_count / summed_distinct_count;
+    for (auto& interval : intervals) {
+      interval.distinct_count = std::min(interval.distinct_count * distinct_count_factor, interval.height);
+    }
+  }
+
+  // Combine adjacent intervals into bins with roughly the same distinct count, as in the EqualDistinctCountHistogram.
+  const auto merged_distinct_count =
+      std::accumulate(intervals.cbegin(), intervals.cend(), HistogramCountType{0},
+                      [](const auto sum, const auto& interval) { return sum + interval.distinct_count; });
+  const auto distinct_count_per_bin = merged_distinct_count / static_cast<HistogramCountType>(max_bin_count);
+
+  auto builder = GenericHistogramBuilder<T>{max_bin_count, domain};
+  auto bin_begin_idx = size_t{0};
+  auto bin_height = HistogramCountType{0};
+  auto bin_distinct_count = HistogramCountType{0};
+  auto cumulative_distinct_count = HistogramCountType{0};
+  auto bin_count = BinID{0};
+  const auto merged_interval_count = intervals.size();
+  for (auto interval_idx = size_t{0}; interval_idx < merged_interval_count; ++interval_idx) {
+    const auto& interval = intervals[interval_idx];
+    bin_height += interval.height;
+    bin_distinct_count += interval.distinct_count;
+    cumulative_distinct_count += interval.distinct_count;
+
+    const auto is_last_interval = interval_idx + 1 == merged_interval_count;
+    const auto bin_is_full = bin_count + 1 < max_bin_count &&
+                             cumulative_distinct_count >= static_cast<float>(bin_count + 1) * distinct_count_per_bin;
+    if (!is_last_interval && !bin_is_full) {
+      continue;
+    }
+
+    builder.add_bin(intervals[bin_begin_idx].min, interval.max, bin_height, std::max(bin_distinct_count, 1.0f));
+    ++bin_count;
+    bin_begin_idx = interval_idx + 1;
+    bin_height = HistogramCountType{0};
+    bin_distinct_count = HistogramCountType{0};
+  }
+
+  return builder.build();
+}
+
 template <typename T>
 std::string GenericHistogram<T>::name() const {
   return "Generic";
@@ -2,6 +2,7 @@
 
 #include <iostream>
 #include <memory>
+#include <optional>
 #include <string>
 #include <utility>
 #include <vector>
@@ -32,6 +33,17 @@ class GenericHistogram : public AbstractHistogram<T> {
                                                               const HistogramCountType& distinct_count,
                                                               const HistogramDomain<T>& domain = {});
 
+  /**
+   * Merges histograms on disjoint sets of rows (e.g., of the chunks of a table) into a histogram with at most
+   * @param max_bin_count bins. The bins of the input histograms may overlap. The distinct counts of overlapping bins
+   * cannot be told apart from each other and are summed up. If the @param total_distinct_count of the merged rows is
+   * known (e.g., from a HyperLogLog sketch), the bin distinct counts are scaled to it.
+   * Returns nullptr if all input histograms are empty.
+   */
+  static std::shared_ptr<GenericHistogram<T>> from_histograms(
+      const std::vector<std::shared_ptr<const AbstractHistogram<T>>>& histograms, const BinID max_bin_count,
+      const std::optional<HistogramCountType>& total_distinct_count = std::nullopt);
+
   std::string name() const override;
   std::shared_ptr<AbstractHistogram<T>> clone() const override;
   HistogramCountType total_distinct_count() const override;
@@ -0,0 +1,64 @@
+#include "hyper_log_log.hpp"
+
+#include <algorithm>
+#include <bit>
+#include <cmath>
+
+#include "utils/assert.hpp"
+
+namespace hyrise {
+
+HyperLogLog::HyperLogLog(const uint8_t init_precision)
+    : precision(init_precision), _registers(size_t{1} << init_precision) {
+  Assert(precision >= 4 && precision <= 18, "HyperLogLog precision must be between 4 and 18.");
+}
+
+void HyperLogLog::add(const size_t hash) {
+  // Finalizer of MurmurHash3, as in the BloomFilter.
+  auto mixed_hash = static_cast<uint64_t>(hash);
+  mixed_hash ^= mixed_hash >> 33;
+  mixed_hash *= 0xff51afd7ed558ccdULL;
+  mixed_hash ^= mixed_hash >> 33;
+  mixed_hash *= 0xc4ceb9fe1a85ec53ULL;
+  mixed_hash ^= mixed_hash >> 33;
+
+  const auto register_idx = mixed_hash >> (64 - precision);
+  // Set the lowest bit so that the rank is bounded for hashes whose remaining bits are all zero.
+  const auto remaining_bits = (mixed_hash << precision) | (uint64_t{1} << (precision - 1));
+  const auto rank = static_cast<uint8_t>(std::countl_zero(remaining_bits) + 1);
+
+  auto& register_value = _registers[register_idx];
+  register_value = std::max(register_value, rank);
+}
+
+void HyperLogLog::merge(const HyperLogLog& other) {
+  Assert(precision == other.precision, "Cannot merge HyperLogLog sketches of different precisions.");
+  for (auto register_idx = size_t{0}; register_idx < _registers.size(); ++register_idx) {
+    _registers[register_idx] = std::max(_registers[register_idx], other._registers[register_idx]);
+  }
+}
+
+Cardinality HyperLogLog::estimate_distinct_count() const {
+  const auto register_count = static_cast<double>(_registers.size());
+
+  auto inverse_sum = 0.0;
+  auto empty_register_count = size_t{0};
+  for (const auto register_value : _registers) {
+    inverse_sum += std::ldexp(1.0, -register_value);
+    empty_register_count += register_value == 0 ? 1 : 0;
+  }
+
+  const auto alpha = 0.7213 / (1.0 + 1.079 / register_count);
+  const auto raw_estimate = alpha * register_count * register_count / inverse_sum;
+
+  // For small cardinalities, many registers are empty and the raw estimate is biased. Linear counting on the number of
+  // empty registers is more accurate there. With 64-bit hashes, no correction for large cardinalities is required.
+  if (raw_estimate <= 2.5 * register_count && empty_register_count > 0) {
+    return static_cast<Cardinality>(register_count *
+                                    std::log(register_count / static_cast<double>(empty_register_count)));
+  }
+
+  return static_cast<Cardinality>(raw_estimate);
+}
+
+}  // namespace hyrise
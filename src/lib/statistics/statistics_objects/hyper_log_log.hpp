@@ -0,0 +1,41 @@
+#pragma once
+
+#include <cstdint>
+#include <vector>
+
+#include "types.hpp"
+
+namespace hyrise {
+
+/**
+ * HyperLogLog sketch to estimate the number of distinct values (or value combinations) of a column (group), see
+ * "HyperLogLog: the analysis of a near-optimal cardinality estimation algorithm" (Flajolet et al., 2007).
+ *
+ * The sketch consists of 2^precision one-byte registers. The first `precision` bits of a value's hash select a
+ * register, which stores the maximum number of leading zeros (plus one) of the remaining bits. The standard error of
+ * the estimation is about 1.04 / sqrt(2^precision), i.e., 1.6 % for the default precision of 12 (4 KiB).
+ *
+ * Unlike histograms, sketches can be merged. Thus, they can be built per chunk and combined, and the distinct count of
+ * a column group is estimated from the combined hashes of its columns without materializing the value combinations.
+ */
+class HyperLogLog {
+ public:
+  static constexpr auto DEFAULT_PRECISION = uint8_t{12};
+
+  explicit HyperLogLog(const uint8_t init_precision = DEFAULT_PRECISION);
+
+  // Adds a hash, e.g., from std::hash. The hash is mixed so that hashes of integers (the identity) can be used.
+  void add(const size_t hash);
+
+  // Combines the registers of both sketches. Afterwards, this sketch represents the union of both value sets.
+  void merge(const HyperLogLog& other);
+
+  Cardinality estimate_distinct_count() const;
+
+  const uint8_t precision;
+
+ private:
+  std::vector<uint8_t> _registers;
+};
+
+}  // namespace hyrise
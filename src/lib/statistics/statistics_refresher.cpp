@@ -0,0 +1,70 @@
+#include "statistics_refresher.hpp"
+
+#include <algorithm>
+#include <cmath>
+
+#include "column_group_statistics.hpp"
+#include "hyrise.hpp"
+#include "statistics/table_statistics.hpp"
+#include "storage/table.hpp"
+#include "utils/pausable_loop_thread.hpp"
+
+namespace hyrise {
+
+StatisticsRefresher::StatisticsRefresher(const std::chrono::milliseconds refresh_interval,
+                                         const float init_staleness_threshold,
+                                         const bool init_refine_sampled_statistics)
+    : staleness_threshold(init_staleness_threshold), refine_sampled_statistics(init_refine_sampled_statistics) {
+  _loop_thread = std::make_unique<PausableLoopThread>(refresh_interval, [&](size_t) { refresh_stale_tables(); });
+}
+
+StatisticsRefresher::~StatisticsRefresher() {
+  // Terminate the thread before the members it uses are destroyed.
+  _loop_thread.reset();
+}
+
+float StatisticsRefresher::staleness(const Table& table) {
+  const auto table_statistics = table.table_statistics();
+  if (!table_statistics) {
+    return 1.0f;
+  }
+
+  const auto row_count = static_cast<float>(table.row_count());
+  if (row_count == 0.0f) {
+    return table_statistics->row_count == 0.0f ? 0.0f : 1.0f;
+  }
+
+  return std::min(std::abs(row_count - table_statistics->row_count) / row_count, 1.0f);
+}
+
+size_t StatisticsRefresher::refresh_stale_tables() const {
+  auto refreshed_table_count = size_t{0};
+  auto refined_table_count = size_t{0};
+  for (const auto& [table_name, table] : Hyrise::get().storage_manager.tables()) {
+    const auto previous_statistics = table->table_statistics();
+    const auto refine = refine_sampled_statistics && refined_table_count == 0 && previous_statistics &&
+                        previous_statistics->sampled_row_count;
+    if (!refine && staleness(*table) <= staleness_threshold) {
+      continue;
+    }
+
+    const auto refreshed_statistics =
+        refine ? TableStatistics::from_table(*table) : TableStatistics::from_chunk_statistics(*table);
+    refined_table_count += refine ? 1 : 0;
+
+    if (previous_statistics) {
+      for (const auto& column_group_statistics : previous_statistics->column_group_statistics) {
+        if (column_group_statistics->column_ids.size() > 1) {
+          refreshed_statistics->column_group_statistics.emplace_back(column_group_statistics);
+        }
+      }
+    }
+
+    table->set_table_statistics(refreshed_statistics);
+    ++refreshed_table_count;
+  }
+
+  return refreshed_table_count;
+}
+
+}  // namespace hyrise
@@ -0,0 +1,58 @@
+#pragma once
+
+#include <chrono>
+#include <memory>
+
+#include "types.hpp"
+
+namespace hyrise {
+
+class Table;
+struct PausableLoopThread;
+
+/**
+ * StorageManager::add_table() creates the statistics of a table once. Afterwards, inserted rows are not reflected in
+ * them. The StatisticsRefresher periodically checks the statistics of all stored tables in a background thread and
+ * replaces the stale ones by merging the statistics of the table's chunks (see
+ * TableStatistics::from_chunk_statistics()), which does not require scanning the whole table again.
+ *
+ * Groups of multiple columns (see ColumnGroupStatistics) are carried over to the refreshed statistics as they are, as
+ * they cannot be merged from chunk statistics.
+ *
+ * If requested, statistics created from a sample (see TableStatistics::from_table_sample()) are refined to exact ones
+ * with TableStatistics::from_table(). As this scans the whole table, at most one table is refined per refresh.
+ *
+ * The staleness of the statistics of each table is exposed in the `meta_tables` table.
+ */
+class StatisticsRefresher : private Noncopyable {
+ public:
+  static constexpr auto DEFAULT_REFRESH_INTERVAL = std::chrono::milliseconds{1'000};
+  static constexpr auto DEFAULT_STALENESS_THRESHOLD = 0.1f;
+
+  explicit StatisticsRefresher(const std::chrono::milliseconds refresh_interval = DEFAULT_REFRESH_INTERVAL,
+                               const float init_staleness_threshold = DEFAULT_STALENESS_THRESHOLD,
+                               const bool init_refine_sampled_statistics = false);
+
+  ~StatisticsRefresher();
+
+  /**
+   * @return the share of rows of @param table that its statistics do not represent, i.e., 0 if the statistics are
+   *         fresh and 1 if there are none.
+   */
+  static float staleness(const Table& table);
+
+  /**
+   * Refreshes the statistics of all stored tables whose staleness exceeds the threshold and, if requested, refines the
+   * sampled statistics of one table. Called by the background thread, but can also be called directly.
+   * @return the number of refreshed tables
+   */
+  size_t refresh_stale_tables() const;
+
+  const float staleness_threshold;
+  const bool refine_sampled_statistics;
+
+ private:
+  std::unique_ptr<PausableLoopThread> _loop_thread;
+};
+
+}  // namespace hyrise
@@ -1,27 +1,165 @@
 #include "table_statistics.hpp"
 
 #include <algorithm>
+#include <cmath>
 #include <numeric>
+#include <random>
 #include <thread>
 
 #include "attribute_statistics.hpp"
+#include "chunk_statistics.hpp"
+#include "column_group_statistics.hpp"
 #include "hyrise.hpp"
 #include "resolve_type.hpp"
 #include "scheduler/job_task.hpp"
 #include "statistics/statistics_objects/abstract_histogram.hpp"
+#include "statistics/statistics_objects/generic_histogram.hpp"
+#include "statistics/statistics_objects/generic_histogram_builder.hpp"
+#include "statistics/statistics_objects/null_value_ratio_statistics.hpp"
+#include "storage/pos_lists/row_id_pos_list.hpp"
+#include "storage/segment_iterate.hpp"
 #include "storage/table.hpp"
 #include "utils/assert.hpp"
 
+namespace {
+
+using namespace hyrise;  // NOLINT
+
+// Fixed so that sampling the same table twice yields the same statistics.
+constexpr auto SAMPLE_SEED = std::mt19937::result_type{17};
+
+// Sampled rows of a table, grouped by chunk. See TableStatistics::from_table_sample() for the sampling strategy.
+struct TableSample {
+  std::vector<std::shared_ptr<RowIDPosList>> position_lists;
+  size_t row_count{0};
+};
+
+TableSample sample_table(const Table& table, const size_t sample_row_count) {
+  auto random_engine = std::mt19937{SAMPLE_SEED};
+  const auto sample_ratio = static_cast<double>(sample_row_count) / static_cast<double>(table.row_count());
+
+  auto sample = TableSample{};
+  auto chunk_offsets = std::vector<ChunkOffset>{};
+  auto sampled_offsets = std::vector<ChunkOffset>{};
+  auto visited_row_count = size_t{0};
+  const auto chunk_count = table.chunk_count();
+  for (auto chunk_id = ChunkID{0}; chunk_id < chunk_count; ++chunk_id) {
+    const auto chunk = table.get_chunk(chunk_id);
+    if (!chunk || chunk->size() == 0) {
+      continue;
+    }
+
+    // Each chunk contributes its share of the sample. Rounding the cumulative row counts rather than those of each
+    // chunk makes the sample size add up even for many small chunks.
+    const auto chunk_size = chunk->size();
+    const auto previous_sampled_row_count =
+        static_cast<size_t>(std::round(static_cast<double>(visited_row_count) * sample_ratio));
+    visited_row_count += chunk_size;
+    const auto sampled_offset_count =
+        static_cast<size_t>(std::round(static_cast<double>(visited_row_count) * sample_ratio)) -
+        previous_sampled_row_count;
+    if (sampled_offset_count == 0) {
+      continue;
+    }
+
+    chunk_offsets.resize(chunk_size);
+    std::iota(chunk_offsets.begin(), chunk_offsets.end(), ChunkOffset{0});
+
+    // std::sample keeps the order of the offsets.
+    sampled_offsets.clear();
+    std::sample(chunk_offsets.begin(), chunk_offsets.end(), std::back_inserter(sampled_offsets), sampled_offset_count,
+                random_engine);
+
+    auto position_list = std::make_shared<RowIDPosList>();
+    position_list->reserve(sampled_offsets.size());
+    for (const auto chunk_offset : sampled_offsets) {
+      position_list->emplace_back(chunk_id, chunk_offset);
+    }
+    position_list->guarantee_single_chunk();
+
+    sample.row_count += position_list->size();
+    sample.position_lists.emplace_back(std::move(position_list));
+  }
+
+  return sample;
+}
+
+// Builds the histogram of the non-NULL values of a column from a sample as described in
+// TableStatistics::from_table_sample(). Returns nullptr if the sample only contains NULLs.
+template <typename T>
+std::shared_ptr<GenericHistogram<T>> histogram_from_sample(const Table& table, const ColumnID column_id,
+                                                           const TableSample& sample, const BinID max_bin_count,
+                                                           size_t& sampled_null_value_count) {
+  auto values = std::vector<T>{};
+  values.reserve(sample.row_count);
+  for (const auto& position_list : sample.position_lists) {
+    const auto& segment = *table.get_chunk(position_list->common_chunk_id())->get_segment(column_id);
+    segment_iterate_filtered<T>(segment, position_list, [&](const auto& position) {
+      if (position.is_null()) {
+        ++sampled_null_value_count;
+        return;
+      }
+      values.emplace_back(position.value());
+    });
+  }
+
+  if (values.empty()) {
+    return nullptr;
+  }
+
+  std::sort(values.begin(), values.end());
+
+  // Distinct sampled values and how often each of them was sampled.
+  auto distinct_values = std::vector<std::pair<T, size_t>>{};
+  for (const auto& value : values) {
+    if (distinct_values.empty() || distinct_values.back().first != value) {
+      distinct_values.emplace_back(value, 0);
+    }
+    ++distinct_values.back().second;
+  }
+
+  const auto scale = static_cast<double>(table.row_count()) / static_cast<double>(sample.row_count);
+  const auto singleton_scale = std::sqrt(scale);
+
+  const auto bin_count = std::min(static_cast<size_t>(max_bin_count), distinct_values.size());
+  const auto distinct_values_per_bin = distinct_values.size() / bin_count;
+  const auto bin_count_with_extra_value = distinct_values.size() % bin_count;
+
+  auto builder = GenericHistogramBuilder<T>{bin_count};
+  auto begin_index = size_t{0};
+  for (auto bin_id = size_t{0}; bin_id < bin_count; ++bin_id) {
+    const auto end_index = begin_index + distinct_values_per_bin + (bin_id < bin_count_with_extra_value ? 1 : 0);
+
+    auto sampled_height = size_t{0};
+    auto singleton_count = size_t{0};
+    for (auto index = begin_index; index < end_index; ++index) {
+      sampled_height += distinct_values[index].second;
+      singleton_count += distinct_values[index].second == 1 ? 1 : 0;
+    }
+
+    const auto height = static_cast<double>(sampled_height) * scale;
+    const auto distinct_count = std::min(
+        singleton_scale * static_cast<double>(singleton_count) +
+            static_cast<double>(end_index - begin_index - singleton_count),
+        height);
+    builder.add_bin(distinct_values[begin_index].first, distinct_values[end_index - 1].first,
+                    static_cast<HistogramCountType>(height), static_cast<HistogramCountType>(distinct_count));
+
+    begin_index = end_index;
+  }
+
+  return builder.build();
+}
+
+}  // namespace
+
 namespace hyrise {
 
 std::shared_ptr<TableStatistics> TableStatistics::from_table(const Table& table) {
   std::vector<std::shared_ptr<BaseAttributeStatistics>> column_statistics(table.column_count());
+  auto column_group_statistics = std::vector<std::shared_ptr<const ColumnGroupStatistics>>(table.column_count());
 
-  /**
-   * Determine bin count, within mostly arbitrarily chosen bounds: 5 (for tables with <=2k rows) up to 100 bins
-   * (for tables with >= 200m rows) are created.
-   */
-  const auto histogram_bin_count = std::min<size_t>(100, std::max<size_t>(5, table.row_count() / 2'000));
+  const auto histogram_bin_count = TableStatistics::histogram_bin_count(table.row_count());
 
   /**
    * We highly recommend setting up a multithreaded scheduler before the following procedure is executed to parallelly
@@ -60,18 +198,193 @@ std::shared_ptr<TableStatistics> TableStatistics::from_table(const Table& table)
 
         column_statistics[column_id] = output_column_statistics;
       });
+
+      // Histograms already describe the distribution of single columns. Thus, we only create the distinct count sketch,
+      // which can be combined with the sketches of other columns.
+      column_group_statistics[column_id] = ColumnGroupStatistics::from_table(table, {column_id}, 0);
     };
     jobs.emplace_back(std::make_shared<JobTask>(generate_column_statistics));
   }
   Hyrise::get().scheduler()->schedule_and_wait_for_tasks(jobs);
 
-  return std::make_shared<TableStatistics>(std::move(column_statistics), table.row_count());
+  auto table_statistics = std::make_shared<TableStatistics>(std::move(column_statistics), table.row_count());
+  table_statistics->column_group_statistics = std::move(column_group_statistics);
+  return table_statistics;
+}
+
+std::shared_ptr<TableStatistics> TableStatistics::from_table_sample(const Table& table, const size_t sample_row_count) {
+  Assert(sample_row_count > 0, "Cannot create statistics from an empty sample.");
+  if (table.row_count() <= sample_row_count) {
+    return from_table(table);
+  }
+
+  const auto column_count = table.column_count();
+  const auto sample = sample_table(table, sample_row_count);
+  const auto histogram_bin_count = TableStatistics::histogram_bin_count(table.row_count());
+
+  auto column_statistics = std::vector<std::shared_ptr<BaseAttributeStatistics>>(column_count);
+  auto jobs = std::vector<std::shared_ptr<AbstractTask>>{};
+  jobs.reserve(column_count);
+  for (auto column_id = ColumnID{0}; column_id < column_count; ++column_id) {
+    jobs.emplace_back(std::make_shared<JobTask>([&, column_id]() {
+      resolve_data_type(table.column_data_type(column_id), [&](const auto data_type_t) {
+        using ColumnDataType = typename decltype(data_type_t)::type;
+
+        const auto output_column_statistics = std::make_shared<AttributeStatistics<ColumnDataType>>();
+        auto sampled_null_value_count = size_t{0};
+        const auto histogram = histogram_from_sample<ColumnDataType>(table, column_id, sample, histogram_bin_count,
+                                                                     sampled_null_value_count);
+        if (histogram) {
+          output_column_statistics->set_statistics_object(histogram);
+        }
+
+        const auto null_value_ratio =
+            static_cast<float>(sampled_null_value_count) / static_cast<float>(sample.row_count);
+        output_column_statistics->set_statistics_object(std::make_shared<NullValueRatioStatistics>(null_value_ratio));
+        column_statistics[column_id] = output_column_statistics;
+      });
+    }));
+  }
+  Hyrise::get().scheduler()->schedule_and_wait_for_tasks(jobs);
+
+  auto table_statistics = std::make_shared<TableStatistics>(std::move(column_statistics), table.row_count());
+  table_statistics->sampled_row_count = sample.row_count;
+
+  // Sketching the columns would require a full scan. Thus, we only create single-column groups if the sketches of all
+  // chunks are already there.
+  auto chunk_statistics = std::vector<std::shared_ptr<const ChunkStatistics>>{};
+  const auto chunk_count = table.chunk_count();
+  for (auto chunk_id = ChunkID{0}; chunk_id < chunk_count; ++chunk_id) {
+    const auto chunk = table.get_chunk(chunk_id);
+    if (!chunk || chunk->size() == 0) {
+      continue;
+    }
+
+    const auto statistics = chunk->statistics();
+    if (!statistics) {
+      return table_statistics;
+    }
+    chunk_statistics.emplace_back(statistics);
+  }
+
+  for (auto column_id = ColumnID{0}; column_id < column_count; ++column_id) {
+    auto distinct_count_sketch = HyperLogLog{ChunkStatistics::SKETCH_PRECISION};
+    for (const auto& statistics : chunk_statistics) {
+      distinct_count_sketch.merge(statistics->distinct_count_sketches[column_id]);
+    }
+    table_statistics->column_group_statistics.emplace_back(
+        std::make_shared<ColumnGroupStatistics>(std::vector<ColumnID>{column_id}, std::move(distinct_count_sketch),
+                                                std::vector<ColumnGroupStatistics::SampledBin>{}));
+  }
+
+  return table_statistics;
+}
+
+std::shared_ptr<TableStatistics> TableStatistics::from_chunk_statistics(const Table& table) {
+  const auto column_count = table.column_count();
+  const auto column_data_types = table.column_data_types();
+
+  auto chunk_statistics = std::vector<std::shared_ptr<const ChunkStatistics>>{};
+  auto row_count = uint64_t{0};
+  const auto chunk_count = table.chunk_count();
+  for (auto chunk_id = ChunkID{0}; chunk_id < chunk_count; ++chunk_id) {
+    const auto chunk = table.get_chunk(chunk_id);
+    if (!chunk || chunk->size() == 0) {
+      continue;
+    }
+
+    auto statistics = chunk->statistics();
+    if (!statistics) {
+      statistics = ChunkStatistics::from_chunk(*chunk, column_data_types);
+      // The statistics of mutable chunks become stale with the next insert. Thus, we only keep them for immutable ones.
+      if (!chunk->is_mutable()) {
+        chunk->set_statistics(statistics);
+      }
+    }
+
+    row_count += statistics->row_count;
+    chunk_statistics.emplace_back(std::move(statistics));
+  }
+
+  const auto histogram_bin_count = TableStatistics::histogram_bin_count(row_count);
+  auto column_statistics = std::vector<std::shared_ptr<BaseAttributeStatistics>>(column_count);
+  auto column_group_statistics = std::vector<std::shared_ptr<const ColumnGroupStatistics>>(column_count);
+  for (auto column_id = ColumnID{0}; column_id < column_count; ++column_id) {
+    auto distinct_count_sketch = HyperLogLog{ChunkStatistics::SKETCH_PRECISION};
+    for (const auto& statistics : chunk_statistics) {
+      distinct_count_sketch.merge(statistics->distinct_count_sketches[column_id]);
+    }
+
+    resolve_data_type(column_data_types[column_id], [&](const auto data_type_t) {
+      using ColumnDataType = typename decltype(data_type_t)::type;
+
+      auto histograms = std::vector<std::shared_ptr<const AbstractHistogram<ColumnDataType>>>{};
+      auto null_value_count = uint64_t{0};
+      for (const auto& statistics : chunk_statistics) {
+        const auto& histogram = statistics->histograms[column_id];
+        if (!histogram) {
+          null_value_count += statistics->row_count;
+          continue;
+        }
+
+        const auto& typed_histogram = static_cast<const AbstractHistogram<ColumnDataType>&>(*histogram);
+        null_value_count += statistics->row_count - static_cast<uint64_t>(typed_histogram.total_count());
+        histograms.emplace_back(std::static_pointer_cast<const AbstractHistogram<ColumnDataType>>(histogram));
+      }
+
+      // The sketches count NULL as a value, the histograms do not.
+      const auto distinct_count = std::max(distinct_count_sketch.estimate_distinct_count() -
+                                               (null_value_count > 0 ? Cardinality{1} : Cardinality{0}),
+                                           Cardinality{1});
+
+      const auto output_column_statistics = std::make_shared<AttributeStatistics<ColumnDataType>>();
+      if (const auto histogram =
+              GenericHistogram<ColumnDataType>::from_histograms(histograms, histogram_bin_count, distinct_count)) {
+        output_column_statistics->set_statistics_object(histogram);
+      }
+
+      const auto null_value_ratio =
+          row_count == 0 ? 0.0f : static_cast<float>(null_value_count) / static_cast<float>(row_count);
+      output_column_statistics->set_statistics_object(std::make_shared<NullValueRatioStatistics>(null_value_ratio));
+      column_statistics[column_id] = output_column_statistics;
+    });
+
+    column_group_statistics[column_id] =
+        std::make_shared<ColumnGroupStatistics>(std::vector<ColumnID>{column_id}, std::move(distinct_count_sketch),
+                                                std::vector<ColumnGroupStatistics::SampledBin>{});
+  }
+
+  auto table_statistics =
+      std::make_shared<TableStatistics>(std::move(column_statistics), static_cast<Cardinality>(row_count));
+  table_statistics->column_group_statistics = std::move(column_group_statistics);
+  return table_statistics;
+}
+
+size_t TableStatistics::histogram_bin_count(const size_t row_count) {
+  return std::min<size_t>(100, std::max<size_t>(5, row_count / 2'000));
 }
 
 TableStatistics::TableStatistics(std::vector<std::shared_ptr<BaseAttributeStatistics>>&& init_column_statistics,
                                  const Cardinality init_row_count)
     : column_statistics(std::move(init_column_statistics)), row_count(init_row_count) {}
 
+std::shared_ptr<const ColumnGroupStatistics> TableStatistics::find_column_group_statistics(
+    const std::vector<ColumnID>& column_ids) const {
+  auto best_column_group_statistics = std::shared_ptr<const ColumnGroupStatistics>{};
+  for (const auto& candidate : column_group_statistics) {
+    if (!candidate->covers(column_ids)) {
+      continue;
+    }
+
+    if (!best_column_group_statistics ||
+        candidate->column_ids.size() < best_column_group_statistics->column_ids.size()) {
+      best_column_group_statistics = candidate;
+    }
+  }
+
+  return best_column_group_statistics;
+}
+
 DataType TableStatistics::column_data_type(const ColumnID column_id) const {
   DebugAssert(column_id < column_statistics.size(), "ColumnID out of bounds");
   return column_statistics[column_id]->data_type;
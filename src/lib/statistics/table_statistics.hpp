@@ -12,6 +12,7 @@
 namespace hyrise {
 
 class BaseAttributeStatistics;
+class ColumnGroupStatistics;
 class Table;
 
 /**
@@ -20,12 +21,60 @@ class Table;
  */
 class TableStatistics {
  public:
+  static constexpr auto DEFAULT_SAMPLE_ROW_COUNT = size_t{1'000'000};
+
+  // Tables with more rows get sampled statistics when they are added to the StorageManager (see from_table_sample()).
+  static constexpr auto MAX_EXACT_ROW_COUNT = size_t{100'000'000};
+
   /**
    * Creates statistics objects for cardinality estimation for all Columns in @param table. See implementation for
-   * which statistics objects are created.
+   * which statistics objects are created. Also creates a ColumnGroupStatistics with a distinct count sketch (but no
+   * sample) for each column.
    */
   static std::shared_ptr<TableStatistics> from_table(const Table& table);
 
+  /**
+   * Creates statistics for @param table from a random sample of about @param sample_row_count rows instead of all of
+   * them. For tables with no more rows than that, this equals from_table(). StorageManager::add_table() uses it for
+   * tables with more than MAX_EXACT_ROW_COUNT rows, where creating exact statistics dominates the loading time.
+   *
+   * Rows are sampled from all chunks, each chunk contributing rows in proportion to its size. We do not sample whole
+   * chunks: if values are clustered in few chunks (e.g., dates of a table sorted by date), the rows of a chunk are
+   * similar, and a sample of chunks is much less informative than a sample of as many rows. The sample is seeded, so
+   * sampling the same table twice yields the same statistics.
+   *
+   * Per column, a GenericHistogram is built whose bins contain roughly the same number of distinct sampled values.
+   * - Bin heights are the sampled heights scaled by row_count / sampled_row_count. Their relative standard error is
+   *   about sqrt(1 / sampled height of the bin), e.g., 10% for a bin of 100 sampled rows. The null value ratio is
+   *   estimated likewise.
+   * - Distinct counts are estimated with the Guaranteed-Error Estimator (GEE, Charikar et al., "Towards Estimation
+   *   Error Guarantees for Distinct Values", PODS 2000): values seen once in the sample stand for
+   *   sqrt(row_count / sampled_row_count) distinct values, values seen more often for one. Its ratio error, i.e.,
+   *   max(estimate / actual, actual / estimate), is bounded by about sqrt(row_count / sampled_row_count).
+   * - The minimum and maximum of the histogram are those of the sample. Rare values outside of them are missed.
+   *
+   * The histograms of all columns are built in parallel on the scheduler. Single-column groups (see
+   * ColumnGroupStatistics) are only created if all chunks have ChunkStatistics, whose sketches are then merged, as
+   * sketching a column would require a full scan. sampled_row_count is set so that the StatisticsRefresher can replace
+   * the statistics by exact ones later.
+   */
+  static std::shared_ptr<TableStatistics> from_table_sample(const Table& table,
+                                                            const size_t sample_row_count = DEFAULT_SAMPLE_ROW_COUNT);
+
+  /**
+   * Creates statistics for @param table by merging the ChunkStatistics of its chunks. This is much cheaper than
+   * from_table() and used to refresh the statistics of a table after inserts (see StatisticsRefresher). Immutable
+   * chunks without ChunkStatistics are assigned new ones. For mutable chunks, temporary ones are created. The
+   * histograms are GenericHistograms and the column groups are the single-column groups only.
+   */
+  static std::shared_ptr<TableStatistics> from_chunk_statistics(const Table& table);
+
+  /**
+   * Determine bin count, within mostly arbitrarily chosen bounds: 5 (for tables with <=2k rows) up to 100 bins
+   * (for tables with >= 200m rows) are created.
+   */
+  static size_t histogram_bin_count(const size_t row_count);
+
   TableStatistics(std::vector<std::shared_ptr<BaseAttributeStatistics>>&& init_column_statistics,
                   const Cardinality init_row_count);
 
@@ -34,8 +83,22 @@ class TableStatistics {
    */
   DataType column_data_type(const ColumnID column_id) const;
 
+  /**
+   * @return the ColumnGroupStatistics with the fewest columns that covers @param column_ids, or nullptr if there is
+   *         none.
+   */
+  std::shared_ptr<const ColumnGroupStatistics> find_column_group_statistics(
+      const std::vector<ColumnID>& column_ids) const;
+
   const std::vector<std::shared_ptr<BaseAttributeStatistics>> column_statistics;
   Cardinality row_count;
+
+  // Number of rows the statistics were created from if they were created from a sample (see from_table_sample()),
+  // std::nullopt if they represent all rows.
+  std::optional<size_t> sampled_row_count;
+
+  // Only maintained for the statistics of stored tables. The column ids refer to the stored table.
+  std::vector<std::shared_ptr<const ColumnGroupStatistics>> column_group_statistics;
 };
 
 std::ostream& operator<<(std::ostream& stream, const TableStatistics& table_statistics);
@@ -186,10 +186,7 @@ bool Chunk::references_exactly_one_table() const {
 }
 
 void Chunk::migrate(boost::container::pmr::memory_resource* memory_source) {
-  // Migrating chunks with indexes is not implemented yet.
-  if (!_indexes.empty()) {
-    Fail("Cannot migrate Chunk with Indexes.");
-  }
+  Assert(can_migrate(), "Cannot migrate Chunk with Indexes.");
 
   _alloc = PolymorphicAllocator<size_t>(memory_source);
   Segments new_segments(_alloc);
@@ -199,6 +196,19 @@ void Chunk::migrate(boost::container::pmr::memory_resource* memory_source) {
   _segments = std::move(new_segments);
 }
 
+bool Chunk::can_migrate() const {
+  // Migrating chunks with indexes is not implemented yet.
+  return _indexes.empty();
+}
+
+NodeID Chunk::numa_node_id() const {
+  return _numa_node_id;
+}
+
+void Chunk::set_numa_node_id(const NodeID numa_node_id) {
+  _numa_node_id = numa_node_id;
+}
+
 const PolymorphicAllocator<Chunk>& Chunk::get_allocator() const {
   return _alloc;
 }
@@ -251,10 +261,29 @@ void Chunk::set_pruning_statistics(const std::optional<ChunkPruningStatistics>&
   _pruning_statistics = pruning_statistics;
 }
 
+std::shared_ptr<const ChunkStatistics> Chunk::statistics() const {
+  return std::atomic_load(&_statistics);
+}
+
+void Chunk::set_statistics(const std::shared_ptr<const ChunkStatistics>& statistics) const {
+  Assert(!is_mutable(), "Cannot set statistics on mutable chunks.");
+  std::atomic_store(&_statistics, statistics);
+}
+
 void Chunk::increase_invalid_row_count(const ChunkOffset count) const {
   _invalid_row_count += count;
 }
 
+CommitID Chunk::last_modification_commit_id() const {
+  return _last_modification_commit_id.load();
+}
+
+void Chunk::update_last_modification_commit_id(const CommitID commit_id) const {
+  auto last_modification_commit_id = _last_modification_commit_id.load();
+  while (last_modification_commit_id < commit_id &&
+         !_last_modification_commit_id.compare_exchange_weak(last_modification_commit_id, commit_id)) {}
+}
+
 const std::vector<SortColumnDefinition>& Chunk::individually_sorted_by() const {
   return _sorted_by;
 }
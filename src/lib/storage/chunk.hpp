@@ -24,6 +24,7 @@ namespace hyrise {
 class AbstractIndex;
 class AbstractSegment;
 class BaseAttributeStatistics;
+class ChunkStatistics;
 
 using Segments = pmr_vector<std::shared_ptr<AbstractSegment>>;
 using Indexes = pmr_vector<std::shared_ptr<AbstractIndex>>;
@@ -125,7 +126,19 @@ class Chunk : private Noncopyable {
 
   void remove_index(const std::shared_ptr<AbstractIndex>& index);
 
+  // Copies all segments using the given memory resource. Chunks with indexes cannot be migrated (see can_migrate).
   void migrate(boost::container::pmr::memory_resource* memory_source);
+  bool can_migrate() const;
+
+  /**
+   * The NUMA node that holds the chunk's data (see place_chunks_on_numa_nodes). Operators use it as the preferred node
+   * of the jobs that process this chunk. For chunks of intermediate results, it is inherited from the input chunk.
+   * INVALID_NODE_ID if the chunk has not been placed.
+   * @{
+   */
+  NodeID numa_node_id() const;
+  void set_numa_node_id(const NodeID numa_node_id);
+  /** @} */
 
   bool references_exactly_one_table() const;
 
@@ -139,6 +152,15 @@ class Chunk : private Noncopyable {
   void set_pruning_statistics(const std::optional<ChunkPruningStatistics>& pruning_statistics);
   /** @} */
 
+  /**
+   * For cardinality estimation, an immutable Chunk can be associated with statistics that are merged into the
+   * statistics of its table (see ChunkStatistics). Thread-safe, as the StatisticsRefresher reads them concurrently.
+   * @{
+   */
+  std::shared_ptr<const ChunkStatistics> statistics() const;
+  void set_statistics(const std::shared_ptr<const ChunkStatistics>& statistics) const;
+  /** @} */
+
   /**
    * For debugging purposes, makes an estimation about the memory used by this chunk and its segments
    */
@@ -175,6 +197,17 @@ class Chunk : private Noncopyable {
    */
   void increase_invalid_row_count(ChunkOffset count) const;
 
+  /**
+   * Returns the commit id of the latest transaction that inserted or deleted rows of this chunk (CommitID{0} if there
+   * is none). Transactions set it while committing, i.e., before their changes become visible. Thus, the rows visible
+   * for two snapshot commit ids are the same if both are at least as high as this commit id (see SQLResultCache).
+   * Rows appended without MVCC (e.g., by Table::append()) are not tracked.
+   */
+  CommitID last_modification_commit_id() const;
+
+  // Raises the last modification commit id. Marked as const for the same reason as increase_invalid_row_count().
+  void update_last_modification_commit_id(const CommitID commit_id) const;
+
   /**
    * Chunks with few visible entries can be cleaned up periodically by the MvccDeletePlugin in a two-step process.
    * Within the first step (clean up transaction), the plugin deletes rows from this chunk and re-inserts them at the
@@ -202,9 +235,12 @@ class Chunk : private Noncopyable {
   std::shared_ptr<MvccData> _mvcc_data;
   Indexes _indexes;
   std::optional<ChunkPruningStatistics> _pruning_statistics;
+  mutable std::shared_ptr<const ChunkStatistics> _statistics;
   bool _is_mutable = true;
   std::vector<SortColumnDefinition> _sorted_by;
+  std::atomic<NodeID> _numa_node_id{INVALID_NODE_ID};
   mutable std::atomic<ChunkOffset::base_type> _invalid_row_count{ChunkOffset::base_type{0}};
+  mutable std::atomic<CommitID> _last_modification_commit_id{CommitID{0}};
 
   // Default value of zero means "not set"
   std::atomic<CommitID> _cleanup_commit_id{CommitID{0}};
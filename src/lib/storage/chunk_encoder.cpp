@@ -7,6 +7,7 @@
 #include "base_value_segment.hpp"
 #include "chunk.hpp"
 #include "resolve_type.hpp"
+#include "statistics/chunk_statistics.hpp"
 #include "statistics/generate_pruning_statistics.hpp"
 #include "storage/abstract_encoded_segment.hpp"
 #include "storage/base_segment_encoder.hpp"
@@ -111,6 +112,11 @@ void ChunkEncoder::encode_chunk(const std::shared_ptr<Chunk>& chunk, const std::
   }
 
   generate_chunk_pruning_statistics(chunk);
+
+  // Like the pruning statistics, the statistics for cardinality estimation do not depend on the encoding.
+  if (!chunk->statistics()) {
+    chunk->set_statistics(ChunkStatistics::from_chunk(*chunk, column_data_types));
+  }
 }
 
 void ChunkEncoder::encode_chunk(const std::shared_ptr<Chunk>& chunk, const std::vector<DataType>& column_data_types,
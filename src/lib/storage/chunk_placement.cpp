@@ -0,0 +1,42 @@
+#include "chunk_placement.hpp"
+
+#include "hyrise.hpp"
+#include "memory/numa_memory_resource.hpp"
+#include "storage/chunk.hpp"
+#include "storage/table.hpp"
+
+namespace hyrise {
+
+void place_chunks_on_numa_nodes(const std::shared_ptr<Table>& table) {
+  const auto& topology = Hyrise::get().topology;
+  const auto node_count = topology.nodes().size();
+  if (node_count < 2) {
+    return;
+  }
+
+  const auto migrate_data = !topology.is_fake_numa_topology();
+
+  const auto chunk_count = table->chunk_count();
+  for (auto chunk_id = ChunkID{0}; chunk_id < chunk_count; ++chunk_id) {
+    const auto& chunk = table->get_chunk(chunk_id);
+    if (!chunk || chunk->is_mutable()) {
+      continue;
+    }
+
+    const auto target_node_id = NodeID{static_cast<NodeID::base_type>(chunk_id % node_count)};
+    if (chunk->numa_node_id() == target_node_id) {
+      continue;
+    }
+
+    if (migrate_data) {
+      if (!chunk->can_migrate()) {
+        continue;
+      }
+      chunk->migrate(NUMAMemoryResource::get(target_node_id));
+    }
+
+    chunk->set_numa_node_id(target_node_id);
+  }
+}
+
+}  // namespace hyrise
@@ -0,0 +1,24 @@
+#pragma once
+
+#include <memory>
+
+#include "types.hpp"
+
+namespace hyrise {
+
+class Table;
+
+/**
+ * Distributes the immutable chunks of a table round-robin across the nodes of the current topology, i.e., chunk i is
+ * placed on node i % node_count. On real NUMA systems, the chunk's segments are migrated to memory of that node
+ * (see Chunk::migrate). On fake-NUMA and non-NUMA topologies, only the node id is recorded so that per-chunk jobs are
+ * still scheduled with an affinity.
+ *
+ * Mutable chunks are skipped because rows might concurrently be appended to them. Chunks that are already placed on
+ * their target node are not touched again, so calling this repeatedly (e.g., after new chunks were finalized) is cheap.
+ * Chunks with indexes cannot be migrated and remain unplaced on real NUMA systems. As Chunk::migrate is not
+ * thread-safe, the table must not be accessed concurrently (the StorageManager places chunks when a table is added).
+ */
+void place_chunks_on_numa_nodes(const std::shared_ptr<Table>& table);
+
+}  // namespace hyrise
@@ -0,0 +1,100 @@
+#include "abstract_table_index.hpp"
+
+#include <mutex>
+
+#include "hash_table_index.hpp"
+#include "ordered_table_index.hpp"
+#include "resolve_type.hpp"
+#include "utils/assert.hpp"
+
+namespace hyrise {
+
+std::shared_ptr<AbstractTableIndex> AbstractTableIndex::create(const TableIndexType type, const DataType data_type,
+                                                               const ColumnID column_id) {
+  auto index = std::shared_ptr<AbstractTableIndex>{};
+  resolve_data_type(data_type, [&](const auto data_type_t) {
+    using ColumnDataType = typename decltype(data_type_t)::type;
+
+    switch (type) {
+      case TableIndexType::Hash:
+        index = std::make_shared<HashTableIndex<ColumnDataType>>(column_id);
+        break;
+      case TableIndexType::Ordered:
+        index = std::make_shared<OrderedTableIndex<ColumnDataType>>(column_id);
+        break;
+    }
+  });
+  return index;
+}
+
+AbstractTableIndex::AbstractTableIndex(const TableIndexType type, const ColumnID column_id)
+    : _type{type}, _column_id{column_id} {}
+
+TableIndexType AbstractTableIndex::type() const {
+  return _type;
+}
+
+ColumnID AbstractTableIndex::column_id() const {
+  return _column_id;
+}
+
+bool AbstractTableIndex::supports(const PredicateCondition predicate_condition) const {
+  switch (predicate_condition) {
+    case PredicateCondition::Equals:
+      return true;
+    case PredicateCondition::NotEquals:
+    case PredicateCondition::LessThan:
+    case PredicateCondition::LessThanEquals:
+    case PredicateCondition::GreaterThan:
+    case PredicateCondition::GreaterThanEquals:
+    case PredicateCondition::BetweenInclusive:
+    case PredicateCondition::BetweenLowerExclusive:
+    case PredicateCondition::BetweenUpperExclusive:
+    case PredicateCondition::BetweenExclusive:
+      return _type == TableIndexType::Ordered;
+    default:
+      return false;
+  }
+}
+
+void AbstractTableIndex::insert_entries(const ChunkID chunk_id, const AbstractSegment& segment,
+                                        const ChunkOffset begin_offset, const ChunkOffset end_offset) {
+  const auto lock = std::unique_lock<std::shared_mutex>{_mutex};
+  _insert_entries(chunk_id, segment, begin_offset, end_offset);
+}
+
+void AbstractTableIndex::remove_entries(const ChunkID chunk_id, const AbstractSegment& segment,
+                                        const ChunkOffset begin_offset, const ChunkOffset end_offset) {
+  const auto lock = std::unique_lock<std::shared_mutex>{_mutex};
+  _remove_entries(chunk_id, segment, begin_offset, end_offset);
+}
+
+void AbstractTableIndex::lookup(const PredicateCondition predicate_condition, const AllTypeVariant& value,
+                                const std::optional<AllTypeVariant>& value2, RowIDPosList& matches) const {
+  Assert(supports(predicate_condition), "Predicate condition not supported by this table index.");
+  Assert(!is_between_predicate_condition(predicate_condition) || value2, "BETWEEN requires a second value.");
+
+  // Comparisons with NULL never match.
+  if (variant_is_null(value) || (value2 && variant_is_null(*value2))) {
+    return;
+  }
+
+  const auto lock = std::shared_lock<std::shared_mutex>{_mutex};
+  _lookup(predicate_condition, value, value2, matches);
+}
+
+std::shared_lock<std::shared_mutex> AbstractTableIndex::acquire_shared_lock() const {
+  return std::shared_lock<std::shared_mutex>{_mutex};
+}
+
+size_t AbstractTableIndex::row_count() const {
+  const auto lock = std::shared_lock<std::shared_mutex>{_mutex};
+  return _row_count;
+}
+
+size_t AbstractTableIndex::memory_consumption() const {
+  const auto lock = std::shared_lock<std::shared_mutex>{_mutex};
+  return sizeof(*this) + _memory_consumption();
+}
+
+}  // namespace hyrise
@@ -0,0 +1,83 @@
+#pragma once
+
+#include <memory>
+#include <optional>
+#include <shared_mutex>
+
+#include "all_type_variant.hpp"
+#include "storage/pos_lists/row_id_pos_list.hpp"
+#include "types.hpp"
+
+namespace hyrise {
+
+class AbstractSegment;
+
+enum class TableIndexType : uint8_t { Hash, Ordered };
+
+/**
+ * Table indexes map the values of a single column to the RowIDs of the rows holding them, across all chunks of a
+ * table. In contrast to chunk indexes (see AbstractIndex), which cover a single chunk, a lookup needs a single probe
+ * regardless of the number of chunks. Hash indexes only support equality lookups. Ordered indexes support range
+ * lookups as well. NULL values are not indexed.
+ *
+ * Table indexes are created via Table::create_table_index() and maintained by the Insert operator: rows are added
+ * once their values are written and removed if the inserting transaction is rolled back. Rows that are invalidated by
+ * a Delete (or an Update) remain indexed because transactions with an older snapshot may still see them. Lookups thus
+ * return candidates that might not be visible. Their visibility has to be checked, e.g., by the Validate operator.
+ *
+ * All methods can be called concurrently.
+ */
+class AbstractTableIndex : private Noncopyable {
+ public:
+  static std::shared_ptr<AbstractTableIndex> create(const TableIndexType type, const DataType data_type,
+                                                    const ColumnID column_id);
+
+  AbstractTableIndex(const TableIndexType type, const ColumnID column_id);
+  virtual ~AbstractTableIndex() = default;
+
+  TableIndexType type() const;
+  ColumnID column_id() const;
+
+  // Returns true if lookup() can handle the predicate condition.
+  bool supports(const PredicateCondition predicate_condition) const;
+
+  // Adds or removes the rows [begin_offset, end_offset) of the chunk with the given ID. `segment` is the chunk's
+  // segment of the indexed column.
+  void insert_entries(const ChunkID chunk_id, const AbstractSegment& segment, const ChunkOffset begin_offset,
+                      const ChunkOffset end_offset);
+  void remove_entries(const ChunkID chunk_id, const AbstractSegment& segment, const ChunkOffset begin_offset,
+                      const ChunkOffset end_offset);
+
+  // Appends the RowIDs of all rows with `<column value> <predicate_condition> value` (and `value2` for BETWEEN) to
+  // `matches`. The values have to be of the column's data type. The order of the appended RowIDs is unspecified.
+  void lookup(const PredicateCondition predicate_condition, const AllTypeVariant& value,
+              const std::optional<AllTypeVariant>& value2, RowIDPosList& matches) const;
+
+  // Operators that probe many values (e.g., the JoinIndex) acquire this lock once and then call lookup_equals() of the
+  // typed index (HashTableIndex or OrderedTableIndex) for each value. Thus, they neither lock the index nor build an
+  // AllTypeVariant per value. Inserts into the table block while the lock is held.
+  std::shared_lock<std::shared_mutex> acquire_shared_lock() const;
+
+  // Number of indexed (i.e., non-NULL) rows
+  size_t row_count() const;
+
+  size_t memory_consumption() const;
+
+ protected:
+  virtual void _insert_entries(const ChunkID chunk_id, const AbstractSegment& segment, const ChunkOffset begin_offset,
+                               const ChunkOffset end_offset) = 0;
+  virtual void _remove_entries(const ChunkID chunk_id, const AbstractSegment& segment, const ChunkOffset begin_offset,
+                               const ChunkOffset end_offset) = 0;
+  virtual void _lookup(const PredicateCondition predicate_condition, const AllTypeVariant& value,
+                       const std::optional<AllTypeVariant>& value2, RowIDPosList& matches) const = 0;
+  virtual size_t _memory_consumption() const = 0;
+
+  size_t _row_count{0};
+
+ private:
+  const TableIndexType _type;
+  const ColumnID _column_id;
+  mutable std::shared_mutex _mutex;
+};
+
+}  // namespace hyrise
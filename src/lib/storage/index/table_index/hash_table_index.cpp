@@ -0,0 +1,81 @@
+#include "hash_table_index.hpp"
+
+#include <algorithm>
+
+#include "storage/segment_iterate.hpp"
+#include "utils/assert.hpp"
+
+namespace hyrise {
+
+template <typename DataType>
+HashTableIndex<DataType>::HashTableIndex(const ColumnID column_id)
+    : AbstractTableIndex{TableIndexType::Hash, column_id} {}
+
+template <typename DataType>
+void HashTableIndex<DataType>::_insert_entries(const ChunkID chunk_id, const AbstractSegment& segment,
+                                               const ChunkOffset begin_offset, const ChunkOffset end_offset) {
+  segment_with_iterators<DataType>(segment, [&](auto iter, const auto /*end*/) {
+    iter += begin_offset;
+    for (auto chunk_offset = begin_offset; chunk_offset < end_offset; ++chunk_offset, ++iter) {
+      if (iter->is_null()) {
+        continue;
+      }
+
+      _row_ids[iter->value()].emplace_back(chunk_id, chunk_offset);
+      ++_row_count;
+    }
+  });
+}
+
+template <typename DataType>
+void HashTableIndex<DataType>::_remove_entries(const ChunkID chunk_id, const AbstractSegment& segment,
+                                               const ChunkOffset begin_offset, const ChunkOffset end_offset) {
+  segment_with_iterators<DataType>(segment, [&](auto iter, const auto /*end*/) {
+    iter += begin_offset;
+    for (auto chunk_offset = begin_offset; chunk_offset < end_offset; ++chunk_offset, ++iter) {
+      if (iter->is_null()) {
+        continue;
+      }
+
+      const auto row_ids_iter = _row_ids.find(iter->value());
+      Assert(row_ids_iter != _row_ids.end(), "Cannot remove a row that is not indexed.");
+      auto& row_ids = row_ids_iter->second;
+      const auto row_id_iter = std::find(row_ids.begin(), row_ids.end(), RowID{chunk_id, chunk_offset});
+      Assert(row_id_iter != row_ids.end(), "Cannot remove a row that is not indexed.");
+
+      row_ids.erase(row_id_iter);
+      if (row_ids.empty()) {
+        _row_ids.erase(row_ids_iter);
+      }
+      --_row_count;
+    }
+  });
+}
+
+template <typename DataType>
+void HashTableIndex<DataType>::_lookup(const PredicateCondition predicate_condition, const AllTypeVariant& value,
+                                       const std::optional<AllTypeVariant>& /*value2*/, RowIDPosList& matches) const {
+  DebugAssert(predicate_condition == PredicateCondition::Equals, "HashTableIndex only supports equality lookups.");
+  lookup_equals(boost::get<DataType>(value), matches);
+}
+
+template <typename DataType>
+void HashTableIndex<DataType>::lookup_equals(const DataType& value, RowIDPosList& matches) const {
+  const auto row_ids_iter = _row_ids.find(value);
+  if (row_ids_iter != _row_ids.end()) {
+    matches.insert(matches.end(), row_ids_iter->second.cbegin(), row_ids_iter->second.cend());
+  }
+}
+
+template <typename DataType>
+size_t HashTableIndex<DataType>::_memory_consumption() const {
+  // Estimate the size of the hash map's nodes and buckets.
+  auto bytes = _row_ids.bucket_count() * sizeof(void*);
+  bytes += _row_ids.size() * (sizeof(DataType) + sizeof(std::vector<RowID>) + sizeof(void*));
+  bytes += _row_count * sizeof(RowID);
+  return bytes;
+}
+
+EXPLICITLY_INSTANTIATE_DATA_TYPES(HashTableIndex);
+
+}  // namespace hyrise
@@ -0,0 +1,36 @@
+#pragma once
+
+#include <unordered_map>
+#include <vector>
+
+#include "abstract_table_index.hpp"
+
+namespace hyrise {
+
+/**
+ * Table index based on a hash map from values to the RowIDs of the rows holding them. Only supports equality lookups.
+ */
+template <typename DataType>
+class HashTableIndex : public AbstractTableIndex {
+ public:
+  explicit HashTableIndex(const ColumnID column_id);
+
+  // Appends the RowIDs of all rows holding @param value to @param matches. The caller has to hold the lock returned
+  // by acquire_shared_lock().
+  void lookup_equals(const DataType& value, RowIDPosList& matches) const;
+
+ protected:
+  void _insert_entries(const ChunkID chunk_id, const AbstractSegment& segment, const ChunkOffset begin_offset,
+                       const ChunkOffset end_offset) final;
+  void _remove_entries(const ChunkID chunk_id, const AbstractSegment& segment, const ChunkOffset begin_offset,
+                       const ChunkOffset end_offset) final;
+  void _lookup(const PredicateCondition predicate_condition, const AllTypeVariant& value,
+               const std::optional<AllTypeVariant>& value2, RowIDPosList& matches) const final;
+  size_t _memory_consumption() const final;
+
+  std::unordered_map<DataType, std::vector<RowID>> _row_ids;
+};
+
+EXPLICITLY_DECLARE_DATA_TYPES(HashTableIndex);
+
+}  // namespace hyrise
@@ -0,0 +1,131 @@
+#include "ordered_table_index.hpp"
+
+#include <algorithm>
+
+#include "storage/segment_iterate.hpp"
+#include "utils/assert.hpp"
+
+namespace {
+
+using namespace hyrise;  // NOLINT
+
+template <typename Iterator>
+void append_row_ids(Iterator begin, const Iterator end, RowIDPosList& matches) {
+  for (; begin != end; ++begin) {
+    matches.insert(matches.end(), begin->second.cbegin(), begin->second.cend());
+  }
+}
+
+}  // namespace
+
+namespace hyrise {
+
+template <typename DataType>
+OrderedTableIndex<DataType>::OrderedTableIndex(const ColumnID column_id)
+    : AbstractTableIndex{TableIndexType::Ordered, column_id} {}
+
+template <typename DataType>
+void OrderedTableIndex<DataType>::_insert_entries(const ChunkID chunk_id, const AbstractSegment& segment,
+                                                  const ChunkOffset begin_offset, const ChunkOffset end_offset) {
+  segment_with_iterators<DataType>(segment, [&](auto iter, const auto /*end*/) {
+    iter += begin_offset;
+    for (auto chunk_offset = begin_offset; chunk_offset < end_offset; ++chunk_offset, ++iter) {
+      if (iter->is_null()) {
+        continue;
+      }
+
+      _row_ids[iter->value()].emplace_back(chunk_id, chunk_offset);
+      ++_row_count;
+    }
+  });
+}
+
+template <typename DataType>
+void OrderedTableIndex<DataType>::_remove_entries(const ChunkID chunk_id, const AbstractSegment& segment,
+                                                  const ChunkOffset begin_offset, const ChunkOffset end_offset) {
+  segment_with_iterators<DataType>(segment, [&](auto iter, const auto /*end*/) {
+    iter += begin_offset;
+    for (auto chunk_offset = begin_offset; chunk_offset < end_offset; ++chunk_offset, ++iter) {
+      if (iter->is_null()) {
+        continue;
+      }
+
+      const auto row_ids_iter = _row_ids.find(iter->value());
+      Assert(row_ids_iter != _row_ids.end(), "Cannot remove a row that is not indexed.");
+      auto& row_ids = row_ids_iter->second;
+      const auto row_id_iter = std::find(row_ids.begin(), row_ids.end(), RowID{chunk_id, chunk_offset});
+      Assert(row_id_iter != row_ids.end(), "Cannot remove a row that is not indexed.");
+
+      row_ids.erase(row_id_iter);
+      if (row_ids.empty()) {
+        _row_ids.erase(row_ids_iter);
+      }
+      --_row_count;
+    }
+  });
+}
+
+template <typename DataType>
+void OrderedTableIndex<DataType>::_lookup(const PredicateCondition predicate_condition, const AllTypeVariant& value,
+                                          const std::optional<AllTypeVariant>& value2, RowIDPosList& matches) const {
+  const auto typed_value = boost::get<DataType>(value);
+
+  switch (predicate_condition) {
+    case PredicateCondition::Equals:
+      lookup_equals(typed_value, matches);
+      return;
+    case PredicateCondition::NotEquals:
+      append_row_ids(_row_ids.cbegin(), _row_ids.lower_bound(typed_value), matches);
+      append_row_ids(_row_ids.upper_bound(typed_value), _row_ids.cend(), matches);
+      return;
+    case PredicateCondition::LessThan:
+      append_row_ids(_row_ids.cbegin(), _row_ids.lower_bound(typed_value), matches);
+      return;
+    case PredicateCondition::LessThanEquals:
+      append_row_ids(_row_ids.cbegin(), _row_ids.upper_bound(typed_value), matches);
+      return;
+    case PredicateCondition::GreaterThan:
+      append_row_ids(_row_ids.upper_bound(typed_value), _row_ids.cend(), matches);
+      return;
+    case PredicateCondition::GreaterThanEquals:
+      append_row_ids(_row_ids.lower_bound(typed_value), _row_ids.cend(), matches);
+      return;
+    default:
+      break;
+  }
+
+  DebugAssert(is_between_predicate_condition(predicate_condition), "Unexpected predicate condition.");
+  const auto typed_value2 = boost::get<DataType>(*value2);
+
+  // Empty ranges, for which the bounds computed below would be in the wrong order
+  if (typed_value2 < typed_value ||
+      (typed_value2 == typed_value && predicate_condition != PredicateCondition::BetweenInclusive)) {
+    return;
+  }
+
+  const auto lower_bound_is_inclusive = predicate_condition == PredicateCondition::BetweenInclusive ||
+                                        predicate_condition == PredicateCondition::BetweenUpperExclusive;
+  const auto upper_bound_is_inclusive = predicate_condition == PredicateCondition::BetweenInclusive ||
+                                        predicate_condition == PredicateCondition::BetweenLowerExclusive;
+
+  const auto begin = lower_bound_is_inclusive ? _row_ids.lower_bound(typed_value) : _row_ids.upper_bound(typed_value);
+  const auto end = upper_bound_is_inclusive ? _row_ids.upper_bound(typed_value2) : _row_ids.lower_bound(typed_value2);
+  append_row_ids(begin, end, matches);
+}
+
+template <typename DataType>
+void OrderedTableIndex<DataType>::lookup_equals(const DataType& value, RowIDPosList& matches) const {
+  const auto row_ids_iter = _row_ids.find(value);
+  if (row_ids_iter != _row_ids.end()) {
+    matches.insert(matches.end(), row_ids_iter->second.cbegin(), row_ids_iter->second.cend());
+  }
+}
+
+template <typename DataType>
+size_t OrderedTableIndex<DataType>::_memory_consumption() const {
+  return _row_ids.bytes_used() + _row_count * sizeof(RowID);
+}
+
+EXPLICITLY_INSTANTIATE_DATA_TYPES(OrderedTableIndex);
+
+}  // namespace hyrise
@@ -0,0 +1,40 @@
+#pragma once
+
+#include <vector>
+
+#include <btree_map.h>
+
+#include "abstract_table_index.hpp"
+
+namespace hyrise {
+
+/**
+ * Table index based on a B-tree from values to the RowIDs of the rows holding them. Supports equality and range
+ * lookups.
+ */
+template <typename DataType>
+class OrderedTableIndex : public AbstractTableIndex {
+ public:
+  explicit OrderedTableIndex(const ColumnID column_id);
+
+  // Appends the RowIDs of all rows holding @param value to @param matches. The caller has to hold the lock returned
+  // by acquire_shared_lock().
+  void lookup_equals(const DataType& value, RowIDPosList& matches) const;
+
+ protected:
+  using Map = btree::btree_map<DataType, std::vector<RowID>>;
+
+  void _insert_entries(const ChunkID chunk_id, const AbstractSegment& segment, const ChunkOffset begin_offset,
+                       const ChunkOffset end_offset) final;
+  void _remove_entries(const ChunkID chunk_id, const AbstractSegment& segment, const ChunkOffset begin_offset,
+                       const ChunkOffset end_offset) final;
+  void _lookup(const PredicateCondition predicate_condition, const AllTypeVariant& value,
+               const std::optional<AllTypeVariant>& value2, RowIDPosList& matches) const final;
+  size_t _memory_consumption() const final;
+
+  Map _row_ids;
+};
+
+EXPLICITLY_DECLARE_DATA_TYPES(OrderedTableIndex);
+
+}  // namespace hyrise
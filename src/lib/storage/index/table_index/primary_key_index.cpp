@@ -0,0 +1,175 @@
+#include "primary_key_index.hpp"
+
+#include <algorithm>
+
+#include <boost/container_hash/hash.hpp>
+
+#include "resolve_type.hpp"
+#include "storage/segment_iterate.hpp"
+#include "storage/table.hpp"
+#include "utils/assert.hpp"
+
+namespace hyrise {
+
+size_t PrimaryKeyIndex::KeyHash::operator()(const Key& key) const {
+  auto seed = size_t{0};
+  for (const auto& value : key) {
+    boost::hash_combine(seed, std::hash<AllTypeVariant>{}(value));
+  }
+  return seed;
+}
+
+PrimaryKeyIndex::PrimaryKeyIndex(const std::vector<ColumnID>& column_ids) : _column_ids{column_ids} {
+  Assert(!_column_ids.empty(), "Primary key requires at least one column.");
+}
+
+const std::vector<ColumnID>& PrimaryKeyIndex::column_ids() const {
+  return _column_ids;
+}
+
+bool PrimaryKeyIndex::insert_entries(const Table& table, const ChunkID chunk_id, const ChunkOffset begin_offset,
+                                     const ChunkOffset end_offset, const TransactionID transaction_id) {
+  const auto chunk = table.get_chunk(chunk_id);
+  Assert(chunk, "Cannot index a physically deleted chunk.");
+
+  auto keys = _read_keys(*chunk, begin_offset, end_offset);
+  for (auto chunk_offset = begin_offset; chunk_offset < end_offset; ++chunk_offset) {
+    auto& key = keys[chunk_offset - begin_offset];
+    auto& stripe = _stripe(key);
+
+    const auto lock = std::lock_guard<std::mutex>{stripe.mutex};
+    auto& row_ids = stripe.row_ids[std::move(key)];
+    const auto key_is_held = std::any_of(row_ids.cbegin(), row_ids.cend(), [&](const auto& row_id) {
+      return _holds_key(table, row_id, transaction_id);
+    });
+    if (key_is_held) {
+      return false;
+    }
+
+    row_ids.emplace_back(chunk_id, chunk_offset);
+    ++stripe.row_count;
+  }
+
+  return true;
+}
+
+void PrimaryKeyIndex::remove_entries(const Chunk& chunk, const ChunkID chunk_id, const ChunkOffset begin_offset,
+                                     const ChunkOffset end_offset) {
+  const auto keys = _read_keys(chunk, begin_offset, end_offset);
+  for (auto chunk_offset = begin_offset; chunk_offset < end_offset; ++chunk_offset) {
+    const auto& key = keys[chunk_offset - begin_offset];
+    auto& stripe = _stripe(key);
+
+    const auto lock = std::lock_guard<std::mutex>{stripe.mutex};
+    const auto row_ids_iter = stripe.row_ids.find(key);
+    if (row_ids_iter == stripe.row_ids.end()) {
+      continue;
+    }
+
+    auto& row_ids = row_ids_iter->second;
+    const auto row_id_iter = std::find(row_ids.begin(), row_ids.end(), RowID{chunk_id, chunk_offset});
+    if (row_id_iter == row_ids.end()) {
+      continue;
+    }
+
+    row_ids.erase(row_id_iter);
+    if (row_ids.empty()) {
+      stripe.row_ids.erase(row_ids_iter);
+    }
+    --stripe.row_count;
+  }
+}
+
+void PrimaryKeyIndex::lookup(const Key& key, RowIDPosList& matches) const {
+  DebugAssert(key.size() == _column_ids.size(), "Lookup requires values for all key columns.");
+  const auto& stripe = _stripe(key);
+
+  const auto lock = std::lock_guard<std::mutex>{stripe.mutex};
+  const auto row_ids_iter = stripe.row_ids.find(key);
+  if (row_ids_iter != stripe.row_ids.end()) {
+    matches.insert(matches.end(), row_ids_iter->second.cbegin(), row_ids_iter->second.cend());
+  }
+}
+
+size_t PrimaryKeyIndex::row_count() const {
+  auto row_count = size_t{0};
+  for (const auto& stripe : _stripes) {
+    const auto lock = std::lock_guard<std::mutex>{stripe.mutex};
+    row_count += stripe.row_count;
+  }
+  return row_count;
+}
+
+size_t PrimaryKeyIndex::memory_consumption() const {
+  // Estimate the size of the hash maps' nodes and buckets. The keys' variants are not resolved.
+  auto bytes = sizeof(*this);
+  for (const auto& stripe : _stripes) {
+    const auto lock = std::lock_guard<std::mutex>{stripe.mutex};
+    bytes += stripe.row_ids.bucket_count() * sizeof(void*);
+    bytes += stripe.row_ids.size() *
+             (sizeof(Key) + _column_ids.size() * sizeof(AllTypeVariant) + sizeof(std::vector<RowID>) + sizeof(void*));
+    bytes += stripe.row_count * sizeof(RowID);
+  }
+  return bytes;
+}
+
+std::vector<PrimaryKeyIndex::Key> PrimaryKeyIndex::_read_keys(const Chunk& chunk, const ChunkOffset begin_offset,
+                                                              const ChunkOffset end_offset) const {
+  const auto key_column_count = _column_ids.size();
+  auto keys = std::vector<Key>(end_offset - begin_offset, Key(key_column_count));
+
+  for (auto key_column_idx = size_t{0}; key_column_idx < key_column_count; ++key_column_idx) {
+    const auto& segment = *chunk.get_segment(_column_ids[key_column_idx]);
+    resolve_data_type(segment.data_type(), [&](const auto data_type_t) {
+      using ColumnDataType = typename decltype(data_type_t)::type;
+
+      segment_with_iterators<ColumnDataType>(segment, [&](auto iter, const auto /*end*/) {
+        iter += begin_offset;
+        for (auto chunk_offset = begin_offset; chunk_offset < end_offset; ++chunk_offset, ++iter) {
+          Assert(!iter->is_null(), "Primary key columns must not contain NULL values.");
+          keys[chunk_offset - begin_offset][key_column_idx] = iter->value();
+        }
+      });
+    });
+  }
+
+  return keys;
+}
+
+bool PrimaryKeyIndex::_holds_key(const Table& table, const RowID row_id, const TransactionID transaction_id) {
+  if (table.uses_mvcc() == UseMvcc::No) {
+    return true;
+  }
+
+  const auto chunk = table.get_chunk(row_id.chunk_id);
+  if (!chunk) {
+    return false;
+  }
+
+  const auto& mvcc_data = chunk->mvcc_data();
+  if (mvcc_data->get_end_cid(row_id.chunk_offset) != MvccData::MAX_COMMIT_ID) {
+    // Deleted by a committed transaction or rolled back.
+    return false;
+  }
+
+  const auto row_tid = mvcc_data->get_tid(row_id.chunk_offset);
+  const auto committed = mvcc_data->get_begin_cid(row_id.chunk_offset) != MvccData::MAX_COMMIT_ID;
+  if (committed) {
+    // Committed rows that are being deleted by the inserting transaction do not hold their key anymore.
+    return row_tid != transaction_id || transaction_id == INVALID_TRANSACTION_ID;
+  }
+
+  // Uncommitted rows are held by the transaction that inserts them, unless this transaction deleted them again (see
+  // Delete, which resets the TID in that case).
+  return row_tid != INVALID_TRANSACTION_ID;
+}
+
+PrimaryKeyIndex::Stripe& PrimaryKeyIndex::_stripe(const Key& key) {
+  return _stripes[KeyHash{}(key) % STRIPE_COUNT];
+}
+
+const PrimaryKeyIndex::Stripe& PrimaryKeyIndex::_stripe(const Key& key) const {
+  return _stripes[KeyHash{}(key) % STRIPE_COUNT];
+}
+
+}  // namespace hyrise
@@ -0,0 +1,87 @@
+#pragma once
+
+#include <array>
+#include <memory>
+#include <mutex>
+#include <unordered_map>
+#include <vector>
+
+#include "all_type_variant.hpp"
+#include "storage/pos_lists/row_id_pos_list.hpp"
+#include "types.hpp"
+
+namespace hyrise {
+
+class Chunk;
+class Table;
+
+/**
+ * Enforced primary key of a table. Maps the values of the key columns to the RowIDs of the rows holding them. In
+ * contrast to the soft key constraints (see TableKeyConstraint), the index is checked by the Insert operator: if a
+ * key is already held by another row, the inserting transaction conflicts. Lookups require values for all key
+ * columns and return the matching rows in constant time.
+ *
+ * A row holds its key unless it was deleted by a committed transaction, rolled back, or is being deleted by the
+ * inserting transaction itself (which is how an Update changes a row). Rows that are being deleted by another
+ * transaction still hold their key, because that transaction might roll back. Rows that no longer hold their key
+ * remain in the index, because transactions with an older snapshot might still see them. Lookups thus return
+ * candidates whose visibility has to be checked, e.g., by the Validate operator. Rows of rolled-back inserts are
+ * removed.
+ *
+ * The index is split into stripes, each with its own hash map and mutex. Concurrent inserts and lookups only contend
+ * if their keys fall into the same stripe.
+ */
+class PrimaryKeyIndex : private Noncopyable {
+ public:
+  // Values of the key columns, in the order of column_ids()
+  using Key = std::vector<AllTypeVariant>;
+
+  struct KeyHash {
+    size_t operator()(const Key& key) const;
+  };
+
+  static constexpr auto STRIPE_COUNT = size_t{64};
+
+  // The key columns must not contain NULL values.
+  explicit PrimaryKeyIndex(const std::vector<ColumnID>& column_ids);
+
+  const std::vector<ColumnID>& column_ids() const;
+
+  // Adds the rows [begin_offset, end_offset) of the chunk with the given ID. Returns false as soon as a row's key is
+  // held by another row of `table` (see class comment). Rows added up to that point remain in the index and have to
+  // be removed via remove_entries() when the transaction is rolled back. Pass INVALID_TRANSACTION_ID if the rows are
+  // not inserted by a transaction, e.g., when the index is created.
+  bool insert_entries(const Table& table, const ChunkID chunk_id, const ChunkOffset begin_offset,
+                      const ChunkOffset end_offset, const TransactionID transaction_id);
+
+  // Removes the rows [begin_offset, end_offset) of the chunk with the given ID. Rows that are not indexed are ignored.
+  void remove_entries(const Chunk& chunk, const ChunkID chunk_id, const ChunkOffset begin_offset,
+                      const ChunkOffset end_offset);
+
+  // Appends the RowIDs of all indexed rows with the given key to `matches`.
+  void lookup(const Key& key, RowIDPosList& matches) const;
+
+  // Number of indexed rows
+  size_t row_count() const;
+
+  size_t memory_consumption() const;
+
+ protected:
+  struct Stripe {
+    mutable std::mutex mutex;
+    std::unordered_map<Key, std::vector<RowID>, KeyHash> row_ids;
+    size_t row_count{0};
+  };
+
+  std::vector<Key> _read_keys(const Chunk& chunk, const ChunkOffset begin_offset, const ChunkOffset end_offset) const;
+
+  static bool _holds_key(const Table& table, const RowID row_id, const TransactionID transaction_id);
+
+  Stripe& _stripe(const Key& key);
+  const Stripe& _stripe(const Key& key) const;
+
+  const std::vector<ColumnID> _column_ids;
+  std::array<Stripe, STRIPE_COUNT> _stripes;
+};
+
+}  // namespace hyrise
@@ -21,6 +21,7 @@
 #include "statistics/generate_pruning_statistics.hpp"
 #include "statistics/table_statistics.hpp"
 #include "storage/base_dictionary_segment.hpp"
+#include "storage/chunk_placement.hpp"
 #include "storage/create_iterable_from_segment.hpp"
 #include "storage/dictionary_segment.hpp"
 #include "storage/dictionary_segment/dictionary_segment_iterable.hpp"
@@ -88,11 +89,17 @@ void StorageManager::add_table(const std::string& name, std::shared_ptr<Table> t
     Assert(table->get_chunk(chunk_id)->has_mvcc_data(), "Table must have MVCC data.");
   }
 
-  // Create table statistics and chunk pruning statistics for added table.
-
-  table->set_table_statistics(TableStatistics::from_table(*table));
+  // Create table statistics and chunk pruning statistics for added table. For large tables, building exact histograms
+  // dominates the loading time. Their statistics are created from a sample instead (and can be refined later, see
+  // StatisticsRefresher).
+  table->set_table_statistics(table->row_count() > TableStatistics::MAX_EXACT_ROW_COUNT
+                                  ? TableStatistics::from_table_sample(*table)
+                                  : TableStatistics::from_table(*table));
   generate_chunk_pruning_statistics(table);
 
+  // Spread the table's chunks across NUMA nodes so that per-chunk jobs can be executed close to their data.
+  place_chunks_on_numa_nodes(table);
+
   _tables[name] = std::move(table);
 
   const auto table_persistence_file_name = name + "_0.bin";
@@ -341,17 +341,83 @@ std::unique_lock<std::mutex> Table::acquire_append_mutex() {
 }
 
 std::shared_ptr<TableStatistics> Table::table_statistics() const {
-  return _table_statistics;
+  return std::atomic_load(&_table_statistics);
 }
 
 void Table::set_table_statistics(const std::shared_ptr<TableStatistics>& table_statistics) {
-  _table_statistics = table_statistics;
+  std::atomic_store(&_table_statistics, table_statistics);
 }
 
 std::vector<IndexStatistics> Table::indexes_statistics() const {
   return _indexes;
 }
 
+std::shared_ptr<AbstractTableIndex> Table::create_table_index(const ColumnID column_id,
+                                                             const TableIndexType type) {
+  Assert(_type == TableType::Data, "Table indexes can only be created on data tables.");
+  Assert(column_id < column_count(), "ColumnID out of range");
+
+  const auto table_index = AbstractTableIndex::create(type, column_data_type(column_id), column_id);
+
+  const auto append_lock = acquire_append_mutex();
+  const auto chunk_count = _chunks.size();
+  for (auto chunk_id = ChunkID{0}; chunk_id < chunk_count; ++chunk_id) {
+    const auto chunk = get_chunk(chunk_id);
+    if (chunk) {
+      table_index->insert_entries(chunk_id, *chunk->get_segment(column_id), ChunkOffset{0}, chunk->size());
+    }
+  }
+
+  _table_indexes.emplace_back(table_index);
+  return table_index;
+}
+
+std::vector<std::shared_ptr<AbstractTableIndex>> Table::table_indexes() const {
+  const auto append_lock = std::lock_guard<std::mutex>{*_append_mutex};
+  return _table_indexes;
+}
+
+std::shared_ptr<AbstractTableIndex> Table::get_table_index(const ColumnID column_id,
+                                                           const PredicateCondition predicate_condition) const {
+  const auto append_lock = std::lock_guard<std::mutex>{*_append_mutex};
+  for (const auto& table_index : _table_indexes) {
+    if (table_index->column_id() == column_id && table_index->supports(predicate_condition)) {
+      return table_index;
+    }
+  }
+  return nullptr;
+}
+
+std::shared_ptr<PrimaryKeyIndex> Table::create_primary_key_index(const std::vector<ColumnID>& column_ids) {
+  Assert(_type == TableType::Data, "Primary key indexes can only be created on data tables.");
+  for (const auto column_id : column_ids) {
+    Assert(column_id < column_count(), "ColumnID out of range");
+    Assert(!column_is_nullable(column_id), "Primary key columns must not be nullable.");
+  }
+
+  const auto primary_key_index = std::make_shared<PrimaryKeyIndex>(column_ids);
+
+  const auto append_lock = acquire_append_mutex();
+  Assert(!_primary_key_index, "Table already has a primary key index.");
+  const auto chunk_count = _chunks.size();
+  for (auto chunk_id = ChunkID{0}; chunk_id < chunk_count; ++chunk_id) {
+    const auto chunk = get_chunk(chunk_id);
+    if (chunk) {
+      const auto unique = primary_key_index->insert_entries(*this, chunk_id, ChunkOffset{0}, chunk->size(),
+                                                            INVALID_TRANSACTION_ID);
+      Assert(unique, "Cannot create primary key index, the table contains duplicate keys.");
+    }
+  }
+
+  _primary_key_index = primary_key_index;
+  return primary_key_index;
+}
+
+std::shared_ptr<PrimaryKeyIndex> Table::primary_key_index() const {
+  const auto append_lock = std::lock_guard<std::mutex>{*_append_mutex};
+  return _primary_key_index;
+}
+
 const TableKeyConstraints& Table::soft_key_constraints() const {
   return _table_key_constraints;
 }
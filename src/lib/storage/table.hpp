@@ -12,6 +12,8 @@
 #include "chunk.hpp"
 #include "memory/zero_allocator.hpp"
 #include "storage/index/index_statistics.hpp"
+#include "storage/index/table_index/abstract_table_index.hpp"
+#include "storage/index/table_index/primary_key_index.hpp"
 #include "storage/table_column_definition.hpp"
 #include "table_key_constraint.hpp"
 #include "types.hpp"
@@ -177,7 +179,7 @@ class Table : private Noncopyable {
 
   /**
    * Tables, typically those stored in the StorageManager, can be associated with statistics to perform Cardinality
-   * estimation during optimization.
+   * estimation during optimization. Thread-safe, as the StatisticsRefresher replaces them while queries are optimized.
    * @{
    */
   std::shared_ptr<TableStatistics> table_statistics() const;
@@ -202,6 +204,31 @@ class Table : private Noncopyable {
     _indexes.emplace_back(index_statistics);
   }
 
+  /**
+   * Table indexes cover a single column across all chunks (see AbstractTableIndex). Creating an index indexes all
+   * existing rows. Afterwards, the index is maintained by the Insert operator. Thus, an index must not be created while
+   * rows are inserted into the table. Only data tables can have table indexes.
+   * @{
+   */
+  std::shared_ptr<AbstractTableIndex> create_table_index(const ColumnID column_id, const TableIndexType type);
+
+  std::vector<std::shared_ptr<AbstractTableIndex>> table_indexes() const;
+
+  // Returns the first index on the column that supports the predicate condition, or nullptr.
+  std::shared_ptr<AbstractTableIndex> get_table_index(const ColumnID column_id,
+                                                      const PredicateCondition predicate_condition) const;
+  /** @} */
+
+  /**
+   * Creates a PrimaryKeyIndex on the given columns, which enforces their uniqueness for all future inserts. Fails if
+   * the existing rows contain duplicate keys. Just as table indexes, it must not be created while rows are inserted.
+   * A table has at most one primary key index. The index is independent of the soft key constraints below.
+   */
+  std::shared_ptr<PrimaryKeyIndex> create_primary_key_index(const std::vector<ColumnID>& column_ids);
+
+  // Returns nullptr if the table has no primary key index.
+  std::shared_ptr<PrimaryKeyIndex> primary_key_index() const;
+
   /**
    * NOTE: Key constraints are currently NOT ENFORCED and are only used to develop optimization rules.
    * We call them "soft" key constraints to draw attention to that.
@@ -251,6 +278,8 @@ class Table : private Noncopyable {
   std::shared_ptr<TableStatistics> _table_statistics;
   std::unique_ptr<std::mutex> _append_mutex;
   std::vector<IndexStatistics> _indexes;
+  std::vector<std::shared_ptr<AbstractTableIndex>> _table_indexes;
+  std::shared_ptr<PrimaryKeyIndex> _primary_key_index;
 
   // For tables with _type==Reference, the row count will not vary. As such, there is no need to iterate over all
   // chunks more than once.
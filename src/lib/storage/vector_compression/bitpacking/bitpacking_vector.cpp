@@ -1,7 +1,56 @@
 #include "bitpacking_vector.hpp"
 
+#include <array>
+#include <utility>
+
 #include "bitpacking_decompressor.hpp"
 #include "bitpacking_iterator.hpp"
+#include "utils/assert.hpp"
+
+namespace {
+
+using namespace hyrise;  // NOLINT
+
+using Block = std::array<uint32_t, BitPackingVector::BLOCK_SIZE>;
+
+// Decodes a full block for a bit width that is known at compile time. The compact_vector stores the values one after
+// another, starting at the least significant bit of each word. Once the loop is unrolled, all word indexes, shifts,
+// and masks are constants and the compiler can vectorize the extraction.
+template <uint32_t BitWidth>
+void decode_full_block(const uint64_t* words, Block& values) {
+  constexpr auto WORD_BITS = uint32_t{64};
+  constexpr auto MASK = (uint64_t{1} << BitWidth) - 1;
+
+  // NOLINTNEXTLINE
+  {}  // clang-format off
+  #pragma GCC unroll 64
+  // clang-format on
+  for (auto index = uint32_t{0}; index < BitPackingVector::BLOCK_SIZE; ++index) {
+    const auto bit_offset = index * BitWidth;
+    const auto word_index = bit_offset / WORD_BITS;
+    const auto shift = bit_offset % WORD_BITS;
+
+    auto value = words[word_index] >> shift;
+    // Values may span two words. As the block ends at a word boundary, the second word is part of the block.
+    if (shift + BitWidth > WORD_BITS) {
+      value |= words[word_index + 1] << (WORD_BITS - shift);
+    }
+    values[index] = static_cast<uint32_t>(value & MASK);
+  }
+}
+
+using DecodeFullBlockFunction = void (*)(const uint64_t*, Block&);
+
+template <size_t... BitWidthOffsets>
+constexpr auto make_decode_full_block_functions(std::index_sequence<BitWidthOffsets...> /*bit_width_offsets*/) {
+  return std::array<DecodeFullBlockFunction, sizeof...(BitWidthOffsets)>{
+      &decode_full_block<static_cast<uint32_t>(BitWidthOffsets + 1)>...};
+}
+
+// Index i holds the function for a bit width of i + 1.
+constexpr auto DECODE_FULL_BLOCK_FUNCTIONS = make_decode_full_block_functions(std::make_index_sequence<32>{});
+
+}  // namespace
 
 namespace hyrise {
 
@@ -11,6 +60,24 @@ const pmr_compact_vector& BitPackingVector::data() const {
   return _data;
 }
 
+void BitPackingVector::decode_block(const size_t block_index, std::array<uint32_t, BLOCK_SIZE>& values) const {
+  const auto begin = block_index * BLOCK_SIZE;
+  const auto end = _data.size();
+  DebugAssert(begin < end, "Block index out of range.");
+
+  if (begin + BLOCK_SIZE <= end) {
+    const auto bit_width = _data.bits();
+    DebugAssert(bit_width >= 1 && bit_width <= 32, "Unexpected bit width.");
+    DECODE_FULL_BLOCK_FUNCTIONS[bit_width - 1](_data.get() + block_index * bit_width, values);
+    return;
+  }
+
+  // The last block may be incomplete. We decode it value by value so that we do not read past the allocated words.
+  for (auto index = begin; index < end; ++index) {
+    values[index - begin] = _data[index];
+  }
+}
+
 size_t BitPackingVector::on_size() const {
   return _data.size();
 }
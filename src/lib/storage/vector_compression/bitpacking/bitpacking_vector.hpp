@@ -1,5 +1,7 @@
 #pragma once
 
+#include <array>
+
 #include "bitpacking_decompressor.hpp"
 #include "bitpacking_iterator.hpp"
 #include "bitpacking_vector_type.hpp"
@@ -16,13 +18,21 @@ namespace hyrise {
  * represent the maximum value of the sequence. The decoding runtime is only marginally slower than 
  * FixedWidthIntegerVector but the compression rate of BitPacking is significantly better.
  * 
+ * Iterators and decompressors decode one value at a time. Sequential scans over the whole vector should use
+ * decode_block() instead, which decodes BLOCK_SIZE values at once with constant shifts and masks.
  */
 class BitPackingVector : public CompressedVector<BitPackingVector> {
  public:
+  // BLOCK_SIZE values with a bit width of b occupy exactly b 64-bit words. Hence, all blocks start at word boundaries.
+  static constexpr auto BLOCK_SIZE = size_t{64};
+
   explicit BitPackingVector(pmr_compact_vector data);
 
   const pmr_compact_vector& data() const;
 
+  // Decodes the values [block_index * BLOCK_SIZE, min((block_index + 1) * BLOCK_SIZE, size())) into `values`.
+  void decode_block(const size_t block_index, std::array<uint32_t, BLOCK_SIZE>& values) const;
+
   size_t on_size() const;
   size_t on_data_size() const;
 
@@ -34,6 +34,7 @@ class AbstractMetaTable : public Noncopyable {
   friend class MetaTableManagerTest;
   friend class MetaTableTest;
   friend class MetaPluginsTest;
+  friend class MetaSchedulingLatencyTest;
   friend class MetaSettingsTest;
   friend class MetaSystemUtilizationTest;
   friend class MetaSystemInformationTest;
@@ -0,0 +1,48 @@
+#include "meta_scheduling_latency_table.hpp"
+
+#include <limits>
+
+#include "hyrise.hpp"
+#include "scheduler/abstract_scheduler.hpp"
+#include "scheduler/task_queue.hpp"
+#include "scheduler/worker.hpp"
+
+namespace hyrise {
+
+MetaSchedulingLatencyTable::MetaSchedulingLatencyTable()
+    : AbstractMetaTable(TableColumnDefinitions{{"node_id", DataType::Int, false},
+                                               {"worker_id", DataType::Int, false},
+                                               {"cpu_id", DataType::Int, false},
+                                               {"latency_lower_us", DataType::Long, false},
+                                               {"latency_upper_us", DataType::Long, false},
+                                               {"task_count", DataType::Long, false}}) {}
+
+const std::string& MetaSchedulingLatencyTable::name() const {
+  static const auto name = std::string{"scheduling_latency"};
+  return name;
+}
+
+std::shared_ptr<Table> MetaSchedulingLatencyTable::_on_generate() const {
+  auto output_table = std::make_shared<Table>(_column_definitions, TableType::Data, std::nullopt, UseMvcc::Yes);
+
+  for (const auto& worker : Hyrise::get().scheduler()->workers()) {
+    const auto histogram = worker->scheduling_latency_histogram();
+    for (auto bucket = size_t{0}; bucket < histogram.size(); ++bucket) {
+      if (histogram[bucket] == 0) {
+        continue;
+      }
+
+      // Bucket 0 holds latencies below 1 µs, bucket i holds latencies in [2^(i-1), 2^i) µs. The last bucket is open.
+      const auto lower_bound = bucket == 0 ? int64_t{0} : int64_t{1} << (bucket - 1);
+      const auto upper_bound =
+          bucket + 1 == histogram.size() ? std::numeric_limits<int64_t>::max() : int64_t{1} << bucket;
+      output_table->append({static_cast<int32_t>(worker->queue()->node_id()), static_cast<int32_t>(worker->id()),
+                            static_cast<int32_t>(worker->cpu_id()), lower_bound, upper_bound,
+                            static_cast<int64_t>(histogram[bucket])});
+    }
+  }
+
+  return output_table;
+}
+
+}  // namespace hyrise
@@ -0,0 +1,23 @@
+#pragma once
+
+#include "utils/meta_tables/abstract_meta_table.hpp"
+
+namespace hyrise {
+
+/**
+ * This meta table shows the histograms of the scheduling latency (i.e., the time between enqueueing a task and the
+ * start of its execution) that are recorded by the workers of the NodeQueueScheduler. Each row is a non-empty bucket
+ * covering latencies in [latency_lower_us, latency_upper_us).
+ */
+class MetaSchedulingLatencyTable : public AbstractMetaTable {
+ public:
+  MetaSchedulingLatencyTable();
+
+  const std::string& name() const final;
+
+ protected:
+  friend class MetaSchedulingLatencyTest;
+  std::shared_ptr<Table> _on_generate() const final;
+};
+
+}  // namespace hyrise
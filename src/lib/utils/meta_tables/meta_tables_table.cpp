@@ -1,6 +1,8 @@
 #include "meta_tables_table.hpp"
 
 #include "hyrise.hpp"
+#include "statistics/statistics_refresher.hpp"
+#include "statistics/table_statistics.hpp"
 
 namespace hyrise {
 
@@ -9,7 +11,9 @@ MetaTablesTable::MetaTablesTable()
                                                {"column_count", DataType::Int, false},
                                                {"row_count", DataType::Long, false},
                                                {"chunk_count", DataType::Int, false},
-                                               {"target_chunk_size", DataType::Long, false}}) {}
+                                               {"target_chunk_size", DataType::Long, false},
+                                               {"statistics_row_count", DataType::Long, true},
+                                               {"statistics_staleness", DataType::Float, false}}) {}
 
 const std::string& MetaTablesTable::name() const {
   static const auto name = std::string{"tables"};
@@ -20,9 +24,13 @@ std::shared_ptr<Table> MetaTablesTable::_on_generate() const {
   auto output_table = std::make_shared<Table>(_column_definitions, TableType::Data, std::nullopt, UseMvcc::Yes);
 
   for (const auto& [table_name, table] : Hyrise::get().storage_manager.tables()) {
+    const auto table_statistics = table->table_statistics();
+    const auto statistics_row_count =
+        table_statistics ? AllTypeVariant{static_cast<int64_t>(table_statistics->row_count)} : NULL_VALUE;
     output_table->append({pmr_string{table_name}, static_cast<int32_t>(table->column_count()),
                           static_cast<int64_t>(table->row_count()), static_cast<int32_t>(table->chunk_count()),
-                          static_cast<int64_t>(table->target_chunk_size())});
+                          static_cast<int64_t>(table->target_chunk_size()), statistics_row_count,
+                          StatisticsRefresher::staleness(*table)});
   }
 
   return output_table;
@@ -5,7 +5,8 @@
 namespace hyrise {
 
 /**
- * This is a class for showing all stored tables via a meta table.
+ * This is a class for showing all stored tables via a meta table, including how many rows their statistics represent
+ * and how stale these statistics are (see StatisticsRefresher).
  */
 class MetaTablesTable : public AbstractMetaTable {
  public:
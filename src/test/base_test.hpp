@@ -8,6 +8,7 @@
 #include "gtest/gtest.h"
 
 #include "cache/gdfs_cache.hpp"
+#include "cache/sharded_gdfs_cache.hpp"
 #include "expression/expression_functional.hpp"
 #include "hyrise.hpp"
 #include "logical_query_plan/mock_node.hpp"
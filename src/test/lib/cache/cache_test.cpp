@@ -1,3 +1,6 @@
+#include <thread>
+#include <vector>
+
 #include "base_test.hpp"
 
 namespace hyrise {
@@ -6,20 +9,24 @@ namespace hyrise {
 // Not using SQL types in this test, only testing cache eviction.
 class CachePolicyTest : public BaseTest {
  protected:
+  // The helpers apply the accesses that try_get() buffered, so that the entries are up to date.
   template <typename Key, typename Value>
-  double inflation(const GDFSCache<Key, Value>& cache) const {
+  double inflation(GDFSCache<Key, Value>& cache) const {
+    cache._apply_accesses();
     return cache._inflation;
   }
 
   template <typename Key, typename Value>
   const boost::heap::fibonacci_heap<typename GDFSCache<Key, Value>::GDFSCacheEntry>& queue(
-      const GDFSCache<Key, Value>& cache) const {
+      GDFSCache<Key, Value>& cache) const {
+    cache._apply_accesses();
     return cache._queue;
   }
 
   template <typename Key, typename Value>
-  const typename GDFSCache<Key, Value>::GDFSCacheEntry get_full_entry(const GDFSCache<Key, Value>& cache,
+  const typename GDFSCache<Key, Value>::GDFSCacheEntry get_full_entry(GDFSCache<Key, Value>& cache,
                                                                       const Key& key) const {
+    cache._apply_accesses();
     return *(cache._map.find(key)->second);
   }
 };
@@ -85,6 +92,52 @@ TEST_F(CachePolicyTest, GDFSCacheTest) {
   ASSERT_EQ(3, get_full_entry(cache, 3).frequency);
 }
 
+TEST_F(CachePolicyTest, GDFSCacheBufferedAccesses) {
+  GDFSCache<int, int> cache(2);
+  cache.set(1, 2);
+  cache.set(2, 4);
+
+  // The accesses are buffered and applied once the buffer is full.
+  const auto access_count = 3 * GDFSCache<int, int>::ACCESS_BUFFER_SIZE + 1;
+  for (auto access_index = size_t{0}; access_index < access_count; ++access_index) {
+    ASSERT_EQ(cache.try_get(1), 2);
+  }
+  EXPECT_EQ(queue(cache).top().key, 2);
+  EXPECT_EQ(cache.snapshot().at(1).frequency, access_count + 1);
+  EXPECT_EQ(get_full_entry(cache, 1).frequency, access_count + 1);
+
+  // Key 2 is only accessed more often than key 1 if the buffered accesses are applied before evicting.
+  for (auto access_index = size_t{0}; access_index < access_count + 7; ++access_index) {
+    ASSERT_EQ(cache.try_get(2), 4);
+  }
+  cache.set(3, 6);
+  EXPECT_FALSE(cache.has(1));
+  EXPECT_TRUE(cache.has(2));
+  EXPECT_TRUE(cache.has(3));
+}
+
+TEST_F(CachePolicyTest, GDFSCacheConcurrentAccesses) {
+  GDFSCache<int, int> cache(2);
+  cache.set(1, 2);
+
+  // Accesses that do not fit into the full buffer are not dropped.
+  const auto thread_count = size_t{8};
+  const auto access_count = 10 * GDFSCache<int, int>::ACCESS_BUFFER_SIZE;
+  auto threads = std::vector<std::thread>{};
+  for (auto thread_id = size_t{0}; thread_id < thread_count; ++thread_id) {
+    threads.emplace_back([&] {
+      for (auto access_index = size_t{0}; access_index < access_count; ++access_index) {
+        ASSERT_EQ(cache.try_get(1), 2);
+      }
+    });
+  }
+  for (auto& thread : threads) {
+    thread.join();
+  }
+
+  EXPECT_EQ(cache.snapshot().at(1).frequency, thread_count * access_count + 1);
+}
+
 class CacheTest : public BaseTest {};
 
 TEST_F(CacheTest, Size) {
@@ -191,4 +244,61 @@ TEST_F(CacheTest, Snapshot) {
   }
 }
 
+TEST_F(CacheTest, ShardedCacheCapacity) {
+  // Small caches consist of a single shard.
+  EXPECT_EQ((ShardedGDFSCache<int, int>{3}.shard_count()), 1);
+
+  const auto capacity = 4 * ShardedGDFSCache<int, int>::MIN_SHARD_CAPACITY + 3;
+  ShardedGDFSCache<int, int> cache(capacity);
+  EXPECT_EQ(cache.shard_count(), 4);
+  EXPECT_EQ(cache.capacity(), capacity);
+
+  for (auto key = 0; key < static_cast<int>(2 * capacity); ++key) {
+    cache.set(key, key);
+  }
+  EXPECT_EQ(cache.size(), capacity);
+  EXPECT_EQ(cache.snapshot().size(), capacity);
+
+  cache.resize(10);
+  EXPECT_EQ(cache.capacity(), 10);
+  EXPECT_EQ(cache.size(), 10);
+
+  cache.clear();
+  EXPECT_EQ(cache.size(), 0);
+}
+
+TEST_F(CacheTest, ShardedCacheConcurrentAccess) {
+  const auto capacity = ShardedGDFSCache<int, int>::MAX_SHARD_COUNT * ShardedGDFSCache<int, int>::MIN_SHARD_CAPACITY;
+  ShardedGDFSCache<int, int> cache(capacity);
+  for (auto key = 0; key < static_cast<int>(capacity); ++key) {
+    cache.set(key, key);
+  }
+
+  const auto thread_count = 8;
+  auto threads = std::vector<std::thread>{};
+  for (auto thread_id = 0; thread_id < thread_count; ++thread_id) {
+    threads.emplace_back([&, thread_id]() {
+      for (auto iteration = 0; iteration < 10'000; ++iteration) {
+        const auto key = (iteration * thread_count + thread_id) % static_cast<int>(2 * capacity);
+        const auto value = cache.try_get(key);
+        if (value) {
+          EXPECT_EQ(*value, key);
+        } else {
+          cache.set(key, key);
+        }
+      }
+    });
+  }
+
+  for (auto& thread : threads) {
+    thread.join();
+  }
+
+  EXPECT_LE(cache.size(), capacity);
+  for (const auto& [key, entry] : cache.snapshot()) {
+    EXPECT_EQ(entry.value, key);
+    EXPECT_GE(*entry.frequency, 1);
+  }
+}
+
 }  // namespace hyrise
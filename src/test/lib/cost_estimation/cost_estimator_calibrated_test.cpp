@@ -0,0 +1,160 @@
+#include <memory>
+
+#include "base_test.hpp"
+
+#include "cost_estimation/cost_estimator_calibrated.hpp"
+#include "expression/expression_functional.hpp"
+#include "hyrise.hpp"
+#include "logical_query_plan/join_node.hpp"
+#include "logical_query_plan/limit_node.hpp"
+#include "logical_query_plan/predicate_node.hpp"
+#include "logical_query_plan/static_table_node.hpp"
+#include "logical_query_plan/stored_table_node.hpp"
+#include "statistics/cardinality_estimator.hpp"
+#include "storage/chunk_encoder.hpp"
+
+using namespace hyrise::expression_functional;  // NOLINT
+
+namespace hyrise {
+
+class CostEstimatorCalibratedTest : public BaseTest {
+ public:
+  void SetUp() override {
+    auto& storage_manager = Hyrise::get().storage_manager;
+    storage_manager.add_table("unencoded", load_table("resources/test_data/tbl/int_int_int.tbl", ChunkOffset{1}));
+    storage_manager.add_table("lz4", load_table("resources/test_data/tbl/int_int_int.tbl", ChunkOffset{1}));
+    ChunkEncoder::encode_all_chunks(storage_manager.get_table("lz4"), SegmentEncodingSpec{EncodingType::LZ4});
+
+    unencoded_node = StoredTableNode::make("unencoded");
+    lz4_node = StoredTableNode::make("lz4");
+    unencoded_a = unencoded_node->get_column("a");
+    lz4_a = lz4_node->get_column("a");
+
+    coefficients = std::make_shared<CostModelCoefficients>();
+    cardinality_estimator = std::make_shared<CardinalityEstimator>();
+  }
+
+  std::shared_ptr<CostEstimatorCalibrated> cost_estimator() const {
+    return std::make_shared<CostEstimatorCalibrated>(cardinality_estimator, coefficients);
+  }
+
+  std::shared_ptr<StoredTableNode> unencoded_node, lz4_node;
+  std::shared_ptr<LQPColumnExpression> unencoded_a, lz4_a;
+  std::shared_ptr<CostModelCoefficients> coefficients;
+  std::shared_ptr<CardinalityEstimator> cardinality_estimator;
+};
+
+TEST_F(CostEstimatorCalibratedTest, TableScanCostDependsOnEncoding) {
+  coefficients->table_scan_cost_per_input_row[EncodingType::Unencoded] = 1.0f;
+  coefficients->table_scan_cost_per_input_row[EncodingType::LZ4] = 10.0f;
+
+  const auto unencoded_scan = PredicateNode::make(greater_than_(unencoded_a, 9), unencoded_node);
+  const auto lz4_scan = PredicateNode::make(greater_than_(lz4_a, 9), lz4_node);
+
+  const auto output_row_count = cardinality_estimator->estimate_cardinality(unencoded_scan);
+  EXPECT_FLOAT_EQ(cost_estimator()->estimate_node_cost(unencoded_scan), 4.0f * 1.0f + output_row_count);
+  EXPECT_FLOAT_EQ(cost_estimator()->estimate_node_cost(lz4_scan), 4.0f * 10.0f + output_row_count);
+}
+
+TEST_F(CostEstimatorCalibratedTest, TableScanCostOnSortedSegments) {
+  const auto table = Hyrise::get().storage_manager.get_table("unencoded");
+  const auto predicate_node = PredicateNode::make(greater_than_(unencoded_a, 9), unencoded_node);
+  const auto unsorted_cost = cost_estimator()->estimate_node_cost(predicate_node);
+
+  const auto chunk_count = table->chunk_count();
+  for (auto chunk_id = ChunkID{0}; chunk_id < chunk_count; ++chunk_id) {
+    table->get_chunk(chunk_id)->set_individually_sorted_by(SortColumnDefinition{ColumnID{0}});
+  }
+
+  // Scans on sorted segments binary search the matching range and only pay for the output rows.
+  const auto output_row_count = cardinality_estimator->estimate_cardinality(predicate_node);
+  const auto sorted_cost = cost_estimator()->estimate_node_cost(predicate_node);
+  EXPECT_FLOAT_EQ(sorted_cost, output_row_count * coefficients->sorted_table_scan_cost_per_output_row);
+  EXPECT_LT(sorted_cost, unsorted_cost);
+
+  // Predicates that cannot be answered with a binary search scan all rows.
+  const auto column_comparison_node =
+      PredicateNode::make(not_equals_(unencoded_a, unencoded_node->get_column("b")), unencoded_node);
+  EXPECT_GE(cost_estimator()->estimate_node_cost(column_comparison_node),
+            4.0f * coefficients->table_scan_cost_per_input_row.at(EncodingType::Unencoded));
+}
+
+TEST_F(CostEstimatorCalibratedTest, TableScanCostOnReferenceSegments) {
+  const auto first_scan = PredicateNode::make(greater_than_(unencoded_a, 0), unencoded_node);
+  const auto second_scan = PredicateNode::make(less_than_(unencoded_a, 12'345), first_scan);
+
+  const auto input_row_count = cardinality_estimator->estimate_cardinality(first_scan);
+  const auto output_row_count = cardinality_estimator->estimate_cardinality(second_scan);
+  EXPECT_FLOAT_EQ(cost_estimator()->estimate_node_cost(second_scan),
+                  input_row_count * coefficients->reference_table_scan_cost_per_input_row +
+                      output_row_count * coefficients->table_scan_cost_per_output_row);
+}
+
+TEST_F(CostEstimatorCalibratedTest, IndexScanCost) {
+  const auto predicate_node = PredicateNode::make(equals_(unencoded_a, 12'345), unencoded_node);
+  const auto output_row_count = cardinality_estimator->estimate_cardinality(predicate_node);
+  const auto index_scan_cost = 4.0f * coefficients->index_scan_cost_per_input_row +
+                               output_row_count * coefficients->index_scan_cost_per_output_row;
+
+  EXPECT_FLOAT_EQ(cost_estimator()->estimate_scan_cost(predicate_node, ScanType::IndexScan), index_scan_cost);
+  EXPECT_FLOAT_EQ(cost_estimator()->estimate_node_cost(predicate_node),
+                  cost_estimator()->estimate_scan_cost(predicate_node, ScanType::TableScan));
+
+  predicate_node->scan_type = ScanType::IndexScan;
+  EXPECT_FLOAT_EQ(cost_estimator()->estimate_node_cost(predicate_node), index_scan_cost);
+}
+
+TEST_F(CostEstimatorCalibratedTest, CheapestJoinOperator) {
+  const auto equi_join = JoinNode::make(JoinMode::Inner, equals_(unencoded_a, lz4_a), unencoded_node, lz4_node);
+  const auto non_equi_join = JoinNode::make(JoinMode::Inner, less_than_(unencoded_a, lz4_a), unencoded_node, lz4_node);
+  const auto semi_non_equi_join =
+      JoinNode::make(JoinMode::Semi, less_than_(unencoded_a, lz4_a), unencoded_node, lz4_node);
+  const auto cross_join = JoinNode::make(JoinMode::Cross, unencoded_node, lz4_node);
+
+  // Without a guaranteed maximum row count of the inputs, the first supporting operator is chosen regardless of the
+  // costs.
+  coefficients->join_hash_cost_per_build_row = 1'000.0f;
+  coefficients->join_nested_loop_cost_per_row_pair = 0.1f;
+  EXPECT_EQ(cost_estimator()->cheapest_join_operator(equi_join), OperatorType::JoinHash);
+  EXPECT_EQ(cost_estimator()->cheapest_join_operator(non_equi_join), OperatorType::JoinSortMerge);
+  EXPECT_EQ(cost_estimator()->cheapest_join_operator(semi_non_equi_join), OperatorType::JoinNestedLoop);
+  EXPECT_EQ(cost_estimator()->cheapest_join_operator(cross_join), std::nullopt);
+
+  // A LIMIT with a literal row count and a StaticTableNode are guaranteed to be small. Comparing all pairs of their
+  // rows is cheaper than hashing or sorting them.
+  const auto limit_node = LimitNode::make(value_(2), unencoded_node);
+  const auto static_table_node = StaticTableNode::make(Hyrise::get().storage_manager.get_table("lz4"));
+  const auto static_a = static_table_node->output_expressions()[0];
+  const auto small_equi_join =
+      JoinNode::make(JoinMode::Inner, equals_(unencoded_a, static_a), limit_node, static_table_node);
+  const auto small_non_equi_join =
+      JoinNode::make(JoinMode::Inner, less_than_(unencoded_a, static_a), limit_node, static_table_node);
+  EXPECT_EQ(cost_estimator()->cheapest_join_operator(small_equi_join), OperatorType::JoinNestedLoop);
+  EXPECT_EQ(cost_estimator()->cheapest_join_operator(small_non_equi_join), OperatorType::JoinNestedLoop);
+  EXPECT_FLOAT_EQ(cost_estimator()->estimate_node_cost(small_equi_join),
+                  cost_estimator()->estimate_join_cost(small_equi_join, OperatorType::JoinNestedLoop));
+
+  coefficients->join_nested_loop_cost_per_row_pair = 1'000.0f;
+  EXPECT_EQ(cost_estimator()->cheapest_join_operator(small_equi_join), OperatorType::JoinSortMerge);
+  EXPECT_EQ(cost_estimator()->cheapest_join_operator(small_non_equi_join), OperatorType::JoinSortMerge);
+
+  coefficients->join_hash_cost_per_build_row = 10.0f;
+  EXPECT_EQ(cost_estimator()->cheapest_join_operator(small_equi_join), OperatorType::JoinHash);
+}
+
+TEST_F(CostEstimatorCalibratedTest, SaveAndLoadCoefficients) {
+  coefficients->table_scan_cost_per_input_row[EncodingType::LZ4] = 42.0f;
+  coefficients->join_hash_cost_per_probe_row = 17.0f;
+
+  const auto filename = test_data_path + "cost_model_coefficients.json";
+  coefficients->save(filename);
+  const auto loaded_coefficients = CostModelCoefficients::load(filename);
+
+  EXPECT_FLOAT_EQ(loaded_coefficients.table_scan_cost_per_input_row.at(EncodingType::LZ4), 42.0f);
+  EXPECT_FLOAT_EQ(loaded_coefficients.table_scan_cost_per_input_row.at(EncodingType::Dictionary),
+                  coefficients->table_scan_cost_per_input_row.at(EncodingType::Dictionary));
+  EXPECT_FLOAT_EQ(loaded_coefficients.join_hash_cost_per_probe_row, 17.0f);
+  EXPECT_FLOAT_EQ(loaded_coefficients.cost_per_row, coefficients->cost_per_row);
+}
+
+}  // namespace hyrise
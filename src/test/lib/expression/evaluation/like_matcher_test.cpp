@@ -1,5 +1,7 @@
 #include <string>
+#include <string_view>
 #include <utility>
+#include <vector>
 
 #include "base_test.hpp"
 
@@ -55,6 +57,72 @@ TEST_F(LikeMatcherTest, NotMatching) {
   EXPECT_FALSE(match("Hello", "He_o"));
 }
 
+TEST_F(LikeMatcherTest, GeneralPatterns) {
+  EXPECT_TRUE(match("Hello World", "H_llo%W%ld"));
+  EXPECT_TRUE(match("Hello World", "%o_W%"));
+  EXPECT_TRUE(match("Hello World", "H%o%o%d"));
+  EXPECT_TRUE(match("aab", "%a_b"));
+  EXPECT_TRUE(match("abcabd", "a%b_"));
+  EXPECT_TRUE(match("line\nbreak", "line_break"));
+  EXPECT_TRUE(match("Hello", "%%H_l%%o"));
+  EXPECT_TRUE(match("abc", "___"));
+  EXPECT_TRUE(match("abc", "%__%"));
+
+  EXPECT_FALSE(match("Hello World", "H_llo%X%ld"));
+  EXPECT_FALSE(match("aba", "ab%ba"));
+  EXPECT_FALSE(match("ab", "%___%"));
+  EXPECT_FALSE(match("abc", "a%_b%c"));
+  EXPECT_FALSE(match("aab", "%a%a"));
+}
+
+TEST_F(LikeMatcherTest, SubstringSearcher) {
+  // The haystack is longer than the 16 characters that are compared at once.
+  const auto haystack = std::string_view{"xxabxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxabcxxxxab"};
+  const auto searcher = LikeMatcher::SubstringSearcher{"abc"};
+  EXPECT_EQ(searcher.find(haystack), 34);
+  EXPECT_EQ(searcher.find(haystack, 34), 34);
+  EXPECT_EQ(searcher.find(haystack, 35), std::string_view::npos);
+  EXPECT_EQ(searcher.find(haystack, 100), std::string_view::npos);
+
+  EXPECT_EQ(LikeMatcher::SubstringSearcher{"ab"}.find(haystack, 35), 41);
+  EXPECT_EQ(LikeMatcher::SubstringSearcher{"a"}.find("a"), 0);
+  EXPECT_EQ(LikeMatcher::SubstringSearcher{""}.find(haystack, 5), 5);
+  EXPECT_EQ(LikeMatcher::SubstringSearcher{"abcd"}.find("abc"), std::string_view::npos);
+}
+
+TEST_F(LikeMatcherTest, MatchesReference) {
+  // Compare all patterns built from the given pieces with a naive recursive matcher.
+  const auto reference_match = [](const auto& self, const std::string_view value, const std::string_view pattern) {
+    if (pattern.empty()) {
+      return value.empty();
+    }
+    if (pattern.front() == '%') {
+      for (auto offset = size_t{0}; offset <= value.size(); ++offset) {
+        if (self(self, value.substr(offset), pattern.substr(1))) {
+          return true;
+        }
+      }
+      return false;
+    }
+    return !value.empty() && (pattern.front() == '_' || pattern.front() == value.front()) &&
+           self(self, value.substr(1), pattern.substr(1));
+  };
+
+  const auto pieces = std::vector<std::string>{"%", "_", "a", "ab", "b"};
+  const auto values = std::vector<std::string>{"", "a", "ab", "ba", "aab", "abab", "babba", "aaaaaaaaaaaaaaaaaaaab"};
+  for (const auto& first : pieces) {
+    for (const auto& second : pieces) {
+      for (const auto& third : pieces) {
+        const auto pattern = first + second + third;
+        for (const auto& value : values) {
+          EXPECT_EQ(match(value, pattern), reference_match(reference_match, value, pattern))
+              << "'" << value << "' LIKE '" << pattern << "'";
+        }
+      }
+    }
+  }
+}
+
 TEST_F(LikeMatcherTest, LowerUpperBound) {
   const auto pattern = pmr_string("Japan%");
   const auto bounds = LikeMatcher::bounds(pattern);
@@ -378,9 +378,49 @@ TEST_F(ExpressionEvaluatorToValuesTest, CaseSeries) {
   EXPECT_TRUE(test_expression<int32_t>(table_empty, *case_(1, empty_a, empty_a), {}));
   EXPECT_TRUE(test_expression<int32_t>(table_empty, *case_(greater_than_(empty_a, 3), empty_a, empty_a), {}));
   EXPECT_TRUE(test_expression<int32_t>(table_empty, *case_(equals_(add_(NullValue{}, 1), 0), 1, 2), {2}));
+  EXPECT_TRUE(test_expression<int32_t>(table_a, *case_(greater_than_(c, 33), a, b), {2, 3, 3, 5}));
+  EXPECT_TRUE(test_expression<int32_t>(table_a, *case_(greater_than_(c, 33), c, d), {2, 5, 34, 7}));
+  EXPECT_TRUE(test_expression<int32_t>(table_a, *case_(less_than_(a, 3), c, d), {33, std::nullopt, 6, 7}));
+  EXPECT_TRUE(test_expression<double>(table_a, *case_(less_than_(a, 3), e, f), {20.5, 100.0, 13.8, 15.9}));
+  EXPECT_TRUE(test_expression<int32_t>(table_a, *case_(greater_than_(a, 2), c, NullValue{}), {std::nullopt, std::nullopt, 34, std::nullopt}));  // NOLINT
+  EXPECT_TRUE(test_expression<int32_t>(table_a, *case_(greater_than_(c, 33), case_(equals_(s1, "what"), add_(a, b), 0), mul_(b, d)), {4, 15, 7, 35}));  // NOLINT
+
+  // Branches taken by few rows are evaluated for these rows only, the others for all rows.
+  EXPECT_TRUE(test_expression<int32_t>(table_b, *case_(equals_(x, 9), add_(x, 100), sub_(x, 1)), {9, 109, 9, 7, 7, 6, 7}));  // NOLINT
+  EXPECT_TRUE(test_expression<int32_t>(table_b, *case_(less_than_(x, 9), case_(equals_(x, 7), mul_(x, 2), x), 0), {0, 0, 0, 8, 8, 14, 8}));  // NOLINT
+  EXPECT_TRUE(test_expression<int32_t>(table_b, *case_(equals_(x, 9), case_(greater_than_(x, 8), x, 0), 1), {1, 9, 1, 1, 1, 1, 1}));  // NOLINT
   // clang-format on
 }
 
+TEST_F(ExpressionEvaluatorToValuesTest, ToSegment) {
+  auto evaluator = ExpressionEvaluator{table_a, ChunkID{0}};
+
+  const auto non_nullable_segment =
+      std::dynamic_pointer_cast<ValueSegment<int32_t>>(evaluator.evaluate_expression_to_segment(*add_(a, b)));
+  ASSERT_TRUE(non_nullable_segment);
+  EXPECT_FALSE(non_nullable_segment->is_nullable());
+  EXPECT_EQ(non_nullable_segment->values(), pmr_vector<int32_t>({3, 5, 7, 9}));
+
+  const auto nullable_segment =
+      std::dynamic_pointer_cast<ValueSegment<int32_t>>(evaluator.evaluate_expression_to_segment(*add_(a, c)));
+  ASSERT_TRUE(nullable_segment);
+  EXPECT_TRUE(nullable_segment->is_nullable());
+  EXPECT_EQ(nullable_segment->null_values(), pmr_vector<bool>({false, true, false, true}));
+  EXPECT_EQ(nullable_segment->values()[0], 34);
+  EXPECT_EQ(nullable_segment->values()[2], 37);
+
+  const auto literal_segment =
+      std::dynamic_pointer_cast<ValueSegment<int32_t>>(evaluator.evaluate_expression_to_segment(*value_(5)));
+  ASSERT_TRUE(literal_segment);
+  EXPECT_FALSE(literal_segment->is_nullable());
+  EXPECT_EQ(literal_segment->values(), pmr_vector<int32_t>({5, 5, 5, 5}));
+
+  const auto null_segment = std::dynamic_pointer_cast<ValueSegment<int32_t>>(
+      evaluator.evaluate_expression_to_segment(*add_(a, NullValue{})));
+  ASSERT_TRUE(null_segment);
+  EXPECT_EQ(null_segment->null_values(), pmr_vector<bool>({true, true, true, true}));
+}
+
 TEST_F(ExpressionEvaluatorToValuesTest, IsNullLiteral) {
   EXPECT_TRUE(test_expression<int32_t>(*is_null_(0), {0}));
   EXPECT_TRUE(test_expression<int32_t>(*is_null_(1), {0}));
@@ -604,6 +604,26 @@ TEST_F(JoinNodeTest, UniqueConstraintsCrossJoin) {
   EXPECT_TRUE(_cross_join_node->unique_constraints()->empty());
 }
 
+TEST_F(JoinNodeTest, UniqueConstraintsReflectPlanChanges) {
+  // Unique constraints are only memoized while they are derived. Thus, changes of the plan are reflected afterwards.
+  _mock_node_a->set_key_constraints({*_key_constraint_a});
+  _mock_node_b->set_key_constraints({*_key_constraint_x, *_key_constraint_y});
+
+  // clang-format off
+  const auto join_node =
+  JoinNode::make(JoinMode::Inner, equals_(_t_a_a, _t_b_y),
+    PredicateNode::make(greater_than_(_t_a_b, 5),
+      _mock_node_a),
+    _mock_node_b);
+  // clang-format on
+
+  EXPECT_EQ(join_node->unique_constraints()->size(), 3);
+
+  // The left join column is not unique anymore. Thus, only the unique constraint of the left input is forwarded.
+  join_node->node_expressions[0] = equals_(_t_a_b, _t_b_y);
+  EXPECT_EQ(join_node->unique_constraints()->size(), 1);
+}
+
 TEST_F(JoinNodeTest, GetOrFindReducedJoinNode) {
   const auto join_predicate = equals_(_t_a_a, _t_b_x);
   auto semi_reduction_node = JoinNode::make(JoinMode::Semi, join_predicate, _mock_node_a, _mock_node_b);
@@ -5,6 +5,7 @@
 #include <vector>
 
 #include "base_test.hpp"
+#include "cost_estimation/cost_model_coefficients.hpp"
 #include "expression/aggregate_expression.hpp"
 #include "expression/arithmetic_expression.hpp"
 #include "expression/expression_functional.hpp"
@@ -52,6 +53,7 @@
 #include "operators/table_wrapper.hpp"
 #include "operators/union_all.hpp"
 #include "operators/union_positions.hpp"
+#include "operators/validate.hpp"
 #include "storage/chunk_encoder.hpp"
 #include "storage/index/group_key/group_key_index.hpp"
 #include "storage/prepared_plan.hpp"
@@ -595,6 +597,25 @@ TEST_F(LQPTranslatorTest, PredicateNodeIndexScanFailsWhenNotApplicable) {
   EXPECT_THROW(LQPTranslator{}.translate_node(predicate_node2), std::logic_error);
 }
 
+TEST_F(LQPTranslatorTest, PredicateNodePrimaryKeyIndexScan) {
+  const auto stored_table_node = StoredTableNode::make("int_float_chunked");
+  const auto a = stored_table_node->get_column("a");
+  const auto b = stored_table_node->get_column("b");
+  Hyrise::get().storage_manager.get_table("int_float_chunked")->create_primary_key_index({ColumnID{0}, ColumnID{1}});
+
+  const auto lookup_node = PredicateNode::make(and_(equals_(a, 12345), equals_(458.7f, b)), stored_table_node);
+  lookup_node->scan_type = ScanType::IndexScan;
+  const auto index_scan_op = std::dynamic_pointer_cast<IndexScan>(LQPTranslator{}.translate_node(lookup_node));
+  ASSERT_TRUE(index_scan_op);
+  EXPECT_EQ(index_scan_op->lqp_node, lookup_node);
+
+  // The key is looked up without casting the values. Thus, a conjunction with a literal of another data type is
+  // evaluated by a TableScan.
+  const auto scan_node = PredicateNode::make(and_(equals_(a, 12345), equals_(b, 458.7)), stored_table_node);
+  scan_node->scan_type = ScanType::IndexScan;
+  EXPECT_TRUE(std::dynamic_pointer_cast<TableScan>(LQPTranslator{}.translate_node(scan_node)));
+}
+
 TEST_F(LQPTranslatorTest, ProjectionNode) {
   /**
    * Build LQP and translate to PQP
@@ -665,6 +686,35 @@ TEST_F(LQPTranslatorTest, JoinNodeToJoinNestedLoop) {
   EXPECT_EQ(join_op->mode(), JoinMode::Inner);
 }
 
+TEST_F(LQPTranslatorTest, JoinNodeToCheapestJoinOperator) {
+  /**
+   * With a calibrated cost model, the cheapest join operator is chosen for inputs that are guaranteed to be small
+   * instead of following a fixed preference order.
+   */
+  auto coefficients = std::make_shared<CostModelCoefficients>();
+  Hyrise::get().cost_model_coefficients = coefficients;
+
+  const auto static_table_node = StaticTableNode::make(table_int_float2);
+  const auto static_b = static_table_node->output_expressions()[1];
+  const auto join_node = JoinNode::make(JoinMode::Inner, equals_(static_b, int_float_b),
+                                        LimitNode::make(value_(2), int_float_node), static_table_node);
+
+  // Comparing all pairs of a few rows is cheaper than hashing them.
+  EXPECT_TRUE(std::dynamic_pointer_cast<JoinNestedLoop>(LQPTranslator{}.translate_node(join_node)));
+
+  coefficients->join_nested_loop_cost_per_row_pair = 1'000.0f;
+  EXPECT_TRUE(std::dynamic_pointer_cast<JoinHash>(LQPTranslator{}.translate_node(join_node)));
+
+  coefficients->join_hash_cost_per_build_row = 1'000.0f;
+  EXPECT_TRUE(std::dynamic_pointer_cast<JoinSortMerge>(LQPTranslator{}.translate_node(join_node)));
+
+  // The sizes of stored tables are only estimated. Thus, the JoinHash is preferred regardless of the costs.
+  coefficients->join_nested_loop_cost_per_row_pair = 0.1f;
+  const auto stored_tables_join_node =
+      JoinNode::make(JoinMode::Inner, equals_(int_float2_b, int_float_b), int_float_node, int_float2_node);
+  EXPECT_TRUE(std::dynamic_pointer_cast<JoinHash>(LQPTranslator{}.translate_node(stored_tables_join_node)));
+}
+
 TEST_F(LQPTranslatorTest, AggregateNodeSimple) {
   /**
    * Build LQP and translate to PQP
@@ -730,6 +780,62 @@ TEST_F(LQPTranslatorTest, JoinAndPredicates) {
   const auto get_table_op_right = std::dynamic_pointer_cast<const GetTable>(predicate_op_right->left_input());
   ASSERT_TRUE(get_table_op_right);
   EXPECT_EQ(get_table_op_right->table_name(), "table_int_float2");
+
+  // Both inputs are filtered. The larger table (table_int_float2) is pruned using the join keys of the other input.
+  EXPECT_FALSE(get_table_op_left->dynamic_pruning_input());
+  const auto& dynamic_pruning_input = get_table_op_right->dynamic_pruning_input();
+  ASSERT_TRUE(dynamic_pruning_input);
+  EXPECT_EQ(dynamic_pruning_input->build_input, join_op->left_input());
+  EXPECT_EQ(dynamic_pruning_input->build_column_id, ColumnID{0});
+  EXPECT_EQ(dynamic_pruning_input->column_id, ColumnID{0});
+}
+
+TEST_F(LQPTranslatorTest, JoinDynamicPruning) {
+  // The unfiltered left input of the semi join is pruned using the join keys of the right input.
+  // clang-format off
+  const auto semi_join_lqp =
+  JoinNode::make(JoinMode::Semi, equals_(int_float_b, int_float2_b),
+    ValidateNode::make(
+      int_float_node),
+    PredicateNode::make(greater_than_(int_float2_a, 30),
+      int_float2_node));
+  // clang-format on
+
+  const auto semi_join = LQPTranslator{}.translate_node(semi_join_lqp);
+  const auto validate = std::dynamic_pointer_cast<const Validate>(semi_join->left_input());
+  ASSERT_TRUE(validate);
+  const auto get_table = std::dynamic_pointer_cast<const GetTable>(validate->left_input());
+  ASSERT_TRUE(get_table);
+  ASSERT_TRUE(get_table->dynamic_pruning_input());
+  EXPECT_EQ(get_table->dynamic_pruning_input()->build_input, semi_join->right_input());
+  EXPECT_EQ(get_table->dynamic_pruning_input()->build_column_id, ColumnID{1});
+  EXPECT_EQ(get_table->dynamic_pruning_input()->column_id, ColumnID{1});
+
+  // Without a filtered input, there is nothing to prune with. Left outer joins keep all rows of their left input.
+  const auto left_node = StoredTableNode::make("table_int_float");
+  const auto right_node = StoredTableNode::make("table_int_float2");
+  const auto left_a = left_node->get_column("a");
+  const auto right_a = right_node->get_column("a");
+
+  // clang-format off
+  const auto inner_join_lqp =
+  JoinNode::make(JoinMode::Inner, equals_(left_a, right_a),
+    left_node,
+    right_node);
+
+  const auto left_join_lqp =
+  JoinNode::make(JoinMode::Left, equals_(left_a, right_a),
+    left_node,
+    PredicateNode::make(greater_than_(right_a, 30),
+      right_node));
+  // clang-format on
+
+  for (const auto& lqp : {inner_join_lqp, left_join_lqp}) {
+    const auto join = LQPTranslator{}.translate_node(lqp);
+    const auto get_table_left = std::dynamic_pointer_cast<const GetTable>(join->left_input());
+    ASSERT_TRUE(get_table_left);
+    EXPECT_FALSE(get_table_left->dynamic_pruning_input());
+  }
 }
 
 TEST_F(LQPTranslatorTest, LimitNode) {
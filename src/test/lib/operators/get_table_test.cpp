@@ -6,7 +6,9 @@
 #include "hyrise.hpp"
 #include "operators/delete.hpp"
 #include "operators/get_table.hpp"
+#include "operators/table_wrapper.hpp"
 #include "operators/validate.hpp"
+#include "scheduler/operator_task.hpp"
 #include "storage/chunk.hpp"
 #include "storage/index/group_key/group_key_index.hpp"
 #include "storage/table.hpp"
@@ -285,6 +287,60 @@ TEST_F(OperatorsGetTableTest, Copy) {
   EXPECT_EQ(get_table_b_copy->pruned_column_ids(), std::vector{ColumnID{0}});
 }
 
+TEST_F(OperatorsGetTableTest, DynamicPruning) {
+  // Only the chunks 0 and 3 contain a = 9. NULL values and values that are not part of the table are ignored.
+  const auto build_table =
+      std::make_shared<Table>(TableColumnDefinitions{{"x", DataType::Long, true}}, TableType::Data);
+  build_table->append({int64_t{9}});
+  build_table->append({NULL_VALUE});
+  build_table->append({int64_t{42}});
+  const auto build_input = std::make_shared<TableWrapper>(build_table);
+  build_input->never_clear_output();
+
+  const auto get_table = std::make_shared<GetTable>("int_int_float");
+  get_table->set_dynamic_pruning_input({build_input, ColumnID{0}, ColumnID{0}});
+
+  // The GetTable waits for its dynamic pruning input.
+  const auto& [tasks, root_task] = OperatorTask::make_tasks_from_operator(get_table);
+  EXPECT_EQ(tasks.size(), 2);
+  Hyrise::get().scheduler()->schedule_and_wait_for_tasks(tasks);
+
+  const auto& table = get_table->get_output();
+  ASSERT_EQ(table->chunk_count(), 2);
+  EXPECT_EQ(table->get_value<float>(ColumnID{2}, 0u), 11.5f);
+  EXPECT_EQ(table->get_value<float>(ColumnID{2}, 1u), 9.5f);
+  EXPECT_EQ(get_table->dynamically_pruned_chunk_count(), 2);
+  EXPECT_EQ(get_table->description(DescriptionMode::SingleLine),
+            "GetTable (int_int_float) pruned: 0/4 chunk(s), 0/3 column(s), 2 chunk(s) at runtime");
+}
+
+TEST_F(OperatorsGetTableTest, DynamicPruningWithPrunedColumns) {
+  // With column a pruned, the first output column is b, which only contains 10. 10.5 cannot be converted to int.
+  const auto build_table =
+      std::make_shared<Table>(TableColumnDefinitions{{"x", DataType::Double, false}}, TableType::Data);
+  build_table->append({11.0});
+  build_table->append({10.5});
+  const auto build_input = std::make_shared<TableWrapper>(build_table);
+  build_input->never_clear_output();
+  build_input->execute();
+
+  const auto get_table = std::make_shared<GetTable>("int_int_float", std::vector{ChunkID{1}}, std::vector{ColumnID{0}});
+  get_table->set_dynamic_pruning_input({build_input, ColumnID{0}, ColumnID{0}});
+  get_table->execute();
+
+  EXPECT_EQ(get_table->get_output()->chunk_count(), 0);
+  EXPECT_EQ(get_table->dynamically_pruned_chunk_count(), 3);
+
+  // Without an executed dynamic pruning input, no chunks are pruned at runtime. Copies of the GetTable also copy the
+  // dynamic pruning input.
+  const auto get_table_copy = std::dynamic_pointer_cast<GetTable>(get_table->deep_copy());
+  ASSERT_TRUE(get_table_copy->dynamic_pruning_input());
+  EXPECT_NE(get_table_copy->dynamic_pruning_input()->build_input, build_input);
+  get_table_copy->execute();
+  EXPECT_EQ(get_table_copy->get_output()->chunk_count(), 3);
+  EXPECT_EQ(get_table_copy->dynamically_pruned_chunk_count(), 0);
+}
+
 TEST_F(OperatorsGetTableTest, AdaptOrderByInformation) {
   auto table = Hyrise::get().storage_manager.get_table("int_int_float");
   table->get_chunk(ChunkID{0})->set_individually_sorted_by(SortColumnDefinition(ColumnID{0}, SortMode::Ascending));
@@ -0,0 +1,153 @@
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "base_test.hpp"
+
+#include "expression/expression_functional.hpp"
+#include "expression/expression_utils.hpp"
+#include "hyrise.hpp"
+#include "operators/table_scan.hpp"
+#include "operators/table_scan/compiled_predicate_table_scan_impl.hpp"
+#include "operators/table_scan/expression_evaluator_table_scan_impl.hpp"
+#include "operators/table_scan/predicate_compiler.hpp"
+#include "operators/table_wrapper.hpp"
+#include "storage/chunk_encoder.hpp"
+#include "storage/encoding_type.hpp"
+#include "storage/table.hpp"
+
+using namespace hyrise::expression_functional;  // NOLINT
+
+namespace hyrise {
+
+class TableScanCompiledPredicateTest : public BaseTest, public ::testing::WithParamInterface<EncodingType> {
+ protected:
+  void SetUp() override {
+    const auto table = load_table("resources/test_data/tbl/int_int_w_null_8_rows.tbl", ChunkOffset{3});
+    ChunkEncoder::encode_all_chunks(table, SegmentEncodingSpec{GetParam()});
+
+    _table_wrapper = std::make_shared<TableWrapper>(table);
+    _table_wrapper->never_clear_output();
+    _table_wrapper->execute();
+
+    _a = pqp_column_(ColumnID{0}, DataType::Int, true, "a");
+    _b = pqp_column_(ColumnID{1}, DataType::Int, true, "b");
+
+    Hyrise::get().predicate_compiler->set_enabled(true);
+  }
+
+  // Scans with the compiler enabled and compares the result to that of the ExpressionEvaluatorTableScanImpl.
+  void check_compiled_scan(const std::shared_ptr<AbstractExpression>& predicate) {
+    const auto compiled_scan = std::make_shared<TableScan>(_table_wrapper, predicate);
+    EXPECT_TRUE(dynamic_cast<CompiledPredicateTableScanImpl*>(compiled_scan->create_impl().get()));
+    compiled_scan->execute();
+
+    Hyrise::get().predicate_compiler->set_enabled(false);
+    const auto reference_scan = std::make_shared<TableScan>(_table_wrapper, predicate);
+    EXPECT_TRUE(dynamic_cast<ExpressionEvaluatorTableScanImpl*>(reference_scan->create_impl().get()));
+    reference_scan->execute();
+    Hyrise::get().predicate_compiler->set_enabled(true);
+
+    EXPECT_TABLE_EQ_UNORDERED(compiled_scan->get_output(), reference_scan->get_output());
+  }
+
+  std::shared_ptr<TableWrapper> _table_wrapper;
+  std::shared_ptr<PQPColumnExpression> _a;
+  std::shared_ptr<PQPColumnExpression> _b;
+};
+
+auto table_scan_compiled_predicate_test_formatter = [](const ::testing::TestParamInfo<EncodingType> info) {
+  return std::to_string(static_cast<uint32_t>(info.param));
+};
+
+INSTANTIATE_TEST_SUITE_P(EncodingTypes, TableScanCompiledPredicateTest,
+                         ::testing::Values(EncodingType::Unencoded, EncodingType::Dictionary, EncodingType::RunLength,
+                                           EncodingType::FrameOfReference),
+                         table_scan_compiled_predicate_test_formatter);
+
+TEST_P(TableScanCompiledPredicateTest, Disjunctions) {
+  check_compiled_scan(or_(equals_(_a, 12), greater_than_(_b, 457)));
+  check_compiled_scan(or_(and_(less_than_(_a, 1000), equals_(_b, 456)), is_null_(_b)));
+  check_compiled_scan(or_(between_inclusive_(_a, 100, 1300), less_than_(_a, _b)));
+}
+
+TEST_P(TableScanCompiledPredicateTest, Arithmetic) {
+  check_compiled_scan(greater_than_(add_(_a, _b), 1700));
+  check_compiled_scan(less_than_equals_(sub_(_a, 100), mul_(_b, 2)));
+  check_compiled_scan(equals_(mul_(_a, 1.5), 18.0));
+  check_compiled_scan(and_(is_not_null_(add_(_a, _b)), greater_than_(_b, 456)));
+}
+
+TEST_P(TableScanCompiledPredicateTest, SimplePredicatesAreNotCompiled) {
+  const auto simple_scan = std::make_shared<TableScan>(_table_wrapper, greater_than_(_a, 123));
+  EXPECT_FALSE(dynamic_cast<CompiledPredicateTableScanImpl*>(simple_scan->create_impl().get()));
+
+  // Division has NULL semantics that the compiler does not replicate.
+  const auto division_predicate = or_(greater_than_(div_(_a, _b), 1), is_null_(_a));
+  const auto division_scan = std::make_shared<TableScan>(_table_wrapper, division_predicate);
+  EXPECT_TRUE(dynamic_cast<ExpressionEvaluatorTableScanImpl*>(division_scan->create_impl().get()));
+}
+
+TEST_P(TableScanCompiledPredicateTest, Parameters) {
+  // The second predicate only differs in its values and thus reuses the CompiledPredicate of the first one.
+  check_compiled_scan(or_(equals_(_a, 12), greater_than_(add_(_a, _b), 1700)));
+  check_compiled_scan(or_(equals_(_a, 1234), greater_than_(add_(_a, _b), 900)));
+
+  const auto parameter = correlated_parameter_(ParameterID{3}, _b);
+  parameter->set_value(457);
+  check_compiled_scan(or_(equals_(_b, parameter), greater_than_(mul_(parameter, 2), _a)));
+  parameter->set_value(NULL_VALUE);
+  check_compiled_scan(or_(equals_(_b, parameter), greater_than_(mul_(parameter, 2), _a)));
+}
+
+TEST_P(TableScanCompiledPredicateTest, StringLiterals) {
+  const auto table = load_table("resources/test_data/tbl/int_string2.tbl", ChunkOffset{2});
+  _table_wrapper = std::make_shared<TableWrapper>(table);
+  _table_wrapper->never_clear_output();
+  _table_wrapper->execute();
+
+  const auto s = pqp_column_(ColumnID{1}, DataType::String, false, "b");
+  check_compiled_scan(or_(equals_(s, "B"), less_than_(value_("A"), value_("B"))));
+  check_compiled_scan(or_(equals_(s, "B"), greater_than_(value_("A"), value_("B"))));
+}
+
+TEST_P(TableScanCompiledPredicateTest, Cache) {
+  auto& predicate_compiler = *Hyrise::get().predicate_compiler;
+  predicate_compiler.clear_cache();
+
+  const auto [compiled_predicate, parameters] = predicate_compiler.compile(or_(equals_(_a, 12), equals_(_b, 456)));
+  ASSERT_TRUE(compiled_predicate);
+  EXPECT_EQ(compiled_predicate->delegated_predicates().size(), 2);
+  EXPECT_EQ(parameters, std::vector<AllTypeVariant>({int32_t{12}, int32_t{456}}));
+  EXPECT_EQ(predicate_compiler.cache_size(), 1);
+
+  const auto bound_predicates = compiled_predicate->bind_delegated_predicates(parameters);
+  ASSERT_EQ(bound_predicates.size(), 2);
+  EXPECT_EQ(expression_get_value_or_parameter(*bound_predicates[0]->arguments[1]), AllTypeVariant{int32_t{12}});
+
+  // Predicates that only differ in their values share a CompiledPredicate, values of other data types do not.
+  const auto [other_compiled_predicate, other_parameters] =
+      predicate_compiler.compile(or_(equals_(_a, 13), equals_(_b, 456)));
+  EXPECT_EQ(other_compiled_predicate, compiled_predicate);
+  EXPECT_EQ(other_parameters, std::vector<AllTypeVariant>({int32_t{13}, int32_t{456}}));
+  EXPECT_EQ(predicate_compiler.cache_size(), 1);
+
+  EXPECT_NE(predicate_compiler.compile(or_(equals_(_a, 13.5), equals_(_b, 456))).first, compiled_predicate);
+  EXPECT_EQ(predicate_compiler.cache_size(), 2);
+
+  predicate_compiler.clear_cache();
+  EXPECT_EQ(predicate_compiler.cache_size(), 0);
+}
+
+TEST_P(TableScanCompiledPredicateTest, Setting) {
+  auto setting = std::make_shared<PredicateCompilerSetting>();
+  EXPECT_EQ(setting->get(), "true");
+
+  setting->set("false");
+  EXPECT_FALSE(Hyrise::get().predicate_compiler->enabled());
+  EXPECT_EQ(setting->get(), "false");
+
+  EXPECT_THROW(setting->set("maybe"), std::logic_error);
+}
+
+}  // namespace hyrise
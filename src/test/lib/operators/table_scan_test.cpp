@@ -607,6 +607,51 @@ TEST_P(OperatorsTableScanTest, ScanOnCompressedSegmentsAroundBounds) {
   }
 }
 
+TEST_P(OperatorsTableScanTest, ScanOnBitPackedDictionarySegment) {
+  // Bit-packed attribute vectors are scanned block by block. The segment spans several blocks and ends with an
+  // incomplete one.
+  if (_encoding_type != EncodingType::Dictionary) {
+    GTEST_SKIP();
+  }
+
+  const auto column_definitions = TableColumnDefinitions{{"a", DataType::Int, true}};
+  const auto table = std::make_shared<Table>(column_definitions, TableType::Data);
+  const auto bit_packed_table = std::make_shared<Table>(column_definitions, TableType::Data);
+  for (auto row = int32_t{0}; row < 200; ++row) {
+    const auto value = row % 10 == 3 ? NULL_VALUE : AllTypeVariant{row % 37};
+    table->append({value});
+    bit_packed_table->append({value});
+  }
+  bit_packed_table->last_chunk()->finalize();
+  ChunkEncoder::encode_all_chunks(bit_packed_table,
+                                  SegmentEncodingSpec{EncodingType::Dictionary, VectorCompressionType::BitPacking});
+
+  const auto table_wrapper = std::make_shared<TableWrapper>(table);
+  table_wrapper->never_clear_output();
+  table_wrapper->execute();
+  const auto bit_packed_table_wrapper = std::make_shared<TableWrapper>(bit_packed_table);
+  bit_packed_table_wrapper->never_clear_output();
+  bit_packed_table_wrapper->execute();
+
+  for (const auto predicate_condition :
+       {PredicateCondition::Equals, PredicateCondition::NotEquals, PredicateCondition::LessThan,
+        PredicateCondition::LessThanEquals, PredicateCondition::GreaterThan, PredicateCondition::GreaterThanEquals}) {
+    const auto expected_scan = create_table_scan(table_wrapper, ColumnID{0}, predicate_condition, 20);
+    expected_scan->execute();
+    const auto scan = create_table_scan(bit_packed_table_wrapper, ColumnID{0}, predicate_condition, 20);
+    scan->execute();
+    EXPECT_TABLE_EQ_ORDERED(scan->get_output(), expected_scan->get_output());
+  }
+
+  const auto expected_between_scan =
+      create_between_table_scan(table_wrapper, ColumnID{0}, 5, 30, PredicateCondition::BetweenUpperExclusive);
+  expected_between_scan->execute();
+  const auto between_scan = create_between_table_scan(bit_packed_table_wrapper, ColumnID{0}, 5, 30,
+                                                      PredicateCondition::BetweenUpperExclusive);
+  between_scan->execute();
+  EXPECT_TABLE_EQ_ORDERED(between_scan->get_output(), expected_between_scan->get_output());
+}
+
 TEST_P(OperatorsTableScanTest, ScanWithEmptyInput) {
   auto scan_1 = std::make_shared<TableScan>(
       get_int_float_op(), greater_than_(get_column_expression(get_int_float_op(), ColumnID{0}), 12345));
@@ -0,0 +1,169 @@
+#include "base_test.hpp"
+
+#include "cost_estimation/cost_estimator_logical.hpp"
+#include "expression/expression_functional.hpp"
+#include "logical_query_plan/join_node.hpp"
+#include "logical_query_plan/lqp_utils.hpp"
+#include "logical_query_plan/mock_node.hpp"
+#include "logical_query_plan/predicate_node.hpp"
+#include "optimizer/join_ordering/dp_ccp.hpp"
+#include "optimizer/join_ordering/iterative_dp_ccp.hpp"
+#include "optimizer/join_ordering/join_graph.hpp"
+#include "statistics/cardinality_estimator.hpp"
+
+using namespace hyrise::expression_functional;  // NOLINT
+
+namespace hyrise {
+
+class IterativeDpCcpTest : public BaseTest {
+ public:
+  void SetUp() override {
+    cardinality_estimator = std::make_shared<CardinalityEstimator>();
+    cost_estimator = std::make_shared<CostEstimatorLogical>(cardinality_estimator);
+
+    // Row counts and value ranges differ, so that there is a single best join order.
+    for (auto node_idx = size_t{0}; node_idx < 10; ++node_idx) {
+      const auto row_count = static_cast<Cardinality>(100 * (node_idx % 4 + 1) + 10 * node_idx);
+      const auto max_value = static_cast<int32_t>(50 + 20 * node_idx);
+      const auto node = create_mock_node_with_statistics(
+          MockNode::ColumnDefinitions{{DataType::Int, "a"}}, row_count,
+          {GenericHistogram<int32_t>::with_single_bin(1, max_value, row_count, row_count / 2)});
+      nodes.emplace_back(node);
+      columns.emplace_back(node->get_column("a"));
+    }
+  }
+
+  // Returns join predicates between the first @param vertex_count nodes that form a chain.
+  std::vector<JoinGraphEdge> chain_edges(const size_t vertex_count, const size_t total_vertex_count) const {
+    auto edges = std::vector<JoinGraphEdge>{};
+    for (auto vertex_idx = size_t{1}; vertex_idx < vertex_count; ++vertex_idx) {
+      auto vertex_set = JoinGraphVertexSet{total_vertex_count};
+      vertex_set.set(vertex_idx - 1);
+      vertex_set.set(vertex_idx);
+      edges.emplace_back(vertex_set, expression_vector(equals_(columns[vertex_idx - 1], columns[vertex_idx])));
+    }
+    return edges;
+  }
+
+  std::vector<std::shared_ptr<AbstractLQPNode>> vertices(const size_t vertex_count) const {
+    return std::vector<std::shared_ptr<AbstractLQPNode>>(nodes.begin(), nodes.begin() + vertex_count);
+  }
+
+  // Checks that @param lqp joins all vertices of @param join_graph and contains all of its predicates exactly once.
+  static void expect_complete_plan(const std::shared_ptr<AbstractLQPNode>& lqp, const JoinGraph& join_graph) {
+    auto expected_predicates = ExpressionUnorderedSet{};
+    auto expected_predicate_count = size_t{0};
+    for (const auto& edge : join_graph.edges) {
+      expected_predicates.insert(edge.predicates.begin(), edge.predicates.end());
+      expected_predicate_count += edge.predicates.size();
+    }
+
+    auto vertex_count = size_t{0};
+    auto predicate_count = size_t{0};
+    visit_lqp(lqp, [&](const auto& node) {
+      if (node->type == LQPNodeType::Mock) {
+        ++vertex_count;
+      } else if (node->type == LQPNodeType::Predicate) {
+        EXPECT_TRUE(expected_predicates.contains(node->node_expressions.front()));
+        ++predicate_count;
+      } else if (node->type == LQPNodeType::Join) {
+        for (const auto& join_predicate : static_cast<const JoinNode&>(*node).join_predicates()) {
+          EXPECT_TRUE(expected_predicates.contains(join_predicate));
+          ++predicate_count;
+        }
+      }
+      return LQPVisitation::VisitInputs;
+    });
+
+    EXPECT_EQ(vertex_count, join_graph.vertices.size());
+    EXPECT_EQ(predicate_count, expected_predicate_count);
+  }
+
+  std::vector<std::shared_ptr<MockNode>> nodes;
+  std::vector<std::shared_ptr<LQPColumnExpression>> columns;
+  std::shared_ptr<AbstractCostEstimator> cost_estimator;
+  std::shared_ptr<AbstractCardinalityEstimator> cardinality_estimator;
+};
+
+TEST_F(IterativeDpCcpTest, InvalidBlockSize) {
+  EXPECT_THROW(IterativeDpCcp{1}, std::logic_error);
+}
+
+TEST_F(IterativeDpCcpTest, NoEdges) {
+  const auto join_graph =
+      JoinGraph{std::vector<std::shared_ptr<AbstractLQPNode>>{nodes[0]}, std::vector<JoinGraphEdge>{}};
+
+  const auto actual_lqp = IterativeDpCcp{}(join_graph, cost_estimator);  // NOLINT
+
+  EXPECT_LQP_EQ(actual_lqp, nodes[0]);
+}
+
+TEST_F(IterativeDpCcpTest, EqualsDpCcpForSmallJoinGraphs) {
+  // If all vertices fit into a single block, DpCcp orders the entire JoinGraph. Local and uncorrelated predicates are
+  // placed the same way.
+  auto edges = chain_edges(5, 5);
+  edges.emplace_back(JoinGraphVertexSet{5, 0b00010}, expression_vector(greater_than_(columns[1], 10)));
+  edges.emplace_back(JoinGraphVertexSet{5, 0b00000}, expression_vector(equals_(6, 6)));
+  edges.emplace_back(JoinGraphVertexSet{5, 0b10001}, expression_vector(less_than_(columns[0], columns[4])));
+  const auto join_graph = JoinGraph{vertices(5), edges};
+
+  const auto expected_lqp = DpCcp{}(join_graph, cost_estimator);  // NOLINT
+
+  EXPECT_LQP_EQ(IterativeDpCcp{5}(join_graph, cost_estimator), expected_lqp);  // NOLINT
+  EXPECT_LQP_EQ(IterativeDpCcp{}(join_graph, cost_estimator), expected_lqp);   // NOLINT
+}
+
+TEST_F(IterativeDpCcpTest, LargeChainQuery) {
+  const auto join_graph = JoinGraph{vertices(10), chain_edges(10, 10)};
+
+  for (const auto block_size : {size_t{2}, size_t{3}, size_t{4}, size_t{10}}) {
+    SCOPED_TRACE(block_size);
+    const auto lqp = IterativeDpCcp{block_size}(join_graph, cost_estimator);  // NOLINT
+    expect_complete_plan(lqp, join_graph);
+  }
+
+  // Larger blocks consider more join orders. Since the selection of the blocks is greedy, this usually, but not
+  // necessarily leads to cheaper plans. For a single block, the plan is optimal.
+  const auto optimal_cost = cost_estimator->estimate_plan_cost(DpCcp{}(join_graph, cost_estimator));  // NOLINT
+  const auto iterative_cost =
+      cost_estimator->estimate_plan_cost(IterativeDpCcp{3}(join_graph, cost_estimator));  // NOLINT
+  EXPECT_GE(iterative_cost, optimal_cost);
+  EXPECT_FLOAT_EQ(cost_estimator->estimate_plan_cost(IterativeDpCcp{10}(join_graph, cost_estimator)),  // NOLINT
+                  optimal_cost);
+}
+
+TEST_F(IterativeDpCcpTest, LargeStarQuery) {
+  auto edges = std::vector<JoinGraphEdge>{};
+  for (auto vertex_idx = size_t{1}; vertex_idx < 10; ++vertex_idx) {
+    auto vertex_set = JoinGraphVertexSet{10};
+    vertex_set.set(0);
+    vertex_set.set(vertex_idx);
+    edges.emplace_back(vertex_set, expression_vector(equals_(columns[0], columns[vertex_idx])));
+  }
+  const auto join_graph = JoinGraph{vertices(10), edges};
+
+  const auto lqp = IterativeDpCcp{4}(join_graph, cost_estimator);  // NOLINT
+  expect_complete_plan(lqp, join_graph);
+}
+
+TEST_F(IterativeDpCcpTest, HyperEdgesAndCrossJoins) {
+  // Vertex 3 is only connected by a hyperedge, vertex 4 is not connected at all. DpCcp cannot order such JoinGraphs.
+  auto edges = chain_edges(3, 5);
+  edges.emplace_back(JoinGraphVertexSet{5, 0b01011},
+                     expression_vector(equals_(add_(columns[0], columns[1]), columns[3])));
+  const auto join_graph = JoinGraph{vertices(5), edges};
+
+  const auto lqp = IterativeDpCcp{2}(join_graph, cost_estimator);  // NOLINT
+  expect_complete_plan(lqp, join_graph);
+
+  auto cross_join_count = size_t{0};
+  visit_lqp(lqp, [&](const auto& node) {
+    if (node->type == LQPNodeType::Join && static_cast<const JoinNode&>(*node).join_mode == JoinMode::Cross) {
+      ++cross_join_count;
+    }
+    return LQPVisitation::VisitInputs;
+  });
+  EXPECT_GE(cross_join_count, 1);
+}
+
+}  // namespace hyrise
@@ -1,6 +1,9 @@
+#include <mutex>
+
 #include "base_test.hpp"
 
 #include "expression/expression_functional.hpp"
+#include "hyrise.hpp"
 #include "logical_query_plan/join_node.hpp"
 #include "logical_query_plan/limit_node.hpp"
 #include "logical_query_plan/logical_plan_root_node.hpp"
@@ -11,6 +14,7 @@
 #include "logical_query_plan/sort_node.hpp"
 #include "optimizer/optimizer.hpp"
 #include "optimizer/strategy/abstract_rule.hpp"
+#include "scheduler/node_queue_scheduler.hpp"
 
 using namespace hyrise::expression_functional;  // NOLINT
 
@@ -285,4 +289,63 @@ TEST_F(OptimizerTest, OptimizesSubqueriesExactlyOnce) {
   }
 }
 
+TEST_F(OptimizerTest, OptimizesSubqueriesInParallel) {
+  /**
+   * Subquery LQPs without nested subqueries are optimized in parallel, the others afterwards (see
+   * AbstractRule::apply_to_plan()).
+   */
+  Hyrise::get().set_scheduler(std::make_shared<NodeQueueScheduler>());
+
+  auto optimized_lqps = std::vector<std::shared_ptr<AbstractLQPNode>>{};
+  auto optimized_lqps_mutex = std::mutex{};
+
+  // A "rule" that records the LQPs it was applied to
+  class MockRule : public AbstractRule {
+   public:
+    MockRule(std::vector<std::shared_ptr<AbstractLQPNode>>& init_optimized_lqps, std::mutex& init_mutex)
+        : optimized_lqps(init_optimized_lqps), mutex(init_mutex) {}
+
+    std::string name() const override {
+      return "MockRule";
+    }
+
+   protected:
+    void _apply_to_plan_without_subqueries(const std::shared_ptr<AbstractLQPNode>& lqp_root) const override {
+      const auto lock = std::lock_guard<std::mutex>{mutex};
+      optimized_lqps.emplace_back(lqp_root->left_input());
+    }
+
+    std::vector<std::shared_ptr<AbstractLQPNode>>& optimized_lqps;
+    std::mutex& mutex;
+  };
+
+  const auto node_d = MockNode::make(MockNode::ColumnDefinitions{{DataType::Int, "v"}}, "node_d");
+
+  // clang-format off
+  const auto subquery_lqp_c =
+  LimitNode::make(to_expression(1),
+    ProjectionNode::make(expression_vector(subquery_a),
+      node_d));
+
+  auto lqp = std::static_pointer_cast<AbstractLQPNode>(
+  ProjectionNode::make(expression_vector(add_(b, lqp_subquery_(subquery_lqp_c))),
+    PredicateNode::make(greater_than_(a, subquery_b),
+      node_a)));
+  // clang-format on
+
+  // The optimizer requires exclusive ownership of the LQP.
+  const auto* const root_lqp = lqp.get();
+
+  auto optimizer = Optimizer{};
+  optimizer.add_rule(std::make_unique<MockRule>(optimized_lqps, optimized_lqps_mutex));
+  const auto optimized_lqp = optimizer.optimize(std::move(lqp));
+
+  // The root LQP comes first, the subquery LQP with the nested subquery last.
+  ASSERT_EQ(optimized_lqps.size(), 4u);
+  EXPECT_EQ(optimized_lqps[0].get(), root_lqp);
+  EXPECT_EQ((std::unordered_set<std::shared_ptr<AbstractLQPNode>>{optimized_lqps[1], optimized_lqps[2]}),
+            (std::unordered_set<std::shared_ptr<AbstractLQPNode>>{subquery_lqp_a, subquery_lqp_b}));
+  EXPECT_EQ(optimized_lqps[3], subquery_lqp_c);
+}
+
 }  // namespace hyrise
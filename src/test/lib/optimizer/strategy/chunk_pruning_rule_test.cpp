@@ -59,6 +59,16 @@ class ChunkPruningRuleTest : public StrategyBaseTest {
     ChunkEncoder::encode_all_chunks(int_float4, SegmentEncodingSpec{EncodingType::Dictionary});
     storage_manager.add_table("int_float4", int_float4);
 
+    // Chunk 0 holds the even values 0 to 38, chunk 1 the odd values 1 to 39. Min/max and range filters cannot tell
+    // them apart, Bloom filters can.
+    auto unclustered = std::make_shared<Table>(TableColumnDefinitions{{"a", DataType::Int, false}}, TableType::Data,
+                                               ChunkOffset{20});
+    for (auto value = int32_t{0}; value < 80; value += 2) {
+      unclustered->append({value % 40 + value / 40});
+    }
+    ChunkEncoder::encode_all_chunks(unclustered, SegmentEncodingSpec{EncodingType::Dictionary});
+    storage_manager.add_table("unclustered", unclustered);
+
     for (const auto& [name, table] : storage_manager.tables()) {
       generate_chunk_pruning_statistics(table);
     }
@@ -449,4 +459,35 @@ TEST_F(ChunkPruningRuleTest, ValueOutOfRange) {
   EXPECT_EQ(pruned_chunk_ids, expected_chunk_ids);
 }
 
+TEST_F(ChunkPruningRuleTest, BloomFilterPruningTest) {
+  auto stored_table_node = std::make_shared<StoredTableNode>("unclustered");
+  const auto a = lqp_column_(stored_table_node, ColumnID{0});
+
+  auto predicate_node = PredicateNode::make(equals_(a, 7), stored_table_node);
+  auto pruned = StrategyBaseTest::apply_rule(_rule, predicate_node);
+
+  EXPECT_EQ(pruned, predicate_node);
+  std::vector<ChunkID> expected_chunk_ids = {ChunkID{0}};
+  EXPECT_EQ(stored_table_node->pruned_chunk_ids(), expected_chunk_ids);
+}
+
+TEST_F(ChunkPruningRuleTest, InListPruningTest) {
+  const auto prune = [&](const auto& make_predicate) {
+    const auto stored_table_node = std::make_shared<StoredTableNode>("unclustered");
+    const auto a = lqp_column_(stored_table_node, ColumnID{0});
+    StrategyBaseTest::apply_rule(_rule, PredicateNode::make(make_predicate(a), stored_table_node));
+    return stored_table_node->pruned_chunk_ids();
+  };
+
+  EXPECT_EQ(prune([](const auto& a) { return in_(a, list_(3, 101)); }), std::vector<ChunkID>{ChunkID{0}});
+  EXPECT_EQ(prune([](const auto& a) { return in_(a, list_(4, 102, NullValue{})); }), std::vector<ChunkID>{ChunkID{1}});
+  EXPECT_EQ(prune([](const auto& a) { return in_(a, list_(101, 102)); }),
+            (std::vector<ChunkID>{ChunkID{0}, ChunkID{1}}));
+  EXPECT_TRUE(prune([](const auto& a) { return in_(a, list_(3, 4)); }).empty());
+  EXPECT_TRUE(prune([](const auto& a) { return not_in_(a, list_(3, 101)); }).empty());
+
+  // 4.5 cannot be converted losslessly to the column's data type.
+  EXPECT_TRUE(prune([](const auto& a) { return in_(a, list_(3, 4.5)); }).empty());
+}
+
 }  // namespace hyrise
@@ -8,13 +8,17 @@
 #include "lib/optimizer/strategy/strategy_base_test.hpp"
 #include "utils/assert.hpp"
 
+#include "cost_estimation/cost_estimator_calibrated.hpp"
 #include "expression/abstract_expression.hpp"
 #include "expression/expression_functional.hpp"
 #include "hyrise.hpp"
+#include "logical_query_plan/logical_plan_root_node.hpp"
 #include "logical_query_plan/mock_node.hpp"
 #include "logical_query_plan/predicate_node.hpp"
 #include "logical_query_plan/stored_table_node.hpp"
+#include "logical_query_plan/validate_node.hpp"
 #include "optimizer/strategy/index_scan_rule.hpp"
+#include "statistics/cardinality_estimator.hpp"
 #include "statistics/attribute_statistics.hpp"
 #include "statistics/table_statistics.hpp"
 #include "storage/chunk_encoder.hpp"
@@ -147,6 +151,38 @@ TEST_F(IndexScanRuleTest, IndexScanWithIndex) {
   EXPECT_EQ(predicate_node_0->scan_type, ScanType::IndexScan);
 }
 
+TEST_F(IndexScanRuleTest, IndexScanWithCalibratedCostModel) {
+  table->create_index<GroupKeyIndex>({ColumnID{2}});
+
+  generate_mock_statistics(1'000'000);
+
+  // StrategyBaseTest::apply_rule() uses the CostEstimatorLogical.
+  auto coefficients = std::make_shared<CostModelCoefficients>();
+  rule->cost_estimator = std::make_shared<CostEstimatorCalibrated>(std::make_shared<CardinalityEstimator>(),
+                                                                   coefficients);
+  const auto apply_rule = [&](const auto& predicate_node) {
+    predicate_node->scan_type = ScanType::TableScan;
+    const auto root_node = LogicalPlanRootNode::make(predicate_node);
+    rule->apply_to_plan(root_node);
+    root_node->set_left_input(nullptr);
+    return predicate_node->scan_type;
+  };
+
+  // Half of the rows qualify. With the default coefficients, scanning the dictionary-encoded table is cheaper than
+  // accessing that many rows via the index.
+  const auto predicate_node = PredicateNode::make(greater_than_(c, 10'000), stored_table_node);
+  EXPECT_EQ(apply_rule(predicate_node), ScanType::TableScan);
+
+  // On a machine where random accesses are cheap, even such an unselective predicate is executed as an IndexScan.
+  coefficients->index_scan_cost_per_output_row = 0.1f;
+  EXPECT_EQ(apply_rule(predicate_node), ScanType::IndexScan);
+
+  // In turn, selective predicates are executed as TableScans if scanning is cheap.
+  const auto selective_predicate_node = PredicateNode::make(greater_than_(c, 19'900), stored_table_node);
+  coefficients->index_scan_cost_per_output_row = 1'000.0f;
+  EXPECT_EQ(apply_rule(selective_predicate_node), ScanType::TableScan);
+}
+
 TEST_F(IndexScanRuleTest, IndexScanWithIndexPrunedColumn) {
   table->create_index<GroupKeyIndex>({ColumnID{2}});
   stored_table_node->set_pruned_column_ids({ColumnID{0}});
@@ -177,4 +213,46 @@ TEST_F(IndexScanRuleTest, IndexScanOnlyOnOutputOfStoredTableNode) {
   EXPECT_EQ(predicate_node_1->scan_type, ScanType::TableScan);
 }
 
+TEST_F(IndexScanRuleTest, PrimaryKeyLookup) {
+  table->create_primary_key_index({ColumnID{0}, ColumnID{2}});
+
+  // clang-format off
+  const auto input_lqp =
+  PredicateNode::make(equals_(11, c),
+    PredicateNode::make(less_than_(b, 15),
+      ValidateNode::make(
+        PredicateNode::make(equals_(a, 9),
+          stored_table_node))));
+  // clang-format on
+
+  const auto actual_lqp = StrategyBaseTest::apply_rule(rule, input_lqp);
+
+  // The key predicates are merged above the StoredTableNode. The expected LQP is built afterwards because the rule
+  // only considers StoredTableNodes with a single output.
+  // clang-format off
+  const auto expected_lqp =
+  PredicateNode::make(less_than_(b, 15),
+    ValidateNode::make(
+      PredicateNode::make(and_(equals_(a, 9), equals_(11, c)),
+        stored_table_node)));
+  // clang-format on
+
+  EXPECT_LQP_EQ(actual_lqp, expected_lqp);
+
+  const auto lookup_node = std::static_pointer_cast<PredicateNode>(actual_lqp->left_input()->left_input());
+  EXPECT_EQ(lookup_node->scan_type, ScanType::IndexScan);
+}
+
+TEST_F(IndexScanRuleTest, NoPrimaryKeyLookupWithoutAllKeyColumns) {
+  table->create_primary_key_index({ColumnID{0}, ColumnID{2}});
+
+  const auto predicate_node_0 = PredicateNode::make(equals_(a, 9), stored_table_node);
+  const auto predicate_node_1 = PredicateNode::make(greater_than_(c, 10), predicate_node_0);
+
+  const auto actual_lqp = StrategyBaseTest::apply_rule(rule, predicate_node_1);
+  EXPECT_EQ(actual_lqp, predicate_node_1);
+  EXPECT_EQ(predicate_node_0->scan_type, ScanType::TableScan);
+  EXPECT_EQ(predicate_node_1->scan_type, ScanType::TableScan);
+}
+
 }  // namespace hyrise
@@ -0,0 +1,185 @@
+#include <memory>
+#include <vector>
+
+#include "base_test.hpp"
+
+#include "hyrise.hpp"
+#include "scheduler/job_task.hpp"
+#include "scheduler/node_queue_scheduler.hpp"
+#include "scheduler/resource_group.hpp"
+#include "scheduler/task_context.hpp"
+
+namespace hyrise {
+
+class ResourceGroupTest : public BaseTest {};
+
+TEST_F(ResourceGroupTest, ConcurrencyLimit) {
+  auto resource_group = ResourceGroup{"limited", 1, 2};
+  EXPECT_TRUE(resource_group.try_admit(8));
+  EXPECT_TRUE(resource_group.try_admit(8));
+  EXPECT_FALSE(resource_group.try_admit(8));
+  EXPECT_EQ(resource_group.running_task_count(), 2);
+
+  resource_group.release();
+  EXPECT_TRUE(resource_group.try_admit(8));
+
+  resource_group.release();
+  resource_group.release();
+  EXPECT_EQ(resource_group.running_task_count(), 0);
+}
+
+TEST_F(ResourceGroupTest, WeightedShare) {
+  const auto initial_competing_weight = ResourceGroup::competing_weight();
+  auto light_group = ResourceGroup{"light", 1};
+  auto heavy_group = ResourceGroup{"heavy", 3};
+
+  // Without competition, a group may use all workers (and more, as only the concurrency limit is enforced then).
+  light_group.register_pending_task();
+  for (auto task_id = 0; task_id < 10; ++task_id) {
+    EXPECT_TRUE(light_group.try_admit(8));
+  }
+  for (auto task_id = 0; task_id < 10; ++task_id) {
+    light_group.release();
+  }
+
+  // While both groups have pending tasks, the light group gets a quarter of the workers, the heavy group the rest.
+  heavy_group.register_pending_task();
+  heavy_group.register_pending_task();
+  EXPECT_EQ(ResourceGroup::competing_weight(), initial_competing_weight + 4);
+  EXPECT_EQ(heavy_group.pending_task_count(), 2);
+
+  EXPECT_TRUE(light_group.try_admit(8));
+  EXPECT_TRUE(light_group.try_admit(8));
+  EXPECT_FALSE(light_group.try_admit(8));
+  for (auto task_id = 0; task_id < 6; ++task_id) {
+    EXPECT_TRUE(heavy_group.try_admit(8));
+  }
+  EXPECT_FALSE(heavy_group.try_admit(8));
+
+  // Once the heavy group has no more pending tasks, the light group may use idle workers again.
+  heavy_group.unregister_pending_task();
+  heavy_group.unregister_pending_task();
+  EXPECT_TRUE(light_group.try_admit(8));
+
+  light_group.unregister_pending_task();
+  EXPECT_EQ(ResourceGroup::competing_weight(), initial_competing_weight);
+
+  for (auto task_id = 0; task_id < 3; ++task_id) {
+    light_group.release();
+  }
+  for (auto task_id = 0; task_id < 6; ++task_id) {
+    heavy_group.release();
+  }
+}
+
+TEST_F(ResourceGroupTest, EveryGroupMayRunOneTask) {
+  auto small_group = ResourceGroup{"small", 1};
+  auto large_group = ResourceGroup{"large", 100};
+  small_group.register_pending_task();
+  large_group.register_pending_task();
+
+  EXPECT_TRUE(small_group.try_admit(4));
+  EXPECT_FALSE(small_group.try_admit(4));
+
+  small_group.release();
+  small_group.unregister_pending_task();
+  large_group.unregister_pending_task();
+}
+
+TEST_F(ResourceGroupTest, TasksInheritContext) {
+  const auto resource_group = std::make_shared<ResourceGroup>("inherit");
+  const auto task_context = std::make_shared<TaskContext>(resource_group, 42);
+  EXPECT_EQ(TaskContext::current(), nullptr);
+
+  auto inner_task_context = std::shared_ptr<TaskContext>{};
+  auto outer_task = std::shared_ptr<JobTask>{};
+  {
+    const auto scoped_task_context = ScopedTaskContext{task_context};
+    EXPECT_EQ(TaskContext::current(), task_context);
+
+    outer_task = std::make_shared<JobTask>([&]() {
+      const auto inner_task = std::make_shared<JobTask>([]() {});
+      inner_task_context = inner_task->task_context();
+    });
+  }
+  EXPECT_EQ(TaskContext::current(), nullptr);
+  EXPECT_EQ(outer_task->task_context(), task_context);
+
+  outer_task->schedule();
+  EXPECT_EQ(inner_task_context, task_context);
+  EXPECT_EQ(TaskContext::current(), nullptr);
+}
+
+TEST_F(ResourceGroupTest, HighPriorityGroup) {
+  const auto resource_group = std::make_shared<ResourceGroup>("interactive", 1, 0, SchedulePriority::High);
+  const auto task = std::make_shared<JobTask>([]() {});
+  EXPECT_EQ(task->priority(), SchedulePriority::Default);
+
+  task->set_task_context(std::make_shared<TaskContext>(resource_group));
+  EXPECT_EQ(task->priority(), SchedulePriority::High);
+}
+
+TEST_F(ResourceGroupTest, ConcurrencyLimitWithNodeQueueScheduler) {
+  Hyrise::get().topology.use_fake_numa_topology(4, 2);
+  Hyrise::get().set_scheduler(std::make_shared<NodeQueueScheduler>());
+
+  const auto resource_group = std::make_shared<ResourceGroup>("limited", 1, 1);
+  const auto task_context = std::make_shared<TaskContext>(resource_group);
+
+  auto concurrent_task_count = std::atomic_uint32_t{0};
+  auto max_concurrent_task_count = std::atomic_uint32_t{0};
+  auto tasks = std::vector<std::shared_ptr<AbstractTask>>{};
+  for (auto task_id = 0; task_id < 20; ++task_id) {
+    tasks.emplace_back(std::make_shared<JobTask>([&]() {
+      const auto current_count = ++concurrent_task_count;
+      auto max_count = max_concurrent_task_count.load();
+      while (current_count > max_count && !max_concurrent_task_count.compare_exchange_weak(max_count, current_count)) {}
+      std::this_thread::sleep_for(std::chrono::microseconds(200));
+      --concurrent_task_count;
+    }));
+    tasks.back()->set_task_context(task_context);
+  }
+
+  // Tasks are scheduled from the main thread, so they all end up in the node queue where admission control applies.
+  AbstractScheduler::schedule_tasks(tasks);
+  AbstractScheduler::wait_for_tasks(tasks);
+  EXPECT_EQ(max_concurrent_task_count, 1);
+  EXPECT_EQ(resource_group->running_task_count(), 0);
+  EXPECT_EQ(resource_group->pending_task_count(), 0);
+
+  Hyrise::get().scheduler()->finish();
+}
+
+TEST_F(ResourceGroupTest, DeniedHighPriorityTasksDoNotStarveOtherTasks) {
+  Hyrise::get().topology.use_fake_numa_topology(2, 2);
+  Hyrise::get().set_scheduler(std::make_shared<NodeQueueScheduler>());
+
+  const auto resource_group = std::make_shared<ResourceGroup>("interactive", 1, 1, SchedulePriority::High);
+  const auto task_context = std::make_shared<TaskContext>(resource_group);
+
+  // The first high-priority task occupies the group's only slot until the default-priority task has run. The worker
+  // that is denied the second high-priority task has to move on to the default-priority task.
+  auto default_task_done = std::atomic_bool{false};
+  auto default_task_done_while_blocked = std::atomic_bool{false};
+  const auto blocking_task = std::make_shared<JobTask>([&]() {
+    const auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds{5};
+    while (!default_task_done && std::chrono::steady_clock::now() < deadline) {
+      std::this_thread::sleep_for(std::chrono::microseconds{100});
+    }
+    default_task_done_while_blocked = default_task_done.load();
+  });
+  const auto denied_task = std::make_shared<JobTask>([]() {});
+  blocking_task->set_task_context(task_context);
+  denied_task->set_task_context(task_context);
+  const auto default_task = std::make_shared<JobTask>([&]() { default_task_done = true; });
+
+  const auto tasks = std::vector<std::shared_ptr<AbstractTask>>{blocking_task, denied_task, default_task};
+  AbstractScheduler::schedule_tasks(tasks);
+  AbstractScheduler::wait_for_tasks(tasks);
+  EXPECT_TRUE(default_task_done_while_blocked);
+  EXPECT_EQ(resource_group->running_task_count(), 0);
+
+  Hyrise::get().scheduler()->finish();
+}
+
+}  // namespace hyrise
@@ -1,4 +1,7 @@
 #include <memory>
+#include <numeric>
+#include <thread>
+#include <unordered_set>
 #include <utility>
 #include <vector>
 
@@ -13,6 +16,8 @@
 #include "scheduler/job_task.hpp"
 #include "scheduler/node_queue_scheduler.hpp"
 #include "scheduler/operator_task.hpp"
+#include "scheduler/task_queue.hpp"
+#include "scheduler/worker.hpp"
 
 using namespace hyrise::expression_functional;  // NOLINT
 
@@ -177,6 +182,53 @@ TEST_F(SchedulerTest, Grouping) {
   EXPECT_EQ(output, expected_output);
 }
 
+TEST_F(SchedulerTest, GroupingByPreferredNode) {
+  // Tasks are only chained with tasks that prefer the same node. Otherwise, the successors would be executed on the
+  // node of the predecessor (see Worker::execute_next).
+  Hyrise::get().topology.use_fake_numa_topology(1, 1);
+  Hyrise::get().set_scheduler(std::make_shared<NodeQueueScheduler>());
+
+  auto tasks = std::vector<std::shared_ptr<AbstractTask>>{};
+
+  constexpr auto TASK_COUNT = 60;
+
+  for (auto task_id = 0; task_id < TASK_COUNT; ++task_id) {
+    tasks.emplace_back(std::make_shared<JobTask>([] {}));
+    tasks.back()->set_preferred_node_id(NodeID{static_cast<NodeID::base_type>(task_id % 3)});
+  }
+  Hyrise::get().scheduler()->schedule_and_wait_for_tasks(tasks);
+  Hyrise::get().scheduler()->finish();
+
+  auto chained_task_count = 0;
+  for (const auto& task : tasks) {
+    EXPECT_TRUE(task->is_done());
+    for (const auto& successor : task->successors()) {
+      EXPECT_EQ(successor->preferred_node_id(), task->preferred_node_id());
+      ++chained_task_count;
+    }
+  }
+
+  // Each node has 20 tasks in NUM_GROUPS chains.
+  EXPECT_EQ(chained_task_count, 3 * (20 - NodeQueueScheduler::NUM_GROUPS));
+}
+
+TEST_F(SchedulerTest, PreferredNodeOutOfRange) {
+  // If chunks were placed for a different topology, the preferred node might not exist anymore.
+  Hyrise::get().topology.use_fake_numa_topology(1, 1);
+  Hyrise::get().set_scheduler(std::make_shared<NodeQueueScheduler>());
+
+  auto task_done = std::atomic_bool{false};
+  auto task = std::make_shared<JobTask>([&task_done] { task_done = true; });
+  task->set_preferred_node_id(NodeID{17});
+  task->schedule();
+
+  Hyrise::get().scheduler()->wait_for_tasks(std::vector<std::shared_ptr<AbstractTask>>{task});
+  Hyrise::get().scheduler()->finish();
+
+  EXPECT_TRUE(task_done);
+  EXPECT_EQ(task->node_id(), NodeID{0});
+}
+
 TEST_F(SchedulerTest, MultipleDependenciesWithScheduler) {
   Hyrise::get().topology.use_fake_numa_topology(8, 4);
   Hyrise::get().set_scheduler(std::make_shared<NodeQueueScheduler>());
@@ -290,4 +342,61 @@ TEST_F(SchedulerTest, SingleWorkerGuaranteeProgress) {
   Hyrise::get().scheduler()->finish();
 }
 
+TEST_F(SchedulerTest, SpawnedTasksAreStolenFromLocalQueue) {
+  Hyrise::get().topology.use_fake_numa_topology(4, 2);
+  Hyrise::get().set_scheduler(std::make_shared<NodeQueueScheduler>());
+
+  constexpr auto SUBTASK_COUNT = size_t{64};
+  auto executing_threads = std::vector<std::thread::id>(SUBTASK_COUNT);
+
+  auto task = std::make_shared<JobTask>([&]() {
+    auto subtasks = std::vector<std::shared_ptr<AbstractTask>>{};
+    for (auto subtask_id = size_t{0}; subtask_id < SUBTASK_COUNT; ++subtask_id) {
+      subtasks.emplace_back(std::make_shared<JobTask>([&, subtask_id]() {
+        executing_threads[subtask_id] = std::this_thread::get_id();
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+      }));
+      subtasks.back()->schedule();
+    }
+
+    // The subtasks have been pushed to the local queue of the current worker, not to the node's queue.
+    const auto worker = Worker::get_this_thread_worker();
+    ASSERT_TRUE(worker);
+    EXPECT_TRUE(worker->queue()->empty());
+    Hyrise::get().scheduler()->wait_for_tasks(subtasks);
+  });
+
+  task->schedule();
+  Hyrise::get().scheduler()->wait_for_tasks(std::vector<std::shared_ptr<AbstractTask>>{task});
+
+  // Idle workers should have stolen some of the subtasks.
+  const auto distinct_threads = std::unordered_set<std::thread::id>(executing_threads.begin(), executing_threads.end());
+  EXPECT_GT(distinct_threads.size(), 1);
+
+  Hyrise::get().scheduler()->finish();
+}
+
+TEST_F(SchedulerTest, SchedulingLatencyHistogram) {
+  Hyrise::get().topology.use_default_topology(2);
+  const auto node_queue_scheduler = std::make_shared<NodeQueueScheduler>();
+  Hyrise::get().set_scheduler(node_queue_scheduler);
+
+  constexpr auto TASK_COUNT = size_t{100};
+  auto tasks = std::vector<std::shared_ptr<AbstractTask>>{};
+  for (auto task_id = size_t{0}; task_id < TASK_COUNT; ++task_id) {
+    tasks.emplace_back(std::make_shared<JobTask>([]() {}));
+  }
+  Hyrise::get().scheduler()->schedule_and_wait_for_tasks(tasks);
+  node_queue_scheduler->wait_for_all_tasks();
+
+  auto recorded_task_count = uint64_t{0};
+  for (const auto& worker : node_queue_scheduler->workers()) {
+    const auto histogram = worker->scheduling_latency_histogram();
+    recorded_task_count = std::accumulate(histogram.begin(), histogram.end(), recorded_task_count);
+  }
+  EXPECT_EQ(recorded_task_count, TASK_COUNT);
+
+  Hyrise::get().scheduler()->finish();
+}
+
 }  // namespace hyrise
@@ -67,6 +67,9 @@ TEST_F(PostgresProtocolHandlerTest, SendParameter) {
 
 TEST_F(PostgresProtocolHandlerTest, SendReadyForQuery) {
   _protocol_handler->send_ready_for_query();
+  // ReadyForQuery messages are not flushed so that the responses to pipelined statements can be sent together.
+  EXPECT_TRUE(_mocked_socket->empty());
+  _protocol_handler->force_flush();
   const std::string file_content = _mocked_socket->read();
 
   EXPECT_EQ(static_cast<PostgresMessageType>(file_content.front()), PostgresMessageType::ReadyForQuery);
@@ -249,6 +252,7 @@ TEST_F(PostgresProtocolHandlerTest, ReadBindPacket) {
   EXPECT_EQ(statement_information.portal, portal);
   EXPECT_EQ(statement_information.statement_name, statement_name);
   EXPECT_EQ(statement_information.parameters, std::vector<AllTypeVariant>{"test"});
+  EXPECT_EQ(statement_information.result_format_codes, std::vector<PostgresFormatCode>{PostgresFormatCode::Text});
 }
 
 TEST_F(PostgresProtocolHandlerTest, ReadExecutePacket) {
@@ -258,7 +262,20 @@ TEST_F(PostgresProtocolHandlerTest, ReadExecutePacket) {
   _mocked_socket->write(portal_name);
   _mocked_socket->write({'\0', '\0', '\0', '\0', '\0'});
 
-  EXPECT_EQ(_protocol_handler->read_execute_packet(), portal_name);
+  const auto [portal, row_limit] = _protocol_handler->read_execute_packet();
+  EXPECT_EQ(portal, portal_name);
+  EXPECT_EQ(row_limit, 0);
+}
+
+TEST_F(PostgresProtocolHandlerTest, ReadExecutePacketWithRowLimit) {
+  const std::string portal_name = "some_portal";
+  _mocked_socket->write(std::string{'\0', '\0', '\0', '\x14'});
+  _mocked_socket->write(portal_name);
+  _mocked_socket->write({'\0', '\0', '\0', '\x01', '\x02'});
+
+  const auto [portal, row_limit] = _protocol_handler->read_execute_packet();
+  EXPECT_EQ(portal, portal_name);
+  EXPECT_EQ(row_limit, 258);
 }
 
 TEST_F(PostgresProtocolHandlerTest, SendErrorMessage) {
@@ -2,6 +2,7 @@
 
 #include "operators/get_table.hpp"
 #include "server/query_handler.hpp"
+#include "sql/sql_plan_cache.hpp"
 
 namespace hyrise {
 
@@ -78,4 +79,55 @@ TEST_F(QueryHandlerTest, CorrectlyInvalidateStatements) {
   EXPECT_FALSE(Hyrise::get().storage_manager.has_prepared_plan(""));
 }
 
+TEST_F(QueryHandlerTest, NormalizeSql) {
+  EXPECT_EQ(QueryHandler::normalize_sql("  SELECT *\n  FROM   table_a\tWHERE a > ? ;  "),
+            "SELECT * FROM table_a WHERE a > ?");
+  EXPECT_EQ(QueryHandler::normalize_sql("SELECT 'a  b' FROM table_a;"), "SELECT 'a  b' FROM table_a");
+  EXPECT_EQ(QueryHandler::normalize_sql("SELECT \"a  b\"  FROM table_a"), "SELECT \"a  b\" FROM table_a");
+
+  // Comments end at the line break, so the second query selects a single column.
+  EXPECT_EQ(QueryHandler::normalize_sql("SELECT 1 -- x\n, 2"), "SELECT 1 , 2");
+  EXPECT_EQ(QueryHandler::normalize_sql("SELECT 1 -- x , 2"), "SELECT 1");
+  EXPECT_EQ(QueryHandler::normalize_sql("SELECT '--' FROM table_a -- ;"), "SELECT '--' FROM table_a");
+}
+
+TEST_F(QueryHandlerTest, SharePreparedPlans) {
+  Hyrise::get().default_prepared_plan_cache = std::make_shared<SQLPreparedPlanCache>();
+
+  QueryHandler::setup_prepared_plan("statement_1", "SELECT * FROM table_a WHERE a > ?");
+  QueryHandler::setup_prepared_plan("statement_2", "SELECT *  FROM table_a\nWHERE a > ?;");
+  QueryHandler::setup_prepared_plan("statement_3", "SELECT * FROM table_a WHERE b > ?");
+
+  const auto& storage_manager = Hyrise::get().storage_manager;
+  EXPECT_EQ(storage_manager.get_prepared_plan("statement_1"), storage_manager.get_prepared_plan("statement_2"));
+  EXPECT_NE(storage_manager.get_prepared_plan("statement_1"), storage_manager.get_prepared_plan("statement_3"));
+  EXPECT_EQ(Hyrise::get().default_prepared_plan_cache->size(), 2);
+}
+
+TEST_F(QueryHandlerTest, BindAndExecuteInserts) {
+  QueryHandler::setup_prepared_plan("insert_statement", "INSERT INTO table_a VALUES (?, ?)");
+  QueryHandler::setup_prepared_plan("select_statement", "SELECT * FROM table_a WHERE a > ?");
+
+  EXPECT_FALSE(QueryHandler::bind_insert_values(PreparedStatementDetails{"select_statement", "", {1}}));
+
+  const auto insert_row =
+      QueryHandler::bind_insert_values(PreparedStatementDetails{"insert_statement", "", {17, 4.5f}});
+  ASSERT_TRUE(insert_row);
+  EXPECT_EQ(insert_row->first, "table_a");
+  EXPECT_EQ(insert_row->second, (std::vector<AllTypeVariant>{int32_t{17}, 4.5f}));
+
+  const auto target_table = Hyrise::get().storage_manager.get_table("table_a");
+  const auto row_count = target_table->row_count();
+
+  const auto rows = std::make_shared<Table>(target_table->column_definitions(), TableType::Data);
+  rows->append(insert_row->second);
+  rows->append({int32_t{18}, 5.5f});
+
+  const auto transaction_context = Hyrise::get().transaction_manager.new_transaction_context(AutoCommit::No);
+  QueryHandler::execute_insert("table_a", rows, transaction_context);
+  transaction_context->commit();
+
+  EXPECT_EQ(target_table->row_count(), row_count + 2);
+}
+
 }  // namespace hyrise
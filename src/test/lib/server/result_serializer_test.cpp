@@ -1,3 +1,7 @@
+#include <optional>
+#include <string>
+#include <vector>
+
 #include "base_test.hpp"
 #include "mock_socket.hpp"
 
@@ -17,6 +21,41 @@ class ResultSerializerTest : public BaseTest {
         std::make_shared<PostgresProtocolHandler<boost::asio::posix::stream_descriptor>>(_mocked_socket->get_socket());
   }
 
+  // Returns a table with one row (1, 2.5, "abc") and one row (NULL, 0.1, "").
+  static std::shared_ptr<Table> create_small_table() {
+    const auto table = std::make_shared<Table>(TableColumnDefinitions{{"a", DataType::Int, true},
+                                                                      {"b", DataType::Double, false},
+                                                                      {"c", DataType::String, false}},
+                                               TableType::Data);
+    table->append({int32_t{1}, 2.5, pmr_string{"abc"}});
+    table->append({NullValue{}, 0.1, pmr_string{""}});
+    return table;
+  }
+
+  // Reads the values of the DataRow message that starts at the given position and moves the position to the next one.
+  static std::vector<std::optional<std::string>> read_data_row(const std::string& content, size_t& position) {
+    EXPECT_EQ(static_cast<PostgresMessageType>(content[position]), PostgresMessageType::DataRow);
+    const auto message_length = NetworkConversionHelper::get_message_length(content.cbegin() + position + 1);
+    const auto value_count = NetworkConversionHelper::get_small_int(content.cbegin() + position + 5);
+    const auto message_end = position + 1 + message_length;
+    position += 7;
+
+    auto values = std::vector<std::optional<std::string>>{};
+    for (auto value_id = uint16_t{0}; value_id < value_count; ++value_id) {
+      const auto value_length =
+          static_cast<int32_t>(NetworkConversionHelper::get_message_length(content.cbegin() + position));
+      position += sizeof(uint32_t);
+      if (value_length == -1) {
+        values.emplace_back(std::nullopt);
+        continue;
+      }
+      values.emplace_back(content.substr(position, value_length));
+      position += value_length;
+    }
+    EXPECT_EQ(position, message_end);
+    return values;
+  }
+
   std::shared_ptr<Table> _test_table;
   std::shared_ptr<MockSocket> _mocked_socket;
   std::shared_ptr<PostgresProtocolHandler<boost::asio::posix::stream_descriptor>> _protocol_handler;
@@ -43,6 +82,103 @@ TEST_F(ResultSerializerTest, QueryResponse) {
   EXPECT_EQ(std::count(file_content.begin(), file_content.end(), 'D'), _test_table->row_count());
 }
 
+TEST_F(ResultSerializerTest, TextQueryResponse) {
+  ResultSerializer::send_query_response(create_small_table(), _protocol_handler);
+  _protocol_handler->force_flush();
+  const auto file_content = _mocked_socket->read();
+
+  auto position = size_t{0};
+  EXPECT_EQ(read_data_row(file_content, position),
+            (std::vector<std::optional<std::string>>{"1", "2.5", "abc"}));
+  // Floating-point values are printed with as many digits as needed to restore them exactly.
+  EXPECT_EQ(read_data_row(file_content, position),
+            (std::vector<std::optional<std::string>>{std::nullopt, "0.10000000000000001", ""}));
+  EXPECT_EQ(position, file_content.size());
+}
+
+TEST_F(ResultSerializerTest, BinaryQueryResponse) {
+  const auto table = create_small_table();
+  ResultSerializer::send_query_response(table, _protocol_handler, {PostgresFormatCode::Binary});
+  _protocol_handler->force_flush();
+  const auto file_content = _mocked_socket->read();
+
+  auto position = size_t{0};
+  const auto first_row = read_data_row(file_content, position);
+  ASSERT_EQ(first_row.size(), 3);
+  EXPECT_EQ(first_row[0], (std::string{'\0', '\0', '\0', '\x01'}));
+  // 2.5 as big-endian IEEE 754 double
+  EXPECT_EQ(first_row[1], (std::string{'\x40', '\x04', '\0', '\0', '\0', '\0', '\0', '\0'}));
+  EXPECT_EQ(first_row[2], "abc");
+
+  const auto second_row = read_data_row(file_content, position);
+  ASSERT_EQ(second_row.size(), 3);
+  EXPECT_EQ(second_row[0], std::nullopt);
+  EXPECT_EQ(second_row[1]->size(), sizeof(double));
+  EXPECT_EQ(second_row[2], "");
+  EXPECT_EQ(position, file_content.size());
+}
+
+TEST_F(ResultSerializerTest, LargeQueryResponse) {
+  // The result is larger than a batch of DataRow messages and than the WriteBuffer.
+  const auto table = std::make_shared<Table>(TableColumnDefinitions{{"a", DataType::String, false}}, TableType::Data,
+                                             ChunkOffset{100});
+  const auto value = pmr_string(1'000, 'x');
+  const auto row_count = ResultSerializer::DATA_ROW_BATCH_SIZE / value.size() + 10;
+  for (auto row_id = size_t{0}; row_id < row_count; ++row_id) {
+    table->append({value});
+  }
+
+  ResultSerializer::send_query_response(table, _protocol_handler);
+  _protocol_handler->force_flush();
+  const auto file_content = _mocked_socket->read();
+
+  auto position = size_t{0};
+  for (auto row_id = size_t{0}; row_id < row_count; ++row_id) {
+    ASSERT_EQ(read_data_row(file_content, position), std::vector<std::optional<std::string>>{std::string(value)});
+  }
+  EXPECT_EQ(position, file_content.size());
+}
+
+TEST_F(ResultSerializerTest, QueryResponseWithRowLimit) {
+  // _test_table has chunks of two rows. Fetch the rows in parts of three.
+  const auto row_count = _test_table->row_count();
+  auto position = RowID{ChunkID{0}, ChunkOffset{0}};
+  auto sent_row_count = uint64_t{0};
+
+  EXPECT_EQ(ResultSerializer::send_query_response_rows(_test_table, _protocol_handler, {}, position, 3), 3);
+  EXPECT_EQ(position, (RowID{ChunkID{1}, ChunkOffset{1}}));
+  sent_row_count += 3;
+
+  while (position.chunk_id < _test_table->chunk_count()) {
+    const auto part_row_count =
+        ResultSerializer::send_query_response_rows(_test_table, _protocol_handler, {}, position, 3);
+    EXPECT_EQ(part_row_count, std::min(uint64_t{3}, row_count - sent_row_count));
+    sent_row_count += part_row_count;
+  }
+  EXPECT_EQ(sent_row_count, row_count);
+  EXPECT_EQ(position, (RowID{_test_table->chunk_count(), ChunkOffset{0}}));
+
+  // Sending all rows at once results in the same messages.
+  _protocol_handler->force_flush();
+  const auto partial_content = _mocked_socket->read();
+  ResultSerializer::send_query_response(_test_table, _protocol_handler);
+  _protocol_handler->force_flush();
+  const auto file_content = _mocked_socket->read();
+  EXPECT_EQ(file_content.substr(partial_content.size()), partial_content);
+}
+
+TEST_F(ResultSerializerTest, FormatCodes) {
+  const auto column_count = ColumnCount{2};
+  EXPECT_EQ(ResultSerializer::format_code({}, ColumnID{1}, column_count), PostgresFormatCode::Text);
+  EXPECT_EQ(ResultSerializer::format_code({PostgresFormatCode::Binary}, ColumnID{1}, column_count),
+            PostgresFormatCode::Binary);
+
+  const auto format_codes = std::vector<PostgresFormatCode>{PostgresFormatCode::Binary, PostgresFormatCode::Text};
+  EXPECT_EQ(ResultSerializer::format_code(format_codes, ColumnID{0}, column_count), PostgresFormatCode::Binary);
+  EXPECT_EQ(ResultSerializer::format_code(format_codes, ColumnID{1}, column_count), PostgresFormatCode::Text);
+  EXPECT_THROW(ResultSerializer::format_code(format_codes, ColumnID{0}, ColumnCount{3}), InvalidInputException);
+}
+
 TEST_F(ResultSerializerTest, CommandCompleteMessage) {
   EXPECT_EQ(ResultSerializer::build_command_complete_message(OperatorType::Insert, 1), "INSERT 0 1");
   EXPECT_EQ(ResultSerializer::build_command_complete_message(OperatorType::Update, 1), "UPDATE -1");
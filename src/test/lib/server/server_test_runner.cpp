@@ -1,7 +1,12 @@
 #include <pqxx/pqxx>
 
+#include <netinet/in.h>
+
+#include <array>
+#include <cstring>
 #include <fstream>
 #include <future>
+#include <optional>
 #include <thread>
 
 #include "base_test.hpp"
@@ -53,6 +58,52 @@ class ServerTestRunner : public BaseTest {
     std::remove((_export_filename + ".csv.json").c_str());
   }
 
+  // Opens a connection that speaks the PostgreSQL protocol directly, so that tests control exactly which messages are
+  // sent and when responses are read. The startup packet (protocol version 3.0, user "x") is sent right away.
+  std::unique_ptr<boost::asio::ip::tcp::socket> _connect_raw_client(boost::asio::io_service& io_service) {
+    auto socket = std::make_unique<boost::asio::ip::tcp::socket>(io_service);
+    socket->connect({boost::asio::ip::address_v4::loopback(), _server->server_port()});
+
+    auto startup_packet = std::string{};
+    _append_int32(startup_packet, 196608);
+    startup_packet += std::string{"user\0x\0\0", 8};
+    _send_message(*socket, std::nullopt, startup_packet);
+    return socket;
+  }
+
+  static void _append_int16(std::string& body, const uint16_t value) {
+    const auto network_value = htons(value);
+    body.append(reinterpret_cast<const char*>(&network_value), sizeof(network_value));
+  }
+
+  static void _append_int32(std::string& body, const uint32_t value) {
+    const auto network_value = htonl(value);
+    body.append(reinterpret_cast<const char*>(&network_value), sizeof(network_value));
+  }
+
+  // Sends a message with the given type and body. Only the startup packet has no message type.
+  static void _send_message(boost::asio::ip::tcp::socket& socket, const std::optional<char> message_type,
+                            const std::string& body) {
+    auto message = std::string{};
+    if (message_type) {
+      message += *message_type;
+    }
+    _append_int32(message, static_cast<uint32_t>(sizeof(uint32_t) + body.size()));
+    message += body;
+    boost::asio::write(socket, boost::asio::buffer(message));
+  }
+
+  // Reads the next message and returns its type. Its body is skipped.
+  static char _receive_message_type(boost::asio::ip::tcp::socket& socket) {
+    auto header = std::array<char, 1 + sizeof(uint32_t)>{};
+    boost::asio::read(socket, boost::asio::buffer(header));
+    auto network_length = uint32_t{};
+    std::memcpy(&network_length, &header[1], sizeof(network_length));
+    auto body = std::vector<char>(ntohl(network_length) - sizeof(uint32_t));
+    boost::asio::read(socket, boost::asio::buffer(body));
+    return header[0];
+  }
+
   std::unique_ptr<Server> _server = std::make_unique<Server>(
       boost::asio::ip::address(), 0, SendExecutionInfo::No);  // Port 0 to select random open port
   std::unique_ptr<std::thread> _server_thread;
@@ -287,6 +338,100 @@ TEST_F(ServerTestRunner, TestMultipleConnections) {
   EXPECT_EQ(result3.size(), expected_num_rows);
 }
 
+TEST_F(ServerTestRunner, TestManyIdleConnections) {
+  // Idle sessions do not occupy a thread. Thus, there can be many more open connections than I/O threads and workers.
+  const auto connection_count = size_t{64};
+  auto connections = std::vector<std::unique_ptr<pqxx::connection>>{};
+  for (auto connection_id = size_t{0}; connection_id < connection_count; ++connection_id) {
+    connections.emplace_back(std::make_unique<pqxx::connection>(_connection_string));
+  }
+
+  const auto expected_num_rows = _table_a->row_count();
+  for (auto round = 0; round < 2; ++round) {
+    for (auto& connection : connections) {
+      pqxx::nontransaction transaction{*connection};
+      const auto result = transaction.exec("SELECT * FROM table_a;");
+      EXPECT_EQ(result.size(), expected_num_rows);
+    }
+  }
+}
+
+TEST_F(ServerTestRunner, TestClientThatDoesNotReadDoesNotBlockOthers) {
+  pqxx::connection insert_connection{_connection_string};
+  pqxx::nontransaction insert_transaction{insert_connection};
+  for (auto i = 0; i < 8; ++i) {
+    insert_transaction.exec("INSERT INTO table_a SELECT * FROM table_a;");
+  }
+
+  // Open more clients than there are I/O threads. Each requests a result of several MB but never reads it, so the
+  // server's socket writes to these clients cannot complete.
+  const auto big_query = std::string{"SELECT * FROM table_a t1, table_a t2"};
+  auto io_service = boost::asio::io_service{};
+  auto stalled_sockets = std::vector<std::unique_ptr<boost::asio::ip::tcp::socket>>{};
+  for (auto client_id = uint32_t{0}; client_id <= Server::IO_THREAD_COUNT; ++client_id) {
+    auto& socket = stalled_sockets.emplace_back(_connect_raw_client(io_service));
+    _send_message(*socket, 'Q', big_query + '\0');
+  }
+
+  // Give the server time to execute the queries and to fill the socket buffers of the stalled clients.
+  std::this_thread::sleep_for(std::chrono::milliseconds(500));
+
+  auto result = std::async(std::launch::async, [&] {
+    pqxx::connection connection{_connection_string};
+    pqxx::nontransaction transaction{connection};
+    return transaction.exec("SELECT * FROM table_a WHERE a = 12345;").size();
+  });
+  ASSERT_EQ(result.wait_for(std::chrono::seconds(10)), std::future_status::ready);
+  EXPECT_EQ(result.get(), size_t{256});
+
+  for (auto& socket : stalled_sockets) {
+    socket->close();
+  }
+}
+
+TEST_F(ServerTestRunner, TestCoalescedInsertsAreAcknowledgedAfterInsertion) {
+  auto io_service = boost::asio::io_service{};
+  const auto socket = _connect_raw_client(io_service);
+
+  auto parse_body = std::string{"\0INSERT INTO table_a VALUES (?, 1.0)\0", 37};
+  _append_int16(parse_body, 0);
+  _send_message(*socket, 'P', parse_body);
+
+  // Execute the statement three times without a Sync message in between. The rows are collected and inserted at once
+  // when the Flush message asks for the pending responses.
+  const auto initial_row_count = _table_a->row_count();
+  const auto insert_count = size_t{3};
+  for (auto insert_id = size_t{0}; insert_id < insert_count; ++insert_id) {
+    const auto value = std::to_string(100 + insert_id);
+    auto bind_body = std::string{"\0\0", 2};
+    _append_int16(bind_body, 0);
+    _append_int16(bind_body, 1);
+    _append_int32(bind_body, static_cast<uint32_t>(value.size()));
+    bind_body += value;
+    _append_int16(bind_body, 0);
+    _send_message(*socket, 'B', bind_body);
+
+    auto execute_body = std::string{"\0", 1};
+    _append_int32(execute_body, 0);
+    _send_message(*socket, 'E', execute_body);
+  }
+  _send_message(*socket, 'H', "");
+
+  // Once a row is acknowledged with CommandComplete, it must be part of the table.
+  auto acknowledged_insert_count = size_t{0};
+  while (acknowledged_insert_count < insert_count) {
+    if (_receive_message_type(*socket) == 'C') {
+      ++acknowledged_insert_count;
+      EXPECT_EQ(_table_a->row_count(), initial_row_count + insert_count);
+    }
+  }
+
+  // Commit the transaction and end the session.
+  _send_message(*socket, 'S', "");
+  while (_receive_message_type(*socket) != 'Z') {}
+  _send_message(*socket, 'X', "");
+}
+
 TEST_F(ServerTestRunner, TestSimpleInsertSelect) {
   pqxx::connection connection{_connection_string};
   pqxx::nontransaction transaction{connection};
@@ -74,4 +74,21 @@ TEST_F(WriteBufferTest, WriteLargeString) {
   EXPECT_EQ(_mocked_socket->read(), original_content);
 }
 
+TEST_F(WriteBufferTest, WriteBytes) {
+  _write_buffer->put_string("some", HasNullTerminator::No);
+  const auto bytes = std::vector<char>{'b', 'y', 't', 'e', 's'};
+  _write_buffer->put_bytes(bytes.data(), bytes.size());
+  _write_buffer->flush();
+  EXPECT_EQ(_mocked_socket->read(), "somebytes");
+}
+
+TEST_F(WriteBufferTest, WriteLargeBytes) {
+  _write_buffer->put_string("some", HasNullTerminator::No);
+  // Blocks larger than the buffer are written directly, after the buffered data.
+  const auto bytes = std::vector<char>(SERVER_BUFFER_SIZE * 3, 'a');
+  _write_buffer->put_bytes(bytes.data(), bytes.size());
+  EXPECT_EQ(_write_buffer->size(), 0);
+  EXPECT_EQ(_mocked_socket->read(), "some" + std::string(bytes.begin(), bytes.end()));
+}
+
 }  // namespace hyrise
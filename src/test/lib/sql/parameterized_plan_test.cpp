@@ -0,0 +1,173 @@
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "base_test.hpp"
+
+#include "hyrise.hpp"
+#include "operators/abstract_operator.hpp"
+#include "operators/get_table.hpp"
+#include "operators/pqp_utils.hpp"
+#include "optimizer/optimizer.hpp"
+#include "scheduler/operator_task.hpp"
+#include "sql/parameterized_plan.hpp"
+#include "sql/sql_pipeline_builder.hpp"
+#include "storage/prepared_plan.hpp"
+#include "storage/table.hpp"
+
+namespace hyrise {
+
+class ParameterizedPlanTest : public BaseTest {
+ protected:
+  void SetUp() override {
+    // Column a holds the values 0 to 99.
+    const auto column_definitions = TableColumnDefinitions{{"a", DataType::Int, false}, {"b", DataType::Int, false}};
+    _table = std::make_shared<Table>(column_definitions, TableType::Data, ChunkOffset{10}, UseMvcc::Yes);
+    for (auto value = int32_t{0}; value < 100; ++value) {
+      _table->append({value, value % 10});
+    }
+    // Only immutable chunks have pruning statistics.
+    _table->last_chunk()->finalize();
+    Hyrise::get().storage_manager.add_table("table_a", _table);
+  }
+
+  std::shared_ptr<PreparedPlan> prepare(const std::string& sql) {
+    const auto extracted_literals = ParameterizedPlan::extract_literals(sql);
+    EXPECT_TRUE(extracted_literals);
+    auto pipeline = SQLPipelineBuilder{sql}.disable_mvcc().create_pipeline();
+    const auto& lqp = pipeline.get_unoptimized_logical_plans().at(0);
+    return ParameterizedPlan::prepare(*extracted_literals, lqp, UseMvcc::No);
+  }
+
+  static std::shared_ptr<const Table> execute(const std::shared_ptr<AbstractOperator>& pqp) {
+    const auto& [tasks, root_operator_task] = OperatorTask::make_tasks_from_operator(pqp);
+    Hyrise::get().scheduler()->schedule_and_wait_for_tasks(tasks);
+    return root_operator_task->get_operator()->get_output();
+  }
+
+  static std::vector<std::shared_ptr<const AbstractOperator>> find_operators(
+      const std::shared_ptr<AbstractOperator>& pqp, const OperatorType type) {
+    auto operators = std::vector<std::shared_ptr<const AbstractOperator>>{};
+    visit_pqp(pqp, [&](const auto& op) {
+      if (op->type() == type) {
+        operators.emplace_back(op);
+      }
+      return PQPVisitation::VisitInputs;
+    });
+    return operators;
+  }
+
+  std::shared_ptr<Table> _table;
+};
+
+TEST_F(ParameterizedPlanTest, ExtractLiterals) {
+  const auto extracted_literals = ParameterizedPlan::extract_literals(
+      "  SELECT a, 'x''y' AS \"col 1\"\n FROM  table_1 WHERE b > 1.5 AND c = 3000000000 OR d = 17;  ");
+  ASSERT_TRUE(extracted_literals);
+  EXPECT_EQ(extracted_literals->normalized_sql,
+            "SELECT a, ? AS \"col 1\" FROM table_1 WHERE b > ? AND c = ? OR d = ?");
+  EXPECT_EQ(extracted_literals->literals,
+            (std::vector<AllTypeVariant>{pmr_string{"x'y"}, double{1.5}, int64_t{3'000'000'000}, int32_t{17}}));
+
+  // Statements other than SELECT, prepared statements, and statements without literals are not parameterized.
+  EXPECT_FALSE(ParameterizedPlan::extract_literals("INSERT INTO table_a VALUES (1, 2)"));
+  EXPECT_FALSE(ParameterizedPlan::extract_literals("SELECT * FROM table_a WHERE a = ?"));
+  EXPECT_FALSE(ParameterizedPlan::extract_literals("SELECT * FROM table_a"));
+  EXPECT_FALSE(ParameterizedPlan::extract_literals("SELECT * FROM table_a WHERE a = 'unterminated"));
+}
+
+TEST_F(ParameterizedPlanTest, CacheKey) {
+  const auto key = [](const std::string& sql, const UseMvcc use_mvcc) {
+    return ParameterizedPlan::cache_key(*ParameterizedPlan::extract_literals(sql), use_mvcc);
+  };
+
+  EXPECT_EQ(key("SELECT * FROM table_a WHERE a = 1", UseMvcc::Yes),
+            key("SELECT * FROM table_a WHERE a = 2", UseMvcc::Yes));
+  EXPECT_NE(key("SELECT * FROM table_a WHERE a = 1", UseMvcc::Yes),
+            key("SELECT * FROM table_a WHERE a = 1", UseMvcc::No));
+  EXPECT_NE(key("SELECT * FROM table_a WHERE a = 1", UseMvcc::Yes),
+            key("SELECT * FROM table_a WHERE a = 1.0", UseMvcc::Yes));
+}
+
+TEST_F(ParameterizedPlanTest, Prepare) {
+  const auto prepared_plan = prepare("SELECT * FROM table_a WHERE a < 10 AND b = 3");
+  ASSERT_TRUE(prepared_plan);
+  EXPECT_EQ(prepared_plan->parameter_ids.size(), 2);
+
+  // Tables with indexes can be parameterized as well. ParameterizedPlan::bind() chooses IndexScans for the literals.
+  _table->create_primary_key_index({ColumnID{0}});
+  EXPECT_TRUE(prepare("SELECT * FROM table_a WHERE a < 10 AND b = 3"));
+}
+
+TEST_F(ParameterizedPlanTest, ValidityRangeAndBind) {
+  const auto prepared_plan = prepare("SELECT * FROM table_a WHERE a < 20");
+  ASSERT_TRUE(prepared_plan);
+
+  const auto parameterized_plan = ParameterizedPlan::create(prepared_plan, {int32_t{20}},
+                                                            Optimizer::create_default_optimizer());
+  ASSERT_EQ(parameterized_plan->validity_ranges().size(), 1);
+  EXPECT_TRUE(parameterized_plan->is_valid_for({int32_t{20}}));
+  EXPECT_TRUE(parameterized_plan->is_valid_for({int32_t{25}}));
+  EXPECT_FALSE(parameterized_plan->is_valid_for({int32_t{90}}));
+  EXPECT_FALSE(parameterized_plan->is_valid_for({int32_t{0}}));
+
+  // Binding copies the plan. It can be executed for values outside of the validity range, too.
+  EXPECT_EQ(execute(parameterized_plan->bind({int32_t{25}}))->row_count(), 25);
+  EXPECT_EQ(execute(parameterized_plan->bind({int32_t{90}}))->row_count(), 90);
+  EXPECT_EQ(execute(parameterized_plan->bind({int32_t{20}}))->row_count(), 20);
+}
+
+TEST_F(ParameterizedPlanTest, BindPrunesChunksAndUsesIndexes) {
+  const auto prepared_plan = prepare("SELECT * FROM table_a WHERE a = 25");
+  ASSERT_TRUE(prepared_plan);
+  const auto parameterized_plan = ParameterizedPlan::create(prepared_plan, {int32_t{25}},
+                                                            Optimizer::create_default_optimizer());
+
+  // The cached plan is optimized without the values. Binding them prunes all chunks but the one that contains 25.
+  const auto pruned_chunk_count = [&](const int32_t value) {
+    const auto get_tables = find_operators(parameterized_plan->bind({value}), OperatorType::GetTable);
+    EXPECT_EQ(get_tables.size(), 1);
+    return std::static_pointer_cast<const GetTable>(get_tables.front())->pruned_chunk_ids().size();
+  };
+  EXPECT_EQ(pruned_chunk_count(25), 9);
+  EXPECT_EQ(pruned_chunk_count(-1), 10);
+
+  // With a primary key index, the key is looked up for every value.
+  _table->create_primary_key_index({ColumnID{0}});
+  const auto pqp = parameterized_plan->bind({int32_t{42}});
+  EXPECT_EQ(find_operators(pqp, OperatorType::IndexScan).size(), 1);
+  EXPECT_EQ(execute(pqp)->row_count(), 1);
+}
+
+TEST_F(ParameterizedPlanTest, SQLPipeline) {
+  const auto cache = std::make_shared<SQLParameterizedPlanCache>();
+  const auto pqp_cache = std::make_shared<SQLPhysicalPlanCache>();
+
+  const auto execute_query = [&](const std::string& sql, const size_t expected_row_count) {
+    auto pipeline =
+        SQLPipelineBuilder{sql}.with_pqp_cache(pqp_cache).with_parameterized_plan_cache(cache).create_pipeline();
+    const auto [pipeline_status, result_table] = pipeline.get_result_table();
+    EXPECT_EQ(pipeline_status, SQLPipelineStatus::Success);
+    EXPECT_EQ(result_table->row_count(), expected_row_count);
+    return pipeline.metrics().statement_metrics.at(0)->query_plan_cache_hit;
+  };
+
+  EXPECT_FALSE(execute_query("SELECT * FROM table_a WHERE a < 20", 20));
+  EXPECT_TRUE(execute_query("SELECT * FROM table_a  WHERE a < 25;", 25));
+  EXPECT_EQ(cache->size(), 1);
+
+  // The estimated cardinality is outside of the validity range. The statement is optimized again.
+  EXPECT_FALSE(execute_query("SELECT * FROM table_a WHERE a < 90", 90));
+  EXPECT_TRUE(execute_query("SELECT * FROM table_a WHERE a < 80", 80));
+  EXPECT_EQ(cache->size(), 1);
+
+  // The plan for the first statement is kept as well.
+  EXPECT_TRUE(execute_query("SELECT * FROM table_a WHERE a < 20", 20));
+
+  // Parameterized statements are not cached by their SQL string.
+  EXPECT_EQ(pqp_cache->size(), 0);
+  EXPECT_FALSE(execute_query("SELECT * FROM table_a", 100));
+  EXPECT_EQ(pqp_cache->size(), 1);
+}
+
+}  // namespace hyrise
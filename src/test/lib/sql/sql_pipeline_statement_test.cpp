@@ -14,6 +14,8 @@
 #include "operators/validate.hpp"
 #include "scheduler/job_task.hpp"
 #include "scheduler/node_queue_scheduler.hpp"
+#include "scheduler/resource_group.hpp"
+#include "scheduler/task_context.hpp"
 #include "sql/sql_pipeline_builder.hpp"
 #include "sql/sql_pipeline_statement.hpp"
 #include "sql/sql_plan_cache.hpp"
@@ -753,4 +755,32 @@ TEST_F(SQLPipelineStatementTest, SQLTranslationInfo) {
   }
 }
 
+TEST_F(SQLPipelineStatementTest, TaskContext) {
+  // Without an explicit resource group, each statement gets its own group.
+  {
+    auto sql_pipeline = SQLPipelineBuilder{_multi_statement_query}.create_pipeline();
+    const auto& statements = get_sql_pipeline_statements(sql_pipeline);
+    const auto& first_task_context = statements.at(0)->task_context();
+    const auto& second_task_context = statements.at(1)->task_context();
+    ASSERT_TRUE(first_task_context && second_task_context);
+    EXPECT_NE(first_task_context->query_id(), second_task_context->query_id());
+    EXPECT_NE(first_task_context->resource_group(), second_task_context->resource_group());
+    EXPECT_FALSE(first_task_context->session_id());
+  }
+
+  {
+    const auto resource_group = std::make_shared<ResourceGroup>("analytics", 2, 4);
+    auto sql_pipeline =
+        SQLPipelineBuilder{_join_query}.with_resource_group(resource_group).with_session_id(17).create_pipeline();
+    const auto statement = get_sql_pipeline_statements(sql_pipeline).at(0);
+    const auto& task_context = statement->task_context();
+    EXPECT_EQ(task_context->resource_group(), resource_group);
+    EXPECT_EQ(task_context->session_id(), 17);
+
+    for (const auto& task : statement->get_tasks()) {
+      EXPECT_EQ(task->task_context(), task_context);
+    }
+  }
+}
+
 }  // namespace hyrise
@@ -1,4 +1,5 @@
 #include <memory>
+#include <sstream>
 #include <string>
 #include <utility>
 
@@ -512,6 +513,22 @@ TEST_F(SQLPipelineTest, GetTimes) {
   EXPECT_GT(statement_metrics->plan_execution_duration, zero_duration);
 }
 
+TEST_F(SQLPipelineTest, OptimizerRuleDurations) {
+  auto sql_pipeline = SQLPipelineBuilder{_join_query}.create_pipeline();
+  sql_pipeline.get_result_table();
+
+  const auto& metrics = sql_pipeline.metrics();
+  const auto rule_durations = metrics.optimizer_rule_durations();
+  EXPECT_TRUE(rule_durations.contains("JoinOrderingRule"));
+  // The PredicatePlacementRule is part of the optimizer twice, but summed up.
+  EXPECT_TRUE(rule_durations.contains("PredicatePlacementRule"));
+  EXPECT_LT(rule_durations.size(), metrics.statement_metrics[0]->optimizer_rule_durations.size());
+
+  auto stream = std::stringstream{};
+  stream << metrics;
+  EXPECT_TRUE(stream.str().find("(slowest rule: ") != std::string::npos);
+}
+
 TEST_F(SQLPipelineTest, RequiresExecutionVariations) {
   EXPECT_FALSE(SQLPipelineBuilder{_select_query_a}.create_pipeline().requires_execution());
   EXPECT_FALSE(SQLPipelineBuilder{_join_query}.create_pipeline().requires_execution());
@@ -35,7 +35,7 @@ class QueryPlanCacheTest : public BaseTest {
   }
 
   size_t query_frequency(const std::string& key) const {
-    return (*(cache->_map.find(key)->second)).frequency;
+    return *cache->snapshot().at(key).frequency;
   }
 
   const std::string Q1 = "SELECT * FROM table_a;";
@@ -0,0 +1,199 @@
+#include <memory>
+#include <string>
+
+#include "base_test.hpp"
+
+#include "expression/expression_functional.hpp"
+#include "hyrise.hpp"
+#include "logical_query_plan/aggregate_node.hpp"
+#include "logical_query_plan/join_node.hpp"
+#include "logical_query_plan/mock_node.hpp"
+#include "logical_query_plan/predicate_node.hpp"
+#include "logical_query_plan/stored_table_node.hpp"
+#include "operators/abstract_operator.hpp"
+#include "operators/pqp_utils.hpp"
+#include "sql/sql_pipeline_builder.hpp"
+#include "sql/sql_plan_cache.hpp"
+#include "sql/sql_result_cache.hpp"
+#include "storage/table.hpp"
+
+namespace hyrise {
+
+using namespace expression_functional;  // NOLINT(build/namespaces)
+
+class SQLResultCacheTest : public BaseTest {
+ protected:
+  void SetUp() override {
+    const auto column_definitions = TableColumnDefinitions{{"a", DataType::Int, false}, {"b", DataType::Int, false}};
+    _table = std::make_shared<Table>(column_definitions, TableType::Data, ChunkOffset{10}, UseMvcc::Yes);
+    for (auto value = int32_t{0}; value < 100; ++value) {
+      _table->append({value, value % 10});
+    }
+    Hyrise::get().storage_manager.add_table("table_a", _table);
+
+    _cache = std::make_shared<SQLResultCache>();
+  }
+
+  // Returns the number of result rows and of the operators that were replaced by cached results.
+  std::pair<size_t, size_t> execute(const std::string& sql,
+                                    const std::shared_ptr<TransactionContext>& transaction_context = nullptr) {
+    auto builder = SQLPipelineBuilder{sql}.with_result_cache(_cache);
+    if (transaction_context) {
+      builder.with_transaction_context(transaction_context);
+    }
+
+    auto pipeline = builder.create_pipeline();
+    const auto [pipeline_status, result_table] = pipeline.get_result_table();
+    EXPECT_EQ(pipeline_status, SQLPipelineStatus::Success);
+    const auto result_row_count = result_table ? result_table->row_count() : size_t{0};
+    return {result_row_count, pipeline.metrics().statement_metrics.at(0)->result_cache_hit_count};
+  }
+
+  const std::string _query = "SELECT b, SUM(a) FROM table_a WHERE a < 50 GROUP BY b";
+
+  std::shared_ptr<Table> _table;
+  std::shared_ptr<SQLResultCache> _cache;
+};
+
+TEST_F(SQLResultCacheTest, IsCacheable) {
+  const auto stored_table_node = StoredTableNode::make("table_a");
+  const auto a = stored_table_node->get_column("a");
+  const auto b = stored_table_node->get_column("b");
+
+  EXPECT_TRUE(SQLResultCache::is_cacheable(AggregateNode::make(expression_vector(b), expression_vector(sum_(a)),
+                                                               PredicateNode::make(less_than_(a, 50),
+                                                                                   stored_table_node))));
+  EXPECT_TRUE(SQLResultCache::is_cacheable(JoinNode::make(JoinMode::Inner, equals_(a, b), stored_table_node,
+                                                          stored_table_node)));
+
+  // Scans are not worth caching.
+  EXPECT_FALSE(SQLResultCache::is_cacheable(PredicateNode::make(less_than_(a, 50), stored_table_node)));
+  EXPECT_FALSE(SQLResultCache::is_cacheable(nullptr));
+
+  // Placeholders have different values in each execution.
+  EXPECT_FALSE(SQLResultCache::is_cacheable(AggregateNode::make(
+      expression_vector(b), expression_vector(sum_(a)),
+      PredicateNode::make(less_than_(a, placeholder_(ParameterID{0})), stored_table_node))));
+
+  // The data of MockNodes is unknown.
+  const auto mock_node = MockNode::make(MockNode::ColumnDefinitions{{DataType::Int, "x"}});
+  EXPECT_FALSE(SQLResultCache::is_cacheable(
+      AggregateNode::make(expression_vector(mock_node->get_column("x")), expression_vector(), mock_node)));
+}
+
+TEST_F(SQLResultCacheTest, ReuseResults) {
+  EXPECT_EQ(execute(_query), std::make_pair(size_t{10}, size_t{0}));
+  EXPECT_EQ(_cache->size(), 1);
+
+  EXPECT_EQ(execute(_query), std::make_pair(size_t{10}, size_t{1}));
+  EXPECT_EQ(execute("SELECT b, SUM(a)  FROM table_a WHERE a < 50 GROUP BY b;"),
+            std::make_pair(size_t{10}, size_t{1}));
+  EXPECT_EQ(_cache->size(), 1);
+
+  // Different predicates lead to different subplans.
+  EXPECT_EQ(execute("SELECT b, SUM(a) FROM table_a WHERE a < 5 GROUP BY b"), std::make_pair(size_t{5}, size_t{0}));
+  EXPECT_EQ(_cache->size(), 2);
+
+  // Queries without joins or aggregates are not cached.
+  EXPECT_EQ(execute("SELECT * FROM table_a WHERE a < 50"), std::make_pair(size_t{50}, size_t{0}));
+  EXPECT_EQ(_cache->size(), 2);
+
+  // Without MVCC, the cache is not used.
+  auto pipeline = SQLPipelineBuilder{_query}.with_result_cache(_cache).disable_mvcc().create_pipeline();
+  EXPECT_EQ(pipeline.get_result_table().second->row_count(), 10);
+  EXPECT_EQ(pipeline.metrics().statement_metrics.at(0)->result_cache_hit_count, 0);
+}
+
+TEST_F(SQLResultCacheTest, ReuseResultsWithPlanCaches) {
+  // Cached plans are deep copies of the PQP. They must keep the LQP nodes that the result cache is looked up with.
+  const auto pqp_cache = std::make_shared<SQLPhysicalPlanCache>();
+  const auto parameterized_plan_cache = std::make_shared<SQLParameterizedPlanCache>();
+  const auto execute_with_plan_caches = [&](const std::string& sql) {
+    auto pipeline = SQLPipelineBuilder{sql}
+                        .with_pqp_cache(pqp_cache)
+                        .with_parameterized_plan_cache(parameterized_plan_cache)
+                        .with_result_cache(_cache)
+                        .create_pipeline();
+    const auto [pipeline_status, result_table] = pipeline.get_result_table();
+    EXPECT_EQ(pipeline_status, SQLPipelineStatus::Success);
+    return std::make_pair(result_table->row_count(),
+                          pipeline.metrics().statement_metrics.at(0)->result_cache_hit_count);
+  };
+
+  EXPECT_EQ(execute_with_plan_caches(_query), std::make_pair(size_t{10}, size_t{0}));
+  EXPECT_EQ(execute_with_plan_caches(_query), std::make_pair(size_t{10}, size_t{1}));
+  EXPECT_EQ(execute_with_plan_caches(_query), std::make_pair(size_t{10}, size_t{1}));
+
+  // The parameterized plan is bound to other literals. Their results are cached separately.
+  EXPECT_EQ(execute_with_plan_caches("SELECT b, SUM(a) FROM table_a WHERE a < 5 GROUP BY b"),
+            std::make_pair(size_t{5}, size_t{0}));
+  EXPECT_EQ(execute_with_plan_caches("SELECT b, SUM(a) FROM table_a WHERE a < 5 GROUP BY b"),
+            std::make_pair(size_t{5}, size_t{1}));
+  EXPECT_EQ(_cache->size(), 2);
+}
+
+TEST_F(SQLResultCacheTest, KeepResultsOnlyWhenExecuted) {
+  // The aggregate is a result cache candidate below the root of the PQP.
+  const auto sql = std::string{"SELECT * FROM (SELECT b, SUM(a) AS s FROM table_a WHERE a < 50 GROUP BY b) AS t "
+                                "WHERE s > 120"};
+  auto pipeline = SQLPipelineBuilder{sql}.with_result_cache(_cache).create_pipeline();
+  pipeline.get_tasks();
+
+  auto aggregate = std::shared_ptr<AbstractOperator>{};
+  visit_pqp(pipeline.get_physical_plans().at(0), [&](const auto& op) {
+    if (op->type() == OperatorType::Aggregate) {
+      aggregate = op;
+    }
+    return PQPVisitation::VisitInputs;
+  });
+  ASSERT_TRUE(aggregate);
+
+  // The statement only registers as an additional consumer when it is executed. Otherwise, the result would never be
+  // released.
+  EXPECT_EQ(aggregate->consumer_count(), 1);
+
+  const auto [pipeline_status, result_table] = pipeline.get_result_table();
+  EXPECT_EQ(pipeline_status, SQLPipelineStatus::Success);
+  EXPECT_EQ(result_table->row_count(), 5);
+  EXPECT_EQ(_cache->size(), 1);
+  EXPECT_EQ(aggregate->state(), OperatorState::ExecutedAndCleared);
+}
+
+TEST_F(SQLResultCacheTest, InvalidateOnModification) {
+  EXPECT_EQ(execute(_query), std::make_pair(size_t{10}, size_t{0}));
+  EXPECT_EQ(execute(_query), std::make_pair(size_t{10}, size_t{1}));
+
+  // The inserted row is part of a new group. The cached result is outdated.
+  execute("INSERT INTO table_a VALUES (10, 11)");
+  EXPECT_EQ(execute(_query), std::make_pair(size_t{11}, size_t{0}));
+  EXPECT_EQ(execute(_query), std::make_pair(size_t{11}, size_t{1}));
+
+  execute("DELETE FROM table_a WHERE b = 11");
+  EXPECT_EQ(execute(_query), std::make_pair(size_t{10}, size_t{0}));
+  EXPECT_EQ(execute(_query), std::make_pair(size_t{10}, size_t{1}));
+
+  // The chunks with the values 50 to 89 are pruned. Deleting their rows does not affect the result.
+  execute("DELETE FROM table_a WHERE a = 60");
+  EXPECT_EQ(execute(_query), std::make_pair(size_t{10}, size_t{1}));
+
+  // The last chunk is mutable and has no pruning statistics. Thus, it is not pruned.
+  execute("DELETE FROM table_a WHERE a = 95");
+  EXPECT_EQ(execute(_query), std::make_pair(size_t{10}, size_t{0}));
+}
+
+TEST_F(SQLResultCacheTest, TransactionWithModifications) {
+  EXPECT_EQ(execute(_query), std::make_pair(size_t{10}, size_t{0}));
+
+  // The transaction sees its own uncommitted row. Thus, it cannot use the cached result.
+  const auto transaction_context = Hyrise::get().transaction_manager.new_transaction_context(AutoCommit::No);
+  execute("INSERT INTO table_a VALUES (10, 11)", transaction_context);
+  EXPECT_EQ(execute(_query, transaction_context), std::make_pair(size_t{11}, size_t{0}));
+
+  // Other transactions do not see the uncommitted row.
+  EXPECT_EQ(execute(_query), std::make_pair(size_t{10}, size_t{1}));
+
+  transaction_context->rollback(RollbackReason::User);
+  EXPECT_EQ(execute(_query), std::make_pair(size_t{10}, size_t{1}));
+}
+
+}  // namespace hyrise
@@ -0,0 +1,249 @@
+#include "base_test.hpp"
+
+#include "expression/expression_functional.hpp"
+#include "hyrise.hpp"
+#include "logical_query_plan/join_node.hpp"
+#include "logical_query_plan/mock_node.hpp"
+#include "logical_query_plan/predicate_node.hpp"
+#include "logical_query_plan/projection_node.hpp"
+#include "logical_query_plan/sort_node.hpp"
+#include "logical_query_plan/stored_table_node.hpp"
+#include "logical_query_plan/validate_node.hpp"
+#include "sql/sql_pipeline_builder.hpp"
+#include "statistics/cardinality_estimator.hpp"
+#include "statistics/cardinality_feedback.hpp"
+
+using namespace hyrise::expression_functional;  // NOLINT
+
+namespace hyrise {
+
+class CardinalityFeedbackTest : public BaseTest {
+ public:
+  void SetUp() override {
+    auto& storage_manager = Hyrise::get().storage_manager;
+    storage_manager.add_table("t_a", load_table("resources/test_data/tbl/int_int.tbl", ChunkOffset{2}));
+    storage_manager.add_table("t_b", load_table("resources/test_data/tbl/int_int2.tbl", ChunkOffset{2}));
+    storage_manager.add_table("t_c", load_table("resources/test_data/tbl/int_int3.tbl", ChunkOffset{2}));
+
+    node_a = StoredTableNode::make("t_a");
+    node_b = StoredTableNode::make("t_b");
+    node_c = StoredTableNode::make("t_c");
+
+    a_a = node_a->get_column("a");
+    a_b = node_a->get_column("b");
+    b_a = node_b->get_column("a");
+    b_b = node_b->get_column("b");
+    c_a = node_c->get_column("a");
+  }
+
+  static std::optional<size_t> hash(const std::shared_ptr<AbstractLQPNode>& lqp) {
+    return CardinalityFeedback::subplan_hash(*lqp);
+  }
+
+  std::shared_ptr<StoredTableNode> node_a, node_b, node_c;
+  std::shared_ptr<LQPColumnExpression> a_a, a_b, b_a, b_b, c_a;
+};
+
+TEST_F(CardinalityFeedbackTest, SubplanHash) {
+  ASSERT_TRUE(hash(node_a));
+  EXPECT_NE(hash(node_a), hash(node_b));
+
+  // Pruned chunks and columns do not change the rows of a table.
+  const auto pruned_node_a = StoredTableNode::make("t_a");
+  pruned_node_a->set_pruned_chunk_ids({ChunkID{1}});
+  pruned_node_a->set_pruned_column_ids({ColumnID{1}});
+  EXPECT_EQ(hash(pruned_node_a), hash(node_a));
+
+  // Neither do Sort and Projection nodes. Validate nodes do.
+  EXPECT_EQ(hash(SortNode::make(expression_vector(a_a), std::vector<SortMode>{SortMode::Ascending}, node_a)),
+            hash(node_a));
+  EXPECT_EQ(hash(ProjectionNode::make(expression_vector(a_b), node_a)), hash(node_a));
+  EXPECT_NE(hash(ValidateNode::make(node_a)), hash(node_a));
+
+  // Predicates are distinguished by their columns, their tables, and their values.
+  EXPECT_NE(hash(PredicateNode::make(greater_than_(a_a, 5), node_a)), hash(node_a));
+  EXPECT_EQ(hash(PredicateNode::make(greater_than_(a_a, 5), node_a)),
+            hash(PredicateNode::make(greater_than_(a_a, 5), pruned_node_a)));
+  EXPECT_NE(hash(PredicateNode::make(greater_than_(a_a, 5), node_a)),
+            hash(PredicateNode::make(greater_than_(a_a, 6), node_a)));
+  EXPECT_NE(hash(PredicateNode::make(greater_than_(a_a, 5), node_a)),
+            hash(PredicateNode::make(greater_than_(a_b, 5), node_a)));
+  EXPECT_NE(hash(PredicateNode::make(greater_than_(a_a, 5), node_a)),
+            hash(PredicateNode::make(greater_than_(b_a, 5), node_b)));
+
+  // Placeholders and MockNodes are not supported.
+  EXPECT_FALSE(hash(PredicateNode::make(greater_than_(a_a, placeholder_(ParameterID{0})), node_a)));
+  EXPECT_FALSE(hash(MockNode::make(MockNode::ColumnDefinitions{{DataType::Int, "a"}})));
+}
+
+TEST_F(CardinalityFeedbackTest, SubplanHashIndependentOfJoinOrder) {
+  // clang-format off
+  const auto lqp_a =
+  JoinNode::make(JoinMode::Inner, equals_(b_a, c_a),
+    JoinNode::make(JoinMode::Inner, equals_(a_b, b_b),
+      PredicateNode::make(greater_than_(a_a, 5),
+        node_a),
+      node_b),
+    node_c);
+
+  const auto lqp_b =
+  PredicateNode::make(greater_than_(a_a, 5),
+    JoinNode::make(JoinMode::Inner, equals_(b_b, a_b),
+      JoinNode::make(JoinMode::Inner, equals_(c_a, b_a),
+        node_c,
+        node_b),
+      node_a));
+
+  const auto lqp_c =
+  PredicateNode::make(equals_(a_b, b_b),
+    JoinNode::make(JoinMode::Inner, equals_(b_a, c_a),
+      JoinNode::make(JoinMode::Cross,
+        PredicateNode::make(greater_than_(a_a, 5),
+          node_a),
+        node_b),
+      node_c));
+
+  const auto lqp_d =
+  JoinNode::make(JoinMode::Inner, equals_(b_a, c_a),
+    JoinNode::make(JoinMode::Inner, equals_(a_b, b_b),
+      node_a,
+      node_b),
+    node_c);
+
+  const auto lqp_e =
+  JoinNode::make(JoinMode::Left, equals_(b_a, c_a),
+    JoinNode::make(JoinMode::Inner, equals_(a_b, b_b),
+      PredicateNode::make(greater_than_(a_a, 5),
+        node_a),
+      node_b),
+    node_c);
+
+  const auto lqp_f =
+  JoinNode::make(JoinMode::Left, equals_(c_a, b_a),
+    node_c,
+    JoinNode::make(JoinMode::Inner, equals_(a_b, b_b),
+      PredicateNode::make(greater_than_(a_a, 5),
+        node_a),
+      node_b));
+  // clang-format on
+
+  ASSERT_TRUE(hash(lqp_a));
+  EXPECT_EQ(hash(lqp_a), hash(lqp_b));
+  EXPECT_EQ(hash(lqp_a), hash(lqp_c));
+  EXPECT_NE(hash(lqp_a), hash(lqp_d));
+
+  // Outer joins are not commutative.
+  EXPECT_NE(hash(lqp_a), hash(lqp_e));
+  EXPECT_NE(hash(lqp_e), hash(lqp_f));
+}
+
+TEST_F(CardinalityFeedbackTest, SubplanHashIgnoresSemiJoinReductions) {
+  const auto predicate_node = PredicateNode::make(greater_than_(b_a, 5), node_b);
+  const auto join_node = JoinNode::make(JoinMode::Inner, equals_(a_b, b_b), node_a, predicate_node);
+  const auto semi_join_reduction = JoinNode::make(JoinMode::Semi, equals_(a_b, b_b), node_a, predicate_node);
+  semi_join_reduction->mark_as_semi_reduction(join_node);
+
+  // The reduction itself differs from its input. Nodes above it are not affected.
+  EXPECT_NE(hash(semi_join_reduction), hash(node_a));
+  EXPECT_EQ(hash(JoinNode::make(JoinMode::Inner, equals_(a_b, b_b), semi_join_reduction, predicate_node)),
+            hash(join_node));
+}
+
+TEST_F(CardinalityFeedbackTest, SubplanHashOfSelfJoins) {
+  // Both StoredTableNodes hash the same. Thus, the predicates could not tell which instance of t_a they filter.
+  const auto node_a2 = StoredTableNode::make("t_a");
+  const auto a2_a = node_a2->get_column("a");
+  const auto a2_b = node_a2->get_column("b");
+
+  // clang-format off
+  const auto self_join =
+  JoinNode::make(JoinMode::Inner, equals_(a_b, a2_b),
+    PredicateNode::make(greater_than_(a_a, 5),
+      node_a),
+    node_a2);
+
+  const auto other_self_join =
+  JoinNode::make(JoinMode::Inner, equals_(a_b, a2_b),
+    node_a,
+    PredicateNode::make(greater_than_(a2_a, 5),
+      node_a2));
+  // clang-format on
+
+  EXPECT_FALSE(hash(self_join));
+  EXPECT_FALSE(hash(other_self_join));
+  EXPECT_FALSE(hash(JoinNode::make(JoinMode::Inner, equals_(b_a, a2_a), self_join, node_b)));
+
+  // Subplans that scan the table once can still be recorded.
+  EXPECT_TRUE(hash(self_join->left_input()));
+  EXPECT_EQ(hash(self_join->left_input()), hash(PredicateNode::make(greater_than_(a2_a, 5), node_a2)));
+}
+
+TEST_F(CardinalityFeedbackTest, SubplanHashMemoization) {
+  const auto join_node =
+      JoinNode::make(JoinMode::Inner, equals_(a_b, b_b), PredicateNode::make(greater_than_(a_a, 5), node_a), node_b);
+
+  auto subplan_hashes = CardinalityFeedback::SubplanHashes{};
+  const auto memoized_hash = CardinalityFeedback::subplan_hash(*join_node, &subplan_hashes);
+  EXPECT_EQ(memoized_hash, hash(join_node));
+  EXPECT_EQ(subplan_hashes.size(), 4);
+  EXPECT_EQ(CardinalityFeedback::subplan_hash(*join_node, &subplan_hashes), memoized_hash);
+}
+
+TEST_F(CardinalityFeedbackTest, EstimationsUseObservedCardinalities) {
+  Hyrise::get().cardinality_feedback = std::make_shared<CardinalityFeedback>();
+  auto& cardinality_feedback = *Hyrise::get().cardinality_feedback;
+
+  const auto predicate_node = PredicateNode::make(greater_than_(a_a, 5), node_a);
+  const auto join_node = JoinNode::make(JoinMode::Cross, predicate_node, node_b);
+  const auto estimated_cardinality = CardinalityEstimator{}.estimate_cardinality(join_node);
+
+  cardinality_feedback.record(*predicate_node, 1);
+  EXPECT_EQ(cardinality_feedback.size(), 1);
+  EXPECT_FLOAT_EQ(CardinalityEstimator{}.estimate_cardinality(predicate_node), 1.0f);
+  EXPECT_FLOAT_EQ(CardinalityEstimator{}.estimate_cardinality(join_node), 3.0f);
+
+  // The join order does not matter.
+  cardinality_feedback.record(*join_node, 42);
+  EXPECT_FLOAT_EQ(CardinalityEstimator{}.estimate_cardinality(JoinNode::make(JoinMode::Cross, node_b, predicate_node)),
+                  42.0f);
+
+  cardinality_feedback.clear();
+  EXPECT_FLOAT_EQ(CardinalityEstimator{}.estimate_cardinality(join_node), estimated_cardinality);
+}
+
+TEST_F(CardinalityFeedbackTest, RequiresReoptimization) {
+  EXPECT_FALSE(CardinalityFeedback{}.requires_reoptimization(1, 1000));
+
+  const auto cardinality_feedback = CardinalityFeedback{2.0f};
+  EXPECT_FALSE(cardinality_feedback.requires_reoptimization(10, 20));
+  EXPECT_FALSE(cardinality_feedback.requires_reoptimization(20, 10));
+  EXPECT_FALSE(cardinality_feedback.requires_reoptimization(0, 1));
+  EXPECT_TRUE(cardinality_feedback.requires_reoptimization(10, 21));
+  EXPECT_TRUE(cardinality_feedback.requires_reoptimization(21, 10));
+  EXPECT_TRUE(cardinality_feedback.requires_reoptimization(0, 3));
+}
+
+TEST_F(CardinalityFeedbackTest, RecordAndReoptimize) {
+  const auto sql = std::string{"SELECT * FROM t_a, t_b, t_c WHERE t_a.b = t_b.b AND t_b.a = t_c.a AND t_c.b > 2"};
+  auto expected_pipeline = SQLPipelineBuilder{sql}.create_pipeline();
+  const auto expected_table = expected_pipeline.get_result_table().second;
+
+  Hyrise::get().cardinality_feedback = std::make_shared<CardinalityFeedback>(2.0f);
+  auto& cardinality_feedback = *Hyrise::get().cardinality_feedback;
+
+  // Pretend that t_a has many more rows than it actually has. Executing its scan reveals the misestimation.
+  cardinality_feedback.record(*ValidateNode::make(node_a), 1'000'000);
+
+  auto pipeline = SQLPipelineBuilder{sql}.create_pipeline();
+  EXPECT_TABLE_EQ_UNORDERED(pipeline.get_result_table().second, expected_table);
+  EXPECT_TRUE(pipeline.metrics().statement_metrics.at(0)->reoptimized);
+  EXPECT_GT(cardinality_feedback.size(), 1);
+  EXPECT_FLOAT_EQ(*cardinality_feedback.try_get(*ValidateNode::make(node_a)), 3.0f);
+
+  // The estimations are correct now.
+  auto second_pipeline = SQLPipelineBuilder{sql}.create_pipeline();
+  EXPECT_TABLE_EQ_UNORDERED(second_pipeline.get_result_table().second, expected_table);
+  EXPECT_FALSE(second_pipeline.metrics().statement_metrics.at(0)->reoptimized);
+}
+
+}  // namespace hyrise
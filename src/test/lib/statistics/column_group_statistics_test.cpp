@@ -0,0 +1,183 @@
+#include "base_test.hpp"
+
+#include "expression/expression_functional.hpp"
+#include "hyrise.hpp"
+#include "logical_query_plan/aggregate_node.hpp"
+#include "logical_query_plan/predicate_node.hpp"
+#include "logical_query_plan/stored_table_node.hpp"
+#include "operators/operator_scan_predicate.hpp"
+#include "statistics/cardinality_estimator.hpp"
+#include "statistics/column_group_statistics.hpp"
+#include "statistics/table_statistics.hpp"
+#include "storage/table.hpp"
+
+using namespace hyrise::expression_functional;  // NOLINT
+
+namespace hyrise {
+
+class ColumnGroupStatisticsTest : public BaseTest {
+ public:
+  void SetUp() override {
+    // Each zip code belongs to exactly one city: zip = row % 100 and city = zip / 10. Thus, there are 100 distinct
+    // combinations of city and zip rather than the 1000 that independent columns would have.
+    const auto column_definitions =
+        TableColumnDefinitions{{"city", DataType::Int, false}, {"zip", DataType::Int, false}};
+    _table = std::make_shared<Table>(column_definitions, TableType::Data, ChunkOffset{300}, UseMvcc::Yes);
+    for (auto row = int32_t{0}; row < 2'000; ++row) {
+      const auto zip = row % 100;
+      _table->append({zip / 10, zip});
+    }
+
+    Hyrise::get().storage_manager.add_table("addresses", _table);
+    _column_group_statistics = ColumnGroupStatistics::from_table(*_table, {ColumnID{1}, ColumnID{0}});
+
+    _stored_table_node = StoredTableNode::make("addresses");
+    _city = _stored_table_node->get_column("city");
+    _zip = _stored_table_node->get_column("zip");
+  }
+
+  void add_column_group_statistics() {
+    _table->table_statistics()->column_group_statistics.emplace_back(_column_group_statistics);
+  }
+
+  std::shared_ptr<Table> _table;
+  std::shared_ptr<ColumnGroupStatistics> _column_group_statistics;
+  std::shared_ptr<StoredTableNode> _stored_table_node;
+  std::shared_ptr<LQPColumnExpression> _city, _zip;
+  CardinalityEstimator _estimator;
+};
+
+TEST_F(ColumnGroupStatisticsTest, FromTable) {
+  EXPECT_EQ(_column_group_statistics->column_ids, std::vector<ColumnID>({ColumnID{0}, ColumnID{1}}));
+  EXPECT_NEAR(_column_group_statistics->distinct_count(), 100.0f, 5.0f);
+
+  // The table has fewer rows than the default sample size, so all rows are sampled.
+  EXPECT_EQ(_column_group_statistics->sampled_histogram.size(), 100);
+  const auto& first_bin = _column_group_statistics->sampled_histogram.front();
+  EXPECT_EQ(first_bin.values, std::vector<AllTypeVariant>({int32_t{0}, int32_t{0}}));
+  EXPECT_FLOAT_EQ(first_bin.height, 20.0f);
+
+  const auto small_sample = ColumnGroupStatistics::from_table(*_table, {ColumnID{0}, ColumnID{1}}, 500);
+  EXPECT_EQ(small_sample->sampled_histogram.size(), 25);
+
+  EXPECT_THROW(ColumnGroupStatistics({}, HyperLogLog{}, {}), std::logic_error);
+  EXPECT_THROW(ColumnGroupStatistics({ColumnID{1}, ColumnID{0}}, HyperLogLog{}, {}), std::logic_error);
+}
+
+TEST_F(ColumnGroupStatisticsTest, TableStatisticsCreateSingleColumnGroups) {
+  const auto& table_statistics = *_table->table_statistics();
+  ASSERT_EQ(table_statistics.column_group_statistics.size(), 2);
+
+  const auto city_statistics = table_statistics.find_column_group_statistics({ColumnID{0}});
+  ASSERT_TRUE(city_statistics);
+  EXPECT_EQ(city_statistics->column_ids, std::vector<ColumnID>({ColumnID{0}}));
+  EXPECT_NEAR(city_statistics->distinct_count(), 10.0f, 1.0f);
+  EXPECT_TRUE(city_statistics->sampled_histogram.empty());
+
+  EXPECT_FALSE(table_statistics.find_column_group_statistics({ColumnID{0}, ColumnID{1}}));
+  add_column_group_statistics();
+  EXPECT_EQ(table_statistics.find_column_group_statistics({ColumnID{0}, ColumnID{1}}), _column_group_statistics);
+  EXPECT_EQ(table_statistics.find_column_group_statistics({ColumnID{1}}), table_statistics.column_group_statistics[1]);
+}
+
+TEST_F(ColumnGroupStatisticsTest, EstimateSelectivity) {
+  const auto city_equals_3 = OperatorScanPredicate{ColumnID{0}, PredicateCondition::Equals, AllTypeVariant{3}};
+  const auto zip_equals_35 = OperatorScanPredicate{ColumnID{1}, PredicateCondition::Equals, AllTypeVariant{35}};
+  const auto zip_equals_45 = OperatorScanPredicate{ColumnID{1}, PredicateCondition::Equals, AllTypeVariant{45}};
+  const auto zip_between =
+      OperatorScanPredicate{ColumnID{1}, PredicateCondition::BetweenInclusive, AllTypeVariant{30}, AllTypeVariant{49}};
+  const auto zip_like = OperatorScanPredicate{ColumnID{1}, PredicateCondition::Like, AllTypeVariant{pmr_string{"3%"}}};
+  const auto other_column = OperatorScanPredicate{ColumnID{2}, PredicateCondition::Equals, AllTypeVariant{3}};
+
+  EXPECT_FLOAT_EQ(*_column_group_statistics->estimate_selectivity({}), 1.0f);
+  EXPECT_FLOAT_EQ(*_column_group_statistics->estimate_selectivity({city_equals_3}), 0.1f);
+  EXPECT_FLOAT_EQ(*_column_group_statistics->estimate_selectivity({city_equals_3, zip_equals_35}), 0.01f);
+  EXPECT_FLOAT_EQ(*_column_group_statistics->estimate_selectivity({city_equals_3, zip_equals_45}), 0.0f);
+  EXPECT_FLOAT_EQ(*_column_group_statistics->estimate_selectivity({city_equals_3, zip_between}), 0.1f);
+
+  // Predicates on the first column select adjacent bins, which are found with a binary search.
+  const auto city_less_than_3 = OperatorScanPredicate{ColumnID{0}, PredicateCondition::LessThan, AllTypeVariant{3}};
+  const auto city_greater_than_equals_8 =
+      OperatorScanPredicate{ColumnID{0}, PredicateCondition::GreaterThanEquals, AllTypeVariant{8}};
+  const auto city_between_exclusive =
+      OperatorScanPredicate{ColumnID{0}, PredicateCondition::BetweenExclusive, AllTypeVariant{2}, AllTypeVariant{5}};
+  const auto city_not_equals_3 = OperatorScanPredicate{ColumnID{0}, PredicateCondition::NotEquals, AllTypeVariant{3}};
+  const auto city_is_null = OperatorScanPredicate{ColumnID{0}, PredicateCondition::IsNull, NULL_VALUE};
+  EXPECT_FLOAT_EQ(*_column_group_statistics->estimate_selectivity({city_less_than_3}), 0.3f);
+  EXPECT_FLOAT_EQ(*_column_group_statistics->estimate_selectivity({city_greater_than_equals_8}), 0.2f);
+  EXPECT_FLOAT_EQ(*_column_group_statistics->estimate_selectivity({city_between_exclusive}), 0.2f);
+  EXPECT_FLOAT_EQ(*_column_group_statistics->estimate_selectivity({city_between_exclusive, city_less_than_3}), 0.0f);
+  EXPECT_FLOAT_EQ(*_column_group_statistics->estimate_selectivity({city_between_exclusive, zip_equals_35}), 0.01f);
+  EXPECT_FLOAT_EQ(*_column_group_statistics->estimate_selectivity({city_not_equals_3}), 0.9f);
+  EXPECT_FLOAT_EQ(*_column_group_statistics->estimate_selectivity({city_is_null}), 0.0f);
+
+  // Search values are cast to the data type of the column.
+  const auto city_equals_3_long =
+      OperatorScanPredicate{ColumnID{0}, PredicateCondition::Equals, AllTypeVariant{int64_t{3}}};
+  EXPECT_FLOAT_EQ(*_column_group_statistics->estimate_selectivity({city_equals_3_long}), 0.1f);
+
+  EXPECT_FALSE(_column_group_statistics->can_estimate(zip_like));
+  EXPECT_FALSE(_column_group_statistics->can_estimate(other_column));
+  EXPECT_FALSE(_column_group_statistics->estimate_selectivity({city_equals_3, zip_like}));
+  EXPECT_FALSE(_column_group_statistics->estimate_selectivity({city_equals_3, other_column}));
+}
+
+TEST_F(ColumnGroupStatisticsTest, EstimateCorrelatedPredicates) {
+  // clang-format off
+  const auto lqp =
+  PredicateNode::make(equals_(_zip, 35),
+    PredicateNode::make(equals_(_city, 3),
+      _stored_table_node));
+
+  const auto swapped_lqp =
+  PredicateNode::make(equals_(_city, 3),
+    PredicateNode::make(equals_(_zip, 35),
+      _stored_table_node));
+
+  const auto contradicting_lqp =
+  PredicateNode::make(equals_(_zip, 45),
+    PredicateNode::make(equals_(_city, 3),
+      _stored_table_node));
+  // clang-format on
+
+  // Assuming independence, the estimation is 2000 * 0.1 * 0.01 = 2 rows.
+  EXPECT_NEAR(_estimator.estimate_cardinality(lqp), 2.0f, 1.0f);
+
+  add_column_group_statistics();
+  EXPECT_NEAR(_estimator.estimate_cardinality(lqp), 20.0f, 1.0f);
+  EXPECT_NEAR(_estimator.estimate_cardinality(swapped_lqp), 20.0f, 1.0f);
+  EXPECT_FLOAT_EQ(_estimator.estimate_cardinality(contradicting_lqp), 0.0f);
+}
+
+TEST_F(ColumnGroupStatisticsTest, EstimateGroupCount) {
+  const auto group_by_city_and_zip = AggregateNode::make(expression_vector(_city, _zip), expression_vector(),
+                                                         _stored_table_node);
+  const auto group_by_city = AggregateNode::make(expression_vector(_city), expression_vector(), _stored_table_node);
+
+  // Without statistics on the column group, the distinct counts of the columns are multiplied and capped by the input.
+  EXPECT_NEAR(_estimator.estimate_cardinality(group_by_city), 10.0f, 1.0f);
+  EXPECT_NEAR(_estimator.estimate_cardinality(group_by_city_and_zip), 1'000.0f, 100.0f);
+
+  add_column_group_statistics();
+  EXPECT_NEAR(_estimator.estimate_cardinality(group_by_city_and_zip), 100.0f, 5.0f);
+  EXPECT_NEAR(_estimator.estimate_cardinality(group_by_city), 10.0f, 1.0f);
+
+  // The group of city and zip also counts the different zip codes. It does not tell the number of cities. Without the
+  // statistics of the single column, we fall back to the input row count.
+  auto& column_group_statistics = _table->table_statistics()->column_group_statistics;
+  const auto city_statistics = column_group_statistics.front();
+  column_group_statistics.erase(column_group_statistics.begin());
+  EXPECT_FLOAT_EQ(_estimator.estimate_cardinality(group_by_city), 2'000.0f);
+  column_group_statistics.insert(column_group_statistics.begin(), city_statistics);
+
+  // Only some of the groups are part of a filtered input.
+  // clang-format off
+  const auto filtered_lqp =
+  AggregateNode::make(expression_vector(_city, _zip), expression_vector(),
+    PredicateNode::make(less_than_(_zip, 10),
+      _stored_table_node));
+  // clang-format on
+  EXPECT_LT(_estimator.estimate_cardinality(filtered_lqp), 100.0f);
+}
+
+}  // namespace hyrise
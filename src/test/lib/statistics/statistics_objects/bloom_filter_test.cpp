@@ -0,0 +1,101 @@
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "base_test.hpp"
+
+#include "statistics/statistics_objects/bloom_filter.hpp"
+#include "types.hpp"
+
+namespace hyrise {
+
+template <typename T>
+class BloomFilterTest : public BaseTest {
+ protected:
+  void SetUp() override {
+    for (auto value = 0; value < 2000; value += 2) {
+      _values.emplace_back(convert(value));
+      _absent_values.emplace_back(convert(value + 1));
+    }
+  }
+
+  static T convert(const int value) {
+    if constexpr (std::is_same_v<T, pmr_string>) {
+      return pmr_string{std::to_string(value)};
+    } else {
+      return static_cast<T>(value);
+    }
+  }
+
+  pmr_vector<T> _values;
+  pmr_vector<T> _absent_values;
+};
+
+using BloomFilterTypes = ::testing::Types<int32_t, int64_t, float, double, pmr_string>;
+TYPED_TEST_SUITE(BloomFilterTest, BloomFilterTypes, );  // NOLINT(whitespace/parens)
+
+TYPED_TEST(BloomFilterTest, NoFalseNegatives) {
+  const auto filter = BloomFilter<TypeParam>::build_filter(this->_values);
+  EXPECT_EQ(filter->block_count(), 32);
+
+  for (const auto& value : this->_values) {
+    EXPECT_TRUE(filter->may_contain(value));
+    EXPECT_FALSE(filter->does_not_contain(PredicateCondition::Equals, AllTypeVariant{value}));
+  }
+}
+
+TYPED_TEST(BloomFilterTest, FalsePositiveRate) {
+  const auto filter = BloomFilter<TypeParam>::build_filter(this->_values);
+
+  auto false_positive_count = size_t{0};
+  for (const auto& value : this->_absent_values) {
+    false_positive_count += filter->may_contain(value);
+  }
+
+  // With eight bits per value, the expected false positive rate is about 2 %.
+  EXPECT_LT(false_positive_count, this->_absent_values.size() / 10);
+
+  // More bits per value result in fewer false positives.
+  const auto larger_filter = BloomFilter<TypeParam>::build_filter(this->_values, 32);
+  auto larger_false_positive_count = size_t{0};
+  for (const auto& value : this->_absent_values) {
+    larger_false_positive_count += larger_filter->may_contain(value);
+  }
+  EXPECT_LE(larger_false_positive_count, false_positive_count);
+}
+
+TYPED_TEST(BloomFilterTest, OnlyEqualsIsPruned) {
+  const auto filter = BloomFilter<TypeParam>::build_filter(pmr_vector<TypeParam>{});
+  EXPECT_EQ(filter->block_count(), 1);
+
+  const auto value = AllTypeVariant{this->_values.front()};
+  EXPECT_TRUE(filter->does_not_contain(PredicateCondition::Equals, value));
+  EXPECT_FALSE(filter->does_not_contain(PredicateCondition::NotEquals, value));
+  EXPECT_FALSE(filter->does_not_contain(PredicateCondition::LessThan, value));
+  EXPECT_FALSE(filter->does_not_contain(PredicateCondition::BetweenInclusive, value, value));
+  EXPECT_FALSE(filter->does_not_contain(PredicateCondition::Equals, NULL_VALUE));
+}
+
+TYPED_TEST(BloomFilterTest, SlicedAndScaled) {
+  const auto filter = BloomFilter<TypeParam>::build_filter(this->_values);
+
+  EXPECT_NE(filter->sliced(PredicateCondition::Equals, AllTypeVariant{this->_values.back()}), nullptr);
+  EXPECT_TRUE(std::dynamic_pointer_cast<BloomFilter<TypeParam>>(
+      filter->sliced(PredicateCondition::GreaterThan, AllTypeVariant{this->_values.back()})));
+
+  const auto scaled_filter = std::dynamic_pointer_cast<BloomFilter<TypeParam>>(filter->scaled(0.5f));
+  ASSERT_TRUE(scaled_filter);
+  for (const auto& value : this->_values) {
+    EXPECT_TRUE(scaled_filter->may_contain(value));
+  }
+}
+
+TYPED_TEST(BloomFilterTest, BlocksDoNotSpanCacheLines) {
+  using Block = typename BloomFilter<TypeParam>::Block;
+  EXPECT_EQ(alignof(Block), 32);
+
+  const auto blocks = std::vector<Block>(3);
+  EXPECT_EQ(reinterpret_cast<uintptr_t>(blocks.data()) % 32, 0);
+}
+
+}  // namespace hyrise
@@ -51,6 +51,15 @@ TEST_F(EqualDistinctCountHistogramTest, FromColumnInt) {
   EXPECT_EQ(hist->bin(BinID{1}), HistogramBin<int32_t>(12345, 123456, 5, 2));
 }
 
+TEST_F(EqualDistinctCountHistogramTest, FromSegment) {
+  const auto& segment = *_int_float4->get_chunk(ChunkID{0})->get_segment(ColumnID{0});
+  const auto hist = EqualDistinctCountHistogram<int32_t>::from_segment(segment, 2u);
+
+  ASSERT_EQ(hist->bin_count(), 2u);
+  EXPECT_EQ(hist->bin(BinID{0}), HistogramBin<int32_t>(12, 123, 2, 2));
+  EXPECT_EQ(hist->bin(BinID{1}), HistogramBin<int32_t>(12345, 123456, 5, 2));
+}
+
 TEST_F(EqualDistinctCountHistogramTest, FromColumnFloat) {
   auto hist = EqualDistinctCountHistogram<float>::from_column(*_float2, ColumnID{0}, 3u);
 
@@ -1186,4 +1186,49 @@ TEST_F(GenericHistogramTest, ScaledWithSelectivity) {
   EXPECT_FLOAT_EQ(scaled_histogram_10->bin_distinct_count(BinID{3}), 5.0f);
 }
 
+TEST_F(GenericHistogramTest, FromHistograms) {
+  const auto histogram_a = GenericHistogram<int32_t>::with_single_bin(1, 10, 10, 10);
+  const auto histogram_b = GenericHistogram<int32_t>::with_single_bin(11, 20, 20, 10);
+
+  const auto merged_histogram = GenericHistogram<int32_t>::from_histograms({histogram_a, histogram_b}, 2u);
+  ASSERT_TRUE(merged_histogram);
+  ASSERT_EQ(merged_histogram->bin_count(), 2u);
+  EXPECT_EQ(merged_histogram->bin(BinID{0}), HistogramBin<int32_t>(1, 10, 10, 10));
+  EXPECT_EQ(merged_histogram->bin(BinID{1}), HistogramBin<int32_t>(11, 20, 20, 10));
+
+  // The number of bins is capped.
+  const auto single_bin_histogram = GenericHistogram<int32_t>::from_histograms({histogram_a, histogram_b}, 1u);
+  ASSERT_EQ(single_bin_histogram->bin_count(), 1u);
+  EXPECT_EQ(single_bin_histogram->bin(BinID{0}), HistogramBin<int32_t>(1, 20, 30, 20));
+
+  EXPECT_FALSE(GenericHistogram<int32_t>::from_histograms({}, 2u));
+  EXPECT_THROW(GenericHistogram<int32_t>::from_histograms({histogram_a}, 0u), std::logic_error);
+}
+
+TEST_F(GenericHistogramTest, FromOverlappingHistograms) {
+  // Both histograms contain the same ten values. Without knowing the total distinct count, the distinct counts of the
+  // overlapping bins are summed up.
+  const auto histogram_a = GenericHistogram<int32_t>::with_single_bin(1, 10, 10, 10);
+  const auto histogram_b = GenericHistogram<int32_t>::with_single_bin(1, 10, 30, 10);
+
+  const auto merged_histogram = GenericHistogram<int32_t>::from_histograms({histogram_a, histogram_b}, 4u);
+  ASSERT_EQ(merged_histogram->bin_count(), 1u);
+  EXPECT_EQ(merged_histogram->bin(BinID{0}), HistogramBin<int32_t>(1, 10, 40, 20));
+
+  const auto scaled_histogram = GenericHistogram<int32_t>::from_histograms({histogram_a, histogram_b}, 4u, 10.0f);
+  ASSERT_EQ(scaled_histogram->bin_count(), 1u);
+  EXPECT_EQ(scaled_histogram->bin(BinID{0}), HistogramBin<int32_t>(1, 10, 40, 10));
+}
+
+TEST_F(GenericHistogramTest, FromStringHistograms) {
+  const auto histogram_a = GenericHistogram<pmr_string>::with_single_bin("a", "c", 3, 3);
+  const auto histogram_b = GenericHistogram<pmr_string>::with_single_bin("b", "d", 3, 3);
+
+  const auto merged_histogram = GenericHistogram<pmr_string>::from_histograms({histogram_a, histogram_b}, 1u);
+  ASSERT_EQ(merged_histogram->bin_count(), 1u);
+  EXPECT_EQ(merged_histogram->bin_minimum(BinID{0}), "a");
+  EXPECT_EQ(merged_histogram->bin_maximum(BinID{0}), "d");
+  EXPECT_NEAR(merged_histogram->total_count(), 6.0f, 1.0f);
+}
+
 }  // namespace hyrise
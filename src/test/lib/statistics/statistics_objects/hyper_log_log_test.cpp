@@ -0,0 +1,44 @@
+#include "base_test.hpp"
+
+#include "statistics/statistics_objects/hyper_log_log.hpp"
+
+namespace hyrise {
+
+class HyperLogLogTest : public BaseTest {
+ public:
+  static HyperLogLog sketch_of_range(const size_t begin, const size_t end) {
+    auto sketch = HyperLogLog{};
+    for (auto value = begin; value < end; ++value) {
+      // Add every value twice. Duplicates must not change the estimation.
+      sketch.add(std::hash<size_t>{}(value));
+      sketch.add(std::hash<size_t>{}(value));
+    }
+    return sketch;
+  }
+};
+
+TEST_F(HyperLogLogTest, InvalidPrecision) {
+  EXPECT_THROW(HyperLogLog{3}, std::logic_error);
+  EXPECT_THROW(HyperLogLog{19}, std::logic_error);
+}
+
+TEST_F(HyperLogLogTest, EstimateDistinctCount) {
+  EXPECT_FLOAT_EQ(HyperLogLog{}.estimate_distinct_count(), 0.0f);
+
+  // Small cardinalities are estimated by linear counting and are almost exact.
+  EXPECT_NEAR(sketch_of_range(0, 10).estimate_distinct_count(), 10.0f, 0.5f);
+  EXPECT_NEAR(sketch_of_range(0, 1'000).estimate_distinct_count(), 1'000.0f, 30.0f);
+
+  // The standard error for the default precision is about 1.6 %. Allow for three times that.
+  EXPECT_NEAR(sketch_of_range(0, 100'000).estimate_distinct_count(), 100'000.0f, 5'000.0f);
+}
+
+TEST_F(HyperLogLogTest, Merge) {
+  auto sketch = sketch_of_range(0, 60'000);
+  sketch.merge(sketch_of_range(40'000, 100'000));
+  EXPECT_NEAR(sketch.estimate_distinct_count(), 100'000.0f, 5'000.0f);
+
+  EXPECT_THROW(sketch.merge(HyperLogLog{10}), std::logic_error);
+}
+
+}  // namespace hyrise
@@ -0,0 +1,91 @@
+#include <chrono>
+#include <thread>
+
+#include "base_test.hpp"
+
+#include "hyrise.hpp"
+#include "statistics/column_group_statistics.hpp"
+#include "statistics/statistics_refresher.hpp"
+#include "statistics/table_statistics.hpp"
+#include "storage/table.hpp"
+
+namespace hyrise {
+
+class StatisticsRefresherTest : public BaseTest {
+ public:
+  void SetUp() override {
+    _table = load_table("resources/test_data/tbl/int_with_nulls_large.tbl", ChunkOffset{20});
+    Hyrise::get().storage_manager.add_table("table_a", _table);
+  }
+
+  void insert_rows(const int32_t row_count) {
+    for (auto row = int32_t{0}; row < row_count; ++row) {
+      _table->append({row, row});
+    }
+  }
+
+  std::shared_ptr<Table> _table;
+};
+
+TEST_F(StatisticsRefresherTest, Staleness) {
+  EXPECT_FLOAT_EQ(StatisticsRefresher::staleness(*_table), 0.0f);
+
+  insert_rows(50);
+  EXPECT_FLOAT_EQ(StatisticsRefresher::staleness(*_table), 0.2f);
+
+  _table->set_table_statistics(nullptr);
+  EXPECT_FLOAT_EQ(StatisticsRefresher::staleness(*_table), 1.0f);
+}
+
+TEST_F(StatisticsRefresherTest, RefreshStaleTables) {
+  // Do not let the background thread interfere.
+  const auto refresher = StatisticsRefresher{std::chrono::hours{1}, 0.1f};
+
+  const auto column_group_statistics = ColumnGroupStatistics::from_table(*_table, {ColumnID{0}, ColumnID{1}});
+  _table->table_statistics()->column_group_statistics.emplace_back(column_group_statistics);
+
+  // Below the staleness threshold, the statistics are kept.
+  insert_rows(10);
+  const auto initial_statistics = _table->table_statistics();
+  EXPECT_EQ(refresher.refresh_stale_tables(), 0);
+  EXPECT_EQ(_table->table_statistics(), initial_statistics);
+
+  insert_rows(40);
+  EXPECT_EQ(refresher.refresh_stale_tables(), 1);
+  const auto refreshed_statistics = _table->table_statistics();
+  EXPECT_NE(refreshed_statistics, initial_statistics);
+  EXPECT_FLOAT_EQ(refreshed_statistics->row_count, 250.0f);
+  EXPECT_FLOAT_EQ(StatisticsRefresher::staleness(*_table), 0.0f);
+
+  // Groups of multiple columns are carried over.
+  ASSERT_EQ(refreshed_statistics->column_group_statistics.size(), 3);
+  EXPECT_EQ(refreshed_statistics->find_column_group_statistics({ColumnID{0}, ColumnID{1}}), column_group_statistics);
+
+  EXPECT_EQ(refresher.refresh_stale_tables(), 0);
+}
+
+TEST_F(StatisticsRefresherTest, RefineSampledStatistics) {
+  _table->set_table_statistics(TableStatistics::from_table_sample(*_table, 100));
+  ASSERT_TRUE(_table->table_statistics()->sampled_row_count);
+
+  const auto refresher = StatisticsRefresher{std::chrono::hours{1}, 0.1f};
+  EXPECT_EQ(refresher.refresh_stale_tables(), 0);
+
+  const auto refining_refresher = StatisticsRefresher{std::chrono::hours{1}, 0.1f, true};
+  EXPECT_EQ(refining_refresher.refresh_stale_tables(), 1);
+  EXPECT_FALSE(_table->table_statistics()->sampled_row_count);
+  EXPECT_EQ(refining_refresher.refresh_stale_tables(), 0);
+}
+
+TEST_F(StatisticsRefresherTest, RefreshInBackground) {
+  insert_rows(100);
+  Hyrise::get().statistics_refresher = std::make_shared<StatisticsRefresher>(std::chrono::milliseconds{1});
+
+  for (auto attempt = 0; attempt < 1'000 && StatisticsRefresher::staleness(*_table) > 0.0f; ++attempt) {
+    std::this_thread::sleep_for(std::chrono::milliseconds{5});
+  }
+
+  EXPECT_FLOAT_EQ(_table->table_statistics()->row_count, 300.0f);
+}
+
+}  // namespace hyrise
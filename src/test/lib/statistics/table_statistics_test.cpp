@@ -1,9 +1,15 @@
 #include "base_test.hpp"
 
 #include "statistics/attribute_statistics.hpp"
+#include "statistics/chunk_statistics.hpp"
+#include "statistics/column_group_statistics.hpp"
 #include "statistics/generate_pruning_statistics.hpp"
 #include "statistics/statistics_objects/abstract_histogram.hpp"
+#include "statistics/statistics_objects/generic_histogram.hpp"
+#include "statistics/statistics_objects/null_value_ratio_statistics.hpp"
 #include "statistics/table_statistics.hpp"
+#include "storage/chunk_encoder.hpp"
+#include "storage/table.hpp"
 #include "utils/load_table.hpp"
 
 namespace hyrise {
@@ -41,4 +47,100 @@ TEST_F(TableStatisticsTest, FromTable) {
   EXPECT_FLOAT_EQ(histogram_b->total_distinct_count(), 190);
 }
 
+TEST_F(TableStatisticsTest, FromTableSample) {
+  const auto table = load_table("resources/test_data/tbl/int_with_nulls_large.tbl", ChunkOffset{20});
+
+  // Small tables are not sampled.
+  EXPECT_FALSE(TableStatistics::from_table_sample(*table, 200)->sampled_row_count);
+
+  const auto table_statistics = TableStatistics::from_table_sample(*table, 100);
+
+  // The row count is exact, the rest is estimated from 100 rows, ten from each of the ten chunks.
+  ASSERT_EQ(table_statistics->row_count, 200u);
+  ASSERT_TRUE(table_statistics->sampled_row_count);
+  EXPECT_EQ(*table_statistics->sampled_row_count, 100);
+  ASSERT_EQ(table_statistics->column_statistics.size(), 2u);
+
+  const auto column_statistics_a =
+      std::dynamic_pointer_cast<AttributeStatistics<int32_t>>(table_statistics->column_statistics.at(0));
+  ASSERT_TRUE(column_statistics_a);
+  EXPECT_NEAR(column_statistics_a->null_value_ratio->ratio, 27.0f / 200.0f, 0.1f);
+
+  const auto histogram_a = std::dynamic_pointer_cast<AbstractHistogram<int32_t>>(column_statistics_a->histogram);
+  ASSERT_TRUE(histogram_a);
+  EXPECT_NEAR(histogram_a->total_count(), 200 - 27, 20.0);
+  // All ten values occur often enough to be sampled more than once.
+  EXPECT_NEAR(histogram_a->total_distinct_count(), 10, 2.0);
+
+  // Nearly all values of column b are unique. The distinct count estimate is within the error bound of the GEE.
+  const auto column_statistics_b =
+      std::dynamic_pointer_cast<AttributeStatistics<int32_t>>(table_statistics->column_statistics.at(1));
+  ASSERT_TRUE(column_statistics_b);
+  const auto histogram_b = std::dynamic_pointer_cast<AbstractHistogram<int32_t>>(column_statistics_b->histogram);
+  ASSERT_TRUE(histogram_b);
+  EXPECT_GT(histogram_b->total_distinct_count(), 190.0f / std::sqrt(2.0f));
+  EXPECT_LT(histogram_b->total_distinct_count(), 190.0f * std::sqrt(2.0f));
+
+  // Without chunk statistics, no single-column groups are created.
+  EXPECT_TRUE(table_statistics->column_group_statistics.empty());
+
+  // Sampling is deterministic.
+  const auto resampled_table_statistics = TableStatistics::from_table_sample(*table, 100);
+  EXPECT_EQ(*resampled_table_statistics->sampled_row_count, *table_statistics->sampled_row_count);
+  const auto resampled_histogram_b = std::dynamic_pointer_cast<GenericHistogram<int32_t>>(
+      std::dynamic_pointer_cast<AttributeStatistics<int32_t>>(resampled_table_statistics->column_statistics.at(1))
+          ->histogram);
+  ASSERT_TRUE(resampled_histogram_b);
+  EXPECT_EQ(*resampled_histogram_b, static_cast<const GenericHistogram<int32_t>&>(*histogram_b));
+
+  // With chunk statistics, their sketches are merged.
+  ChunkEncoder::encode_all_chunks(table);
+  const auto encoded_table_statistics = TableStatistics::from_table_sample(*table, 100);
+  ASSERT_EQ(encoded_table_statistics->column_group_statistics.size(), 2u);
+  EXPECT_NEAR(encoded_table_statistics->column_group_statistics[1]->distinct_count(), 191, 10.0);
+}
+
+TEST_F(TableStatisticsTest, FromChunkStatistics) {
+  const auto table =
+      load_table("resources/test_data/tbl/int_with_nulls_large.tbl", ChunkOffset{20}, FinalizeLastChunk::No);
+  const auto first_chunk = table->get_chunk(ChunkID{0});
+  const auto last_chunk = table->last_chunk();
+  ASSERT_FALSE(first_chunk->statistics());
+
+  const auto table_statistics = TableStatistics::from_chunk_statistics(*table);
+
+  // Immutable chunks keep the statistics that were created for them. Mutable ones do not.
+  EXPECT_TRUE(first_chunk->statistics());
+  ASSERT_TRUE(last_chunk->is_mutable());
+  EXPECT_FALSE(last_chunk->statistics());
+
+  ASSERT_EQ(table_statistics->row_count, 200u);
+  ASSERT_EQ(table_statistics->column_statistics.size(), 2u);
+
+  const auto column_statistics_a =
+      std::dynamic_pointer_cast<AttributeStatistics<int32_t>>(table_statistics->column_statistics.at(0));
+  ASSERT_TRUE(column_statistics_a);
+  EXPECT_FLOAT_EQ(column_statistics_a->null_value_ratio->ratio, 27.0f / 200.0f);
+
+  const auto histogram_a = std::dynamic_pointer_cast<AbstractHistogram<int32_t>>(column_statistics_a->histogram);
+  ASSERT_TRUE(histogram_a);
+  EXPECT_NEAR(histogram_a->total_count(), 200 - 27, 1.0);
+  EXPECT_NEAR(histogram_a->total_distinct_count(), 10, 1.0);
+
+  const auto column_statistics_b =
+      std::dynamic_pointer_cast<AttributeStatistics<int32_t>>(table_statistics->column_statistics.at(1));
+  ASSERT_TRUE(column_statistics_b);
+  EXPECT_FLOAT_EQ(column_statistics_b->null_value_ratio->ratio, 9.0f / 200.0f);
+
+  const auto histogram_b = std::dynamic_pointer_cast<AbstractHistogram<int32_t>>(column_statistics_b->histogram);
+  ASSERT_TRUE(histogram_b);
+  EXPECT_NEAR(histogram_b->total_count(), 200 - 9, 1.0);
+  EXPECT_NEAR(histogram_b->total_distinct_count(), 190, 10.0);
+
+  // The merged sketches form the single-column groups.
+  ASSERT_EQ(table_statistics->column_group_statistics.size(), 2u);
+  EXPECT_EQ(table_statistics->column_group_statistics[1]->column_ids, std::vector<ColumnID>{ColumnID{1}});
+  EXPECT_NEAR(table_statistics->column_group_statistics[1]->distinct_count(), 191, 10.0);
+}
+
 }  // namespace hyrise
@@ -8,6 +8,8 @@
 #include "all_type_variant.hpp"
 #include "operators/table_scan.hpp"
 #include "operators/table_wrapper.hpp"
+#include "statistics/chunk_statistics.hpp"
+#include "statistics/statistics_objects/abstract_histogram.hpp"
 #include "storage/abstract_encoded_segment.hpp"
 #include "storage/base_value_segment.hpp"
 #include "storage/chunk.hpp"
@@ -71,6 +73,28 @@ TEST_F(ChunkEncoderTest, EncodeSingleChunk) {
   assert_chunk_encoding(chunk, chunk_encoding_spec);
 }
 
+TEST_F(ChunkEncoderTest, CreatesChunkStatistics) {
+  const auto chunk = _table->get_chunk(ChunkID{0});
+  EXPECT_FALSE(chunk->statistics());
+
+  ChunkEncoder::encode_chunk(chunk, _table->column_data_types());
+  const auto statistics = chunk->statistics();
+  ASSERT_TRUE(statistics);
+  EXPECT_EQ(statistics->row_count, 5);
+  ASSERT_EQ(statistics->histograms.size(), 3);
+  ASSERT_EQ(statistics->distinct_count_sketches.size(), 3);
+
+  const auto& histogram = static_cast<const AbstractHistogram<int32_t>&>(*statistics->histograms[0]);
+  EXPECT_EQ(histogram.bin_minimum(BinID{0}), 0);
+  EXPECT_EQ(histogram.bin_maximum(histogram.bin_count() - 1), 4);
+  EXPECT_FLOAT_EQ(histogram.total_count(), 5.0f);
+  EXPECT_NEAR(statistics->distinct_count_sketches[0].estimate_distinct_count(), 5.0f, 0.5f);
+
+  // The statistics do not depend on the encoding and are not recreated.
+  ChunkEncoder::encode_chunk(chunk, _table->column_data_types(), SegmentEncodingSpec{EncodingType::RunLength});
+  EXPECT_EQ(chunk->statistics(), statistics);
+}
+
 TEST_F(ChunkEncoderTest, LeaveOneSegmentUnencoded) {
   const auto chunk_encoding_spec =
       ChunkEncodingSpec{SegmentEncodingSpec{EncodingType::Unencoded}, SegmentEncodingSpec{EncodingType::RunLength},
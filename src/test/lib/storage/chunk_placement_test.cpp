@@ -0,0 +1,75 @@
+#include <memory>
+#include <thread>
+
+#include "base_test.hpp"
+
+#include "hyrise.hpp"
+#include "operators/table_wrapper.hpp"
+#include "storage/chunk_placement.hpp"
+#include "storage/table.hpp"
+
+namespace hyrise {
+
+class ChunkPlacementTest : public BaseTest {
+ protected:
+  void SetUp() override {
+    // int_float4.tbl has seven rows, which results in four chunks. The last chunk is not finalized.
+    table = load_table("resources/test_data/tbl/int_float4.tbl", ChunkOffset{2}, FinalizeLastChunk::No);
+  }
+
+  std::shared_ptr<Table> table;
+};
+
+TEST_F(ChunkPlacementTest, SingleNodeIsNotPlaced) {
+  Hyrise::get().topology.use_non_numa_topology();
+  place_chunks_on_numa_nodes(table);
+
+  for (auto chunk_id = ChunkID{0}; chunk_id < table->chunk_count(); ++chunk_id) {
+    EXPECT_EQ(table->get_chunk(chunk_id)->numa_node_id(), INVALID_NODE_ID);
+  }
+}
+
+TEST_F(ChunkPlacementTest, RoundRobinPlacement) {
+  if (std::thread::hardware_concurrency() < 2) {
+    // The fake NUMA topology cannot have more nodes than there are cores.
+    GTEST_SKIP();
+  }
+
+  Hyrise::get().topology.use_fake_numa_topology(2, 1);
+  ASSERT_EQ(Hyrise::get().topology.nodes().size(), 2);
+  ASSERT_EQ(table->chunk_count(), 4);
+
+  place_chunks_on_numa_nodes(table);
+
+  EXPECT_EQ(table->get_chunk(ChunkID{0})->numa_node_id(), NodeID{0});
+  EXPECT_EQ(table->get_chunk(ChunkID{1})->numa_node_id(), NodeID{1});
+  EXPECT_EQ(table->get_chunk(ChunkID{2})->numa_node_id(), NodeID{0});
+
+  // Mutable chunks are not placed, as rows might still be appended to them.
+  EXPECT_EQ(table->get_chunk(ChunkID{3})->numa_node_id(), INVALID_NODE_ID);
+
+  table->last_chunk()->finalize();
+  place_chunks_on_numa_nodes(table);
+  EXPECT_EQ(table->get_chunk(ChunkID{3})->numa_node_id(), NodeID{1});
+}
+
+TEST_F(ChunkPlacementTest, TableScanForwardsNodeId) {
+  table->last_chunk()->finalize();
+  table->get_chunk(ChunkID{0})->set_numa_node_id(NodeID{1});
+  table->get_chunk(ChunkID{1})->set_numa_node_id(NodeID{0});
+
+  const auto table_wrapper = std::make_shared<TableWrapper>(table);
+  table_wrapper->never_clear_output();
+  table_wrapper->execute();
+
+  const auto table_scan = create_table_scan(table_wrapper, ColumnID{0}, PredicateCondition::GreaterThan, 0);
+  table_scan->execute();
+
+  const auto& output_table = table_scan->get_output();
+  ASSERT_EQ(output_table->chunk_count(), 4);
+  EXPECT_EQ(output_table->get_chunk(ChunkID{0})->numa_node_id(), NodeID{1});
+  EXPECT_EQ(output_table->get_chunk(ChunkID{1})->numa_node_id(), NodeID{0});
+  EXPECT_EQ(output_table->get_chunk(ChunkID{2})->numa_node_id(), INVALID_NODE_ID);
+}
+
+}  // namespace hyrise
@@ -1,3 +1,5 @@
+#include <algorithm>
+#include <array>
 #include <bitset>
 #include <iostream>
 #include <memory>
@@ -5,6 +7,7 @@
 #include "base_test.hpp"
 
 #include "storage/segment_encoding_utils.hpp"
+#include "storage/vector_compression/bitpacking/bitpacking_vector.hpp"
 #include "storage/vector_compression/resolve_compressed_vector_type.hpp"
 #include "storage/vector_compression/vector_compression.hpp"
 
@@ -130,4 +133,32 @@ TEST_P(CompressedVectorTest, DecodeSequenceOfZerosUsingDecompressor) {
   }
 }
 
+class BitPackingVectorTest : public BaseTest {};
+
+TEST_F(BitPackingVectorTest, DecodeBlocks) {
+  for (const auto bit_width : {1u, 7u, 13u, 25u, 31u}) {
+    // Use all bits of the bit width and end with an incomplete block.
+    const auto max_value = (uint32_t{1} << bit_width) - 1;
+    auto sequence = pmr_vector<uint32_t>(BitPackingVector::BLOCK_SIZE * 3 + 5);
+    for (auto index = size_t{0}; index < sequence.size(); ++index) {
+      sequence[index] = static_cast<uint32_t>((index * 2'654'435'761u) & max_value);
+    }
+    sequence[0] = max_value;
+
+    const auto encoded_sequence = compress_vector(sequence, VectorCompressionType::BitPacking, {}, {max_value});
+    const auto& bit_packed_sequence = dynamic_cast<const BitPackingVector&>(*encoded_sequence);
+    EXPECT_EQ(bit_packed_sequence.data().bits(), bit_width);
+
+    auto values = std::array<uint32_t, BitPackingVector::BLOCK_SIZE>{};
+    for (auto block_index = size_t{0}; block_index < 4; ++block_index) {
+      bit_packed_sequence.decode_block(block_index, values);
+      const auto block_begin = block_index * BitPackingVector::BLOCK_SIZE;
+      const auto block_size = std::min(BitPackingVector::BLOCK_SIZE, sequence.size() - block_begin);
+      for (auto index = size_t{0}; index < block_size; ++index) {
+        EXPECT_EQ(values[index], sequence[block_begin + index]);
+      }
+    }
+  }
+}
+
 }  // namespace hyrise
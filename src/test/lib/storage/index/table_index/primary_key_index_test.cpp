@@ -0,0 +1,146 @@
+#include <memory>
+#include <vector>
+
+#include "base_test.hpp"
+
+#include "concurrency/transaction_context.hpp"
+#include "hyrise.hpp"
+#include "operators/delete.hpp"
+#include "operators/get_table.hpp"
+#include "operators/index_scan.hpp"
+#include "operators/insert.hpp"
+#include "operators/table_scan.hpp"
+#include "operators/table_wrapper.hpp"
+#include "operators/validate.hpp"
+#include "storage/index/table_index/primary_key_index.hpp"
+#include "storage/table.hpp"
+
+namespace hyrise {
+
+class PrimaryKeyIndexTest : public BaseTest {
+ protected:
+  void SetUp() override {
+    // a|b: 4|10, 1|3, 13|2, 6|9 | 4|17, 8|12, 7|1, 0|18 | ...
+    _table = load_table("resources/test_data/tbl/int_int3.tbl", ChunkOffset{4});
+    Hyrise::get().storage_manager.add_table("table_a", _table);
+  }
+
+  static std::shared_ptr<AbstractOperator> rows(const std::vector<std::pair<int32_t, int32_t>>& values) {
+    const auto column_definitions =
+        TableColumnDefinitions{{"a", DataType::Int, false}, {"b", DataType::Int, false}};
+    const auto table = std::make_shared<Table>(column_definitions, TableType::Data);
+    for (const auto& [a, b] : values) {
+      table->append({a, b});
+    }
+
+    const auto table_wrapper = std::make_shared<TableWrapper>(table);
+    table_wrapper->execute();
+    return table_wrapper;
+  }
+
+  static std::shared_ptr<Insert> insert(const std::shared_ptr<AbstractOperator>& values,
+                                        const std::shared_ptr<TransactionContext>& context) {
+    const auto insert = std::make_shared<Insert>("table_a", values);
+    insert->set_transaction_context(context);
+    insert->execute();
+    return insert;
+  }
+
+  std::shared_ptr<Table> _table;
+};
+
+TEST_F(PrimaryKeyIndexTest, CreateAndLookup) {
+  // Column a alone contains a duplicate and cannot be the primary key.
+  EXPECT_THROW(_table->create_primary_key_index({ColumnID{0}}), std::logic_error);
+  EXPECT_FALSE(_table->primary_key_index());
+
+  const auto primary_key_index = _table->create_primary_key_index({ColumnID{0}, ColumnID{1}});
+  EXPECT_EQ(_table->primary_key_index(), primary_key_index);
+  EXPECT_EQ(primary_key_index->row_count(), _table->row_count());
+  EXPECT_THROW(_table->create_primary_key_index({ColumnID{1}}), std::logic_error);
+
+  auto matches = RowIDPosList{};
+  primary_key_index->lookup({int32_t{4}, int32_t{17}}, matches);
+  EXPECT_EQ(matches, (RowIDPosList{RowID{ChunkID{1}, ChunkOffset{0}}}));
+
+  matches.clear();
+  primary_key_index->lookup({int32_t{4}, int32_t{11}}, matches);
+  EXPECT_TRUE(matches.empty());
+}
+
+TEST_F(PrimaryKeyIndexTest, InsertConflictsOnDuplicateKey) {
+  const auto primary_key_index = _table->create_primary_key_index({ColumnID{0}, ColumnID{1}});
+  const auto row_count = primary_key_index->row_count();
+
+  // The key is held by a committed row.
+  const auto duplicate_context = Hyrise::get().transaction_manager.new_transaction_context(AutoCommit::No);
+  EXPECT_TRUE(insert(rows({{5, 5}, {4, 10}}), duplicate_context)->execute_failed());
+  duplicate_context->rollback(RollbackReason::Conflict);
+  EXPECT_EQ(primary_key_index->row_count(), row_count);
+
+  // The key is held by another row of the same insert.
+  const auto self_duplicate_context = Hyrise::get().transaction_manager.new_transaction_context(AutoCommit::No);
+  EXPECT_TRUE(insert(rows({{5, 5}, {5, 5}}), self_duplicate_context)->execute_failed());
+  self_duplicate_context->rollback(RollbackReason::Conflict);
+  EXPECT_EQ(primary_key_index->row_count(), row_count);
+
+  // The key is held by an uncommitted row of another transaction.
+  const auto first_context = Hyrise::get().transaction_manager.new_transaction_context(AutoCommit::No);
+  EXPECT_FALSE(insert(rows({{5, 5}}), first_context)->execute_failed());
+  const auto second_context = Hyrise::get().transaction_manager.new_transaction_context(AutoCommit::No);
+  EXPECT_TRUE(insert(rows({{5, 5}}), second_context)->execute_failed());
+  second_context->rollback(RollbackReason::Conflict);
+  first_context->commit();
+  EXPECT_EQ(primary_key_index->row_count(), row_count + 1);
+}
+
+TEST_F(PrimaryKeyIndexTest, DeleteAndReinsertKey) {
+  const auto primary_key_index = _table->create_primary_key_index({ColumnID{0}, ColumnID{1}});
+
+  // Delete and re-insert a row in the same transaction, as an Update does.
+  const auto update_context = Hyrise::get().transaction_manager.new_transaction_context(AutoCommit::No);
+  const auto get_table = std::make_shared<GetTable>("table_a");
+  get_table->execute();
+  const auto validate = std::make_shared<Validate>(get_table);
+  validate->set_transaction_context(update_context);
+  validate->execute();
+  const auto table_scan = create_table_scan(validate, ColumnID{1}, PredicateCondition::Equals, int32_t{10});
+  table_scan->execute();
+  const auto delete_op = std::make_shared<Delete>(table_scan);
+  delete_op->set_transaction_context(update_context);
+  delete_op->execute();
+  EXPECT_FALSE(delete_op->execute_failed());
+
+  EXPECT_FALSE(insert(rows({{4, 10}}), update_context)->execute_failed());
+  update_context->commit();
+
+  // The deleted row remains in the index for older snapshots, but only the new row holds the key.
+  auto matches = RowIDPosList{};
+  primary_key_index->lookup({int32_t{4}, int32_t{10}}, matches);
+  EXPECT_EQ(matches.size(), 2);
+
+  const auto duplicate_context = Hyrise::get().transaction_manager.new_transaction_context(AutoCommit::No);
+  EXPECT_TRUE(insert(rows({{4, 10}}), duplicate_context)->execute_failed());
+  duplicate_context->rollback(RollbackReason::Conflict);
+}
+
+TEST_F(PrimaryKeyIndexTest, IndexScan) {
+  _table->create_primary_key_index({ColumnID{0}, ColumnID{1}});
+
+  const auto get_table = std::make_shared<GetTable>("table_a");
+  get_table->never_clear_output();
+  get_table->execute();
+
+  // The predicate columns may be given in any order.
+  const auto index_scan = std::make_shared<IndexScan>(
+      get_table, SegmentIndexType::GroupKey, std::vector<ColumnID>{ColumnID{1}, ColumnID{0}},
+      PredicateCondition::Equals, std::vector<AllTypeVariant>{int32_t{17}, int32_t{4}});
+  index_scan->execute();
+
+  const auto& output = index_scan->get_output();
+  ASSERT_EQ(output->row_count(), 1);
+  EXPECT_EQ(output->get_value<int32_t>(ColumnID{0}, 0), 4);
+  EXPECT_EQ(output->get_value<int32_t>(ColumnID{1}, 0), 17);
+}
+
+}  // namespace hyrise
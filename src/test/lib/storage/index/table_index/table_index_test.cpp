@@ -0,0 +1,204 @@
+#include <algorithm>
+#include <memory>
+#include <optional>
+#include <vector>
+
+#include "base_test.hpp"
+
+#include "concurrency/transaction_context.hpp"
+#include "hyrise.hpp"
+#include "operators/get_table.hpp"
+#include "operators/index_scan.hpp"
+#include "operators/insert.hpp"
+#include "operators/join_index.hpp"
+#include "operators/join_nested_loop.hpp"
+#include "operators/table_scan.hpp"
+#include "operators/table_wrapper.hpp"
+#include "storage/chunk_encoder.hpp"
+#include "storage/index/table_index/abstract_table_index.hpp"
+#include "storage/index/table_index/hash_table_index.hpp"
+#include "storage/index/table_index/ordered_table_index.hpp"
+#include "storage/reference_segment.hpp"
+#include "storage/table.hpp"
+
+namespace hyrise {
+
+class TableIndexTest : public BaseTest {
+ protected:
+  void SetUp() override {
+    // a: 0, 2, 10, 0 | 4, 12, 10, 4 | 6, 2, 8, 12 | 8, 6
+    _table = load_table("resources/test_data/tbl/int_int_shuffled.tbl", ChunkOffset{4});
+    Hyrise::get().storage_manager.add_table("table_a", _table);
+  }
+
+  static std::vector<RowID> lookup(const AbstractTableIndex& table_index, const PredicateCondition predicate_condition,
+                                   const AllTypeVariant& value,
+                                   const std::optional<AllTypeVariant>& value2 = std::nullopt) {
+    auto matches = RowIDPosList{};
+    table_index.lookup(predicate_condition, value, value2, matches);
+    auto sorted_matches = std::vector<RowID>(matches.begin(), matches.end());
+    std::sort(sorted_matches.begin(), sorted_matches.end());
+    return sorted_matches;
+  }
+
+  std::shared_ptr<Table> _table;
+};
+
+TEST_F(TableIndexTest, Supports) {
+  const auto hash_index = _table->create_table_index(ColumnID{0}, TableIndexType::Hash);
+  const auto ordered_index = _table->create_table_index(ColumnID{1}, TableIndexType::Ordered);
+
+  EXPECT_TRUE(hash_index->supports(PredicateCondition::Equals));
+  EXPECT_FALSE(hash_index->supports(PredicateCondition::LessThan));
+  EXPECT_FALSE(hash_index->supports(PredicateCondition::BetweenInclusive));
+  EXPECT_FALSE(hash_index->supports(PredicateCondition::Like));
+
+  EXPECT_TRUE(ordered_index->supports(PredicateCondition::Equals));
+  EXPECT_TRUE(ordered_index->supports(PredicateCondition::GreaterThanEquals));
+  EXPECT_TRUE(ordered_index->supports(PredicateCondition::BetweenExclusive));
+  EXPECT_TRUE(ordered_index->supports(PredicateCondition::NotEquals));
+  EXPECT_FALSE(ordered_index->supports(PredicateCondition::IsNull));
+
+  EXPECT_EQ(_table->table_indexes().size(), 2);
+  EXPECT_EQ(_table->get_table_index(ColumnID{0}, PredicateCondition::Equals), hash_index);
+  EXPECT_EQ(_table->get_table_index(ColumnID{0}, PredicateCondition::LessThan), nullptr);
+  EXPECT_EQ(_table->get_table_index(ColumnID{1}, PredicateCondition::LessThan), ordered_index);
+}
+
+TEST_F(TableIndexTest, EqualsLookup) {
+  for (const auto index_type : {TableIndexType::Hash, TableIndexType::Ordered}) {
+    const auto table_index = AbstractTableIndex::create(index_type, DataType::Int, ColumnID{0});
+    for (auto chunk_id = ChunkID{0}; chunk_id < _table->chunk_count(); ++chunk_id) {
+      const auto chunk = _table->get_chunk(chunk_id);
+      table_index->insert_entries(chunk_id, *chunk->get_segment(ColumnID{0}), ChunkOffset{0}, chunk->size());
+    }
+
+    EXPECT_EQ(table_index->row_count(), 14);
+    EXPECT_EQ(lookup(*table_index, PredicateCondition::Equals, int32_t{10}),
+              (std::vector<RowID>{RowID{ChunkID{0}, ChunkOffset{2}}, RowID{ChunkID{1}, ChunkOffset{2}}}));
+    EXPECT_EQ(lookup(*table_index, PredicateCondition::Equals, int32_t{6}),
+              (std::vector<RowID>{RowID{ChunkID{2}, ChunkOffset{0}}, RowID{ChunkID{3}, ChunkOffset{1}}}));
+    EXPECT_TRUE(lookup(*table_index, PredicateCondition::Equals, int32_t{5}).empty());
+    EXPECT_TRUE(lookup(*table_index, PredicateCondition::Equals, NullValue{}).empty());
+
+    // Typed lookups while holding the lock
+    const auto lock = table_index->acquire_shared_lock();
+    auto matches = RowIDPosList{};
+    if (index_type == TableIndexType::Hash) {
+      static_cast<const HashTableIndex<int32_t>&>(*table_index).lookup_equals(int32_t{10}, matches);
+    } else {
+      static_cast<const OrderedTableIndex<int32_t>&>(*table_index).lookup_equals(int32_t{10}, matches);
+    }
+    EXPECT_EQ(matches.size(), 2);
+  }
+}
+
+TEST_F(TableIndexTest, RangeLookups) {
+  const auto table_index = _table->create_table_index(ColumnID{0}, TableIndexType::Ordered);
+
+  EXPECT_EQ(lookup(*table_index, PredicateCondition::LessThanEquals, int32_t{2}),
+            (std::vector<RowID>{RowID{ChunkID{0}, ChunkOffset{0}}, RowID{ChunkID{0}, ChunkOffset{1}},
+                                RowID{ChunkID{0}, ChunkOffset{3}}, RowID{ChunkID{2}, ChunkOffset{1}}}));
+  EXPECT_EQ(lookup(*table_index, PredicateCondition::LessThan, int32_t{2}),
+            (std::vector<RowID>{RowID{ChunkID{0}, ChunkOffset{0}}, RowID{ChunkID{0}, ChunkOffset{3}}}));
+  EXPECT_EQ(lookup(*table_index, PredicateCondition::GreaterThan, int32_t{10}),
+            (std::vector<RowID>{RowID{ChunkID{1}, ChunkOffset{1}}, RowID{ChunkID{2}, ChunkOffset{3}}}));
+  EXPECT_EQ(lookup(*table_index, PredicateCondition::GreaterThanEquals, int32_t{12}).size(), 2);
+  EXPECT_EQ(lookup(*table_index, PredicateCondition::BetweenInclusive, int32_t{4}, int32_t{6}).size(), 4);
+  EXPECT_EQ(lookup(*table_index, PredicateCondition::BetweenExclusive, int32_t{4}, int32_t{6}).size(), 0);
+  EXPECT_EQ(lookup(*table_index, PredicateCondition::BetweenLowerExclusive, int32_t{4}, int32_t{6}).size(), 2);
+  EXPECT_EQ(lookup(*table_index, PredicateCondition::BetweenUpperExclusive, int32_t{4}, int32_t{6}).size(), 2);
+  EXPECT_TRUE(lookup(*table_index, PredicateCondition::BetweenInclusive, int32_t{6}, int32_t{4}).empty());
+}
+
+TEST_F(TableIndexTest, MaintainedByInsert) {
+  const auto table_index = _table->create_table_index(ColumnID{0}, TableIndexType::Hash);
+
+  const auto insert = [&]() {
+    const auto values = load_table("resources/test_data/tbl/int_int_shuffled.tbl", ChunkOffset{4});
+    const auto table_wrapper = std::make_shared<TableWrapper>(values);
+    table_wrapper->execute();
+
+    const auto insert = std::make_shared<Insert>("table_a", table_wrapper);
+    const auto context = Hyrise::get().transaction_manager.new_transaction_context(AutoCommit::No);
+    insert->set_transaction_context(context);
+    insert->execute();
+    return context;
+  };
+
+  const auto committed_context = insert();
+  committed_context->commit();
+  EXPECT_EQ(table_index->row_count(), 28);
+  EXPECT_EQ(lookup(*table_index, PredicateCondition::Equals, int32_t{10}),
+            (std::vector<RowID>{RowID{ChunkID{0}, ChunkOffset{2}}, RowID{ChunkID{1}, ChunkOffset{2}},
+                                RowID{ChunkID{4}, ChunkOffset{2}}, RowID{ChunkID{5}, ChunkOffset{2}}}));
+
+  // Rows of rolled back inserts are removed from the index.
+  const auto rolled_back_context = insert();
+  EXPECT_EQ(table_index->row_count(), 42);
+  rolled_back_context->rollback(RollbackReason::User);
+  EXPECT_EQ(table_index->row_count(), 28);
+  EXPECT_EQ(lookup(*table_index, PredicateCondition::Equals, int32_t{10}).size(), 4);
+}
+
+TEST_F(TableIndexTest, IndexScan) {
+  ChunkEncoder::encode_all_chunks(_table);
+  _table->create_table_index(ColumnID{0}, TableIndexType::Ordered);
+
+  const auto get_table = std::make_shared<GetTable>("table_a", std::vector<ChunkID>{ChunkID{1}},
+                                                    std::vector<ColumnID>{});
+  get_table->never_clear_output();
+  get_table->execute();
+
+  const auto index_scan =
+      std::make_shared<IndexScan>(get_table, SegmentIndexType::GroupKey, std::vector<ColumnID>{ColumnID{0}},
+                                  PredicateCondition::GreaterThanEquals, std::vector<AllTypeVariant>{int32_t{4}});
+  index_scan->execute();
+
+  const auto table_scan =
+      create_table_scan(get_table, ColumnID{0}, PredicateCondition::GreaterThanEquals, int32_t{4});
+  table_scan->execute();
+
+  // The index scan references the stored table and skips the pruned chunk.
+  const auto& output = index_scan->get_output();
+  EXPECT_EQ(output->row_count(), 6);
+  for (auto chunk_id = ChunkID{0}; chunk_id < output->chunk_count(); ++chunk_id) {
+    const auto reference_segment =
+        std::dynamic_pointer_cast<ReferenceSegment>(output->get_chunk(chunk_id)->get_segment(ColumnID{1}));
+    ASSERT_TRUE(reference_segment);
+    EXPECT_EQ(reference_segment->referenced_table(), _table);
+    EXPECT_NE(reference_segment->pos_list()->common_chunk_id(), ChunkID{1});
+  }
+  EXPECT_TABLE_EQ_UNORDERED(output, table_scan->get_output());
+}
+
+TEST_F(TableIndexTest, JoinIndex) {
+  _table->create_table_index(ColumnID{0}, TableIndexType::Hash);
+
+  const auto probe_table = load_table("resources/test_data/tbl/int_int_shuffled_2.tbl", ChunkOffset{5});
+  const auto probe_table_wrapper = std::make_shared<TableWrapper>(probe_table);
+  probe_table_wrapper->never_clear_output();
+  probe_table_wrapper->execute();
+
+  const auto get_table = std::make_shared<GetTable>("table_a");
+  get_table->never_clear_output();
+  get_table->execute();
+
+  const auto primary_predicate = OperatorJoinPredicate{{ColumnID{0}, ColumnID{0}}, PredicateCondition::Equals};
+  for (const auto mode : {JoinMode::Inner, JoinMode::Left, JoinMode::Semi, JoinMode::AntiNullAsFalse}) {
+    const auto join_index = std::make_shared<JoinIndex>(probe_table_wrapper, get_table, mode, primary_predicate);
+    join_index->execute();
+
+    // No chunk indexes exist, so all chunks are either joined using the table index or the nested loop fallback.
+    const auto& performance_data = static_cast<const JoinIndex::PerformanceData&>(*join_index->performance_data);
+    EXPECT_EQ(performance_data.chunks_scanned_with_index, _table->chunk_count());
+    EXPECT_EQ(performance_data.chunks_scanned_without_index, 0);
+
+    const auto join_nested_loop =
+        std::make_shared<JoinNestedLoop>(probe_table_wrapper, get_table, mode, primary_predicate);
+    join_nested_loop->execute();
+    EXPECT_TABLE_EQ_UNORDERED(join_index->get_output(), join_nested_loop->get_output());
+  }
+}
+
+}  // namespace hyrise
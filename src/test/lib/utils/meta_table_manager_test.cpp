@@ -11,6 +11,7 @@
 #include "utils/meta_tables/meta_exec_table.hpp"
 #include "utils/meta_tables/meta_log_table.hpp"
 #include "utils/meta_tables/meta_plugins_table.hpp"
+#include "utils/meta_tables/meta_scheduling_latency_table.hpp"
 #include "utils/meta_tables/meta_segments_accurate_table.hpp"
 #include "utils/meta_tables/meta_segments_table.hpp"
 #include "utils/meta_tables/meta_settings_table.hpp"
@@ -33,6 +34,7 @@ class MetaTableManagerTest : public BaseTest {
             std::make_shared<MetaExecTable>(),
             std::make_shared<MetaLogTable>(),
             std::make_shared<MetaPluginsTable>(),
+            std::make_shared<MetaSchedulingLatencyTable>(),
             std::make_shared<MetaSegmentsTable>(),
             std::make_shared<MetaSegmentsAccurateTable>(),
             std::make_shared<MetaSettingsTable>(),
@@ -0,0 +1,62 @@
+#include "base_test.hpp"
+
+#include "hyrise.hpp"
+#include "scheduler/job_task.hpp"
+#include "scheduler/node_queue_scheduler.hpp"
+#include "utils/meta_tables/meta_scheduling_latency_table.hpp"
+
+namespace hyrise {
+
+class MetaSchedulingLatencyTest : public BaseTest {
+ protected:
+  const std::shared_ptr<Table> generate_meta_table(const std::shared_ptr<AbstractMetaTable>& table) const {
+    return table->_generate();
+  }
+};
+
+TEST_F(MetaSchedulingLatencyTest, IsImmutable) {
+  const auto meta_scheduling_latency_table = std::make_shared<MetaSchedulingLatencyTable>();
+  EXPECT_FALSE(meta_scheduling_latency_table->can_insert());
+  EXPECT_FALSE(meta_scheduling_latency_table->can_update());
+  EXPECT_FALSE(meta_scheduling_latency_table->can_delete());
+}
+
+TEST_F(MetaSchedulingLatencyTest, EmptyWithoutNodeQueueScheduler) {
+  const auto meta_scheduling_latency_table = std::make_shared<MetaSchedulingLatencyTable>();
+  EXPECT_EQ(generate_meta_table(meta_scheduling_latency_table)->row_count(), 0);
+}
+
+TEST_F(MetaSchedulingLatencyTest, TableGeneration) {
+  Hyrise::get().topology.use_fake_numa_topology(4, 2);
+  Hyrise::get().set_scheduler(std::make_shared<NodeQueueScheduler>());
+
+  constexpr auto TASK_COUNT = int64_t{50};
+  auto tasks = std::vector<std::shared_ptr<AbstractTask>>{};
+  for (auto task_id = int64_t{0}; task_id < TASK_COUNT; ++task_id) {
+    tasks.emplace_back(std::make_shared<JobTask>([]() {}));
+  }
+  Hyrise::get().scheduler()->schedule_and_wait_for_tasks(tasks);
+  Hyrise::get().scheduler()->wait_for_all_tasks();
+
+  const auto meta_scheduling_latency_table = std::make_shared<MetaSchedulingLatencyTable>();
+  const auto meta_table = generate_meta_table(meta_scheduling_latency_table);
+  EXPECT_GT(meta_table->row_count(), 0);
+
+  const auto lower_bound_column_id = meta_table->column_id_by_name("latency_lower_us");
+  const auto upper_bound_column_id = meta_table->column_id_by_name("latency_upper_us");
+  const auto task_count_column_id = meta_table->column_id_by_name("task_count");
+  const auto node_id_column_id = meta_table->column_id_by_name("node_id");
+
+  auto task_count = int64_t{0};
+  for (auto row_id = uint64_t{0}; row_id < meta_table->row_count(); ++row_id) {
+    const auto row = meta_table->get_row(row_id);
+    EXPECT_LT(boost::get<int64_t>(row[lower_bound_column_id]), boost::get<int64_t>(row[upper_bound_column_id]));
+    EXPECT_LT(boost::get<int32_t>(row[node_id_column_id]), 2);
+    task_count += boost::get<int64_t>(row[task_count_column_id]);
+  }
+  EXPECT_EQ(task_count, TASK_COUNT);
+
+  Hyrise::get().scheduler()->finish();
+}
+
+}  // namespace hyrise